@@ -38,6 +38,13 @@
 #include "version.inc"
 
 
+/*
+ * A new registry of the core types, for the caller to enroll
+ * more types into and LLRP_TypeRegistry_destruct(). To share one
+ * registry between threads with no setup, use the const
+ * LLRP_CoreTypeRegistry (out_ltkc.h) instead, or a registry
+ * layered over it (LLRP_TypeRegistry_constructLayered()).
+ */
 extern LLRP_tSTypeRegistry *
 LLRP_getTheTypeRegistry (void);
 
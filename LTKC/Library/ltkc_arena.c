@@ -0,0 +1,286 @@
+
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  ltkc_arena.c
+ **
+ ** @brief Bump allocator for the elements of one decoded message
+ **
+ ** A decoded report is hundreds of small elements and vectors. Taking
+ ** each from malloc() and giving each back to free() costs more than
+ ** decoding them. An arena hands them out of one block instead, and
+ ** the whole block goes back in one call.
+ **
+ *****************************************************************************/
+
+
+#include "ltkc_platform.h"
+#include "ltkc_base.h"
+
+
+/*
+ * Every allocation, and the start of every block's storage,
+ * is a multiple of this. It suits pointers and llrp_u64_t.
+ */
+#define LLRP_ARENA_ALIGN        (8u)
+#define LLRP_ARENA_ROUND(n)     \
+    (((n) + LLRP_ARENA_ALIGN - 1u) & ~(LLRP_ARENA_ALIGN - 1u))
+
+/*
+ * First block size when the caller has no better idea
+ */
+#define LLRP_ARENA_DEFAULT_SIZE (4096u)
+
+/*
+ * Each block added is twice the size of the last, up to this.
+ * Past it, a big arena grows by this much at a time, so the
+ * last block is not mostly unused.
+ */
+#define LLRP_ARENA_MAX_GROWTH   (4u*1024u*1024u)
+
+
+/* forward declaration of private routines. */
+static llrp_bool_t
+addBlock (
+  LLRP_tSArena *                pArena,
+  unsigned int                  nByte);
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Construct a new arena
+ **
+ ** @param[in]  nFirstBlockSize Bytes the first block holds. A good guess
+ **                             saves adding blocks. 0 selects a default.
+ **
+ ** @return     !=NULL          Pointer to the arena
+ **             ==NULL          Error, always an allocation failure
+ **
+ *****************************************************************************/
+
+LLRP_tSArena *
+LLRP_Arena_construct (
+  unsigned int                  nFirstBlockSize)
+{
+    LLRP_tSArena *              pArena;
+    LLRP_tSArenaBlock *         pBlock;
+    unsigned int                nArena;
+    unsigned int                nHeader;
+
+    if(0 == nFirstBlockSize)
+    {
+        nFirstBlockSize = LLRP_ARENA_DEFAULT_SIZE;
+    }
+    nFirstBlockSize = LLRP_ARENA_ROUND(nFirstBlockSize);
+
+    /*
+     * The arena, the first block's header and its storage
+     * are one allocation.
+     */
+    nArena = LLRP_ARENA_ROUND(sizeof *pArena);
+    nHeader = LLRP_ARENA_ROUND(sizeof *pBlock);
+
+    pArena = malloc(nArena + nHeader + nFirstBlockSize);
+    if(NULL == pArena)
+    {
+        return pArena;
+    }
+
+    pBlock = (LLRP_tSArenaBlock *)((unsigned char *)pArena + nArena);
+    pBlock->pNext = NULL;
+    pBlock->nSize = nFirstBlockSize;
+
+    pArena->pOwner = NULL;
+    pArena->pBlockList = pBlock;
+    pArena->pFree = (unsigned char *)pBlock + nHeader;
+    pArena->pLimit = pArena->pFree + nFirstBlockSize;
+    pArena->nNextBlockSize = 2u * nFirstBlockSize;
+    if(LLRP_ARENA_MAX_GROWTH < pArena->nNextBlockSize)
+    {
+        pArena->nNextBlockSize = LLRP_ARENA_MAX_GROWTH;
+    }
+
+    return pArena;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Destruct an arena and everything allocated from it
+ **
+ ** Destructors are not run. Elements in the arena should be
+ ** destructed first, normally by destructing pOwner, which
+ ** then calls this.
+ **
+ ** @param[in]  pArena          Pointer to the arena
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Arena_destruct (
+  LLRP_tSArena *                pArena)
+{
+    LLRP_tSArenaBlock *         pBlock;
+
+    /*
+     * Free the blocks added later. The last one on
+     * the list goes with the arena.
+     */
+    while(NULL != (pBlock = pArena->pBlockList)->pNext)
+    {
+        pArena->pBlockList = pBlock->pNext;
+        free(pBlock);
+    }
+
+    free(pArena);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Allocate from an arena
+ **
+ ** The memory is not zeroed.
+ **
+ ** @param[in]  pArena          Pointer to the arena
+ ** @param[in]  nByte           Bytes wanted
+ **
+ ** @return     !=NULL          The memory, aligned for any LLRP type
+ **             ==NULL          Allocation failure
+ **
+ *****************************************************************************/
+
+void *
+LLRP_Arena_alloc (
+  LLRP_tSArena *                pArena,
+  unsigned int                  nByte)
+{
+    void *                      pMemory;
+
+    nByte = LLRP_ARENA_ROUND(nByte);
+
+    if(nByte > (unsigned int)(pArena->pLimit - pArena->pFree) &&
+       !addBlock(pArena, nByte))
+    {
+        return NULL;
+    }
+
+    pMemory = pArena->pFree;
+    pArena->pFree += nByte;
+
+    return pMemory;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Tell whether memory came from an arena
+ **
+ ** @param[in]  pArena          Pointer to the arena
+ ** @param[in]  pMemory         The memory
+ **
+ ** @return     TRUE            pMemory is inside one of the arena's blocks
+ **             FALSE           It is not, or it is NULL
+ **
+ *****************************************************************************/
+
+llrp_bool_t
+LLRP_Arena_contains (
+  const LLRP_tSArena *          pArena,
+  const void *                  pMemory)
+{
+    const LLRP_tSArenaBlock *   pBlock;
+    const unsigned char *       pByte = pMemory;
+    const unsigned char *       pBegin;
+
+    for(pBlock = pArena->pBlockList; NULL != pBlock; pBlock = pBlock->pNext)
+    {
+        pBegin = (const unsigned char *)pBlock +
+                    LLRP_ARENA_ROUND(sizeof *pBlock);
+        if(pByte >= pBegin && pByte < pBegin + pBlock->nSize)
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to add a block big enough for nByte
+ **
+ ** What is left of the current block is abandoned.
+ **
+ ** @param[in]  pArena          Pointer to the arena
+ ** @param[in]  nByte           Bytes the new block must hold, rounded
+ **
+ ** @return     TRUE            Block added
+ **             FALSE           Allocation failure
+ **
+ *****************************************************************************/
+
+static llrp_bool_t
+addBlock (
+  LLRP_tSArena *                pArena,
+  unsigned int                  nByte)
+{
+    LLRP_tSArenaBlock *         pBlock;
+    unsigned int                nHeader = LLRP_ARENA_ROUND(sizeof *pBlock);
+    unsigned int                nSize = pArena->nNextBlockSize;
+
+    if(nSize < nByte)
+    {
+        nSize = nByte;
+    }
+
+    pBlock = malloc(nHeader + nSize);
+    if(NULL == pBlock)
+    {
+        return FALSE;
+    }
+
+    pBlock->pNext = pArena->pBlockList;
+    pBlock->nSize = nSize;
+    pArena->pBlockList = pBlock;
+
+    pArena->pFree = (unsigned char *)pBlock + nHeader;
+    pArena->pLimit = pArena->pFree + nSize;
+    if(LLRP_ARENA_MAX_GROWTH / 2u >= nSize)
+    {
+        pArena->nNextBlockSize = 2u * nSize;
+    }
+    else
+    {
+        pArena->nNextBlockSize = LLRP_ARENA_MAX_GROWTH;
+    }
+
+    return TRUE;
+}
@@ -39,6 +39,8 @@ struct LLRP_SEncoder;
 struct LLRP_SEncoderOps;
 struct LLRP_SEncoderStream;
 struct LLRP_SEncoderStreamOps;
+struct LLRP_SArena;
+struct LLRP_SArenaBlock;
 
 
 typedef enum LLRP_ResultCode            LLRP_tResultCode;
@@ -62,6 +64,9 @@ typedef struct LLRP_SEncoder            LLRP_tSEncoder;
 typedef struct LLRP_SEncoderOps         LLRP_tSEncoderOps;
 typedef struct LLRP_SEncoderStream      LLRP_tSEncoderStream;
 typedef struct LLRP_SEncoderStreamOps   LLRP_tSEncoderStreamOps;
+typedef struct LLRP_SArena              LLRP_tSArena;
+typedef struct LLRP_SArenaBlock         LLRP_tSArenaBlock;
+typedef struct LLRP_SLazySubParameters  LLRP_tSLazySubParameters;
 
 
 typedef struct
@@ -228,6 +233,11 @@ enum LLRP_ResultCode
     LLRP_RC_XMLExtraNode,
     LLRP_RC_XMLInvalidFieldCharacters,
     LLRP_RC_XMLOutOfRange,
+    LLRP_RC_SendQueueFull,
+    LLRP_RC_TransactCancelled,
+    LLRP_RC_EnrollTooManyTypes,
+    LLRP_RC_EnrollDuplicateType,
+    LLRP_RC_EnrollAllocationFailed,
 
 };
 
@@ -375,6 +385,14 @@ struct LLRP_STypeDescriptor
       LLRP_tSElement *          pElement,
       LLRP_tSDecoderStream *    pDecoderStream);
 
+    /* Same, specialized for the frame (binary) decoder, which
+     * prefers it. NULL if the type has no fixed field block
+     * to gain from it. Only ever given a frame decoder stream. */
+    void
+    (*pfDecodeFrameFields) (
+      LLRP_tSElement *          pElement,
+      LLRP_tSDecoderStream *    pDecoderStream);
+
     /* After fields are decoded, the CDecoder itself takes care
      * of gathering the subparameters into m_listAllSubParameters.
      * Once the end of the enclosing TLV (or message) is reached
@@ -475,41 +493,122 @@ struct LLRP_SEnumTableEntry
  * A collection of pointers to STypeDescriptors.
  * During decode operations types can be looked up
  * by code (vendor and typenum) or by name.
+ *
+ * The code generator also emits each set of types as a const
+ * registry, LLRP_<name>TypeRegistry, initialized at compile time.
+ * Nothing changes a registry during lookups, so one that is
+ * no longer being enrolled into, such as those, can be shared
+ * by any number of threads decoding at once.
+ *
+ * A registry can be layered over another (pBase). Types it does
+ * not have are looked up in the base, which is not copied. This
+ * is how vendor types are added to the const core registry.
  */
 #define LTKC_MAX_CUSTOM_MESSAGE     1024u
 #define LTKC_MAX_CUSTOM_PARAMETER   1024u
+#define LTKC_MAX_NAME_INDEX         8u
+/* Smallest custom hash, a power of two */
+#define LTKC_CUSTOM_HASH_MIN        16u
+/* Standard type numbers are 16 bits, found in pages of 256 */
+#define LTKC_TYPE_PAGE_SHIFT        8u
+#define LTKC_TYPE_PAGE_SIZE         256u
+#define LTKC_TYPE_PAGE_COUNT        256u
 struct LLRP_STypeRegistry
 {
-    /* Standard messages subscripted by type number */
-    const LLRP_tSTypeDescriptor * apStdMessageTypeDescriptors[1024u];
-    /* Standard parameters subscripted by type number */
-    const LLRP_tSTypeDescriptor * apStdParameterTypeDescriptors[1024u];
+    /*
+     * Standard messages and parameters by type number, two levels:
+     * page [TypeNum >> 8], then entry [TypeNum & 0xFF]. A NULL page
+     * has no types. Types are sparse and mostly in a few runs, so
+     * this covers the whole 16-bit space in a few KB. The pages of
+     * a registry enrolled into are its own (malloc); those of a
+     * generated const registry are const arrays.
+     */
+    const LLRP_tSTypeDescriptor * const *
+                        apStdMessagePages[LTKC_TYPE_PAGE_COUNT];
+    const LLRP_tSTypeDescriptor * const *
+                        apStdParameterPages[LTKC_TYPE_PAGE_COUNT];
 
-    /* Custom messages, sequential search */
+    /* Custom messages, in the order enrolled */
     const LLRP_tSTypeDescriptor *
                 apCustMessageTypeDescriptors[LTKC_MAX_CUSTOM_MESSAGE];
     unsigned int                nCustMessageTypeDescriptors;
-    /* Custom parameters, sequential search */
+    /* Custom parameters, in the order enrolled */
     const LLRP_tSTypeDescriptor *
                 apCustParameterTypeDescriptors[LTKC_MAX_CUSTOM_PARAMETER];
     unsigned int                nCustParameterTypeDescriptors;
+
+    /*
+     * The same custom types hashed by vendor and subtype,
+     * open addressing with linear probing. NULL=>empty slot.
+     * They are never more than half full, so a probe always
+     * ends at the type or at an empty slot. Each has the fewest
+     * slots, a power of two and at least LTKC_CUSTOM_HASH_MIN,
+     * that keeps it so: NULL with 0 slots until the first custom
+     * type, then malloc'd and doubled as types are enrolled. Those
+     * of a generated const registry are const arrays of that size.
+     */
+    const LLRP_tSTypeDescriptor * const *
+                                apCustMessageHash;
+    unsigned int                nCustMessageHash;
+    const LLRP_tSTypeDescriptor * const *
+                                apCustParameterHash;
+    unsigned int                nCustParameterHash;
+
+    /*
+     * Name indexes, one per generated set of types (core, each
+     * vendor extension). Each is sorted by name (strcmp order)
+     * so lookupByName() can do a binary search instead of
+     * comparing the name of every enrolled type. Only types
+     * enrolled here count as indexed, each once, so when as many
+     * are indexed as were enrolled, a name none of the indexes
+     * has is not enrolled at all.
+     */
+    const LLRP_tSTypeDescriptor * const *
+                                appNameIndex[LTKC_MAX_NAME_INDEX];
+    unsigned int                anNameIndex[LTKC_MAX_NAME_INDEX];
+    unsigned int                nNameIndex;
+    unsigned int                nEnrolledTypeDescriptors;
+    unsigned int                nIndexedTypeDescriptors;
+
+    /* Registry to look in for types not found here, or NULL */
+    const LLRP_tSTypeRegistry * pBase;
 };
 
 /* Create a new TypeRegistry */
 extern LLRP_tSTypeRegistry *
 LLRP_TypeRegistry_construct (void);
 
+/* Create a new TypeRegistry layered over another */
+extern LLRP_tSTypeRegistry *
+LLRP_TypeRegistry_constructLayered (
+  const LLRP_tSTypeRegistry *   pBase);
+
 /* Destruct a TypeRegistry */
 extern void
 LLRP_TypeRegistry_destruct (
   LLRP_tSTypeRegistry *         pTypeRegistry);
 
-/* Add a type descriptor to the registry */
+/*
+ * Add a type descriptor to the registry. A standard type replaces
+ * any enrolled under its number. A custom type whose vendor and
+ * subtype are already enrolled is refused (EnrollDuplicateType),
+ * as is one past LTKC_MAX_CUSTOM_* (EnrollTooManyTypes) or one
+ * there is no memory for (EnrollAllocationFailed). Types in the
+ * base registry do not count; those are hidden instead.
+ */
 extern LLRP_tResultCode
 LLRP_TypeRegistry_enroll (
   LLRP_tSTypeRegistry *         pTypeRegistry,
   const LLRP_tSTypeDescriptor * pTypeDescriptor);
 
+/* Add a name-sorted table of enrolled type descriptors */
+extern LLRP_tResultCode
+LLRP_TypeRegistry_enrollNameIndex (
+  LLRP_tSTypeRegistry *         pTypeRegistry,
+  const LLRP_tSTypeDescriptor * const *
+                                ppTypeDescriptors,
+  unsigned int                  nTypeDescriptor);
+
 /* Lookup a standard message type descriptor. NULL=>not found */
 const LLRP_tSTypeDescriptor *
 LLRP_TypeRegistry_lookupMessage (
@@ -567,6 +666,11 @@ LLRP_TypeRegistry_lookupByName (
  *
  * This works because every parameter referenced by specific
  * fields is also referenced by m_listAllSubParameters.
+ *
+ * An element decoded into an arena (see SArena) has pArena
+ * set. Its memory, and that of the vectors the decoder gave
+ * it, is not freed on its own. It goes with the arena when
+ * the arena's owner, the top-level message, is destructed.
  */
 
 struct LLRP_SElement
@@ -579,6 +683,9 @@ struct LLRP_SElement
 
     /* List of all sub elements */
     LLRP_tSParameter *          listAllSubParameters;
+
+    /* Arena the element was allocated from, NULL if malloc()ed */
+    LLRP_tSArena *              pArena;
 };
 
 struct LLRP_SMessage
@@ -591,7 +698,17 @@ struct LLRP_SMessage
 
     llrp_u32_t                  MessageID;
 
+    /* Links for a connection's input queue, oldest first */
     LLRP_tSMessage *            pQueueNext;
+    LLRP_tSMessage *            pQueuePrev;
+
+    /* Next in the input queue index chain, see ltkc_connection.c */
+    LLRP_tSMessage *            pIndexNext;
+
+    /* Where the sub-parameters not decoded yet are in the frame.
+     * NULL unless the message was decoded lazily, see
+     * LLRP_Message_materializeAll(). */
+    LLRP_tSLazySubParameters *  pLazy;
 };
 
 struct LLRP_SParameter
@@ -603,9 +720,74 @@ struct LLRP_SParameter
 
     /* Next pointer for element headed by specific member */
     LLRP_tSParameter *          pNextSubParameter;
+
+    /* Previous pointers for the same two lists. The head's
+     * points at the tail, so appending doesn't walk the list. */
+    LLRP_tSParameter *          pPrevAllSubParameters;
+    LLRP_tSParameter *          pPrevSubParameter;
 };
 
 
+/*
+ * SArena
+ *
+ * Bump allocator for the elements and vectors of one decoded
+ * message. Allocations are never freed one by one. The whole
+ * arena goes in one call, normally when pOwner is destructed.
+ *
+ * The arena and its first block are a single malloc(). More
+ * blocks, each twice the size of the last, are added only when
+ * the first is used up.
+ */
+
+struct LLRP_SArenaBlock
+{
+    /* Next older block */
+    LLRP_tSArenaBlock *         pNext;
+
+    /* Bytes of storage following this header */
+    unsigned int                nSize;
+};
+
+struct LLRP_SArena
+{
+    /* Element whose destruct frees the arena, NULL if none */
+    LLRP_tSElement *            pOwner;
+
+    /* Free space in the newest block */
+    unsigned char *             pFree;
+    unsigned char *             pLimit;
+
+    /* Blocks, newest first. The last is part of the arena's allocation. */
+    LLRP_tSArenaBlock *         pBlockList;
+
+    /* Size of the next block to add */
+    unsigned int                nNextBlockSize;
+};
+
+
+/*
+ * ltkc_arena.c
+ */
+extern LLRP_tSArena *
+LLRP_Arena_construct (
+  unsigned int                  nFirstBlockSize);
+
+extern void
+LLRP_Arena_destruct (
+  LLRP_tSArena *                pArena);
+
+extern void *
+LLRP_Arena_alloc (
+  LLRP_tSArena *                pArena,
+  unsigned int                  nByte);
+
+extern llrp_bool_t
+LLRP_Arena_contains (
+  const LLRP_tSArena *          pArena,
+  const void *                  pMemory);
+
+
 /*
  * ltkc_element.c
  */
@@ -613,6 +795,16 @@ LLRP_tSElement *
 LLRP_Element_construct (
   const LLRP_tSTypeDescriptor *  pTypeDescriptor);
 
+extern LLRP_tSElement *
+LLRP_Element_constructInArena (
+  const LLRP_tSTypeDescriptor * pTypeDescriptor,
+  LLRP_tSArena *                pArena);
+
+extern llrp_bool_t
+LLRP_Element_isArenaMemory (
+  const LLRP_tSElement *        pElement,
+  const void *                  pMemory);
+
 extern void
 LLRP_Element_destruct (
   LLRP_tSElement *              pElement);
@@ -635,13 +827,13 @@ extern void
 LLRP_Element_clearSubParameterAllList (
   LLRP_tSElement *              pElement);
 
-extern void
+extern LLRP_tResultCode
 LLRP_Element_setSubParameterPtr (
   LLRP_tSElement *              pElement,
   LLRP_tSParameter **           ppPtr,
   LLRP_tSParameter *            pValue);
 
-extern void
+extern LLRP_tResultCode
 LLRP_Element_addToSubParameterList (
   LLRP_tSElement *              pElement,
   LLRP_tSParameter **           ppListHead,
@@ -652,7 +844,7 @@ LLRP_Element_attachToSubParameterList (
   LLRP_tSParameter **           ppListHead,
   LLRP_tSParameter *            pValue);
 
-extern void
+extern LLRP_tResultCode
 LLRP_Element_clearSubParameterList (
   LLRP_tSElement *              pElement,
   LLRP_tSParameter **           ppListHead);
@@ -662,6 +854,16 @@ LLRP_Element_countSubParameterList (
   LLRP_tSElement *              pElement,
   LLRP_tSParameter **           ppListHead);
 
+/*
+ * LLRP_Element_walk() calls pFunc for each element. pFunc gives 0
+ * to go on or a positive value, which the walk returns, to stop.
+ * Negative values are reserved for the walk itself. It gives
+ * LLRP_WALK_DECODE_FAILED, and walks nothing, when it meets a lazily
+ * decoded message with a sub-parameter that fails to decode;
+ * LLRP_Message_materializeAll() says why.
+ */
+#define LLRP_WALK_DECODE_FAILED     (-1)
+
 extern int
 LLRP_Element_walk (
   const LLRP_tSElement *        pElement,
@@ -677,6 +879,23 @@ LLRP_Message_setMessageID (
   LLRP_tSMessage *              pMessage,
   llrp_u32_t                    MessageID);
 
+/*
+ * Lazily decoded messages, see bLazySubParameters in ltkc_frame.h.
+ * The generated get and begin accessors of a message call the first
+ * for the member they return. The second decodes everything left
+ * and gives the first error decoding any of it. Both are in
+ * ltkc_framedecode.c.
+ */
+extern void
+LLRP_Message_materializeSubParameters (
+  LLRP_tSMessage *              pMessage,
+  LLRP_tSParameter *            pFirst);
+
+extern LLRP_tResultCode
+LLRP_Message_materializeAll (
+  LLRP_tSMessage *              pMessage,
+  LLRP_tSErrorDetails *         pError);
+
 extern llrp_bool_t
 LLRP_Parameter_isAllowedIn (
   LLRP_tSParameter *            pParameter,
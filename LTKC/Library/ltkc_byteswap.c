@@ -0,0 +1,747 @@
+
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  ltkc_byteswap.c
+ **
+ ** @brief Bulk big-endian conversion of vector fields
+ **
+ ** LLRP_ByteSwap_PORTABLE assembles each value from its bytes with
+ ** shifts. It works on any host and is the fallback everywhere.
+ **
+ ** LLRP_ByteSwap_SSE2 and LLRP_ByteSwap_AVX2 swap 16 and 32 bytes
+ ** at a time on x86, which is little-endian. They are compiled with
+ ** GCC/clang target attributes, so the library itself needs no
+ ** special flags, and used only if the CPU says it has the
+ ** instructions. The odd values at the end of a vector go through
+ ** the portable code.
+ **
+ ** Swapping is its own inverse, so on x86 a load and a store are
+ ** the same operation.
+ **
+ *****************************************************************************/
+
+
+#include "ltkc_platform.h"
+#include "ltkc_base.h"
+#include "ltkc_frame.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LTKC_BYTESWAP_X86
+#include <immintrin.h>
+#endif
+
+
+/*
+ * Forward declarations of private routines
+ */
+
+static llrp_bool_t
+isSupported_PORTABLE (void);
+
+static void
+load16_PORTABLE (
+  llrp_u16_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n);
+
+static void
+load32_PORTABLE (
+  llrp_u32_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n);
+
+static void
+load64_PORTABLE (
+  llrp_u64_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n);
+
+static void
+store16_PORTABLE (
+  llrp_u8_t *                   pDst,
+  const llrp_u16_t *            pSrc,
+  unsigned int                  n);
+
+static void
+store32_PORTABLE (
+  llrp_u8_t *                   pDst,
+  const llrp_u32_t *            pSrc,
+  unsigned int                  n);
+
+static void
+store64_PORTABLE (
+  llrp_u8_t *                   pDst,
+  const llrp_u64_t *            pSrc,
+  unsigned int                  n);
+
+static llrp_bool_t
+isSupported_SSE2 (void);
+
+static llrp_bool_t
+isSupported_AVX2 (void);
+
+#ifdef LTKC_BYTESWAP_X86
+
+static unsigned int
+swap16_SSE2 (
+  void *                        pDst,
+  const void *                  pSrc,
+  unsigned int                  n);
+
+static unsigned int
+swap32_SSE2 (
+  void *                        pDst,
+  const void *                  pSrc,
+  unsigned int                  n);
+
+static unsigned int
+swap64_SSE2 (
+  void *                        pDst,
+  const void *                  pSrc,
+  unsigned int                  n);
+
+static unsigned int
+swapBytes_AVX2 (
+  void *                        pDst,
+  const void *                  pSrc,
+  unsigned int                  nByte,
+  const llrp_u8_t *             pShuffle);
+
+static void
+load16_SSE2 (
+  llrp_u16_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n);
+
+static void
+load32_SSE2 (
+  llrp_u32_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n);
+
+static void
+load64_SSE2 (
+  llrp_u64_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n);
+
+static void
+store16_SSE2 (
+  llrp_u8_t *                   pDst,
+  const llrp_u16_t *            pSrc,
+  unsigned int                  n);
+
+static void
+store32_SSE2 (
+  llrp_u8_t *                   pDst,
+  const llrp_u32_t *            pSrc,
+  unsigned int                  n);
+
+static void
+store64_SSE2 (
+  llrp_u8_t *                   pDst,
+  const llrp_u64_t *            pSrc,
+  unsigned int                  n);
+
+static void
+load16_AVX2 (
+  llrp_u16_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n);
+
+static void
+load32_AVX2 (
+  llrp_u32_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n);
+
+static void
+load64_AVX2 (
+  llrp_u64_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n);
+
+static void
+store16_AVX2 (
+  llrp_u8_t *                   pDst,
+  const llrp_u16_t *            pSrc,
+  unsigned int                  n);
+
+static void
+store32_AVX2 (
+  llrp_u8_t *                   pDst,
+  const llrp_u32_t *            pSrc,
+  unsigned int                  n);
+
+static void
+store64_AVX2 (
+  llrp_u8_t *                   pDst,
+  const llrp_u64_t *            pSrc,
+  unsigned int                  n);
+
+#define SSE2_LOAD16     load16_SSE2
+#define SSE2_LOAD32     load32_SSE2
+#define SSE2_LOAD64     load64_SSE2
+#define SSE2_STORE16    store16_SSE2
+#define SSE2_STORE32    store32_SSE2
+#define SSE2_STORE64    store64_SSE2
+#define AVX2_LOAD16     load16_AVX2
+#define AVX2_LOAD32     load32_AVX2
+#define AVX2_LOAD64     load64_AVX2
+#define AVX2_STORE16    store16_AVX2
+#define AVX2_STORE32    store32_AVX2
+#define AVX2_STORE64    store64_AVX2
+
+#else /* LTKC_BYTESWAP_X86 */
+
+/*
+ * Not built in. pfIsSupported says so, and the
+ * portable routines keep the tables usable.
+ */
+#define SSE2_LOAD16     load16_PORTABLE
+#define SSE2_LOAD32     load32_PORTABLE
+#define SSE2_LOAD64     load64_PORTABLE
+#define SSE2_STORE16    store16_PORTABLE
+#define SSE2_STORE32    store32_PORTABLE
+#define SSE2_STORE64    store64_PORTABLE
+#define AVX2_LOAD16     load16_PORTABLE
+#define AVX2_LOAD32     load32_PORTABLE
+#define AVX2_LOAD64     load64_PORTABLE
+#define AVX2_STORE16    store16_PORTABLE
+#define AVX2_STORE32    store32_PORTABLE
+#define AVX2_STORE64    store64_PORTABLE
+
+#endif /* LTKC_BYTESWAP_X86 */
+
+
+const LLRP_tSByteSwapKernel     LLRP_ByteSwap_PORTABLE =
+{
+    .pName              = "portable",
+    .pfIsSupported      = isSupported_PORTABLE,
+    .pfLoad16           = load16_PORTABLE,
+    .pfLoad32           = load32_PORTABLE,
+    .pfLoad64           = load64_PORTABLE,
+    .pfStore16          = store16_PORTABLE,
+    .pfStore32          = store32_PORTABLE,
+    .pfStore64          = store64_PORTABLE,
+};
+
+const LLRP_tSByteSwapKernel     LLRP_ByteSwap_SSE2 =
+{
+    .pName              = "sse2",
+    .pfIsSupported      = isSupported_SSE2,
+    .pfLoad16           = SSE2_LOAD16,
+    .pfLoad32           = SSE2_LOAD32,
+    .pfLoad64           = SSE2_LOAD64,
+    .pfStore16          = SSE2_STORE16,
+    .pfStore32          = SSE2_STORE32,
+    .pfStore64          = SSE2_STORE64,
+};
+
+const LLRP_tSByteSwapKernel     LLRP_ByteSwap_AVX2 =
+{
+    .pName              = "avx2",
+    .pfIsSupported      = isSupported_AVX2,
+    .pfLoad16           = AVX2_LOAD16,
+    .pfLoad32           = AVX2_LOAD32,
+    .pfLoad64           = AVX2_LOAD64,
+    .pfStore16          = AVX2_STORE16,
+    .pfStore32          = AVX2_STORE32,
+    .pfStore64          = AVX2_STORE64,
+};
+
+/*
+ * The kernel in use, NULL until the first call picks one.
+ * Decoding threads read it concurrently, so it is only loaded
+ * and stored atomically. The kernels are constant, so relaxed
+ * order is enough, and two threads making the first call
+ * at once just store the same pointer.
+ */
+static const LLRP_tSByteSwapKernel *s_pKernel;
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Get the byte swap kernel, picking the best if none is set
+ **
+ *****************************************************************************/
+
+const LLRP_tSByteSwapKernel *
+LLRP_ByteSwap_getKernel (void)
+{
+    const LLRP_tSByteSwapKernel *pKernel;
+
+    pKernel = __atomic_load_n(&s_pKernel, __ATOMIC_RELAXED);
+
+    if(NULL == pKernel)
+    {
+        if(LLRP_ByteSwap_AVX2.pfIsSupported())
+        {
+            pKernel = &LLRP_ByteSwap_AVX2;
+        }
+        else if(LLRP_ByteSwap_SSE2.pfIsSupported())
+        {
+            pKernel = &LLRP_ByteSwap_SSE2;
+        }
+        else
+        {
+            pKernel = &LLRP_ByteSwap_PORTABLE;
+        }
+        __atomic_store_n(&s_pKernel, pKernel, __ATOMIC_RELAXED);
+    }
+
+    return pKernel;
+}
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Use a particular byte swap kernel, for all threads
+ **
+ ** Meant for benchmarks and tests. NULL goes back to the best one.
+ **
+ ** @return     0 on success, -1 if the kernel can't run here
+ **
+ *****************************************************************************/
+
+int
+LLRP_ByteSwap_setKernel (
+  const LLRP_tSByteSwapKernel * pKernel)
+{
+    if(NULL != pKernel && !pKernel->pfIsSupported())
+    {
+        return -1;
+    }
+
+    __atomic_store_n(&s_pKernel, pKernel, __ATOMIC_RELAXED);
+
+    return 0;
+}
+
+
+static llrp_bool_t
+isSupported_PORTABLE (void)
+{
+    return TRUE;
+}
+
+static void
+load16_PORTABLE (
+  llrp_u16_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i;
+
+    for(i = 0; i < n; i++, pSrc += 2)
+    {
+        pDst[i] = (llrp_u16_t)(((unsigned int)pSrc[0] << 8u) | pSrc[1]);
+    }
+}
+
+static void
+load32_PORTABLE (
+  llrp_u32_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i;
+
+    for(i = 0; i < n; i++, pSrc += 4)
+    {
+        pDst[i] = LLRP_FRAME_LOAD_U32(pSrc);
+    }
+}
+
+static void
+load64_PORTABLE (
+  llrp_u64_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i;
+
+    for(i = 0; i < n; i++, pSrc += 8)
+    {
+        pDst[i] = LLRP_FRAME_LOAD_U64(pSrc);
+    }
+}
+
+static void
+store16_PORTABLE (
+  llrp_u8_t *                   pDst,
+  const llrp_u16_t *            pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i;
+
+    for(i = 0; i < n; i++, pDst += 2)
+    {
+        pDst[0] = pSrc[i] >> 8u;
+        pDst[1] = pSrc[i] >> 0u;
+    }
+}
+
+static void
+store32_PORTABLE (
+  llrp_u8_t *                   pDst,
+  const llrp_u32_t *            pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i;
+
+    for(i = 0; i < n; i++, pDst += 4)
+    {
+        pDst[0] = pSrc[i] >> 24u;
+        pDst[1] = pSrc[i] >> 16u;
+        pDst[2] = pSrc[i] >> 8u;
+        pDst[3] = pSrc[i] >> 0u;
+    }
+}
+
+static void
+store64_PORTABLE (
+  llrp_u8_t *                   pDst,
+  const llrp_u64_t *            pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i;
+
+    for(i = 0; i < n; i++, pDst += 8)
+    {
+        pDst[0] = pSrc[i] >> 56u;
+        pDst[1] = pSrc[i] >> 48u;
+        pDst[2] = pSrc[i] >> 40u;
+        pDst[3] = pSrc[i] >> 32u;
+        pDst[4] = pSrc[i] >> 24u;
+        pDst[5] = pSrc[i] >> 16u;
+        pDst[6] = pSrc[i] >> 8u;
+        pDst[7] = pSrc[i] >> 0u;
+    }
+}
+
+
+#ifdef LTKC_BYTESWAP_X86
+
+static llrp_bool_t
+isSupported_SSE2 (void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2") ? TRUE : FALSE;
+}
+
+static llrp_bool_t
+isSupported_AVX2 (void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? TRUE : FALSE;
+}
+
+/*
+ * The SSE2 routines swap whole 16-byte blocks and return how
+ * many values they did. SSE2 has no byte shuffle: the bytes of
+ * each 16-bit word are swapped with shifts, after the words
+ * of each value are put in reverse order.
+ */
+#define SSE2_SWAP_WORD_BYTES(v)                                 \
+    _mm_or_si128(_mm_slli_epi16((v), 8), _mm_srli_epi16((v), 8))
+
+__attribute__((target("sse2")))
+static unsigned int
+swap16_SSE2 (
+  void *                        pDst,
+  const void *                  pSrc,
+  unsigned int                  n)
+{
+    const llrp_u8_t *           pIn  = (const llrp_u8_t *) pSrc;
+    llrp_u8_t *                 pOut = (llrp_u8_t *) pDst;
+    unsigned int                nBlock = n / 8u;
+    unsigned int                i;
+
+    for(i = 0; i < nBlock; i++, pIn += 16, pOut += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *) pIn);
+
+        _mm_storeu_si128((__m128i *) pOut, SSE2_SWAP_WORD_BYTES(v));
+    }
+
+    return nBlock * 8u;
+}
+
+__attribute__((target("sse2")))
+static unsigned int
+swap32_SSE2 (
+  void *                        pDst,
+  const void *                  pSrc,
+  unsigned int                  n)
+{
+    const llrp_u8_t *           pIn  = (const llrp_u8_t *) pSrc;
+    llrp_u8_t *                 pOut = (llrp_u8_t *) pDst;
+    unsigned int                nBlock = n / 4u;
+    unsigned int                i;
+
+    for(i = 0; i < nBlock; i++, pIn += 16, pOut += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *) pIn);
+
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2,3,0,1));
+        v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2,3,0,1));
+        _mm_storeu_si128((__m128i *) pOut, SSE2_SWAP_WORD_BYTES(v));
+    }
+
+    return nBlock * 4u;
+}
+
+__attribute__((target("sse2")))
+static unsigned int
+swap64_SSE2 (
+  void *                        pDst,
+  const void *                  pSrc,
+  unsigned int                  n)
+{
+    const llrp_u8_t *           pIn  = (const llrp_u8_t *) pSrc;
+    llrp_u8_t *                 pOut = (llrp_u8_t *) pDst;
+    unsigned int                nBlock = n / 2u;
+    unsigned int                i;
+
+    for(i = 0; i < nBlock; i++, pIn += 16, pOut += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *) pIn);
+
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0,1,2,3));
+        v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0,1,2,3));
+        _mm_storeu_si128((__m128i *) pOut, SSE2_SWAP_WORD_BYTES(v));
+    }
+
+    return nBlock * 2u;
+}
+
+/*
+ * AVX2 reverses the bytes of each value with one shuffle. The
+ * shuffle works within each 16-byte lane, so one pattern per
+ * value size serves both lanes. Returns how many bytes it did.
+ */
+__attribute__((target("avx2")))
+static unsigned int
+swapBytes_AVX2 (
+  void *                        pDst,
+  const void *                  pSrc,
+  unsigned int                  nByte,
+  const llrp_u8_t *             pShuffle)
+{
+    __m256i                     Shuffle;
+    const llrp_u8_t *           pIn  = (const llrp_u8_t *) pSrc;
+    llrp_u8_t *                 pOut = (llrp_u8_t *) pDst;
+    unsigned int                nBlock = nByte / 32u;
+    unsigned int                i;
+
+    Shuffle = _mm256_loadu_si256((const __m256i *) pShuffle);
+    for(i = 0; i < nBlock; i++, pIn += 32, pOut += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *) pIn);
+
+        _mm256_storeu_si256((__m256i *) pOut,
+                            _mm256_shuffle_epi8(v, Shuffle));
+    }
+
+    return nBlock * 32u;
+}
+
+static const llrp_u8_t          s_aShuffle16_AVX2[32] =
+{
+    1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14,
+    1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14,
+};
+
+static const llrp_u8_t          s_aShuffle32_AVX2[32] =
+{
+    3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12,
+    3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12,
+};
+
+static const llrp_u8_t          s_aShuffle64_AVX2[32] =
+{
+    7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8,
+    7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8,
+};
+
+static void
+load16_SSE2 (
+  llrp_u16_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i = swap16_SSE2(pDst, pSrc, n);
+
+    load16_PORTABLE(pDst + i, pSrc + 2u * i, n - i);
+}
+
+static void
+load32_SSE2 (
+  llrp_u32_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i = swap32_SSE2(pDst, pSrc, n);
+
+    load32_PORTABLE(pDst + i, pSrc + 4u * i, n - i);
+}
+
+static void
+load64_SSE2 (
+  llrp_u64_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i = swap64_SSE2(pDst, pSrc, n);
+
+    load64_PORTABLE(pDst + i, pSrc + 8u * i, n - i);
+}
+
+static void
+store16_SSE2 (
+  llrp_u8_t *                   pDst,
+  const llrp_u16_t *            pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i = swap16_SSE2(pDst, pSrc, n);
+
+    store16_PORTABLE(pDst + 2u * i, pSrc + i, n - i);
+}
+
+static void
+store32_SSE2 (
+  llrp_u8_t *                   pDst,
+  const llrp_u32_t *            pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i = swap32_SSE2(pDst, pSrc, n);
+
+    store32_PORTABLE(pDst + 4u * i, pSrc + i, n - i);
+}
+
+static void
+store64_SSE2 (
+  llrp_u8_t *                   pDst,
+  const llrp_u64_t *            pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i = swap64_SSE2(pDst, pSrc, n);
+
+    store64_PORTABLE(pDst + 8u * i, pSrc + i, n - i);
+}
+
+static void
+load16_AVX2 (
+  llrp_u16_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i;
+
+    i = swapBytes_AVX2(pDst, pSrc, 2u * n,
+                        s_aShuffle16_AVX2) / 2u;
+    load16_PORTABLE(pDst + i, pSrc + 2u * i, n - i);
+}
+
+static void
+load32_AVX2 (
+  llrp_u32_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i;
+
+    i = swapBytes_AVX2(pDst, pSrc, 4u * n,
+                        s_aShuffle32_AVX2) / 4u;
+    load32_PORTABLE(pDst + i, pSrc + 4u * i, n - i);
+}
+
+static void
+load64_AVX2 (
+  llrp_u64_t *                  pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i;
+
+    i = swapBytes_AVX2(pDst, pSrc, 8u * n,
+                        s_aShuffle64_AVX2) / 8u;
+    load64_PORTABLE(pDst + i, pSrc + 8u * i, n - i);
+}
+
+static void
+store16_AVX2 (
+  llrp_u8_t *                   pDst,
+  const llrp_u16_t *            pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i;
+
+    i = swapBytes_AVX2(pDst, pSrc, 2u * n,
+                        s_aShuffle16_AVX2) / 2u;
+    store16_PORTABLE(pDst + 2u * i, pSrc + i, n - i);
+}
+
+static void
+store32_AVX2 (
+  llrp_u8_t *                   pDst,
+  const llrp_u32_t *            pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i;
+
+    i = swapBytes_AVX2(pDst, pSrc, 4u * n,
+                        s_aShuffle32_AVX2) / 4u;
+    store32_PORTABLE(pDst + 4u * i, pSrc + i, n - i);
+}
+
+static void
+store64_AVX2 (
+  llrp_u8_t *                   pDst,
+  const llrp_u64_t *            pSrc,
+  unsigned int                  n)
+{
+    unsigned int                i;
+
+    i = swapBytes_AVX2(pDst, pSrc, 8u * n,
+                        s_aShuffle64_AVX2) / 8u;
+    store64_PORTABLE(pDst + 8u * i, pSrc + i, n - i);
+}
+
+#else /* LTKC_BYTESWAP_X86 */
+
+static llrp_bool_t
+isSupported_SSE2 (void)
+{
+    return FALSE;
+}
+
+static llrp_bool_t
+isSupported_AVX2 (void)
+{
+    return FALSE;
+}
+
+#endif /* LTKC_BYTESWAP_X86 */
@@ -0,0 +1,616 @@
+
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  ltkc_columns.c
+ **
+ ** @brief Columnar batch decode of one parameter type
+ **
+ ** The columns are filled from LLRP_FrameDecoder_stream() callbacks,
+ ** so no element is built. The arrays of a column set grow together,
+ ** doubling, and are kept across LLRP_Columns_clear().
+ **
+ *****************************************************************************/
+
+
+#include "ltkc_platform.h"
+#include "ltkc_base.h"
+#include "ltkc_frame.h"
+
+
+/*
+ * Rows and pool bytes the arrays first have room for
+ */
+#define LLRP_COLUMNS_FIRST_ROWS     (64u)
+#define LLRP_COLUMNS_FIRST_BYTES    (1024u)
+
+/*
+ * State of one LLRP_Columns_decodeFrame()
+ */
+struct LLRP_SColumnsDecode
+{
+    LLRP_tSColumnsHdr *         pColumns;
+
+    /* 0 outside a row, 1 in the row parameter,
+     * 2 in a sub-parameter of it that has a column */
+    unsigned int                nDepth;
+
+    llrp_bool_t                 bAllocFailed;
+};
+
+typedef struct LLRP_SColumnsDecode LLRP_tSColumnsDecode;
+
+
+/*
+ * BEGIN forward decls
+ */
+static int
+decodeBegin (
+  void *                        pContext,
+  const LLRP_tSTypeDescriptor * pType);
+
+static void
+decodeField (
+  void *                        pContext,
+  const LLRP_tSTypeDescriptor * pType,
+  const LLRP_tSFieldDescriptor *pField,
+  const LLRP_tSFrameStreamField *pValue);
+
+static void
+decodeEnd (
+  void *                        pContext,
+  const LLRP_tSTypeDescriptor * pType);
+
+static llrp_bool_t
+beginRow (
+  LLRP_tSColumnsHdr *           pColumns);
+
+static llrp_bool_t
+growRows (
+  LLRP_tSColumnsHdr *           pColumns);
+
+static llrp_bool_t
+setPoolBytes (
+  LLRP_tSColumnPool *           pPool,
+  unsigned int                  iRow,
+  const llrp_u8_t *             pBytes,
+  unsigned int                  nByte);
+
+static llrp_bool_t
+hasColumn (
+  const LLRP_tSColumnSet *      pColumnSet,
+  const LLRP_tSTypeDescriptor * pType);
+
+static llrp_u8_t **
+columnValues (
+  LLRP_tSColumnsHdr *           pColumns,
+  const LLRP_tSColumnDescriptor *pColumn);
+
+static llrp_u8_t **
+columnPresent (
+  LLRP_tSColumnsHdr *           pColumns,
+  const LLRP_tSColumnDescriptor *pColumn);
+
+static LLRP_tSColumnPool *
+columnPool (
+  LLRP_tSColumnsHdr *           pColumns,
+  const LLRP_tSColumnDescriptor *pColumn);
+/*
+ * END forward decls
+ */
+
+
+static const LLRP_tSFrameStreamCallbacks
+s_ColumnsDecodeCallbacks =
+{
+    decodeBegin,
+    decodeField,
+    decodeEnd
+};
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Construct empty columns
+ **
+ ** @param[in]  pColumnSet      The column set, normally generated,
+ **                             e.g. LLRP_csTagReportData
+ **
+ ** @return     !=NULL          Pointer to the columns, pColumnSet's
+ **                             nSizeBytes of them
+ **             ==NULL          Error, always an allocation failure
+ **
+ *****************************************************************************/
+
+LLRP_tSColumnsHdr *
+LLRP_Columns_construct (
+  const LLRP_tSColumnSet *      pColumnSet)
+{
+    LLRP_tSColumnsHdr *         pColumns;
+
+    pColumns = malloc(pColumnSet->nSizeBytes);
+    if(NULL != pColumns)
+    {
+        memset(pColumns, 0, pColumnSet->nSizeBytes);
+
+        pColumns->pColumnSet = pColumnSet;
+    }
+
+    return pColumns;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Destruct columns and their arrays
+ **
+ ** @param[in]  pColumns        Pointer to the columns, NULL is OK
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Columns_destruct (
+  LLRP_tSColumnsHdr *           pColumns)
+{
+    const LLRP_tSColumnSet *    pColumnSet;
+    const LLRP_tSColumnDescriptor *pColumn;
+    LLRP_tSColumnPool *         pPool;
+    unsigned int                iColumn;
+
+    if(NULL == pColumns)
+    {
+        return;
+    }
+
+    pColumnSet = pColumns->pColumnSet;
+    for(iColumn = 0; iColumn < pColumnSet->nColumn; iColumn++)
+    {
+        pColumn = &pColumnSet->pColumns[iColumn];
+        if(0 == pColumn->nValueBytes)
+        {
+            pPool = columnPool(pColumns, pColumn);
+            free(pPool->pBytes);
+            free(pPool->pOffset);
+        }
+        else
+        {
+            free(*columnValues(pColumns, pColumn));
+            if(0 != pColumn->oPresent)
+            {
+                free(*columnPresent(pColumns, pColumn));
+            }
+        }
+    }
+
+    free(pColumns);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Drop all rows, keeping the arrays for the next ones
+ **
+ ** @param[in]  pColumns        Pointer to the columns
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Columns_clear (
+  LLRP_tSColumnsHdr *           pColumns)
+{
+    const LLRP_tSColumnSet *    pColumnSet = pColumns->pColumnSet;
+    unsigned int                iColumn;
+
+    for(iColumn = 0; iColumn < pColumnSet->nColumn; iColumn++)
+    {
+        if(0 == pColumnSet->pColumns[iColumn].nValueBytes)
+        {
+            columnPool(pColumns, &pColumnSet->pColumns[iColumn])->nByte = 0;
+        }
+    }
+
+    pColumns->nRow = 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Append the rows in the decoder's frame
+ **
+ ** The frame decoder has been given the frame, see
+ ** LLRP_FrameDecoder_reset(). Any message type will do; the rows
+ ** are the parameters of the row type wherever they are in it.
+ **
+ ** @param[in]  pColumns        Pointer to the columns
+ ** @param[in]  pDecoder        Pointer to the frame decoder
+ **
+ ** @return     LLRP_RC_OK      Rows, if any, appended
+ **             other           Error in the decoder's ErrorDetails,
+ **                             and no rows appended. An allocation
+ **                             failure is LLRP_RC_FieldAllocationFailed.
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+LLRP_Columns_decodeFrame (
+  LLRP_tSColumnsHdr *           pColumns,
+  LLRP_tSFrameDecoder *         pDecoder)
+{
+    const LLRP_tSColumnSet *    pColumnSet = pColumns->pColumnSet;
+    LLRP_tSColumnsDecode        Decode;
+    LLRP_tResultCode            eResultCode;
+    LLRP_tSColumnPool *         pPool;
+    unsigned int                nRowBefore;
+    unsigned int                iColumn;
+
+    nRowBefore = pColumns->nRow;
+
+    Decode.pColumns     = pColumns;
+    Decode.nDepth       = 0;
+    Decode.bAllocFailed = FALSE;
+
+    eResultCode = LLRP_FrameDecoder_stream(pDecoder,
+                    &s_ColumnsDecodeCallbacks, &Decode);
+
+    if(LLRP_RC_OK == eResultCode && Decode.bAllocFailed)
+    {
+        eResultCode = LLRP_RC_FieldAllocationFailed;
+        LLRP_Error_resultCodeAndWhatStr(&pDecoder->decoderHdr.ErrorDetails,
+            eResultCode, "column allocation failed");
+    }
+
+    /*
+     * All of the frame or none of it. The pools end
+     * where the last row kept ends.
+     */
+    if(LLRP_RC_OK != eResultCode)
+    {
+        pColumns->nRow = nRowBefore;
+        for(iColumn = 0; iColumn < pColumnSet->nColumn; iColumn++)
+        {
+            if(0 == pColumnSet->pColumns[iColumn].nValueBytes)
+            {
+                pPool = columnPool(pColumns, &pColumnSet->pColumns[iColumn]);
+                pPool->nByte = (0 == nRowBefore) ? 0 :
+                                pPool->pOffset[nRowBefore];
+            }
+        }
+    }
+
+    return eResultCode;
+}
+
+
+/*
+ * Stream callbacks. A row begins with each parameter of the row
+ * type not already in a row. In a row only the sub-parameters
+ * with a column are gone into.
+ */
+static int
+decodeBegin (
+  void *                        pContext,
+  const LLRP_tSTypeDescriptor * pType)
+{
+    LLRP_tSColumnsDecode *      pDecode = pContext;
+    LLRP_tSColumnsHdr *         pColumns = pDecode->pColumns;
+
+    if(pDecode->bAllocFailed)
+    {
+        return 1;
+    }
+
+    if(0 == pDecode->nDepth)
+    {
+        if(pType == pColumns->pColumnSet->pRowType)
+        {
+            if(!beginRow(pColumns))
+            {
+                pDecode->bAllocFailed = TRUE;
+                return 1;
+            }
+            pDecode->nDepth = 1;
+        }
+        return 0;
+    }
+
+    if(1 == pDecode->nDepth && hasColumn(pColumns->pColumnSet, pType))
+    {
+        pDecode->nDepth = 2;
+        return 0;
+    }
+
+    return 1;
+}
+
+static void
+decodeField (
+  void *                        pContext,
+  const LLRP_tSTypeDescriptor * pType,
+  const LLRP_tSFieldDescriptor *pField,
+  const LLRP_tSFrameStreamField *pValue)
+{
+    LLRP_tSColumnsDecode *      pDecode = pContext;
+    LLRP_tSColumnsHdr *         pColumns = pDecode->pColumns;
+    const LLRP_tSColumnSet *    pColumnSet = pColumns->pColumnSet;
+    const LLRP_tSColumnDescriptor *pColumn;
+    unsigned int                iRow;
+    unsigned int                iColumn;
+    llrp_u8_t *                 pPresent;
+
+    if(0 == pDecode->nDepth || pDecode->bAllocFailed)
+    {
+        return;
+    }
+
+    iRow = pColumns->nRow - 1u;
+
+    for(iColumn = 0; iColumn < pColumnSet->nColumn; iColumn++)
+    {
+        pColumn = &pColumnSet->pColumns[iColumn];
+        if(pColumn->pType != pType || pColumn->pField != pField)
+        {
+            continue;
+        }
+
+        if(0 == pColumn->nValueBytes)
+        {
+            if(!setPoolBytes(columnPool(pColumns, pColumn), iRow,
+                    pValue->pBytes, pValue->nValue))
+            {
+                pDecode->bAllocFailed = TRUE;
+            }
+            return;
+        }
+
+        /*
+         * The union's members all start at its start, so the
+         * first nValueBytes are the value whatever its type.
+         */
+        memcpy(*columnValues(pColumns, pColumn) +
+                    (size_t)iRow * pColumn->nValueBytes,
+                &pValue->Scalar, pColumn->nValueBytes);
+        if(0 != pColumn->oPresent)
+        {
+            pPresent = *columnPresent(pColumns, pColumn);
+            pPresent[iRow >> 3u] |= (llrp_u8_t)(1u << (iRow & 7u));
+        }
+        return;
+    }
+}
+
+static void
+decodeEnd (
+  void *                        pContext,
+  const LLRP_tSTypeDescriptor * pType)
+{
+    LLRP_tSColumnsDecode *      pDecode = pContext;
+
+    if(0 != pDecode->nDepth)
+    {
+        pDecode->nDepth--;
+    }
+}
+
+/*
+ * Add a row of absent values: zeros, clear presence
+ * bits and no pool bytes
+ */
+static llrp_bool_t
+beginRow (
+  LLRP_tSColumnsHdr *           pColumns)
+{
+    const LLRP_tSColumnSet *    pColumnSet = pColumns->pColumnSet;
+    const LLRP_tSColumnDescriptor *pColumn;
+    LLRP_tSColumnPool *         pPool;
+    llrp_u8_t *                 pPresent;
+    unsigned int                iRow = pColumns->nRow;
+    unsigned int                iColumn;
+
+    if(iRow == pColumns->nRowMax && !growRows(pColumns))
+    {
+        return FALSE;
+    }
+
+    for(iColumn = 0; iColumn < pColumnSet->nColumn; iColumn++)
+    {
+        pColumn = &pColumnSet->pColumns[iColumn];
+        if(0 == pColumn->nValueBytes)
+        {
+            pPool = columnPool(pColumns, pColumn);
+            pPool->pOffset[iRow] = pPool->nByte;
+            pPool->pOffset[iRow + 1u] = pPool->nByte;
+            continue;
+        }
+
+        memset(*columnValues(pColumns, pColumn) +
+                    (size_t)iRow * pColumn->nValueBytes,
+                0, pColumn->nValueBytes);
+        if(0 != pColumn->oPresent)
+        {
+            pPresent = *columnPresent(pColumns, pColumn);
+            pPresent[iRow >> 3u] &= (llrp_u8_t)~(1u << (iRow & 7u));
+        }
+    }
+
+    pColumns->nRow++;
+
+    return TRUE;
+}
+
+/*
+ * Double the rows every array has room for. An array that
+ * did grow keeps its new size even if a later one fails.
+ */
+static llrp_bool_t
+growRows (
+  LLRP_tSColumnsHdr *           pColumns)
+{
+    const LLRP_tSColumnSet *    pColumnSet = pColumns->pColumnSet;
+    const LLRP_tSColumnDescriptor *pColumn;
+    LLRP_tSColumnPool *         pPool;
+    llrp_u8_t **                ppArray;
+    unsigned int                nRowMax;
+    unsigned int                iColumn;
+    void *                      pNew;
+
+    nRowMax = 2u * pColumns->nRowMax;
+    if(LLRP_COLUMNS_FIRST_ROWS > nRowMax)
+    {
+        nRowMax = LLRP_COLUMNS_FIRST_ROWS;
+    }
+
+    for(iColumn = 0; iColumn < pColumnSet->nColumn; iColumn++)
+    {
+        pColumn = &pColumnSet->pColumns[iColumn];
+        if(0 == pColumn->nValueBytes)
+        {
+            pPool = columnPool(pColumns, pColumn);
+            pNew = realloc(pPool->pOffset,
+                        ((size_t)nRowMax + 1u) * sizeof *pPool->pOffset);
+            if(NULL == pNew)
+            {
+                return FALSE;
+            }
+            pPool->pOffset = pNew;
+            continue;
+        }
+
+        ppArray = columnValues(pColumns, pColumn);
+        pNew = realloc(*ppArray, (size_t)nRowMax * pColumn->nValueBytes);
+        if(NULL == pNew)
+        {
+            return FALSE;
+        }
+        *ppArray = pNew;
+
+        if(0 != pColumn->oPresent)
+        {
+            ppArray = columnPresent(pColumns, pColumn);
+            pNew = realloc(*ppArray, (nRowMax + 7u) / 8u);
+            if(NULL == pNew)
+            {
+                return FALSE;
+            }
+            *ppArray = pNew;
+        }
+    }
+
+    pColumns->nRowMax = nRowMax;
+
+    return TRUE;
+}
+
+/*
+ * Make nByte bytes row iRow's, the last row, in place of
+ * any it had
+ */
+static llrp_bool_t
+setPoolBytes (
+  LLRP_tSColumnPool *           pPool,
+  unsigned int                  iRow,
+  const llrp_u8_t *             pBytes,
+  unsigned int                  nByte)
+{
+    unsigned int                iByte = pPool->pOffset[iRow];
+    unsigned int                nByteMax;
+    void *                      pNew;
+
+    if(iByte + nByte > pPool->nByteMax)
+    {
+        nByteMax = 2u * pPool->nByteMax;
+        if(LLRP_COLUMNS_FIRST_BYTES > nByteMax)
+        {
+            nByteMax = LLRP_COLUMNS_FIRST_BYTES;
+        }
+        while(iByte + nByte > nByteMax)
+        {
+            nByteMax *= 2u;
+        }
+
+        pNew = realloc(pPool->pBytes, nByteMax);
+        if(NULL == pNew)
+        {
+            return FALSE;
+        }
+        pPool->pBytes = pNew;
+        pPool->nByteMax = nByteMax;
+    }
+
+    if(0 != nByte)
+    {
+        memcpy(pPool->pBytes + iByte, pBytes, nByte);
+    }
+    pPool->nByte = iByte + nByte;
+    pPool->pOffset[iRow + 1u] = pPool->nByte;
+
+    return TRUE;
+}
+
+static llrp_bool_t
+hasColumn (
+  const LLRP_tSColumnSet *      pColumnSet,
+  const LLRP_tSTypeDescriptor * pType)
+{
+    unsigned int                iColumn;
+
+    for(iColumn = 0; iColumn < pColumnSet->nColumn; iColumn++)
+    {
+        if(pColumnSet->pColumns[iColumn].pType == pType)
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+static llrp_u8_t **
+columnValues (
+  LLRP_tSColumnsHdr *           pColumns,
+  const LLRP_tSColumnDescriptor *pColumn)
+{
+    return (llrp_u8_t **)((char *)pColumns + pColumn->oValues);
+}
+
+static llrp_u8_t **
+columnPresent (
+  LLRP_tSColumnsHdr *           pColumns,
+  const LLRP_tSColumnDescriptor *pColumn)
+{
+    return (llrp_u8_t **)((char *)pColumns + pColumn->oPresent);
+}
+
+static LLRP_tSColumnPool *
+columnPool (
+  LLRP_tSColumnsHdr *           pColumns,
+  const LLRP_tSColumnDescriptor *pColumn)
+{
+    return (LLRP_tSColumnPool *)((char *)pColumns + pColumn->oValues);
+}
@@ -43,6 +43,7 @@
 #include <errno.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <arpa/inet.h>
@@ -50,6 +51,7 @@
 #include <netdb.h>
 #include <fcntl.h>
 #include <time.h>
+#include <limits.h>
 
 #include "ltkc_platform.h"
 #include "ltkc_base.h"
@@ -59,17 +61,221 @@
 
 #define LLRP1_TCP_PORT   (5084u)
 
+/* Most queued frames gathered into one non-blocking send */
+#define LLRP_SEND_MAX_IOV   (64)
 
-/* forward declaration of private routine. */
+/* ErrorAck, the reply to a request that cannot be carried out */
+#define LLRP_ERROR_ACK_TYPENUM  (305u)
+
+
+/* forward declaration of private routines. */
 static LLRP_tResultCode
 recvAdvance (
   LLRP_tSConnection *           pConn,
-  int                           nMaxMS,
-  time_t                        timeLimit);
+  llrp_u64_t                    Deadline);
+
+static void
+compactRecvBuffer (
+  LLRP_tSConnection *           pConn);
+
+static llrp_u64_t
+getMonotonicMS (void);
+
+static LLRP_tResultCode
+prepareRecvBuffer (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  nNeed);
+
+static llrp_bool_t
+growSendBuffer (
+  LLRP_tSConnection *           pConn);
+
+static void
+shrinkRecvBuffer (
+  LLRP_tSConnection *           pConn,
+  llrp_u64_t                    NowMS);
+
+static void
+shrinkSendBuffer (
+  LLRP_tSConnection *           pConn,
+  llrp_u64_t                    NowMS);
+
+static llrp_bool_t
+resizeBuffer (
+  unsigned char **              ppBuffer,
+  unsigned int *                pnAlloc,
+  unsigned int                  nKeep,
+  unsigned int                  nNewAlloc);
+
+static int
+recvRead (
+  LLRP_tSConnection *           pConn,
+  llrp_bool_t                   bBlock);
+
+static void
+detachIO (
+  LLRP_tSConnection *           pConn);
+
+static int
+posixAttach (
+  LLRP_tSConnection *           pConn);
+
+static void
+posixDetach (
+  LLRP_tSConnection *           pConn);
+
+static int
+posixWait (
+  LLRP_tSConnection *           pConn,
+  int                           nMS);
+
+static int
+posixRead (
+  LLRP_tSConnection *           pConn,
+  unsigned char *               pBuf,
+  unsigned int                  nBuf,
+  llrp_bool_t                   bBlock);
+
+static int
+posixWrite (
+  LLRP_tSConnection *           pConn,
+  const unsigned char *         pBuf,
+  unsigned int                  nBuf);
+
+static int
+posixFlush (
+  LLRP_tSConnection *           pConn);
+
+static int
+posixGetPollFd (
+  LLRP_tSConnection *           pConn);
+
+static void
+recvDecodeFrame (
+  LLRP_tSConnection *           pConn);
+
+static void
+enqueueInputMessage (
+  LLRP_tSConnection *           pConn,
+  LLRP_tSMessage *              pMessage);
+
+static void
+unlinkInputMessage (
+  LLRP_tSConnection *           pConn,
+  LLRP_tSMessage *              pMessage);
+
+static LLRP_tSMessage *
+findQueuedResponse (
+  LLRP_tSConnection *           pConn,
+  const LLRP_tSTypeDescriptor * pResponseType,
+  const LLRP_tSTypeDescriptor * pErrorMsgType,
+  llrp_u32_t                    ResponseMessageID,
+  LLRP_tSMessage *              pScanAfter);
+
+static void
+growInputIndex (
+  LLRP_tSConnection *           pConn);
+
+static LLRP_tSMessage **
+indexBucket (
+  LLRP_tSConnection *           pConn,
+  llrp_u32_t                    MessageID,
+  LLRP_tSMessage ***            pppTail);
+
+static LLRP_tResultCode
+sendFrameNonBlocking (
+  LLRP_tSConnection *           pConn,
+  const unsigned char *         pFrame,
+  unsigned int                  nFrame);
+
+static int
+sendNoWait (
+  LLRP_tSConnection *           pConn,
+  struct iovec *                pIov,
+  int                           nIov);
+
+static LLRP_tResultCode
+enqueueSendFrame (
+  LLRP_tSConnection *           pConn,
+  const unsigned char *         pFrame,
+  unsigned int                  nFrame);
+
+static void
+discardSendQueue (
+  LLRP_tSConnection *           pConn);
+
+static const LLRP_tSTypeDescriptor *
+lookupErrorAckType (
+  LLRP_tSConnection *           pConn);
+
+static llrp_u32_t
+nextTransactMessageID (
+  LLRP_tSConnection *           pConn);
+
+static llrp_bool_t
+finishTransactByResponse (
+  LLRP_tSConnection *           pConn,
+  LLRP_tSMessage *              pMessage);
+
+static void
+finishTransactByFrameError (
+  LLRP_tSConnection *           pConn,
+  llrp_u32_t                    MessageID,
+  const LLRP_tSErrorDetails *   pError);
+
+static void
+finishTransact (
+  LLRP_tSConnection *           pConn,
+  LLRP_tSTransact *             pTransact,
+  LLRP_tResultCode              eResultCode,
+  const char *                  pWhatStr,
+  LLRP_tSMessage *              pResponse);
+
+static void
+unlinkPendingTransact (
+  LLRP_tSConnection *           pConn,
+  LLRP_tSTransact *             pTransact);
+
+static void
+unlinkDoneTransact (
+  LLRP_tSConnection *           pConn,
+  LLRP_tSTransact *             pTransact);
+
+static void
+finishAllTransacts (
+  LLRP_tSConnection *           pConn,
+  LLRP_tResultCode              eResultCode,
+  const char *                  pWhatStr);
+
+static void
+expireTransacts (
+  LLRP_tSConnection *           pConn);
+
+static llrp_u64_t
+earliestTransactDeadline (
+  LLRP_tSConnection *           pConn);
+
+static void
+deliverTransacts (
+  LLRP_tSConnection *           pConn);
 
-static time_t
-calculateTimeLimit (
-  int                           nMaxMS);
+
+
+
+/*
+ * The default I/O backend, plain system calls on the fd
+ */
+const LLRP_tSConnIO             LLRP_ConnIO_POSIX =
+{
+    "posix",
+    posixAttach,
+    posixDetach,
+    posixWait,
+    posixRead,
+    posixWrite,
+    posixFlush,
+    posixGetPollFd,
+};
 
 
 
@@ -81,9 +287,12 @@ calculateTimeLimit (
  ** @param[in]  pTypeRegistry   The LLRP registry of known message/parameter
  **                             types. Includes standard and custom.
  **                             Used during decode.
- ** @param[in]  nBufferSize     Size of each the receive and send buffers.
- **                             Use size larger than the largest frame
- **                             you expect. 0 selects a default value.
+ ** @param[in]  nBufferSize     Initial size of each the receive and
+ **                             send buffers. Use a size larger than
+ **                             most frames you expect. Bigger ones
+ **                             grow the buffer, up to 16MB unless
+ **                             LLRP_Conn_setBufferLimits() says
+ **                             otherwise. 0 selects a default value.
  **
  ** @return     !=NULL          Pointer to connection instance
  **             ==NULL          Error, always an allocation failure
@@ -132,14 +341,19 @@ LLRP_Conn_construct (
      * is no connection yet.
      */
     pConn->fd = -1;
+    pConn->pIO = &LLRP_ConnIO_POSIX;
     pConn->pTypeRegistry = pTypeRegistry;
     pConn->nBufferSize = nBufferSize;
+    pConn->nMaxBufferSize = 16u*1024u*1024u;
+    pConn->nIdleShrinkMS = 10000u;
 
     /*
      * Allocate and check each the recv and send buffers.
      */
     pConn->Recv.pBuffer = malloc(nBufferSize);
     pConn->Send.pBuffer = malloc(nBufferSize);
+    pConn->Recv.nAlloc = nBufferSize;
+    pConn->Send.nAlloc = nBufferSize;
 
     if(NULL == pConn->Recv.pBuffer || NULL == pConn->Send.pBuffer)
     {
@@ -153,6 +367,13 @@ LLRP_Conn_construct (
     memset(pConn->Recv.pBuffer, 0, nBufferSize);
     memset(pConn->Send.pBuffer, 0, nBufferSize);
 
+    /*
+     * The decoder and encoder live in the connection. Each
+     * frame only re-points them, nothing is allocated.
+     */
+    LLRP_FrameDecoder_init(&pConn->Recv.Decoder, pTypeRegistry, NULL, 0);
+    LLRP_FrameEncoder_init(&pConn->Send.Encoder, NULL, 0);
+
     /*
      * Victory
      */
@@ -182,6 +403,14 @@ LLRP_Conn_destruct (
          */
         LLRP_Conn_closeConnectionToReader(pConn);
 
+        /*
+         * Finish any transaction still pending and make the
+         * callbacks, so the application can release its contexts.
+         */
+        finishAllTransacts(pConn, LLRP_RC_TransactCancelled,
+            "connection destructed");
+        deliverTransacts(pConn);
+
         /*
          * Destruct any message in the input queue
          */
@@ -195,6 +424,23 @@ LLRP_Conn_destruct (
             LLRP_Element_destruct((LLRP_tSElement *)pMessage);
         }
 
+        /*
+         * Free the input queue index
+         */
+        if(NULL != pConn->InputIndex.apHead)
+        {
+            free(pConn->InputIndex.apHead);
+        }
+        if(NULL != pConn->InputIndex.apTail)
+        {
+            free(pConn->InputIndex.apTail);
+        }
+
+        /*
+         * Discard any frames still waiting to be sent
+         */
+        discardSendQueue(pConn);
+
         /*
          * free each the receive and send bufers
          */
@@ -434,7 +680,7 @@ LLRP_Conn_startServerForUpper (
      * (no reason it shouldn't) we do not declare defeat.
      */
     Flag = 1;
-    setsockopt(Sock, IPPROTO_TCP, TCP_NODELAY, (void*)&Flag, sizeof Flag);
+    setsockopt(pConn->fd, IPPROTO_TCP, TCP_NODELAY, (void*)&Flag, sizeof Flag);
 
 	KeepAlive = 1;
 	setsockopt(pConn->fd, SOL_SOCKET, SO_KEEPALIVE, (void *)&KeepAlive, sizeof(KeepAlive));
@@ -474,6 +720,106 @@ LLRP_Conn_getConnectError (
     return pConn->pConnectErrorStr;
 }
 
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Choose the I/O backend of an open connection
+ **
+ ** Do this right after the connection is opened, before any traffic,
+ ** and before adding it to a LLRP_tSConnGroup or LLRP_tSProxy. Those
+ ** watch LLRP_Conn_getPollFd(), which the backend decides. Closing
+ ** the connection goes back to LLRP_ConnIO_POSIX, and until then
+ ** the backend can't be changed again.
+ **
+ ** A backend other than LLRP_ConnIO_POSIX already sends without
+ ** waiting, so it does not go with LLRP_Conn_setSendNonBlocking().
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  pIO             The backend, e.g. &LLRP_ConnIO_IOURING
+ **
+ ** @return     ==0             Backend in use
+ **             !=0             Error, check getConnectError() for reason.
+ **                             The connection keeps the backend it had.
+ **
+ *****************************************************************************/
+
+int
+LLRP_Conn_setIO (
+  LLRP_tSConnection *           pConn,
+  const LLRP_tSConnIO *         pIO)
+{
+    if(0 > pConn->fd)
+    {
+        pConn->pConnectErrorStr = "not connected";
+        return -1;
+    }
+
+    if(pIO == pConn->pIO)
+    {
+        return 0;
+    }
+
+    /*
+     * A backend may hold bytes it has read but not handed over,
+     * so it stays until the connection is closed.
+     */
+    if(&LLRP_ConnIO_POSIX != pConn->pIO)
+    {
+        pConn->pConnectErrorStr = "backend already chosen";
+        return -1;
+    }
+
+    if(pConn->Send.bNonBlocking)
+    {
+        pConn->pConnectErrorStr = "backend can't do non-blocking send mode";
+        return -1;
+    }
+
+    /*
+     * Bytes already read ahead stay in the receive buffer
+     * and are decoded first, whatever the backend.
+     */
+    pConn->pIO = pIO;
+    pConn->pIOContext = NULL;
+    if(0 != (*pIO->pfAttach)(pConn))
+    {
+        pConn->pIO = &LLRP_ConnIO_POSIX;
+        pConn->pIOContext = NULL;
+        pConn->pConnectErrorStr = "backend attach failed";
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Get the fd an event loop should watch for input
+ **
+ ** With LLRP_ConnIO_POSIX it is the socket. Other backends may
+ ** have one of their own.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return                     The fd, <0 if not connected
+ **
+ *****************************************************************************/
+
+int
+LLRP_Conn_getPollFd (
+  LLRP_tSConnection *           pConn)
+{
+    if(0 > pConn->fd)
+    {
+        return -1;
+    }
+
+    return (*pConn->pIO->pfGetPollFd)(pConn);
+}
+
 /**
  *****************************************************************************
  **
@@ -496,12 +842,32 @@ LLRP_Conn_closeConnectionToUpper (
         return -1;
     }
 
+    /*
+     * Whatever the backend has yet to send goes first.
+     */
+    detachIO(pConn);
+
     shutdown(pConn->fd, SHUT_RDWR);
 
     close(pConn->fd);
 
     pConn->fd = -1;
 
+    /*
+     * Drop anything read ahead or not yet sent.
+     * It belongs to the old stream.
+     */
+    pConn->Recv.nBuffer = 0;
+    pConn->Recv.iNext = 0;
+    pConn->Recv.bFrameValid = FALSE;
+    discardSendQueue(pConn);
+
+    /*
+     * No response to a pending transaction can come now.
+     */
+    finishAllTransacts(pConn, LLRP_RC_TransactCancelled,
+        "connection closed");
+
     return 0;
 }
 
@@ -527,16 +893,143 @@ LLRP_Conn_closeConnectionToReader (
         return -1;
     }
 
+    /*
+     * Whatever the backend has yet to send goes first.
+     */
+    detachIO(pConn);
+
     shutdown(pConn->fd, SHUT_RDWR);
 
     close(pConn->fd);
 
     pConn->fd = -1;
 
+    /*
+     * Drop anything read ahead or not yet sent.
+     * It belongs to the old stream.
+     */
+    pConn->Recv.nBuffer = 0;
+    pConn->Recv.iNext = 0;
+    pConn->Recv.bFrameValid = FALSE;
+    discardSendQueue(pConn);
+
+    /*
+     * No response to a pending transaction can come now.
+     */
+    finishAllTransacts(pConn, LLRP_RC_TransactCancelled,
+        "connection closed");
+
     return 0;
 }
 
 
+/**
+ *****************************************************************************
+ **
+ ** @brief  Set how far the buffers may grow and when they shrink
+ **
+ ** The send and receive buffers start at the nBufferSize given to
+ ** LLRP_Conn_construct(). A frame that does not fit grows its buffer,
+ ** doubling, up to nMaxBufferSize. A receive frame bigger than that
+ ** is LLRP_RC_RecvBufferOverflow, a send frame is an encoder overrun.
+ **
+ ** A grown buffer goes back to nBufferSize once nIdleShrinkMS pass
+ ** without a frame that needs more. That is checked as frames come
+ ** and go, and by LLRP_Conn_shrinkIdleBuffers().
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  nMaxBufferSize  Most each buffer may grow to. Less than
+ **                             nBufferSize means no growth at all.
+ **                             0 selects the default, 16MB.
+ ** @param[in]  nIdleShrinkMS   How long a grown buffer is kept after
+ **                             the last frame that needed it
+ **
+ ** @return     LLRP_RC_OK          Limits set
+ **             LLRP_RC_MiscError   A buffer already holds more
+ **                                 than nMaxBufferSize
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+LLRP_Conn_setBufferLimits (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  nMaxBufferSize,
+  unsigned int                  nIdleShrinkMS)
+{
+    LLRP_tSErrorDetails *       pError = &pConn->Recv.ErrorDetails;
+
+    LLRP_Error_clear(pError);
+
+    if(0 == nMaxBufferSize)
+    {
+        nMaxBufferSize = 16u*1024u*1024u;
+    }
+    if(pConn->nBufferSize > nMaxBufferSize)
+    {
+        nMaxBufferSize = pConn->nBufferSize;
+    }
+
+    /*
+     * A buffer grown past the new limit goes back now, if
+     * what it holds fits.
+     */
+    pConn->nMaxBufferSize = nMaxBufferSize;
+    pConn->nIdleShrinkMS = nIdleShrinkMS;
+    if(pConn->Recv.nAlloc > nMaxBufferSize)
+    {
+        shrinkRecvBuffer(pConn, ~(llrp_u64_t)0);
+    }
+    if(pConn->Send.nAlloc > nMaxBufferSize)
+    {
+        shrinkSendBuffer(pConn, ~(llrp_u64_t)0);
+    }
+    if(pConn->Recv.nAlloc > nMaxBufferSize ||
+       pConn->Send.nAlloc > nMaxBufferSize)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "buffer holds more than limit");
+    }
+
+    return pError->eResultCode;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Give back buffer space not needed for a while
+ **
+ ** Buffers that grew for a big frame and have gone the idle time,
+ ** see LLRP_Conn_setBufferLimits(), without another go back to
+ ** nBufferSize. A receive buffer holding part of a big frame is
+ ** left alone.
+ **
+ ** A connection that goes quiet after a big frame never gets to
+ ** check this for itself. An application with many connections
+ ** calls this on each from time to time.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Conn_shrinkIdleBuffers (
+  LLRP_tSConnection *           pConn)
+{
+    llrp_u64_t                  NowMS;
+
+    if(pConn->Recv.nAlloc > pConn->nBufferSize ||
+       pConn->Send.nAlloc > pConn->nBufferSize)
+    {
+        NowMS = getMonotonicMS();
+        shrinkRecvBuffer(pConn, NowMS);
+        shrinkSendBuffer(pConn, NowMS);
+    }
+}
+
+
 /**
  *****************************************************************************
  **
@@ -546,7 +1039,7 @@ LLRP_Conn_closeConnectionToReader (
  ** LLRP_Conn_recvResponse(). The MessageID is taken from
  ** the outgoing messages. It's best to not use MessageID 0.
  ** The expected response type is also taken from the outgoing
- ** message. ERROR_MESSAGE is also deemed a response;
+ ** message. ErrorAck is also deemed a response;
  **
  ** @param[in]  pConn           Pointer to the connection instance.
  ** @param[in]  pSendMessage    Pointer to the LLRP message to send.
@@ -648,665 +1141,556 @@ LLRP_Conn_getTransactError (
 /**
  *****************************************************************************
  **
- ** @brief  Send a LLRP message to a connection
+ ** @brief  Submit a LLRP request without awaiting the response
+ **
+ ** The request is sent, as by LLRP_Conn_sendMessage(), and a
+ ** transaction returned at once. Many requests can be submitted
+ ** back-to-back so a sequence of them costs one round trip
+ ** rather than one each.
+ **
+ ** If the MessageID of the request is 0 one is assigned that no
+ ** other pending transaction is using.
+ **
+ ** The transaction finishes when a message with its MessageID,
+ ** of pResponseType or ErrorAck, is decoded by any of the receive
+ ** routines. It also finishes when nMaxMS passes (noticed by
+ ** LLRP_Conn_transactPoll()), when it is cancelled, and when the
+ ** connection is closed.
  **
  ** @param[in]  pConn           Pointer to the connection instance.
- ** @param[in]  pMessage        Pointer to the LLRP message to send.
+ ** @param[in]  pSendMessage    Pointer to the LLRP message to send.
+ ** @param[in]  pResponseType   The type descriptor of the response.
+ **                             NULL => the one the request type
+ **                             names, if any, else any message with
+ **                             the MessageID.
+ ** @param[in]  nMaxMS          -1 => no timeout
+ **                             >=0 => ms to await the response,
+ **                                   from now
+ ** @param[in]  pfDone          Called from LLRP_Conn_transactPoll()
+ **                             once the transaction finishes. NULL
+ **                             to use LLRP_Transact_isDone() instead.
+ ** @param[in]  pAppContext     Passed to pfDone
  **
- ** @return     LLRP_RC_OK          Frame sent
- **             LLRP_RC_SendIOError I/O error in write().
- **                                 Probably means fd is bad.
- **             LLRP_RC_...         Encoder error.
- **                                 Check LLRP_Conn_getSendError() for why.
+ ** @return     ==NULL          Something failed. Use
+ **                             LLRP_Conn_getSendError() for why.
+ **             !=NULL          The pending transaction
  **
  *****************************************************************************/
 
-LLRP_tResultCode
-LLRP_Conn_sendMessage (
+LLRP_tSTransact *
+LLRP_Conn_transactSubmit (
   LLRP_tSConnection *           pConn,
-  LLRP_tSMessage *              pMessage)
+  LLRP_tSMessage *              pSendMessage,
+  const LLRP_tSTypeDescriptor * pResponseType,
+  int                           nMaxMS,
+  void                          (*pfDone)(
+                                  LLRP_tSTransact *     pTransact,
+                                  void *                pAppContext),
+  void *                        pAppContext)
 {
-    LLRP_tSErrorDetails *       pError = &pConn->Send.ErrorDetails;
-    LLRP_tSFrameEncoder *       pEncoder;
+    LLRP_tSTransact *           pTransact;
+    LLRP_tResultCode            lrc;
 
     /*
-     * Clear the error details in the send state.
+     * Default the response type from the request type.
      */
-    LLRP_Error_clear(pError);
+    if(NULL == pResponseType)
+    {
+        pResponseType = pSendMessage->elementHdr.pType->pResponseType;
+    }
 
     /*
-     * Make sure the socket is open.
+     * The MessageID is what matches the response to
+     * the request. Make sure there is a usable one.
      */
-    if(0 > pConn->fd)
+    if(0 == pSendMessage->MessageID)
     {
-        LLRP_Error_resultCodeAndWhatStr(pError,
-            LLRP_RC_MiscError, "not connected");
-        return pError->eResultCode;
+        LLRP_Message_setMessageID(pSendMessage,
+            nextTransactMessageID(pConn));
     }
 
     /*
-     * Construct a frame encoder. It needs to know the buffer
-     * base and maximum size.
-     */
-
-    pEncoder = LLRP_FrameEncoder_construct(pConn->Send.pBuffer,
-                                                pConn->nBufferSize);
-
-    /*
-     * Check that the encoder actually got created.
+     * Allocate, check, and zero-fill the transaction.
      */
-    if(NULL == pEncoder)
+    pTransact = malloc(sizeof *pTransact);
+    if(NULL == pTransact)
     {
+        LLRP_tSErrorDetails *   pError = &pConn->Send.ErrorDetails;
+
+        LLRP_Error_clear(pError);
         LLRP_Error_resultCodeAndWhatStr(pError,
-            LLRP_RC_MiscError, "encoder constructor failed");
-        return pError->eResultCode;
+            LLRP_RC_MiscError, "transaction allocation failed");
+        return NULL;
     }
+    memset(pTransact, 0, sizeof *pTransact);
 
-    /*
-     * Encode the message. Return value is ignored.
-     * We check the encoder's ErrorDetails for results.
-     * The &...encoderHdr is in lieu of type casting since
-     * the generic LLRP_Encoder_encodeElement() takes the
-     * generic LLRP_tSEncoder.
-     */
-    LLRP_Encoder_encodeElement(&pEncoder->encoderHdr, &pMessage->elementHdr);
-
-    /*
-     * Regardless of what happened capture the error details
-     * and the number of bytes placed in the buffer.
-     */
-    pConn->Send.ErrorDetails = pEncoder->encoderHdr.ErrorDetails;
-    pConn->Send.nBuffer = pEncoder->iNext;
+    pTransact->MessageID = pSendMessage->MessageID;
+    pTransact->pResponseType = pResponseType;
+    pTransact->pErrorAckType = lookupErrorAckType(pConn);
+    pTransact->Deadline = LLRP_Conn_calculateDeadline(nMaxMS);
+    pTransact->pfDone = pfDone;
+    pTransact->pAppContext = pAppContext;
 
     /*
-     * Bye bye li'l encoder.
+     * Send the request
      */
-    LLRP_Encoder_destruct(&pEncoder->encoderHdr);
+    lrc = LLRP_Conn_sendMessage(pConn, pSendMessage);
+    if(LLRP_RC_OK != lrc)
+    {
+        free(pTransact);
+        return NULL;
+    }
 
     /*
-     * If the encoding appears complete write the frame
-     * to the connection. NB: this is not ready for
-     * non-blocking I/O (EWOULDBLOCK).
+     * Append it to the pending list.
      */
-    if(LLRP_RC_OK == pError->eResultCode)
+    pTransact->pConn = pConn;
+    pTransact->pPrev = pConn->Transact.pPendingTail;
+    if(NULL == pConn->Transact.pPendingTail)
     {
-        int             rc;
-
-        rc = write(pConn->fd, pConn->Send.pBuffer, pConn->Send.nBuffer);
-        if(rc != pConn->Send.nBuffer)
-        {
-            /* Yikes! */
-            LLRP_Error_resultCodeAndWhatStr(pError,
-                LLRP_RC_SendIOError, "send IO error");
-        }
+        pConn->Transact.pPendingHead = pTransact;
     }
+    else
+    {
+        pConn->Transact.pPendingTail->pNext = pTransact;
+    }
+    pConn->Transact.pPendingTail = pTransact;
+    pConn->Transact.nPending++;
 
-    /*
-     * Done.
-     */
-    return pError->eResultCode;
+    return pTransact;
 }
 
 
 /**
  *****************************************************************************
  **
- ** @brief  Get the details that explains LLRP_Conn_sendMessage() error
- **
- ** @param[in]  pConn           Pointer to the connection instance.
+ ** @brief  Advance asynchronous transactions
  **
- ** @return                     Pointer to const error details
+ ** Receives, subject to nMaxMS, until at least one transaction
+ ** finishes. Transactions past their deadline finish with
+ ** LLRP_RC_RecvTimeout. Then the callbacks of finished
+ ** transactions are made, oldest first.
  **
- *****************************************************************************/
-
-extern const LLRP_tSErrorDetails *
-LLRP_Conn_getSendError (
-  LLRP_tSConnection *           pConn)
-{
-    return &pConn->Send.ErrorDetails;
-}
-
-
-/**
- *****************************************************************************
+ ** Messages that are not responses go on the input queue, as
+ ** usual, for LLRP_Conn_recvMessage() or LLRP_Conn_recvQueued().
  **
- ** @brief  Receive a message from a connection
+ ** For a connection in a LLRP_tSConnGroup, call this with
+ ** nMaxMS 0 after each group event to get timeouts and callbacks.
  **
- ** The message could have already arrived and be pending
- ** on the input queue.
+ ** A callback may submit or cancel transactions. It must not
+ ** call LLRP_Conn_transactPoll() or destruct the connection.
  **
  ** @param[in]  pConn           Pointer to the connection instance.
  ** @param[in]  nMaxMS          -1 => block indefinitely
- **                              0 => just peek at input queue and
- **                                   socket queue, return immediately
- **                                   no matter what
- **                             >0 => ms to await complete frame
+ **                              0 => just peek at socket queue,
+ **                                   return immediately
+ **                             >0 => ms to await a finish
  **
- ** @return     ==NULL          No message available per parameters.
- **                             Check LLRP_Conn_getRecvErrot() for why
- **             !=NULL          Input message
+ ** @return     LLRP_RC_OK          At least one transaction finished,
+ **                                 or none is pending
+ **             LLRP_RC_RecvTimeout None finished within nMaxMS
+ **             LLRP_RC_RecvEOF, LLRP_RC_RecvIOError,
+ **             LLRP_RC_RecvFramingError, LLRP_RC_RecvBufferOverflow
+ **                                 The stream failed. Every pending
+ **                                 transaction finished with this error.
  **
  *****************************************************************************/
 
-LLRP_tSMessage *
-LLRP_Conn_recvMessage (
+LLRP_tResultCode
+LLRP_Conn_transactPoll (
   LLRP_tSConnection *           pConn,
   int                           nMaxMS)
 {
-    time_t                      timeLimit = calculateTimeLimit(nMaxMS);
-    LLRP_tResultCode            lrc;
-    LLRP_tSMessage *            pMessage;
+    llrp_u64_t                  Deadline;
+    unsigned int                nFinished;
+    LLRP_tResultCode            lrc = LLRP_RC_OK;
 
     /*
-     * Make sure the socket is open.
+     * Fix the deadline now, before anything takes time.
      */
-    if(0 > pConn->fd)
-    {
-        LLRP_tSErrorDetails *   pError = &pConn->Recv.ErrorDetails;
-
-        LLRP_Error_resultCodeAndWhatStr(pError,
-            LLRP_RC_MiscError, "not connected");
-        return NULL;
-    }
+    Deadline = LLRP_Conn_calculateDeadline(nMaxMS);
+    nFinished = pConn->Transact.nFinished;
 
-    /*
-     * Loop until victory or some sort of exception happens
-     */
     for(;;)
     {
+        llrp_u64_t              WaitDeadline;
+
         /*
-         * Check the input queue to see if there is already
-         * a message pending.
+         * Finish whatever is overdue. Stop as soon as
+         * something has finished.
          */
-        pMessage = pConn->pInputQueue;
-        if(NULL != pMessage)
+        expireTransacts(pConn);
+        if(nFinished != pConn->Transact.nFinished ||
+           0 == pConn->Transact.nPending)
         {
-            pConn->pInputQueue = pMessage->pQueueNext;
-            return pMessage;
+            lrc = LLRP_RC_OK;
+            break;
         }
 
         /*
-         * No message available. Advance the receiver state
-         * and see if a message is produced.
+         * Wait no longer than the earliest pending deadline
+         * so it is noticed on time.
          */
-        lrc = recvAdvance(pConn, nMaxMS, timeLimit);
-        if(lrc != LLRP_RC_OK)
+        WaitDeadline = earliestTransactDeadline(pConn);
+        if(0 == WaitDeadline || (0 != Deadline && Deadline < WaitDeadline))
         {
-            return NULL;
+            WaitDeadline = Deadline;
+        }
+
+        lrc = recvAdvance(pConn, WaitDeadline);
+
+        if(LLRP_RC_RecvTimeout == lrc)
+        {
+            if(WaitDeadline == Deadline)
+            {
+                /* Our own time is up. Last look for the overdue. */
+                expireTransacts(pConn);
+                break;
+            }
+            /* A transaction's time is up. Loop to expire it. */
+            continue;
+        }
+
+        if(LLRP_RC_RecvEOF == lrc ||
+           LLRP_RC_RecvIOError == lrc ||
+           LLRP_RC_RecvFramingError == lrc ||
+           LLRP_RC_RecvBufferOverflow == lrc)
+        {
+            /*
+             * No response is ever coming.
+             */
+            finishAllTransacts(pConn, lrc, pConn->Recv.ErrorDetails.pWhatStr);
+            break;
         }
+
+        /*
+         * A message, or a frame that failed to decode and was
+         * dropped. Either way, carry on.
+         */
+    }
+
+    deliverTransacts(pConn);
+
+    if(nFinished != pConn->Transact.nFinished)
+    {
+        lrc = LLRP_RC_OK;
     }
+
+    return lrc;
 }
 
 
 /**
  *****************************************************************************
  **
- ** @brief  Get the details that explains LLRP_Conn_recvMessage()
- **         or LLRP_Conn_recvResponse() error
+ ** @brief  Get the count of transactions awaiting a response
  **
  ** @param[in]  pConn           Pointer to the connection instance.
  **
- ** @return                     Pointer to const error details
+ ** @return     Count of pending transactions
  **
  *****************************************************************************/
 
-const LLRP_tSErrorDetails *
-LLRP_Conn_getRecvError (
+unsigned int
+LLRP_Conn_getTransactPendingCount (
   LLRP_tSConnection *           pConn)
 {
-    return &pConn->Recv.ErrorDetails;
+    return pConn->Transact.nPending;
 }
 
 
 /**
  *****************************************************************************
  **
- ** @brief  Receive a specific message from a connection
+ ** @brief  Cancel a pending transaction
  **
- ** The message is identified by type and message ID.
+ ** It finishes with LLRP_RC_TransactCancelled. A callback is
+ ** made from the next LLRP_Conn_transactPoll(). If the response
+ ** arrives later it goes on the input queue like any other
+ ** message. Cancelling a finished transaction does nothing.
  **
- ** This is used to receive a response to a request, but
- ** could be used for other things, too. A message matches
- ** and is returned if the type matches AND if the message
- ** ID matches. Either or both can be wildcards.
+ ** @param[in]  pTransact       From LLRP_Conn_transactSubmit()
  **
- ** The sought message could have already arrived and be pending
- ** on the input queue. While we are looking for the response
- ** notifications might arrive. They are held in the input
- ** queue while we continue to look for the sought message.
+ ** @return     void
  **
- ** About timeLimit....
- ** The timeLimit is the last time() we'll try to receive
- ** the sought message and prevents "spinning".
- ** It is conceivable that a steady stream of messages
- ** other than the one sought could arrive, and the time
- ** between those messages could be smaller the nMaxMS.
- ** When that happens, recvAdvance() would not time out
- ** during its poll/select. It could "spin". The time out
- ** must be detected by other means and that's the
- ** purpose of timeLimit.
+ *****************************************************************************/
+
+void
+LLRP_Transact_cancel (
+  LLRP_tSTransact *             pTransact)
+{
+    if(!pTransact->bDone)
+    {
+        finishTransact(pTransact->pConn, pTransact,
+            LLRP_RC_TransactCancelled, "cancelled", NULL);
+    }
+}
+
+
+/**
+ *****************************************************************************
  **
- ** @param[in]  pConn           Pointer to the connection instance.
- ** @param[in]  nMaxMS          -1 => block indefinitely
- **                              0 => just peek at input queue and
- **                                   socket queue, return immediately
- **                                   no matter what
- **                             >0 => ms to await complete frame
- ** @param[in]  pResponseType   The type descriptor of the sought
- **                             or NULL to match all messages.
- **                             If not NULL, ERROR_MESSAGE will
- **                             also match.
- ** @param[in]  ResponseMessageID The MessageID of sought message
- **                             or 0 to match all messages.
+ ** @brief  See if a transaction has finished
  **
- ** @return     ==NULL          No message available per parameters.
- **                             Check LLRP_Conn_getRecvErrot() for why
- **             !=NULL          Input message
+ ** Only meaningful for a transaction without a callback.
+ ** A timeout is noticed only by LLRP_Conn_transactPoll().
+ **
+ ** @param[in]  pTransact       From LLRP_Conn_transactSubmit()
+ **
+ ** @return     TRUE            Finished, LLRP_Transact_getError() says how
+ **             FALSE           Still pending
  **
  *****************************************************************************/
 
-LLRP_tSMessage *
-LLRP_Conn_recvResponse (
-  LLRP_tSConnection *           pConn,
-  int                           nMaxMS,
-  const LLRP_tSTypeDescriptor * pResponseType,
-  llrp_u32_t                    ResponseMessageID)
+llrp_bool_t
+LLRP_Transact_isDone (
+  LLRP_tSTransact *             pTransact)
 {
-    time_t                      timeLimit = calculateTimeLimit(nMaxMS);
-    const LLRP_tSTypeDescriptor *pErrorMsgType;
-    LLRP_tResultCode            lrc;
-    LLRP_tSMessage *            pMessage;
-    LLRP_tSMessage **           ppMessage;
-
-    /*
-     * Make sure the socket is open.
-     */
-    if(0 > pConn->fd)
-    {
-        LLRP_tSErrorDetails *   pError = &pConn->Recv.ErrorDetails;
+    return pTransact->bDone;
+}
 
-        LLRP_Error_resultCodeAndWhatStr(pError,
-            LLRP_RC_MiscError, "not connected");
-        return NULL;
-    }
 
-    /*
-     * Look up the ERROR_MESSAGE type descriptor now.
-     */
-    pErrorMsgType = LLRP_TypeRegistry_lookupMessage(
-                    pConn->pTypeRegistry, 100u);
+/**
+ *****************************************************************************
+ **
+ ** @brief  Get the details of how a transaction finished
+ **
+ ** @param[in]  pTransact       From LLRP_Conn_transactSubmit()
+ **
+ ** @return                     Pointer to const error details.
+ **                             LLRP_RC_OK means there is a response.
+ **
+ *****************************************************************************/
 
-    /*
-     * Loop until victory or some sort of exception happens
-     */
-    for(;;)
-    {
-        /*
-         * Check the input queue to see if the sought
-         * message is present.
-         */
-        for(
-            ppMessage = &pConn->pInputQueue;
-            NULL != (pMessage = *ppMessage);
-            ppMessage = &pMessage->pQueueNext)
-        {
-            /*
-             * Are we looking for a particular message type?
-             */
-            if(NULL != pResponseType)
-            {
-                /*
-                 * See if it is the sought response type or
-                 * an ERROR_MESSAGE.
-                 */
-                if(pMessage->elementHdr.pType != pResponseType &&
-                   pMessage->elementHdr.pType != pErrorMsgType)
-                {
-                    /* Type does not match. Keep looking. */
-                    continue;
-                }
-            }
+const LLRP_tSErrorDetails *
+LLRP_Transact_getError (
+  LLRP_tSTransact *             pTransact)
+{
+    return &pTransact->ErrorDetails;
+}
 
-            /*
-             * Are we looking for a particular message ID?
-             */
-            if(0 != ResponseMessageID)
-            {
-                if(pMessage->MessageID != ResponseMessageID)
-                {
-                    /* Message ID does not match. Keep looking. */
-                    continue;
-                }
-            }
 
-            /* Found it */
-            break;
-        }
+/**
+ *****************************************************************************
+ **
+ ** @brief  Take the response from a finished transaction
+ **
+ ** The response becomes the caller's to destruct. In a callback
+ ** this must be used to keep the response, otherwise it is
+ ** destructed with the transaction.
+ **
+ ** @param[in]  pTransact       From LLRP_Conn_transactSubmit()
+ **
+ ** @return     ==NULL          No response (yet), or already taken
+ **             !=NULL          Response message, maybe an ErrorAck
+ **
+ *****************************************************************************/
 
-        /*
-         * If we found it unlink it from the queue and return it.
-         */
-        if(NULL != pMessage)
-        {
-            *ppMessage = pMessage->pQueueNext;
-            pMessage->pQueueNext = NULL;
-            return pMessage;
-        }
+LLRP_tSMessage *
+LLRP_Transact_takeResponse (
+  LLRP_tSTransact *             pTransact)
+{
+    LLRP_tSMessage *            pMessage;
 
-        /*
-         * Sought message is not in the queue. Advance the
-         * receiver state and see if the message is produced.
-         */
-        lrc = recvAdvance(pConn, nMaxMS, timeLimit);
-        if(lrc != LLRP_RC_OK)
-        {
-            return NULL;
-        }
+    pMessage = pTransact->pResponse;
+    pTransact->pResponse = NULL;
 
-        /*
-         * Loop to the top and try again.
-         */
-    }
+    return pMessage;
 }
 
 
 /**
  *****************************************************************************
  **
- ** @brief  Internal routine to advance receiver
+ ** @brief  Destruct a transaction
  **
- ** @param[in]  pConn           Pointer to the connection instance.
- ** @param[in]  nMaxMS          -1 => block indefinitely
- **                              0 => just peek at input queue and
- **                                   socket queue, return immediately
- **                                   no matter what
- **                             >0 => ms to await complete frame
+ ** For transactions without a callback. If still pending it is
+ ** withdrawn, silently. A response not taken is destructed too.
  **
- ** @return     LLRP_RC_OK          Frame received
- **             LLRP_RC_RecvEOF     End-of-file condition on fd
- **             LLRP_RC_RecvIOError I/O error in poll() or read().
+ ** A transaction with a callback is destructed by the library
+ ** once the callback returns. Until the callback is made, even
+ ** if it has finished (say by LLRP_Transact_cancel()), it may be
+ ** destructed by the application to withdraw it without one.
+ ** It must not be from its own callback.
+ **
+ ** @param[in]  pTransact       From LLRP_Conn_transactSubmit()
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Transact_destruct (
+  LLRP_tSTransact *             pTransact)
+{
+    if(NULL == pTransact)
+    {
+        return;
+    }
+
+    if(!pTransact->bDone)
+    {
+        unlinkPendingTransact(pTransact->pConn, pTransact);
+    }
+    else if(NULL != pTransact->pConn)
+    {
+        /*
+         * Finished with a callback not yet made. Take it
+         * off the done list so deliverTransacts() won't.
+         */
+        unlinkDoneTransact(pTransact->pConn, pTransact);
+    }
+
+    if(NULL != pTransact->pResponse)
+    {
+        LLRP_Element_destruct(&pTransact->pResponse->elementHdr);
+    }
+
+    free(pTransact);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Send a LLRP message to a connection
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  pMessage        Pointer to the LLRP message to send.
+ **
+ ** In non-blocking mode (LLRP_Conn_setSendNonBlocking()) the frame
+ ** is written as far as the socket will take it right now and the
+ ** rest is queued for LLRP_Conn_sendFlush().
+ **
+ ** @return     LLRP_RC_OK          Frame sent, or in non-blocking mode
+ **                                 sent or queued
+ **             LLRP_RC_SendIOError I/O error in write().
  **                                 Probably means fd is bad.
- **             LLRP_RC_RecvFramingError
- **                                 LLRP_FrameExtract() detected an
- **                                 impossible situation. Recovery unlikely.
- **             LLRP_RC_RecvTimeout Frame didn't complete within allowed time
- **             LLRP_RC_RecvBufferOverflow
- **                                 LLRP_FrameExtract() detected an inbound
- **                                 message that would overflow the receive
- **                                 buffer.
- **             LLRP_RC_...         Decoder error.
+ **             LLRP_RC_SendQueueFull
+ **                                 Non-blocking mode only. The queue
+ **                                 is at its limit. Nothing was sent.
+ **             LLRP_RC_...         Encoder error.
+ **                                 Check LLRP_Conn_getSendError() for why.
  **
  *****************************************************************************/
 
-static LLRP_tResultCode
-recvAdvance (
+LLRP_tResultCode
+LLRP_Conn_sendMessage (
   LLRP_tSConnection *           pConn,
-  int                           nMaxMS,
-  time_t                        timeLimit)
+  LLRP_tSMessage *              pMessage)
 {
-    LLRP_tSErrorDetails *       pError = &pConn->Recv.ErrorDetails;
+    LLRP_tSErrorDetails *       pError = &pConn->Send.ErrorDetails;
+    LLRP_tSFrameEncoder *       pEncoder;
 
     /*
-     * Clear the error details in the receiver state.
+     * Clear the error details in the send state.
      */
     LLRP_Error_clear(pError);
 
     /*
-     * Loop until victory or some sort of exception happens
+     * Make sure the socket is open.
      */
-    for(;;)
+    if(0 > pConn->fd)
     {
-        int                     rc;
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "not connected");
+        return pError->eResultCode;
+    }
 
+    /*
+     * Encode into the send buffer. If the frame does not fit,
+     * grow the buffer and encode again. Doubling keeps the
+     * retries few, and they happen only until the buffer
+     * is big enough for the traffic.
+     */
+    for(;;)
+    {
         /*
-         * Note that the frame is in progress.
-         * Existing buffer content, if any, is deemed
-         * invalid or incomplete.
+         * Point the connection's frame encoder at the buffer.
+         * It needs to know the buffer base and maximum size.
          */
-        pConn->Recv.bFrameValid = FALSE;
+        pEncoder = &pConn->Send.Encoder;
+        LLRP_FrameEncoder_reset(pEncoder, pConn->Send.pBuffer,
+                                                    pConn->Send.nAlloc);
 
         /*
-         * Check to see if we have a frame in the buffer.
-         * If not, how many more bytes do we need?
-         *
-         * LLRP_FrameExtract() status
-         *
-         * LLRP_FRAME_ERROR     Impossible situation, like message
-         *                      length too small or the like.
-         *                      Recovery in this situation is
-         *                      unlikely and probably the app
-         *                      should drop the connection.
-         *
-         * LLRP_FRAME_READY     Frame is complete. Details are
-         *                      available for pre-decode decisions.
-         *
-         * LLRP_FRAME_NEED_MORE Need more input bytes to finish the frame.
-         *                      The nBytesNeeded field is how many more.
+         * Encode the message. Return value is ignored.
+         * We check the encoder's ErrorDetails for results.
+         * The &...encoderHdr is in lieu of type casting since
+         * the generic LLRP_Encoder_encodeElement() takes the
+         * generic LLRP_tSEncoder.
          */
-        pConn->Recv.FrameExtract =
-            LLRP_FrameExtract(pConn->Recv.pBuffer, pConn->Recv.nBuffer);
+        LLRP_Encoder_encodeElement(&pEncoder->encoderHdr,
+                                                &pMessage->elementHdr);
 
         /*
-         * Framing error?
+         * Regardless of what happened capture the error details
+         * and the number of bytes placed in the buffer.
          */
-        if(LLRP_FRAME_ERROR == pConn->Recv.FrameExtract.eStatus)
-        {
-            LLRP_Error_resultCodeAndWhatStr(pError,
-                LLRP_RC_RecvFramingError, "framing error in message stream");
-            break;
-        }
+        pConn->Send.ErrorDetails = pEncoder->encoderHdr.ErrorDetails;
+        pConn->Send.nBuffer = pEncoder->iNext;
 
         /*
-         * Need more bytes? extractRc>0 means we do and extractRc is the
-         * number of bytes immediately required.
+         * Running out of buffer is an overrun of a field
+         * or of reserved bits.
          */
-        if(LLRP_FRAME_NEED_MORE == pConn->Recv.FrameExtract.eStatus)
+        if((LLRP_RC_FieldOverrun != pError->eResultCode &&
+            LLRP_RC_ReservedBitsOverrun != pError->eResultCode) ||
+           !growSendBuffer(pConn))
         {
-            unsigned int        nRead = pConn->Recv.FrameExtract.nBytesNeeded;
-            unsigned char *     pBufPos =
-                                  &pConn->Recv.pBuffer[pConn->Recv.nBuffer];
-
-            /*
-             * Before we do anything that might block,
-             * check to see if the time limit is exceeded.
-             */
-            if(0 != timeLimit)
-            {
-                if(time(NULL) > timeLimit)
-                {
-                    /* Timeout */
-                    LLRP_Error_resultCodeAndWhatStr(pError,
-                        LLRP_RC_RecvTimeout, "timeout");
-                    break;
-                }
-            }
-
-            /*
-             * The frame extractor needs more data, make sure the
-             * frame size fits in the receive buffer.
-             */
-            if(pConn->Recv.nBuffer + nRead > pConn->nBufferSize)
-            {
-                /* Buffer overflow */
-                LLRP_Error_resultCodeAndWhatStr(pError,
-                    LLRP_RC_RecvBufferOverflow, "buffer overflow");
-                break;
-            }
-
-            /*
-             * If this is not a block indefinitely request use poll()
-             * to see if there is data in time.
-             */
-            if(nMaxMS >= 0)
-            {
-                struct pollfd           pfd;
-
-                pfd.fd = pConn->fd;
-                pfd.events = POLLIN | POLLERR | POLLHUP | POLLNVAL;
-                pfd.revents = 0;
-
-                rc = poll(&pfd, 1, nMaxMS);
-                if(0 > rc)
-                {
-                    /* Error */
-                    LLRP_Error_resultCodeAndWhatStr(pError,
-                        LLRP_RC_RecvIOError, "poll failed");
-                    break;
-                }
-                if(0 == rc)
-                {
-                    /* Timeout */
-                    LLRP_Error_resultCodeAndWhatStr(pError,
-                        LLRP_RC_RecvTimeout, "timeout");
-                    break;
-                }
-            }
-
-            /*
-             * Read some number of bytes from the socket.
-             */
-            rc = read(pConn->fd, pBufPos, nRead);
-
-            if(0 > rc)
-            {
-                /*
-                 * Error. Note this could be EWOULDBLOCK if the
-                 * file descriptor is using non-blocking I/O.
-                 * So we return the error but do not tear-up
-                 * the receiver state.
-                 */
-                LLRP_Error_resultCodeAndWhatStr(pError,
-                    LLRP_RC_RecvIOError, "recv IO error");
-                break;
-            }
-
-            if(0 == rc)
-            {
-                /* EOF */
-                LLRP_Error_resultCodeAndWhatStr(pError,
-                    LLRP_RC_RecvEOF, "recv end-of-file");
-                break;
-            }
+            break;
+        }
+    }
 
-            /*
-             * When we get here, rc>0 meaning some bytes were read.
-             * Update the number of bytes present.
-             * Then loop to the top and retry the FrameExtract().
-             */
-            pConn->Recv.nBuffer += rc;
+    /*
+     * Note a big frame, or give back space not
+     * needed for a while.
+     */
+    if(pConn->Send.nAlloc > pConn->nBufferSize)
+    {
+        llrp_u64_t              NowMS = getMonotonicMS();
 
-            continue;
+        if(pConn->Send.nBuffer > pConn->nBufferSize)
+        {
+            pConn->Send.LastLargeMS = NowMS;
         }
-
-        /*
-         * Is the frame ready?
-         * If a valid frame is present, decode and enqueue it.
-         */
-        if(LLRP_FRAME_READY == pConn->Recv.FrameExtract.eStatus)
+        else
         {
-            /*
-             * Frame appears complete. Time to try to decode it.
-             */
-            LLRP_tSFrameDecoder *   pDecoder;
-            LLRP_tSMessage *        pMessage;
-            LLRP_tSMessage **       ppMessageTail;
-
-            /*
-             * Construct a new frame decoder. It needs the registry
-             * to facilitate decoding.
-             */
-            pDecoder = LLRP_FrameDecoder_construct(pConn->pTypeRegistry,
-                    pConn->Recv.pBuffer, pConn->Recv.nBuffer);
-
-            /*
-             * Make sure we really got one. If not, weird problem.
-             */
-            if(pDecoder == NULL)
-            {
-                /* All we can do is discard the frame. */
-                pConn->Recv.nBuffer = 0;
-                pConn->Recv.bFrameValid = FALSE;
-                LLRP_Error_resultCodeAndWhatStr(pError,
-                    LLRP_RC_MiscError, "decoder constructor failed");
-                break;
-            }
-
-            /*
-             * Now ask the nice, brand new decoder to decode the frame.
-             * It returns NULL for some kind of error.
-             * The &...decoderHdr is in lieu of type casting since
-             * the generic LLRP_Decoder_decodeMessage() takes the
-             * generic LLRP_tSDecoder.
-             */
-            pMessage = LLRP_Decoder_decodeMessage(&pDecoder->decoderHdr);
-
-            /*
-             * Always capture the error details even when it works.
-             * Whatever happened, we are done with the decoder.
-             */
-            pConn->Recv.ErrorDetails = pDecoder->decoderHdr.ErrorDetails;
-
-            /*
-             * Bye bye and thank you li'l decoder.
-             */
-            LLRP_Decoder_destruct(&pDecoder->decoderHdr);
-
-            /*
-             * If NULL there was an error. Clean up the
-             * receive state. Return the error.
-             */
-            if(NULL == pMessage)
-            {
-                /*
-                 * Make sure the return is not LLRP_RC_OK
-                 */
-                if(LLRP_RC_OK == pError->eResultCode)
-                {
-                    LLRP_Error_resultCodeAndWhatStr(pError,
-                        LLRP_RC_MiscError, "NULL message but no error");
-                }
-
-                /*
-                 * All we can do is discard the frame.
-                 */
-                pConn->Recv.nBuffer = 0;
-                pConn->Recv.bFrameValid = FALSE;
-
-                break;
-            }
-
-            /*
-             * Yay! It worked. Enqueue the message.
-             */
-            ppMessageTail = &pConn->pInputQueue;
-            while(NULL != *ppMessageTail)
-            {
-                ppMessageTail = &(*ppMessageTail)->pQueueNext;
-            }
+            shrinkSendBuffer(pConn, NowMS);
+        }
+    }
 
-            pMessage->pQueueNext = NULL;
-            *ppMessageTail = pMessage;
+    /*
+     * In non-blocking mode the frame goes out through
+     * the send queue.
+     */
+    if(LLRP_RC_OK == pError->eResultCode && pConn->Send.bNonBlocking)
+    {
+        return sendFrameNonBlocking(pConn,
+                    pConn->Send.pBuffer, pConn->Send.nBuffer);
+    }
 
-            /*
-             * Note that the frame is valid. Consult
-             * Recv.FrameExtract.MessageLength.
-             * Clear the buffer count to be ready for next time.
-             */
-            pConn->Recv.bFrameValid = TRUE;
-            pConn->Recv.nBuffer = 0;
+    /*
+     * If the encoding appears complete write the frame
+     * to the connection.
+     */
+    if(LLRP_RC_OK == pError->eResultCode)
+    {
+        int             rc;
 
-            break;
+        rc = (*pConn->pIO->pfWrite)(pConn,
+                pConn->Send.pBuffer, pConn->Send.nBuffer);
+        if(rc != pConn->Send.nBuffer)
+        {
+            /* Yikes! */
+            LLRP_Error_resultCodeAndWhatStr(pError,
+                LLRP_RC_SendIOError, "send IO error");
         }
-
-        /*
-         * If we get here there was an FrameExtract status
-         * we didn't expect.
-         */
-
-        /*NOTREACHED*/
-        assert(0);
     }
 
+    /*
+     * Done.
+     */
     return pError->eResultCode;
 }
 
@@ -1314,62 +1698,2672 @@ recvAdvance (
 /**
  *****************************************************************************
  **
- ** @brief  Internal routine to calculate time limit
+ ** @brief  Send already encoded LLRP frames to a connection
  **
- ** Based on nMaxMS, the subscriber specified max time to
- ** await receipt of a (specific) message, determine the
- ** last time() to try.
+ ** The bytes go out as they are, no encode. This is for relaying
+ ** frames received on another connection. They must be one or more
+ ** whole frames so the stream stays framed.
  **
- ** The timeLimit prevents "spinning".
- ** See LLRP_Conn_recvResponse() above.
+ ** In non-blocking mode (LLRP_Conn_setSendNonBlocking()) the bytes
+ ** are written as far as the socket will take them right now and the
+ ** rest is queued for LLRP_Conn_sendFlush().
  **
- ** @param[in]  nMaxMS          -1 => block indefinitely
- **                              0 => just peek at input queue and
- **                                   socket queue, return immediately
- **                                   no matter what
- **                             >0 => ms to await complete frame
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  pFrame          The frame bytes
+ ** @param[in]  nFrame          Count of bytes
  **
- ** @return     timeLimit        0 => never stop
- **                             >0 => latest time() to try
+ ** @return     LLRP_RC_OK          Sent, or in non-blocking mode
+ **                                 sent or queued
+ **             LLRP_RC_SendIOError I/O error in write().
+ **             LLRP_RC_SendQueueFull
+ **                                 Non-blocking mode only. The queue
+ **                                 is at its limit. Nothing was sent.
  **
  *****************************************************************************/
 
-static time_t
-calculateTimeLimit (
-  int                           nMaxMS)
-{
-    if(0 == nMaxMS)
+LLRP_tResultCode
+LLRP_Conn_sendFrame (
+  LLRP_tSConnection *           pConn,
+  const unsigned char *         pFrame,
+  unsigned int                  nFrame)
+{
+    LLRP_tSErrorDetails *       pError = &pConn->Send.ErrorDetails;
+
+    LLRP_Error_clear(pError);
+
+    /*
+     * Make sure the socket is open.
+     */
+    if(0 > pConn->fd)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "not connected");
+        return pError->eResultCode;
+    }
+
+    if(pConn->Send.bNonBlocking)
+    {
+        return sendFrameNonBlocking(pConn, pFrame, nFrame);
+    }
+
+    /*
+     * Blocking. Batches of relayed frames can be large. The
+     * backend writes until all of it is gone.
+     */
+    if((int)nFrame != (*pConn->pIO->pfWrite)(pConn, pFrame, nFrame))
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_SendIOError, "send IO error");
+    }
+
+    return pError->eResultCode;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Get the details that explains LLRP_Conn_sendMessage() error
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return                     Pointer to const error details
+ **
+ *****************************************************************************/
+
+extern const LLRP_tSErrorDetails *
+LLRP_Conn_getSendError (
+  LLRP_tSConnection *           pConn)
+{
+    return &pConn->Send.ErrorDetails;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Select blocking or non-blocking send
+ **
+ ** In non-blocking mode LLRP_Conn_sendMessage() never waits on the
+ ** socket. Whatever the socket does not take right away is copied
+ ** to a queue. The queue is written by LLRP_Conn_sendFlush(), using
+ ** writev()-style batching of all the queued frames. Use
+ ** LLRP_Conn_setSendWatch() to hear when the queue is non-empty,
+ ** then call LLRP_Conn_sendFlush() when the fd is writable.
+ ** LLRP_tSConnGroup does this itself for its members.
+ **
+ ** The fd is not switched to O_NONBLOCK. Writes use MSG_DONTWAIT,
+ ** so receive is unaffected. That requires a socket; for other kinds
+ ** of fd the application must set O_NONBLOCK itself.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  bNonBlocking    TRUE for non-blocking, FALSE for the
+ **                             original blocking write()
+ ** @param[in]  nMaxQueueBytes  Most bytes to hold in the queue.
+ **                             0 selects a default of four times
+ **                             the buffer size.
+ **
+ ** @return     LLRP_RC_OK          Mode set
+ **             LLRP_RC_MiscError   Can not go back to blocking with
+ **                                 frames still queued
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+LLRP_Conn_setSendNonBlocking (
+  LLRP_tSConnection *           pConn,
+  llrp_bool_t                   bNonBlocking,
+  unsigned int                  nMaxQueueBytes)
+{
+    LLRP_tSErrorDetails *       pError = &pConn->Send.ErrorDetails;
+
+    LLRP_Error_clear(pError);
+
+    if(!bNonBlocking && NULL != pConn->Send.pQueueHead)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "send queue not empty");
+        return pError->eResultCode;
+    }
+
+    if(bNonBlocking && &LLRP_ConnIO_POSIX != pConn->pIO)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "backend sends without waiting already");
+        return pError->eResultCode;
+    }
+
+    if(0 == nMaxQueueBytes)
+    {
+        nMaxQueueBytes = 4u * pConn->nBufferSize;
+    }
+
+    pConn->Send.bNonBlocking = bNonBlocking;
+    pConn->Send.nMaxQueueBytes = nMaxQueueBytes;
+
+    return pError->eResultCode;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Set the function to call when the send queue fills or drains
+ **
+ ** pfWatch is called with bWantWrite TRUE when a frame is queued
+ ** and the queue was empty, and with FALSE when the queue empties.
+ ** An event loop uses it to add and remove its interest in the fd
+ ** being writable.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  pfWatch         The function, or NULL for none
+ ** @param[in]  pWatchArg       Passed to pfWatch
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Conn_setSendWatch (
+  LLRP_tSConnection *           pConn,
+  void                          (*pfWatch)(
+                                  LLRP_tSConnection *   pConn,
+                                  llrp_bool_t           bWantWrite,
+                                  void *                pWatchArg),
+  void *                        pWatchArg)
+{
+    pConn->Send.pfWatch = pfWatch;
+    pConn->Send.pWatchArg = pWatchArg;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Write as much of the send queue as the socket will take
+ **
+ ** Never blocks. Up to LLRP_SEND_MAX_IOV queued frames go out per
+ ** system call. Returns once the queue is empty or the socket
+ ** is full.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return     LLRP_RC_OK          Queue written, or socket full.
+ **                                 LLRP_Conn_getSendQueueBytes()
+ **                                 tells which.
+ **             LLRP_RC_SendIOError I/O error. The queue is discarded.
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+LLRP_Conn_sendFlush (
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSErrorDetails *       pError = &pConn->Send.ErrorDetails;
+
+    LLRP_Error_clear(pError);
+
+    while(NULL != pConn->Send.pQueueHead)
+    {
+        struct iovec            aIov[LLRP_SEND_MAX_IOV];
+        LLRP_tSSendFrame *      pFrame;
+        unsigned int            nWant = 0;
+        unsigned int            nDone;
+        int                     nIov = 0;
+        int                     rc;
+
+        /*
+         * Gather the queued frames. Only the first can
+         * be partly written already.
+         */
+        for(
+            pFrame = pConn->Send.pQueueHead;
+            NULL != pFrame && LLRP_SEND_MAX_IOV > nIov;
+            pFrame = pFrame->pNext)
+        {
+            aIov[nIov].iov_base = &pFrame->pFrame[pFrame->iNext];
+            aIov[nIov].iov_len = pFrame->nFrame - pFrame->iNext;
+            nWant += aIov[nIov].iov_len;
+            nIov++;
+        }
+
+        rc = sendNoWait(pConn, aIov, nIov);
+        if(0 > rc)
+        {
+            if(EWOULDBLOCK == errno || EAGAIN == errno)
+            {
+                /* Socket is full. Try again when writable. */
+                break;
+            }
+
+            LLRP_Error_resultCodeAndWhatStr(pError,
+                LLRP_RC_SendIOError, "send IO error");
+            discardSendQueue(pConn);
+            break;
+        }
+
+        /*
+         * Retire what was written. Whole frames are freed,
+         * a partly written frame keeps its place.
+         */
+        pConn->Send.nQueueBytes -= rc;
+        nDone = rc;
+        while(0 < nDone)
+        {
+            unsigned int        nLeft;
+
+            pFrame = pConn->Send.pQueueHead;
+            nLeft = pFrame->nFrame - pFrame->iNext;
+            if(nDone < nLeft)
+            {
+                pFrame->iNext += nDone;
+                break;
+            }
+
+            nDone -= nLeft;
+            pConn->Send.pQueueHead = pFrame->pNext;
+            free(pFrame);
+        }
+
+        if(NULL == pConn->Send.pQueueHead)
+        {
+            pConn->Send.pQueueTail = NULL;
+            if(NULL != pConn->Send.pfWatch)
+            {
+                (*pConn->Send.pfWatch)(pConn, FALSE, pConn->Send.pWatchArg);
+            }
+        }
+
+        /*
+         * A short write means the socket is full.
+         * Trying again now would just get EWOULDBLOCK.
+         */
+        if((unsigned int)rc < nWant)
+        {
+            break;
+        }
+    }
+
+    return pError->eResultCode;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Get the number of bytes waiting in the send queue
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return                     Count of bytes queued, not yet written
+ **
+ *****************************************************************************/
+
+unsigned int
+LLRP_Conn_getSendQueueBytes (
+  LLRP_tSConnection *           pConn)
+{
+    return pConn->Send.nQueueBytes;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Receive a message from a connection
+ **
+ ** The message could have already arrived and be pending
+ ** on the input queue.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  nMaxMS          -1 => block indefinitely
+ **                              0 => just peek at input queue and
+ **                                   socket queue, return immediately
+ **                                   no matter what
+ **                             >0 => ms to await complete frame
+ **
+ ** @return     ==NULL          No message available per parameters.
+ **                             Check LLRP_Conn_getRecvErrot() for why
+ **             !=NULL          Input message
+ **
+ *****************************************************************************/
+
+LLRP_tSMessage *
+LLRP_Conn_recvMessage (
+  LLRP_tSConnection *           pConn,
+  int                           nMaxMS)
+{
+    llrp_u64_t                  Deadline;
+    LLRP_tResultCode            lrc;
+    LLRP_tSMessage *            pMessage;
+
+    /*
+     * Fix the deadline now, before anything takes time.
+     */
+    Deadline = LLRP_Conn_calculateDeadline(nMaxMS);
+
+    /*
+     * Make sure the socket is open.
+     */
+    if(0 > pConn->fd)
+    {
+        LLRP_tSErrorDetails *   pError = &pConn->Recv.ErrorDetails;
+
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "not connected");
+        return NULL;
+    }
+
+    /*
+     * Loop until victory or some sort of exception happens
+     */
+    for(;;)
+    {
+        /*
+         * Check the input queue to see if there is already
+         * a message pending.
+         */
+        pMessage = LLRP_Conn_recvQueued(pConn);
+        if(NULL != pMessage)
+        {
+            return pMessage;
+        }
+
+        /*
+         * No message available. Advance the receiver state
+         * and see if a message is produced.
+         */
+        lrc = recvAdvance(pConn, Deadline);
+        if(lrc != LLRP_RC_OK)
+        {
+            return NULL;
+        }
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Take the oldest message from the input queue
+ **
+ ** No I/O is done. This is for event-driven use, for example by
+ ** LLRP_tSConnGroup, after LLRP_Conn_recvDecodeBuffered().
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return     ==NULL          The input queue is empty
+ **             !=NULL          Input message
+ **
+ *****************************************************************************/
+
+LLRP_tSMessage *
+LLRP_Conn_recvQueued (
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSMessage *            pMessage;
+
+    pMessage = pConn->pInputQueue;
+    if(NULL != pMessage)
+    {
+        unlinkInputMessage(pConn, pMessage);
+    }
+
+    return pMessage;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Get the details that explains LLRP_Conn_recvMessage()
+ **         or LLRP_Conn_recvResponse() error
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return                     Pointer to const error details
+ **
+ *****************************************************************************/
+
+const LLRP_tSErrorDetails *
+LLRP_Conn_getRecvError (
+  LLRP_tSConnection *           pConn)
+{
+    return &pConn->Recv.ErrorDetails;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Receive a specific message from a connection
+ **
+ ** The message is identified by type and message ID.
+ **
+ ** This is used to receive a response to a request, but
+ ** could be used for other things, too. A message matches
+ ** and is returned if the type matches AND if the message
+ ** ID matches. Either or both can be wildcards.
+ **
+ ** The sought message could have already arrived and be pending
+ ** on the input queue. While we are looking for the response
+ ** notifications might arrive. They are held in the input
+ ** queue while we continue to look for the sought message.
+ **
+ ** About the deadline....
+ ** The deadline is the CLOCK_MONOTONIC millisecond after which
+ ** we stop trying to receive the sought message. It prevents
+ ** "spinning". It is conceivable that a steady stream of messages
+ ** other than the one sought could arrive, and the time
+ ** between those messages could be smaller the nMaxMS.
+ ** Were each poll() given the whole nMaxMS, recvAdvance() would
+ ** never time out. Instead every poll() waits only for the time
+ ** remaining, and no I/O is started once the deadline passes.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  nMaxMS          -1 => block indefinitely
+ **                              0 => just peek at input queue and
+ **                                   socket queue, return immediately
+ **                                   no matter what
+ **                             >0 => ms to await complete frame
+ ** @param[in]  pResponseType   The type descriptor of the sought
+ **                             or NULL to match all messages.
+ **                             If not NULL, ErrorAck will
+ **                             also match.
+ ** @param[in]  ResponseMessageID The MessageID of sought message
+ **                             or 0 to match all messages.
+ **
+ ** @return     ==NULL          No message available per parameters.
+ **                             Check LLRP_Conn_getRecvErrot() for why
+ **             !=NULL          Input message
+ **
+ *****************************************************************************/
+
+LLRP_tSMessage *
+LLRP_Conn_recvResponse (
+  LLRP_tSConnection *           pConn,
+  int                           nMaxMS,
+  const LLRP_tSTypeDescriptor * pResponseType,
+  llrp_u32_t                    ResponseMessageID)
+{
+    llrp_u64_t                  Deadline;
+    const LLRP_tSTypeDescriptor *pErrorMsgType;
+    LLRP_tResultCode            lrc;
+    LLRP_tSMessage *            pMessage;
+    LLRP_tSMessage *            pScanFrom = NULL;
+
+    /*
+     * Fix the deadline now, before anything takes time.
+     */
+    Deadline = LLRP_Conn_calculateDeadline(nMaxMS);
+
+    /*
+     * Make sure the socket is open.
+     */
+    if(0 > pConn->fd)
+    {
+        LLRP_tSErrorDetails *   pError = &pConn->Recv.ErrorDetails;
+
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "not connected");
+        return NULL;
+    }
+
+    /*
+     * Look up the ErrorAck type descriptor now.
+     */
+    pErrorMsgType = lookupErrorAckType(pConn);
+
+    /*
+     * Loop until victory or some sort of exception happens
+     */
+    for(;;)
+    {
+        /*
+         * Check the input queue to see if the sought
+         * message is present. With a MessageID the index
+         * goes straight to it. Without one, the queue is
+         * scanned, but only the part not scanned before.
+         */
+        pMessage = findQueuedResponse(pConn, pResponseType,
+                        pErrorMsgType, ResponseMessageID, pScanFrom);
+
+        /*
+         * If we found it unlink it from the queue and return it.
+         */
+        if(NULL != pMessage)
+        {
+            unlinkInputMessage(pConn, pMessage);
+            return pMessage;
+        }
+
+        /*
+         * Whatever arrives next is appended after the
+         * current tail. That is where the next scan starts.
+         */
+        pScanFrom = pConn->pInputQueueTail;
+
+        /*
+         * Sought message is not in the queue. Advance the
+         * receiver state and see if the message is produced.
+         */
+        lrc = recvAdvance(pConn, Deadline);
+        if(lrc != LLRP_RC_OK)
+        {
+            return NULL;
+        }
+
+        /*
+         * Loop to the top and try again.
+         */
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Set the hook called with each frame before it is decoded
+ **
+ ** The hook gets the frame header, already extracted, and the
+ ** whole frame. It runs for every frame whichever receive routine
+ ** (or connection group) reads it. Returning LLRP_PREDECODE_SKIP
+ ** drops the frame without building an element tree, so frames that
+ ** only need counting or forwarding cost no decode. The frame bytes
+ ** are only valid during the call.
+ **
+ ** A skipped frame never reaches the input queue, nor does it
+ ** finish an asynchronous transaction.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  pfPreDecode     The hook, NULL to decode everything
+ ** @param[in]  pPreDecodeArg   Passed to pfPreDecode
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Conn_setPreDecodeHook (
+  LLRP_tSConnection *           pConn,
+  LLRP_tEPreDecodeAction        (*pfPreDecode)(
+                                  LLRP_tSConnection *   pConn,
+                                  const LLRP_tSFrameExtract *
+                                                        pFrameExtract,
+                                  const unsigned char * pFrame,
+                                  unsigned int          nFrame,
+                                  void *                pPreDecodeArg),
+  void *                        pPreDecodeArg)
+{
+    pConn->Recv.pfPreDecode = pfPreDecode;
+    pConn->Recv.pPreDecodeArg = pPreDecodeArg;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Choose whether messages are decoded into arenas
+ **
+ ** With an arena each received message, with all its parameters
+ ** and vectors, takes one allocation instead of one per element.
+ ** Destructing the message frees it all at once.
+ **
+ ** The parameters of such a message live and die with it. One
+ ** can't be taken out and kept after the message is destructed.
+ ** Anything added to the message, or set on one of its
+ ** parameters, is freed the usual way.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  bDecodeArena    TRUE to use arenas, FALSE (the default)
+ **                             to allocate each element on its own
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Conn_setDecodeArena (
+  LLRP_tSConnection *           pConn,
+  llrp_bool_t                   bDecodeArena)
+{
+    pConn->Recv.bDecodeArena = bDecodeArena;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Choose whether byte vectors are copied out of the frame
+ **
+ ** The u8v, s8v, u1v, utf8v and bytesToEnd fields of a received
+ ** message, EPCs and TIDs and vendor blobs mostly, can point
+ ** straight at their bytes in the frame instead of each being
+ ** copied out. The receive buffer is reused for the next frame,
+ ** so the message keeps one copy of its whole frame, in an arena.
+ ** This implies LLRP_Conn_setDecodeArena() for these messages,
+ ** with the same rules.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  bDecodeZeroCopy TRUE to point into the frame, FALSE
+ **                             (the default) to copy each vector
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Conn_setDecodeZeroCopy (
+  LLRP_tSConnection *           pConn,
+  llrp_bool_t                   bDecodeZeroCopy)
+{
+    pConn->Recv.bDecodeZeroCopy = bDecodeZeroCopy;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Choose whether sub-parameters are decoded when first read
+ **
+ ** Only the framing of a received message's sub-parameters is
+ ** checked as it is received; each is decoded when its accessor is
+ ** first called, so a report read for a few of its tags costs little
+ ** more than those tags. The message keeps one copy of its frame,
+ ** in an arena. This implies LLRP_Conn_setDecodeArena() for these
+ ** messages, with the same rules.
+ **
+ ** A sub-parameter that fails to decode is left empty and the error
+ ** kept, see LLRP_Message_materializeAll(). Such a message changes
+ ** as it is read, so only one thread may read it at a time.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  bDecodeLazy     TRUE to decode when read, FALSE (the
+ **                             default) to decode all on receipt
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Conn_setDecodeLazy (
+  LLRP_tSConnection *           pConn,
+  llrp_bool_t                   bDecodeLazy)
+{
+    pConn->Recv.bDecodeLazy = bDecodeLazy;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Calculate the deadline for a timeout
+ **
+ ** Based on nMaxMS, the subscriber specified max time to
+ ** await receipt of a (specific) message, determine the
+ ** last CLOCK_MONOTONIC millisecond to try. The monotonic clock
+ ** is not disturbed by changes to the time of day.
+ **
+ ** When just peeking (nMaxMS 0) the deadline is now. I/O already
+ ** started in the current millisecond carries on, so anything
+ ** the socket holds is taken, but nothing waits.
+ **
+ ** @param[in]  nMaxMS          -1 => block indefinitely
+ **                              0 => just peek at input queue and
+ **                                   socket queue, return immediately
+ **                                   no matter what
+ **                             >0 => ms to await complete frame
+ **
+ ** @return     Deadline         0 => never stop
+ **                             >0 => last monotonic ms to try
+ **
+ *****************************************************************************/
+
+llrp_u64_t
+LLRP_Conn_calculateDeadline (
+  int                           nMaxMS)
+{
+    if(0 > nMaxMS)
+    {
+        /* Try indefinitely */
+        return 0;
+    }
+
+    return getMonotonicMS() + (unsigned int)nMaxMS;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Calculate the milliseconds left until a deadline
+ **
+ ** The result is suitable as a poll() or epoll_wait() timeout.
+ **
+ ** @param[in]  Deadline        From LLRP_Conn_calculateDeadline()
+ **
+ ** @return     -1              No deadline, wait indefinitely
+ **             >=0             ms left, 0 once the deadline is reached
+ **
+ *****************************************************************************/
+
+int
+LLRP_Conn_remainingMS (
+  llrp_u64_t                    Deadline)
+{
+    llrp_u64_t                  Now;
+
+    if(0 == Deadline)
+    {
+        return -1;
+    }
+
+    Now = getMonotonicMS();
+    if(Now >= Deadline)
+    {
+        return 0;
+    }
+    if(Deadline - Now > INT_MAX)
+    {
+        return INT_MAX;
+    }
+
+    return (int)(Deadline - Now);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Read whatever input is available on a connection
+ **
+ ** This is for event-driven use, for example by LLRP_tSConnGroup,
+ ** where something else (epoll, select, ...) has determined the
+ ** fd is readable. It does one read() without poll(). Complete frames
+ ** are not decoded here; use LLRP_Conn_recvDecodeBuffered() for that.
+ **
+ ** EWOULDBLOCK and EINTR are not errors. They leave the receiver
+ ** state as it was and return LLRP_RC_OK.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return     LLRP_RC_OK          Bytes read, or none were available
+ **             LLRP_RC_RecvEOF     End-of-file condition on fd
+ **             LLRP_RC_RecvIOError I/O error in read().
+ **             LLRP_RC_RecvBufferOverflow
+ **                                 The buffer is full of one incomplete
+ **                                 frame.
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+LLRP_Conn_recvFill (
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSErrorDetails *       pError = &pConn->Recv.ErrorDetails;
+    unsigned int                nNeed;
+    int                         rc;
+
+    LLRP_Error_clear(pError);
+
+    /*
+     * Make sure the socket is open.
+     */
+    if(0 > pConn->fd)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "not connected");
+        return pError->eResultCode;
+    }
+
+    /*
+     * Make room for the rest of the frame in progress, if any.
+     * The buffer grows if the frame needs it and the frame
+     * is within limits.
+     */
+    pConn->Recv.FrameExtract = LLRP_FrameExtract(
+            &pConn->Recv.pBuffer[pConn->Recv.iNext],
+            pConn->Recv.nBuffer - pConn->Recv.iNext);
+    nNeed = pConn->Recv.nBuffer - pConn->Recv.iNext + 1u;
+    if(LLRP_FRAME_NEED_MORE == pConn->Recv.FrameExtract.eStatus)
+    {
+        nNeed += pConn->Recv.FrameExtract.nBytesNeeded - 1u;
+    }
+    if(LLRP_RC_OK != prepareRecvBuffer(pConn, nNeed))
+    {
+        return pError->eResultCode;
+    }
+
+    rc = recvRead(pConn, FALSE);
+    if(0 > rc && (EWOULDBLOCK == errno || EAGAIN == errno || EINTR == errno))
+    {
+        /* Nothing there after all. Not an error. */
+        LLRP_Error_clear(pError);
+    }
+
+    return pError->eResultCode;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Decode every complete frame already in the receive buffer
+ **
+ ** Each frame is decoded and appended to the input queue. No I/O
+ ** is done. On return the buffer holds at most one partial frame.
+ **
+ ** A frame that fails to decode is discarded and decoding carries on
+ ** with the next one. The first such error is what is returned and
+ ** what LLRP_Conn_getRecvError() reports.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return     LLRP_RC_OK          All complete frames decoded
+ **             LLRP_RC_RecvFramingError
+ **                                 LLRP_FrameExtract() detected an
+ **                                 impossible situation. Recovery unlikely.
+ **             LLRP_RC_RecvBufferOverflow
+ **                                 The next frame will not fit in the
+ **                                 receive buffer.
+ **             LLRP_RC_...         Decoder error.
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+LLRP_Conn_recvDecodeBuffered (
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSErrorDetails *       pError = &pConn->Recv.ErrorDetails;
+    LLRP_tSErrorDetails         FirstError;
+
+    LLRP_Error_clear(&FirstError);
+
+    for(;;)
+    {
+        LLRP_Error_clear(pError);
+
+        pConn->Recv.FrameExtract = LLRP_FrameExtract(
+                &pConn->Recv.pBuffer[pConn->Recv.iNext],
+                pConn->Recv.nBuffer - pConn->Recv.iNext);
+
+        if(LLRP_FRAME_READY == pConn->Recv.FrameExtract.eStatus)
+        {
+            recvDecodeFrame(pConn);
+            if(LLRP_RC_OK != pError->eResultCode &&
+               LLRP_RC_OK == FirstError.eResultCode)
+            {
+                FirstError = *pError;
+            }
+            continue;
+        }
+
+        if(LLRP_FRAME_ERROR == pConn->Recv.FrameExtract.eStatus)
+        {
+            LLRP_Error_resultCodeAndWhatStr(pError,
+                LLRP_RC_RecvFramingError, "framing error in message stream");
+            return pError->eResultCode;
+        }
+
+        /*
+         * LLRP_FRAME_NEED_MORE. Done unless the frame can never fit,
+         * not even in a buffer grown to the limit.
+         */
+        if(pConn->Recv.nBuffer - pConn->Recv.iNext +
+                pConn->Recv.FrameExtract.nBytesNeeded > pConn->nMaxBufferSize)
+        {
+            LLRP_Error_resultCodeAndWhatStr(pError,
+                LLRP_RC_RecvBufferOverflow, "buffer overflow");
+            return pError->eResultCode;
+        }
+        break;
+    }
+
+    *pError = FirstError;
+
+    return pError->eResultCode;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to advance receiver
+ **
+ ** Each poll() waits only for the time remaining until Deadline,
+ ** so a frame that trickles in over several reads still times
+ ** out when the caller asked.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  Deadline        From LLRP_Conn_calculateDeadline().
+ **                             0 => block indefinitely
+ **
+ ** @return     LLRP_RC_OK          Frame received
+ **             LLRP_RC_RecvEOF     End-of-file condition on fd
+ **             LLRP_RC_RecvIOError I/O error in poll() or read().
+ **                                 Probably means fd is bad.
+ **             LLRP_RC_RecvFramingError
+ **                                 LLRP_FrameExtract() detected an
+ **                                 impossible situation. Recovery unlikely.
+ **             LLRP_RC_RecvTimeout Frame didn't complete within allowed time
+ **             LLRP_RC_RecvBufferOverflow
+ **                                 LLRP_FrameExtract() detected an inbound
+ **                                 message that would overflow the receive
+ **                                 buffer.
+ **             LLRP_RC_...         Decoder error.
+ **
+ *****************************************************************************/
+
+static LLRP_tResultCode
+recvAdvance (
+  LLRP_tSConnection *           pConn,
+  llrp_u64_t                    Deadline)
+{
+    LLRP_tSErrorDetails *       pError = &pConn->Recv.ErrorDetails;
+
+    /*
+     * Clear the error details in the receiver state.
+     */
+    LLRP_Error_clear(pError);
+
+    /*
+     * Loop until victory or some sort of exception happens
+     */
+    for(;;)
+    {
+        int                     rc;
+        unsigned int            nFrameBuffer;
+
+        /*
+         * Note that the frame is in progress.
+         * Existing buffer content, if any, is deemed
+         * invalid or incomplete.
+         */
+        pConn->Recv.bFrameValid = FALSE;
+
+        /*
+         * The next frame starts at iNext. Anything before
+         * that belongs to frames already decoded. Anything
+         * after it was read ahead and may be one or more
+         * complete frames plus the start of another.
+         */
+        nFrameBuffer = pConn->Recv.nBuffer - pConn->Recv.iNext;
+
+        /*
+         * Check to see if we have a frame in the buffer.
+         * If not, how many more bytes do we need?
+         *
+         * LLRP_FrameExtract() status
+         *
+         * LLRP_FRAME_ERROR     Impossible situation, like message
+         *                      length too small or the like.
+         *                      Recovery in this situation is
+         *                      unlikely and probably the app
+         *                      should drop the connection.
+         *
+         * LLRP_FRAME_READY     Frame is complete. Details are
+         *                      available for pre-decode decisions.
+         *
+         * LLRP_FRAME_NEED_MORE Need more input bytes to finish the frame.
+         *                      The nBytesNeeded field is how many more.
+         */
+        pConn->Recv.FrameExtract = LLRP_FrameExtract(
+                &pConn->Recv.pBuffer[pConn->Recv.iNext], nFrameBuffer);
+
+        /*
+         * Framing error?
+         */
+        if(LLRP_FRAME_ERROR == pConn->Recv.FrameExtract.eStatus)
+        {
+            LLRP_Error_resultCodeAndWhatStr(pError,
+                LLRP_RC_RecvFramingError, "framing error in message stream");
+            break;
+        }
+
+        /*
+         * Need more bytes? extractRc>0 means we do and extractRc is the
+         * number of bytes immediately required.
+         */
+        if(LLRP_FRAME_NEED_MORE == pConn->Recv.FrameExtract.eStatus)
+        {
+            unsigned int        nRead = pConn->Recv.FrameExtract.nBytesNeeded;
+
+            /*
+             * Before we do anything that might block,
+             * check to see if the deadline has passed.
+             * Frames already buffered are decoded regardless,
+             * this only stops further I/O.
+             */
+            if(0 != Deadline && getMonotonicMS() > Deadline)
+            {
+                /* Timeout */
+                LLRP_Error_resultCodeAndWhatStr(pError,
+                    LLRP_RC_RecvTimeout, "timeout");
+                break;
+            }
+
+            /*
+             * The frame extractor needs more data, make sure the
+             * frame fits in the receive buffer, growing it if
+             * need be. The partial frame, if any, is moved to
+             * the front so the whole frame will be contiguous.
+             */
+            if(LLRP_RC_OK != prepareRecvBuffer(pConn, nFrameBuffer + nRead))
+            {
+                /* Buffer overflow */
+                break;
+            }
+
+            /*
+             * If this is not a block indefinitely request wait
+             * to see if there is data in time. Wait only for what
+             * is left of the time allowed, not the whole of it.
+             */
+            if(0 != Deadline)
+            {
+                rc = (*pConn->pIO->pfWait)(pConn,
+                        LLRP_Conn_remainingMS(Deadline));
+                if(0 > rc && EINTR == errno)
+                {
+                    /* Interrupted. Loop and wait out the rest. */
+                    continue;
+                }
+                if(0 > rc)
+                {
+                    /* Error */
+                    LLRP_Error_resultCodeAndWhatStr(pError,
+                        LLRP_RC_RecvIOError, "poll failed");
+                    break;
+                }
+                if(0 == rc)
+                {
+                    /* Timeout */
+                    LLRP_Error_resultCodeAndWhatStr(pError,
+                        LLRP_RC_RecvTimeout, "timeout");
+                    break;
+                }
+            }
+
+            /*
+             * Read ahead. Note that an error could be EWOULDBLOCK
+             * if the file descriptor is using non-blocking I/O.
+             * So we return the error but do not tear-up
+             * the receiver state.
+             */
+            if(0 >= recvRead(pConn, TRUE))
+            {
+                break;
+            }
+
+            /*
+             * Some bytes were read. Loop to the top and
+             * retry the FrameExtract().
+             */
+            continue;
+        }
+
+        /*
+         * Is the frame ready?
+         * If a valid frame is present, decode and enqueue it.
+         */
+        if(LLRP_FRAME_READY == pConn->Recv.FrameExtract.eStatus)
+        {
+            recvDecodeFrame(pConn);
+            break;
+        }
+
+        /*
+         * If we get here there was an FrameExtract status
+         * we didn't expect.
+         */
+
+        /*NOTREACHED*/
+        assert(0);
+    }
+
+    return pError->eResultCode;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to compact the receive buffer
+ **
+ ** Bytes before Recv.iNext belong to frames already decoded.
+ ** Move the rest, at most one partial frame, to the front.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+static void
+compactRecvBuffer (
+  LLRP_tSConnection *           pConn)
+{
+    unsigned int                nRemain;
+
+    if(0 == pConn->Recv.iNext)
+    {
+        return;
+    }
+
+    nRemain = pConn->Recv.nBuffer - pConn->Recv.iNext;
+    memmove(pConn->Recv.pBuffer,
+            &pConn->Recv.pBuffer[pConn->Recv.iNext], nRemain);
+    pConn->Recv.nBuffer = nRemain;
+    pConn->Recv.iNext = 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to make room in the receive buffer
+ **
+ ** Compacts the buffer. Then grows it if nNeed bytes do not fit,
+ ** at least doubling so a big frame arriving in pieces does not
+ ** copy the buffer each time. Otherwise gives back space not
+ ** needed for a while.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  nNeed           Count of bytes, from the start of the
+ **                             frame in progress, the buffer must hold
+ **
+ ** @return     LLRP_RC_OK          There is room
+ **             LLRP_RC_RecvBufferOverflow
+ **                                 nNeed is over the limit, or
+ **                                 growing failed. Recv.ErrorDetails set.
+ **
+ *****************************************************************************/
+
+static LLRP_tResultCode
+prepareRecvBuffer (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  nNeed)
+{
+    LLRP_tSErrorDetails *       pError = &pConn->Recv.ErrorDetails;
+    unsigned int                nNewAlloc;
+
+    compactRecvBuffer(pConn);
+
+    if(nNeed <= pConn->Recv.nAlloc)
+    {
+        if(pConn->Recv.nAlloc > pConn->nBufferSize &&
+           nNeed <= pConn->nBufferSize)
+        {
+            shrinkRecvBuffer(pConn, getMonotonicMS());
+        }
+        return LLRP_RC_OK;
+    }
+
+    if(nNeed > pConn->nMaxBufferSize)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_RecvBufferOverflow, "buffer overflow");
+        return pError->eResultCode;
+    }
+
+    nNewAlloc = pConn->Recv.nAlloc;
+    while(nNewAlloc < nNeed && nNewAlloc <= pConn->nMaxBufferSize / 2u)
+    {
+        nNewAlloc *= 2u;
+    }
+    if(nNewAlloc < nNeed)
+    {
+        nNewAlloc = pConn->nMaxBufferSize;
+    }
+
+    if(!resizeBuffer(&pConn->Recv.pBuffer, &pConn->Recv.nAlloc,
+                pConn->Recv.nBuffer, nNewAlloc))
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_RecvBufferOverflow, "buffer grow failed");
+        return pError->eResultCode;
+    }
+    pConn->Recv.LastLargeMS = getMonotonicMS();
+
+    return LLRP_RC_OK;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to double the send buffer
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return     TRUE            Grown, encode again
+ **             FALSE           Already at the limit, or out of memory
+ **
+ *****************************************************************************/
+
+static llrp_bool_t
+growSendBuffer (
+  LLRP_tSConnection *           pConn)
+{
+    unsigned int                nNewAlloc;
+
+    if(pConn->Send.nAlloc >= pConn->nMaxBufferSize)
+    {
+        return FALSE;
+    }
+
+    if(pConn->Send.nAlloc <= pConn->nMaxBufferSize / 2u)
+    {
+        nNewAlloc = pConn->Send.nAlloc * 2u;
+    }
+    else
+    {
+        nNewAlloc = pConn->nMaxBufferSize;
+    }
+
+    /* Nothing in the buffer is worth keeping, it is encoded again */
+    return resizeBuffer(&pConn->Send.pBuffer, &pConn->Send.nAlloc,
+                0, nNewAlloc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to shrink an idle receive buffer
+ **
+ ** The buffer goes back to nBufferSize if it has not held more
+ ** than that for nIdleShrinkMS and what it holds now fits.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  NowMS           getMonotonicMS(), or all ones to
+ **                             shrink regardless of time
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+static void
+shrinkRecvBuffer (
+  LLRP_tSConnection *           pConn,
+  llrp_u64_t                    NowMS)
+{
+    if(pConn->Recv.nAlloc <= pConn->nBufferSize ||
+       NowMS - pConn->Recv.LastLargeMS < pConn->nIdleShrinkMS)
+    {
+        return;
+    }
+
+    compactRecvBuffer(pConn);
+    if(pConn->Recv.nBuffer > pConn->nBufferSize)
+    {
+        return;
+    }
+
+    /* If this fails the grown buffer is simply kept */
+    resizeBuffer(&pConn->Recv.pBuffer, &pConn->Recv.nAlloc,
+            pConn->Recv.nBuffer, pConn->nBufferSize);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to shrink an idle send buffer
+ **
+ ** The buffer goes back to nBufferSize if it has not held a frame
+ ** bigger than that for nIdleShrinkMS. Send.nBuffer and the
+ ** buffer content are kept for the debugger as far as they fit.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  NowMS           getMonotonicMS(), or all ones to
+ **                             shrink regardless of time
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+static void
+shrinkSendBuffer (
+  LLRP_tSConnection *           pConn,
+  llrp_u64_t                    NowMS)
+{
+    if(pConn->Send.nAlloc <= pConn->nBufferSize ||
+       NowMS - pConn->Send.LastLargeMS < pConn->nIdleShrinkMS)
+    {
+        return;
+    }
+
+    if(pConn->Send.nBuffer > pConn->nBufferSize)
+    {
+        pConn->Send.nBuffer = 0;
+    }
+
+    resizeBuffer(&pConn->Send.pBuffer, &pConn->Send.nAlloc,
+            pConn->Send.nBuffer, pConn->nBufferSize);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to reallocate a send or receive buffer
+ **
+ ** Only the first nKeep bytes are copied, which is less than
+ ** realloc() would copy when growing a buffer that is mostly empty.
+ **
+ ** @param[in,out] ppBuffer     The buffer, replaced on success
+ ** @param[in,out] pnAlloc      Its size, updated on success
+ ** @param[in]  nKeep           Count of bytes to carry over
+ ** @param[in]  nNewAlloc       New size, at least nKeep
+ **
+ ** @return     TRUE            Done
+ **             FALSE           Out of memory, buffer unchanged
+ **
+ *****************************************************************************/
+
+static llrp_bool_t
+resizeBuffer (
+  unsigned char **              ppBuffer,
+  unsigned int *                pnAlloc,
+  unsigned int                  nKeep,
+  unsigned int                  nNewAlloc)
+{
+    unsigned char *             pNew;
+
+    pNew = malloc(nNewAlloc);
+    if(NULL == pNew)
+    {
+        return FALSE;
+    }
+
+    memcpy(pNew, *ppBuffer, nKeep);
+    free(*ppBuffer);
+
+    *ppBuffer = pNew;
+    *pnAlloc = nNewAlloc;
+
+    return TRUE;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to read ahead into the receive buffer
+ **
+ ** Asks for as many bytes as fit in the buffer, not just what
+ ** the current frame needs. read() returns what the socket
+ ** already has, so a burst of frames lands with one system call
+ ** and the frames after the first are split out of the buffer
+ ** without touching the socket.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  bBlock          TRUE to wait for input if there is none.
+ **                             The POSIX backend waits only if the fd
+ **                             is blocking, as read() does.
+ **
+ ** @return     >0              Number of bytes read
+ **             ==0             End-of-file, Recv.ErrorDetails set
+ **             <0              I/O error, Recv.ErrorDetails set,
+ **                             errno tells why
+ **
+ *****************************************************************************/
+
+static int
+recvRead (
+  LLRP_tSConnection *           pConn,
+  llrp_bool_t                   bBlock)
+{
+    LLRP_tSErrorDetails *       pError = &pConn->Recv.ErrorDetails;
+    unsigned int                nRoom;
+    int                         rc;
+
+    nRoom = pConn->Recv.nAlloc - pConn->Recv.nBuffer;
+    rc = (*pConn->pIO->pfRead)(pConn,
+            &pConn->Recv.pBuffer[pConn->Recv.nBuffer], nRoom, bBlock);
+
+    if(0 > rc)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_RecvIOError, "recv IO error");
+    }
+    else if(0 == rc)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_RecvEOF, "recv end-of-file");
+    }
+    else
+    {
+        pConn->Recv.nBuffer += rc;
+
+        /*
+         * Part of a big frame, or a burst that needs the
+         * grown buffer. Either way keep it a while longer.
+         */
+        if(pConn->Recv.nBuffer > pConn->nBufferSize)
+        {
+            pConn->Recv.LastLargeMS = getMonotonicMS();
+        }
+    }
+
+    return rc;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to decode the frame at Recv.iNext
+ **
+ ** Recv.FrameExtract must say LLRP_FRAME_READY. The frame is
+ ** consumed whatever happens. On success the message is appended
+ ** to the input queue. On failure Recv.ErrorDetails says why.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+static void
+recvDecodeFrame (
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSErrorDetails *       pError = &pConn->Recv.ErrorDetails;
+    LLRP_tSFrameDecoder *       pDecoder;
+    LLRP_tSMessage *            pMessage;
+    unsigned char *             pFrame;
+    unsigned int                nFrame;
+
+    /*
+     * The frame is the header plus the MessageLength body.
+     * Whatever happens below, it is consumed and the
+     * next frame, if any, starts right after it.
+     */
+    pFrame = &pConn->Recv.pBuffer[pConn->Recv.iNext];
+    nFrame = pConn->Recv.FrameExtract.MessageLength + 19u;
+    pConn->Recv.iNext += nFrame;
+    pConn->Recv.bFrameValid = FALSE;
+
+    /*
+     * Give the pre-decode hook, if any, first look. It may
+     * take the frame as it is and spare us the decode.
+     */
+    if(NULL != pConn->Recv.pfPreDecode &&
+       LLRP_PREDECODE_SKIP == (*pConn->Recv.pfPreDecode)(pConn,
+                &pConn->Recv.FrameExtract, pFrame, nFrame,
+                pConn->Recv.pPreDecodeArg))
+    {
+        if(pConn->Recv.iNext == pConn->Recv.nBuffer)
+        {
+            pConn->Recv.iNext = 0;
+            pConn->Recv.nBuffer = 0;
+        }
+        return;
+    }
+
+    /*
+     * Point the connection's frame decoder at the frame.
+     * It needs the registry to facilitate decoding.
+     */
+    pDecoder = &pConn->Recv.Decoder;
+    LLRP_FrameDecoder_reset(pDecoder, pFrame, nFrame);
+    pDecoder->decoderHdr.pRegistry = pConn->pTypeRegistry;
+    pDecoder->bUseArena = pConn->Recv.bDecodeArena;
+    pDecoder->bBorrowVectors = pConn->Recv.bDecodeZeroCopy;
+    pDecoder->bLazySubParameters = pConn->Recv.bDecodeLazy;
+
+    /*
+     * Now ask the decoder to decode the frame.
+     * It returns NULL for some kind of error.
+     * The &...decoderHdr is in lieu of type casting since
+     * the generic LLRP_Decoder_decodeMessage() takes the
+     * generic LLRP_tSDecoder.
+     */
+    pMessage = LLRP_Decoder_decodeMessage(&pDecoder->decoderHdr);
+
+    /*
+     * Always capture the error details even when it works.
+     * Whatever happened, we are done with the decoder.
+     */
+    pConn->Recv.ErrorDetails = pDecoder->decoderHdr.ErrorDetails;
+
+    /*
+     * If NULL there was an error. All we can do is discard
+     * the frame. Frames read ahead after it are kept.
+     */
+    if(NULL == pMessage)
+    {
+        /*
+         * Make sure the return is not LLRP_RC_OK
+         */
+        if(LLRP_RC_OK == pError->eResultCode)
+        {
+            LLRP_Error_resultCodeAndWhatStr(pError,
+                LLRP_RC_MiscError, "NULL message but no error");
+        }
+
+        /*
+         * If it was the response to a pending transaction
+         * there will be no other. Finish it with the error.
+         */
+        if(0 != pConn->Transact.nPending)
+        {
+            finishTransactByFrameError(pConn,
+                pConn->Recv.FrameExtract.MessageID, pError);
+        }
+        return;
+    }
+
+    /*
+     * Yay! It worked. A response to a pending transaction
+     * finishes it. Anything else is enqueued.
+     */
+    if(0 == pConn->Transact.nPending ||
+       !finishTransactByResponse(pConn, pMessage))
+    {
+        enqueueInputMessage(pConn, pMessage);
+    }
+
+    /*
+     * Note that the frame is valid. Consult
+     * Recv.FrameExtract.MessageLength.
+     * When the buffer holds nothing more, rewind it
+     * so the next read() starts at the front.
+     */
+    pConn->Recv.bFrameValid = TRUE;
+    if(pConn->Recv.iNext == pConn->Recv.nBuffer)
+    {
+        pConn->Recv.iNext = 0;
+        pConn->Recv.nBuffer = 0;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to send encoded frames without blocking
+ **
+ ** If nothing is queued ahead of them, the bytes are written right
+ ** away as far as the socket allows. Whatever is left is copied to
+ ** the send queue.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  pFrame          One or more whole frames
+ ** @param[in]  nFrame          Count of bytes
+ **
+ ** @return     LLRP_RC_OK          Sent or queued
+ **             LLRP_RC_SendIOError I/O error
+ **             LLRP_RC_SendQueueFull
+ **                                 Queue is at its limit, nothing sent
+ **             LLRP_RC_MiscError   Queue allocation failed
+ **
+ *****************************************************************************/
+
+static LLRP_tResultCode
+sendFrameNonBlocking (
+  LLRP_tSConnection *           pConn,
+  const unsigned char *         pFrame,
+  unsigned int                  nFrame)
+{
+    LLRP_tSErrorDetails *       pError = &pConn->Send.ErrorDetails;
+
+    /*
+     * Frames already waiting go first. Refuse the new one if
+     * the queue is at its limit. A lone frame is always taken
+     * so a limit smaller than a frame can not wedge the queue.
+     */
+    if(NULL != pConn->Send.pQueueHead)
+    {
+        if(pConn->Send.nQueueBytes + nFrame > pConn->Send.nMaxQueueBytes)
+        {
+            LLRP_Error_resultCodeAndWhatStr(pError,
+                LLRP_RC_SendQueueFull, "send queue full");
+            return pError->eResultCode;
+        }
+    }
+    else
+    {
+        struct iovec            Iov;
+        int                     rc;
+
+        Iov.iov_base = (void *)pFrame;
+        Iov.iov_len = nFrame;
+
+        rc = sendNoWait(pConn, &Iov, 1);
+        if(0 > rc)
+        {
+            if(EWOULDBLOCK != errno && EAGAIN != errno)
+            {
+                LLRP_Error_resultCodeAndWhatStr(pError,
+                    LLRP_RC_SendIOError, "send IO error");
+                return pError->eResultCode;
+            }
+            rc = 0;
+        }
+
+        pFrame += rc;
+        nFrame -= rc;
+        if(0 == nFrame)
+        {
+            /* All gone, nothing to queue */
+            return pError->eResultCode;
+        }
+    }
+
+    return enqueueSendFrame(pConn, pFrame, nFrame);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to write without waiting
+ **
+ ** Uses sendmsg() with MSG_DONTWAIT so the fd need not be
+ ** O_NONBLOCK. MSG_NOSIGNAL turns a broken connection into
+ ** EPIPE rather than SIGPIPE. If the fd is not a socket, falls
+ ** back to writev(), which blocks unless the fd is O_NONBLOCK.
+ **
+ ** @return     >=0             Bytes written
+ **             <0              Error, errno tells why
+ **
+ *****************************************************************************/
+
+static int
+sendNoWait (
+  LLRP_tSConnection *           pConn,
+  struct iovec *                pIov,
+  int                           nIov)
+{
+    struct msghdr               Msg;
+    int                         rc;
+
+    memset(&Msg, 0, sizeof Msg);
+    Msg.msg_iov = pIov;
+    Msg.msg_iovlen = nIov;
+
+    do
+    {
+        rc = sendmsg(pConn->fd, &Msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if(0 > rc && ENOTSOCK == errno)
+        {
+            rc = writev(pConn->fd, pIov, nIov);
+        }
+    } while(0 > rc && EINTR == errno);
+
+    return rc;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to append a copy of a frame to the send queue
+ **
+ ** @return     LLRP_RC_OK          Queued
+ **             LLRP_RC_MiscError   Allocation failed. If the frame was
+ **                                 partly written the stream is now
+ **                                 broken and the app should reconnect.
+ **
+ *****************************************************************************/
+
+static LLRP_tResultCode
+enqueueSendFrame (
+  LLRP_tSConnection *           pConn,
+  const unsigned char *         pFrame,
+  unsigned int                  nFrame)
+{
+    LLRP_tSErrorDetails *       pError = &pConn->Send.ErrorDetails;
+    LLRP_tSSendFrame *          pSendFrame;
+
+    pSendFrame = malloc(sizeof *pSendFrame + nFrame);
+    if(NULL == pSendFrame)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "send queue allocation failed");
+        return pError->eResultCode;
+    }
+
+    pSendFrame->pNext = NULL;
+    pSendFrame->pFrame = (unsigned char *)(pSendFrame + 1);
+    pSendFrame->nFrame = nFrame;
+    pSendFrame->iNext = 0;
+    memcpy(pSendFrame->pFrame, pFrame, nFrame);
+
+    pConn->Send.nQueueBytes += nFrame;
+
+    if(NULL == pConn->Send.pQueueTail)
+    {
+        pConn->Send.pQueueHead = pSendFrame;
+        pConn->Send.pQueueTail = pSendFrame;
+
+        /*
+         * Queue just became non-empty. Tell the event loop
+         * to watch for writable.
+         */
+        if(NULL != pConn->Send.pfWatch)
+        {
+            (*pConn->Send.pfWatch)(pConn, TRUE, pConn->Send.pWatchArg);
+        }
+    }
+    else
+    {
+        pConn->Send.pQueueTail->pNext = pSendFrame;
+        pConn->Send.pQueueTail = pSendFrame;
+    }
+
+    return pError->eResultCode;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to free every frame in the send queue
+ **
+ *****************************************************************************/
+
+static void
+discardSendQueue (
+  LLRP_tSConnection *           pConn)
+{
+    llrp_bool_t                 bWasQueued;
+
+    bWasQueued = (NULL != pConn->Send.pQueueHead);
+
+    while(NULL != pConn->Send.pQueueHead)
+    {
+        LLRP_tSSendFrame *      pSendFrame;
+
+        pSendFrame = pConn->Send.pQueueHead;
+        pConn->Send.pQueueHead = pSendFrame->pNext;
+
+        free(pSendFrame);
+    }
+
+    pConn->Send.pQueueTail = NULL;
+    pConn->Send.nQueueBytes = 0;
+
+    if(bWasQueued && NULL != pConn->Send.pfWatch)
+    {
+        (*pConn->Send.pfWatch)(pConn, FALSE, pConn->Send.pWatchArg);
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to append a message to the input queue
+ **
+ ** O(1). The message goes on the tail of the queue and on the
+ ** tail of its MessageID index chain, so both stay oldest first.
+ ** MessageID 0 is not indexed. Unsolicited reports and events
+ ** all carry it, so its chain would hold most of the queue, and
+ ** findQueuedResponse() scans the queue for it anyway.
+ **
+ *****************************************************************************/
+
+static void
+enqueueInputMessage (
+  LLRP_tSConnection *           pConn,
+  LLRP_tSMessage *              pMessage)
+{
+    LLRP_tSMessage **           ppHead;
+    LLRP_tSMessage **           ppTail;
+
+    /*
+     * Keep the index at most two messages per bucket.
+     */
+    if(0 != pMessage->MessageID &&
+       pConn->InputIndex.nMessage >= 2u * pConn->InputIndex.nBucket)
+    {
+        growInputIndex(pConn);
+    }
+
+    pMessage->pQueueNext = NULL;
+    pMessage->pQueuePrev = pConn->pInputQueueTail;
+    if(NULL == pConn->pInputQueueTail)
+    {
+        pConn->pInputQueue = pMessage;
+    }
+    else
+    {
+        pConn->pInputQueueTail->pQueueNext = pMessage;
+    }
+    pConn->pInputQueueTail = pMessage;
+
+    pMessage->pIndexNext = NULL;
+    ppHead = indexBucket(pConn, pMessage->MessageID, &ppTail);
+    if(NULL != ppHead)
+    {
+        pConn->InputIndex.nMessage++;
+        if(NULL == *ppTail)
+        {
+            *ppHead = pMessage;
+        }
+        else
+        {
+            (*ppTail)->pIndexNext = pMessage;
+        }
+        *ppTail = pMessage;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to remove a message from the input queue
+ **
+ ** O(1) for the queue. For the index, the message's chain is
+ ** walked to find its predecessor. Chains average two entries
+ ** or fewer, and the oldest message, which recvMessage() takes,
+ ** is always first in its chain. MessageID 0 has no chain.
+ **
+ *****************************************************************************/
+
+static void
+unlinkInputMessage (
+  LLRP_tSConnection *           pConn,
+  LLRP_tSMessage *              pMessage)
+{
+    LLRP_tSMessage **           ppHead;
+    LLRP_tSMessage **           ppTail;
+
+    ppHead = indexBucket(pConn, pMessage->MessageID, &ppTail);
+    if(NULL != ppHead)
+    {
+        LLRP_tSMessage *        pPrev = NULL;
+        LLRP_tSMessage **       ppLink = ppHead;
+
+        while(*ppLink != pMessage)
+        {
+            pPrev = *ppLink;
+            ppLink = &pPrev->pIndexNext;
+        }
+
+        *ppLink = pMessage->pIndexNext;
+        if(*ppTail == pMessage)
+        {
+            *ppTail = pPrev;
+        }
+        pConn->InputIndex.nMessage--;
+    }
+
+    if(NULL == pMessage->pQueuePrev)
+    {
+        pConn->pInputQueue = pMessage->pQueueNext;
+    }
+    else
+    {
+        pMessage->pQueuePrev->pQueueNext = pMessage->pQueueNext;
+    }
+    if(NULL == pMessage->pQueueNext)
+    {
+        pConn->pInputQueueTail = pMessage->pQueuePrev;
+    }
+    else
+    {
+        pMessage->pQueueNext->pQueuePrev = pMessage->pQueuePrev;
+    }
+
+    pMessage->pQueueNext = NULL;
+    pMessage->pQueuePrev = NULL;
+    pMessage->pIndexNext = NULL;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to find the oldest queued message that
+ **         matches a response type and MessageID
+ **
+ ** See LLRP_Conn_recvResponse() for the matching rules.
+ **
+ ** @param[in]  pScanAfter      Without a MessageID the queue is scanned.
+ **                             Messages up to and including this one
+ **                             were scanned before and are skipped.
+ **                             NULL to scan the whole queue.
+ **
+ ** @return     !=NULL          The message, still in the queue
+ **             ==NULL          No match
+ **
+ *****************************************************************************/
+
+static LLRP_tSMessage *
+findQueuedResponse (
+  LLRP_tSConnection *           pConn,
+  const LLRP_tSTypeDescriptor * pResponseType,
+  const LLRP_tSTypeDescriptor * pErrorMsgType,
+  llrp_u32_t                    ResponseMessageID,
+  LLRP_tSMessage *              pScanAfter)
+{
+    LLRP_tSMessage *            pMessage;
+    LLRP_tSMessage **           ppHead;
+    LLRP_tSMessage **           ppTail;
+    llrp_bool_t                 bIndexed;
+
+    /*
+     * A particular message ID? Walk only its index chain.
+     */
+    ppHead = indexBucket(pConn, ResponseMessageID, &ppTail);
+    bIndexed = (NULL != ppHead);
+
+    if(bIndexed)
+    {
+        pMessage = *ppHead;
+    }
+    else if(NULL != pScanAfter)
+    {
+        pMessage = pScanAfter->pQueueNext;
+    }
+    else
+    {
+        pMessage = pConn->pInputQueue;
+    }
+
+    for(;
+        NULL != pMessage;
+        pMessage = bIndexed ? pMessage->pIndexNext : pMessage->pQueueNext)
+    {
+        /*
+         * Are we looking for a particular message type?
+         * See if it is the sought response type or
+         * an ErrorAck.
+         */
+        if(NULL != pResponseType &&
+           pMessage->elementHdr.pType != pResponseType &&
+           pMessage->elementHdr.pType != pErrorMsgType)
+        {
+            /* Type does not match. Keep looking. */
+            continue;
+        }
+
+        /*
+         * Are we looking for a particular message ID?
+         * Index chains hold other IDs that hash the same.
+         */
+        if(0 != ResponseMessageID &&
+           pMessage->MessageID != ResponseMessageID)
+        {
+            /* Message ID does not match. Keep looking. */
+            continue;
+        }
+
+        /* Found it */
+        break;
+    }
+
+    return pMessage;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to double the input queue index
+ **
+ ** The queue is walked oldest first and each message is appended
+ ** to its new chain, so chains stay oldest first. If allocation
+ ** fails the old index is kept. It still works, just with longer
+ ** chains. If there never was one, lookups scan the queue.
+ **
+ *****************************************************************************/
+
+static void
+growInputIndex (
+  LLRP_tSConnection *           pConn)
+{
+    unsigned int                nBucket;
+    LLRP_tSMessage **           apHead;
+    LLRP_tSMessage **           apTail;
+    LLRP_tSMessage *            pMessage;
+
+    nBucket = pConn->InputIndex.nBucket;
+    nBucket = (0 == nBucket) ? 64u : 2u * nBucket;
+
+    apHead = calloc(nBucket, sizeof *apHead);
+    apTail = calloc(nBucket, sizeof *apTail);
+    if(NULL == apHead || NULL == apTail)
+    {
+        free(apHead);
+        free(apTail);
+        return;
+    }
+
+    free(pConn->InputIndex.apHead);
+    free(pConn->InputIndex.apTail);
+    pConn->InputIndex.apHead = apHead;
+    pConn->InputIndex.apTail = apTail;
+    pConn->InputIndex.nBucket = nBucket;
+
+    for(
+        pMessage = pConn->pInputQueue;
+        NULL != pMessage;
+        pMessage = pMessage->pQueueNext)
+    {
+        LLRP_tSMessage **       ppHead;
+        LLRP_tSMessage **       ppTail;
+
+        pMessage->pIndexNext = NULL;
+        ppHead = indexBucket(pConn, pMessage->MessageID, &ppTail);
+        if(NULL == ppHead)
+        {
+            continue;
+        }
+        if(NULL == *ppTail)
+        {
+            *ppHead = pMessage;
+        }
+        else
+        {
+            (*ppTail)->pIndexNext = pMessage;
+        }
+        *ppTail = pMessage;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to find the index chain for a MessageID
+ **
+ ** @param[out] pppTail         Set to the chain's tail pointer
+ **
+ ** @return     !=NULL          Pointer to the chain's head pointer
+ **             ==NULL          There is no index, or the MessageID
+ **                             is 0, which is never indexed
+ **
+ *****************************************************************************/
+
+static LLRP_tSMessage **
+indexBucket (
+  LLRP_tSConnection *           pConn,
+  llrp_u32_t                    MessageID,
+  LLRP_tSMessage ***            pppTail)
+{
+    unsigned int                iBucket;
+
+    if(0 == pConn->InputIndex.nBucket || 0 == MessageID)
+    {
+        *pppTail = NULL;
+        return NULL;
+    }
+
+    /*
+     * Fibonacci hashing. MessageIDs are often sequential;
+     * this spreads them and folds in the high bits.
+     */
+    iBucket = (llrp_u32_t)(MessageID * 2654435761u) >> 16u;
+    iBucket ^= MessageID;
+    iBucket &= pConn->InputIndex.nBucket - 1u;
+
+    *pppTail = &pConn->InputIndex.apTail[iBucket];
+    return &pConn->InputIndex.apHead[iBucket];
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to read the monotonic clock
+ **
+ ** @return                     CLOCK_MONOTONIC in milliseconds
+ **
+ *****************************************************************************/
+
+static llrp_u64_t
+getMonotonicMS (void)
+{
+    struct timespec             Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return (llrp_u64_t)Now.tv_sec * 1000u + Now.tv_nsec / 1000000u;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to look up the ErrorAck type
+ **
+ ** A reader answers a request it cannot carry out with ErrorAck
+ ** rather than the usual response. It is deemed a response too.
+ **
+ ** @return     ==NULL          Not in the registry
+ **             !=NULL          ErrorAck type descriptor
+ **
+ *****************************************************************************/
+
+static const LLRP_tSTypeDescriptor *
+lookupErrorAckType (
+  LLRP_tSConnection *           pConn)
+{
+    return LLRP_TypeRegistry_lookupMessage(pConn->pTypeRegistry,
+                LLRP_ERROR_ACK_TYPENUM);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to pick a MessageID for a transaction
+ **
+ ** Counts up from the last one assigned, skipping 0 and any
+ ** MessageID a pending transaction is using.
+ **
+ *****************************************************************************/
+
+static llrp_u32_t
+nextTransactMessageID (
+  LLRP_tSConnection *           pConn)
+{
+    llrp_u32_t                  MessageID = pConn->Transact.LastMessageID;
+    LLRP_tSTransact *           pTransact;
+
+    do
+    {
+        MessageID++;
+        if(0 == MessageID)
+        {
+            MessageID = 1;
+        }
+
+        for(pTransact = pConn->Transact.pPendingHead;
+            NULL != pTransact;
+            pTransact = pTransact->pNext)
+        {
+            if(pTransact->MessageID == MessageID)
+            {
+                break;
+            }
+        }
+    } while(NULL != pTransact);
+
+    pConn->Transact.LastMessageID = MessageID;
+
+    return MessageID;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to finish the transaction a message answers
+ **
+ ** Called for each message decoded while transactions are pending.
+ ** The oldest pending transaction with the MessageID whose
+ ** response type, or ErrorAck, matches takes the message.
+ **
+ ** @return     TRUE            The message was a response, now owned
+ **                             by the transaction
+ **             FALSE           Not a response, enqueue it as usual
+ **
+ *****************************************************************************/
+
+static llrp_bool_t
+finishTransactByResponse (
+  LLRP_tSConnection *           pConn,
+  LLRP_tSMessage *              pMessage)
+{
+    const LLRP_tSTypeDescriptor * pType = pMessage->elementHdr.pType;
+    LLRP_tSTransact *           pTransact;
+
+    for(pTransact = pConn->Transact.pPendingHead;
+        NULL != pTransact;
+        pTransact = pTransact->pNext)
+    {
+        if(pTransact->MessageID != pMessage->MessageID)
+        {
+            continue;
+        }
+
+        if(NULL != pTransact->pResponseType &&
+           pType != pTransact->pResponseType &&
+           pType != pTransact->pErrorAckType)
+        {
+            continue;
+        }
+
+        finishTransact(pConn, pTransact, LLRP_RC_OK, NULL, pMessage);
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to finish the transaction a bad frame answers
+ **
+ ** A frame that failed to decode still has a MessageID in its
+ ** header. The oldest pending transaction with it finishes with
+ ** the decode error rather than waiting out its timeout.
+ **
+ *****************************************************************************/
+
+static void
+finishTransactByFrameError (
+  LLRP_tSConnection *           pConn,
+  llrp_u32_t                    MessageID,
+  const LLRP_tSErrorDetails *   pError)
+{
+    LLRP_tSTransact *           pTransact;
+
+    for(pTransact = pConn->Transact.pPendingHead;
+        NULL != pTransact;
+        pTransact = pTransact->pNext)
+    {
+        if(pTransact->MessageID == MessageID)
+        {
+            finishTransact(pConn, pTransact,
+                pError->eResultCode, pError->pWhatStr, NULL);
+            break;
+        }
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to finish a pending transaction
+ **
+ ** The transaction leaves the pending list. With a callback it
+ ** goes on the done list for deliverTransacts(). Without one the
+ ** application sees it finished with LLRP_Transact_isDone().
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  pTransact       The pending transaction
+ ** @param[in]  eResultCode     LLRP_RC_OK with a response, else why not
+ ** @param[in]  pWhatStr        Error description, NULL with a response
+ ** @param[in]  pResponse       The response, or NULL
+ **
+ *****************************************************************************/
+
+static void
+finishTransact (
+  LLRP_tSConnection *           pConn,
+  LLRP_tSTransact *             pTransact,
+  LLRP_tResultCode              eResultCode,
+  const char *                  pWhatStr,
+  LLRP_tSMessage *              pResponse)
+{
+    unlinkPendingTransact(pConn, pTransact);
+    pConn->Transact.nFinished++;
+
+    pTransact->bDone = TRUE;
+    pTransact->pResponse = pResponse;
+    LLRP_Error_clear(&pTransact->ErrorDetails);
+    if(LLRP_RC_OK != eResultCode)
     {
-        /* When just peeking, try for at most one second */
-        return time(NULL) + 1;
+        LLRP_Error_resultCodeAndWhatStr(&pTransact->ErrorDetails,
+            eResultCode, pWhatStr);
     }
-    else if(0 < nMaxMS)
+
+    if(NULL != pTransact->pfDone)
     {
         /*
-         * Try for a at most a certain period of time.
-         *
-         * timeLimit = now + ceil(nMaxMS/1000) + 1
-         *
-         * The last +1 compensates for not knowing
-         * when the next time() tick will happen.
-         *
-         * For example, if now is SECONDS.999 seconds
-         * the next tick will happen in 1 millisecond.
-         * Suppose nMaxMS is 500ms (1/2 second).
-         * Even rounding 500ms up to 1 second, the
-         * time limit without the +1 would be
-         * SECONDS+1 -- 1ms away. That's too soon.
-         *
-         * The extra +1 makes the maximum timeout
-         * longer than required. But the timeLimit
-         * is a safeguard anyway and usually the
-         * timeout will occur when the user wants.
+         * Remember the connection while on the done list,
+         * for LLRP_Transact_destruct() to take it off.
          */
-        return time(NULL) + ((nMaxMS + 1999u) / 1000u);
+        pTransact->pConn = pConn;
+        if(NULL == pConn->Transact.pDoneTail)
+        {
+            pConn->Transact.pDoneHead = pTransact;
+        }
+        else
+        {
+            pConn->Transact.pDoneTail->pNext = pTransact;
+        }
+        pConn->Transact.pDoneTail = pTransact;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to take a transaction off the pending list
+ **
+ *****************************************************************************/
+
+static void
+unlinkPendingTransact (
+  LLRP_tSConnection *           pConn,
+  LLRP_tSTransact *             pTransact)
+{
+    if(NULL == pTransact->pPrev)
+    {
+        pConn->Transact.pPendingHead = pTransact->pNext;
     }
     else
     {
-        /* Try indefinitely */
-        return 0;
+        pTransact->pPrev->pNext = pTransact->pNext;
+    }
+
+    if(NULL == pTransact->pNext)
+    {
+        pConn->Transact.pPendingTail = pTransact->pPrev;
+    }
+    else
+    {
+        pTransact->pNext->pPrev = pTransact->pPrev;
+    }
+
+    pTransact->pNext = NULL;
+    pTransact->pPrev = NULL;
+    pTransact->pConn = NULL;
+    pConn->Transact.nPending--;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to finish every pending transaction
+ **
+ ** Used when no response can come, the stream has failed or
+ ** the connection is closing.
+ **
+ *****************************************************************************/
+
+static void
+finishAllTransacts (
+  LLRP_tSConnection *           pConn,
+  LLRP_tResultCode              eResultCode,
+  const char *                  pWhatStr)
+{
+    while(NULL != pConn->Transact.pPendingHead)
+    {
+        finishTransact(pConn, pConn->Transact.pPendingHead,
+            eResultCode, pWhatStr, NULL);
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to finish transactions past their deadline
+ **
+ *****************************************************************************/
+
+static void
+expireTransacts (
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSTransact *           pTransact;
+    LLRP_tSTransact *           pNext;
+    llrp_u64_t                  Now;
+
+    if(0 == pConn->Transact.nPending)
+    {
+        return;
+    }
+
+    Now = getMonotonicMS();
+    for(pTransact = pConn->Transact.pPendingHead;
+        NULL != pTransact;
+        pTransact = pNext)
+    {
+        pNext = pTransact->pNext;
+        if(0 != pTransact->Deadline && Now >= pTransact->Deadline)
+        {
+            finishTransact(pConn, pTransact,
+                LLRP_RC_RecvTimeout, "timeout", NULL);
+        }
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to find the earliest pending deadline
+ **
+ ** @return     0               No pending transaction has one
+ **             >0              The earliest
+ **
+ *****************************************************************************/
+
+static llrp_u64_t
+earliestTransactDeadline (
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSTransact *           pTransact;
+    llrp_u64_t                  Earliest = 0;
+
+    for(pTransact = pConn->Transact.pPendingHead;
+        NULL != pTransact;
+        pTransact = pTransact->pNext)
+    {
+        if(0 != pTransact->Deadline &&
+           (0 == Earliest || pTransact->Deadline < Earliest))
+        {
+            Earliest = pTransact->Deadline;
+        }
+    }
+
+    return Earliest;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to take a transaction off the done list
+ **
+ ** The done list is short, the callbacks not yet made since the
+ ** last LLRP_Conn_transactPoll(), so it is searched.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  pTransact       A finished transaction on its done list
+ **
+ *****************************************************************************/
+
+static void
+unlinkDoneTransact (
+  LLRP_tSConnection *           pConn,
+  LLRP_tSTransact *             pTransact)
+{
+    LLRP_tSTransact *           pPrev = NULL;
+    LLRP_tSTransact *           pCur;
+
+    for(pCur = pConn->Transact.pDoneHead; NULL != pCur; pCur = pCur->pNext)
+    {
+        if(pCur == pTransact)
+        {
+            break;
+        }
+        pPrev = pCur;
+    }
+
+    if(NULL == pCur)
+    {
+        return;
+    }
+
+    if(NULL == pPrev)
+    {
+        pConn->Transact.pDoneHead = pTransact->pNext;
+    }
+    else
+    {
+        pPrev->pNext = pTransact->pNext;
+    }
+
+    if(pConn->Transact.pDoneTail == pTransact)
+    {
+        pConn->Transact.pDoneTail = pPrev;
+    }
+
+    pTransact->pNext = NULL;
+    pTransact->pConn = NULL;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to make the callbacks of finished transactions
+ **
+ ** Each transaction is off the done list before its callback is
+ ** made, so the callback may cancel others or submit new ones.
+ ** Those that finish are called back in the same pass.
+ **
+ *****************************************************************************/
+
+static void
+deliverTransacts (
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSTransact *           pTransact;
+
+    while(NULL != (pTransact = pConn->Transact.pDoneHead))
+    {
+        pConn->Transact.pDoneHead = pTransact->pNext;
+        if(NULL == pConn->Transact.pDoneHead)
+        {
+            pConn->Transact.pDoneTail = NULL;
+        }
+        pTransact->pNext = NULL;
+        pTransact->pConn = NULL;
+
+        (*pTransact->pfDone)(pTransact, pTransact->pAppContext);
+
+        LLRP_Transact_destruct(pTransact);
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to go back to the POSIX backend
+ **
+ ** What the backend has yet to send is sent first. The fd
+ ** is left open.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+static void
+detachIO (
+  LLRP_tSConnection *           pConn)
+{
+    if(&LLRP_ConnIO_POSIX == pConn->pIO)
+    {
+        return;
+    }
+
+    (*pConn->pIO->pfFlush)(pConn);
+    (*pConn->pIO->pfDetach)(pConn);
+
+    pConn->pIO = &LLRP_ConnIO_POSIX;
+    pConn->pIOContext = NULL;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routines of the POSIX backend
+ **
+ ** Plain poll(), read() and write() on the fd, as the connection
+ ** has always done. There is no state to set up.
+ **
+ *****************************************************************************/
+
+static int
+posixAttach (
+  LLRP_tSConnection *           pConn)
+{
+    return 0;
+}
+
+static void
+posixDetach (
+  LLRP_tSConnection *           pConn)
+{
+}
+
+static int
+posixWait (
+  LLRP_tSConnection *           pConn,
+  int                           nMS)
+{
+    struct pollfd               pfd;
+
+    pfd.fd = pConn->fd;
+    pfd.events = POLLIN | POLLERR | POLLHUP | POLLNVAL;
+    pfd.revents = 0;
+
+    return poll(&pfd, 1, nMS);
+}
+
+static int
+posixRead (
+  LLRP_tSConnection *           pConn,
+  unsigned char *               pBuf,
+  unsigned int                  nBuf,
+  llrp_bool_t                   bBlock)
+{
+    return read(pConn->fd, pBuf, nBuf);
+}
+
+static int
+posixWrite (
+  LLRP_tSConnection *           pConn,
+  const unsigned char *         pBuf,
+  unsigned int                  nBuf)
+{
+    unsigned int                nDone = 0;
+    int                         rc;
+
+    /*
+     * A blocking socket takes it all, unless interrupted.
+     */
+    while(nDone < nBuf)
+    {
+        rc = write(pConn->fd, &pBuf[nDone], nBuf - nDone);
+        if(0 > rc && EINTR == errno)
+        {
+            continue;
+        }
+        if(0 >= rc)
+        {
+            return -1;
+        }
+        nDone += rc;
     }
+
+    return nDone;
+}
+
+static int
+posixFlush (
+  LLRP_tSConnection *           pConn)
+{
+    /* Writes are done when posixWrite() returns */
+    return 0;
+}
+
+static int
+posixGetPollFd (
+  LLRP_tSConnection *           pConn)
+{
+    return pConn->fd;
 }
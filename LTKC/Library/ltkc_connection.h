@@ -33,6 +33,112 @@
 struct LLRP_SConnection;
 typedef struct LLRP_SConnection     LLRP_tSConnection;
 
+struct LLRP_SSendFrame;
+typedef struct LLRP_SSendFrame      LLRP_tSSendFrame;
+
+struct LLRP_SConnIO;
+typedef struct LLRP_SConnIO         LLRP_tSConnIO;
+
+struct LLRP_STransact;
+typedef struct LLRP_STransact       LLRP_tSTransact;
+
+struct LLRP_SConnGroup;
+struct LLRP_SConnGroupMember;
+struct LLRP_SConnGroupEvent;
+typedef struct LLRP_SConnGroup          LLRP_tSConnGroup;
+typedef struct LLRP_SConnGroupMember    LLRP_tSConnGroupMember;
+typedef struct LLRP_SConnGroupEvent     LLRP_tSConnGroupEvent;
+
+struct LLRP_SServer;
+typedef struct LLRP_SServer             LLRP_tSServer;
+
+struct LLRP_SProxy;
+struct LLRP_SProxySide;
+typedef struct LLRP_SProxy              LLRP_tSProxy;
+typedef struct LLRP_SProxySide          LLRP_tSProxySide;
+
+struct LLRP_SRecvThread;
+typedef struct LLRP_SRecvThread         LLRP_tSRecvThread;
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  What a pre-decode hook wants done with a frame
+ **
+ *****************************************************************************/
+
+enum LLRP_EPreDecodeAction
+{
+    /** Decode the frame as usual */
+    LLRP_PREDECODE_DECODE,
+
+    /** Drop the frame without decoding it. The hook has
+     ** counted it, forwarded it, or just doesn't want it. */
+    LLRP_PREDECODE_SKIP,
+};
+typedef enum LLRP_EPreDecodeAction  LLRP_tEPreDecodeAction;
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Structure of an I/O backend
+ **
+ ** A connection does all its socket I/O through one of these. The
+ ** default, LLRP_ConnIO_POSIX, is poll(), read() and write() on the
+ ** fd. LLRP_ConnIO_IOURING is io_uring. See LLRP_Conn_setIO().
+ **
+ ** A backend keeps what state it needs in pConn->pIOContext.
+ ** Functions that fail return -1 with errno set, like the system
+ ** calls they stand for. Only LLRP_ConnIO_POSIX lets one thread
+ ** send while another receives.
+ **
+ *****************************************************************************/
+
+struct LLRP_SConnIO
+{
+    /** For messages */
+    const char *                pName;
+
+    /** Set up on pConn->fd, which is connected. 0 or -1 */
+    int                         (*pfAttach)(
+                                  LLRP_tSConnection *   pConn);
+
+    /** Tear down. pfFlush has already been called. */
+    void                        (*pfDetach)(
+                                  LLRP_tSConnection *   pConn);
+
+    /** Wait up to nMS, -1 for ever, for pfRead to have input or
+     ** end-of-file. Like poll(): >0 ready, 0 timeout, -1 error */
+    int                         (*pfWait)(
+                                  LLRP_tSConnection *   pConn,
+                                  int                   nMS);
+
+    /** Like read(). Without bBlock, -1 with EAGAIN rather
+     ** than wait when there is no input yet. */
+    int                         (*pfRead)(
+                                  LLRP_tSConnection *   pConn,
+                                  unsigned char *       pBuf,
+                                  unsigned int          nBuf,
+                                  llrp_bool_t           bBlock);
+
+    /** Take all of pBuf for sending, or fail. The backend may
+     ** still be sending it on return. nBuf or -1 */
+    int                         (*pfWrite)(
+                                  LLRP_tSConnection *   pConn,
+                                  const unsigned char * pBuf,
+                                  unsigned int          nBuf);
+
+    /** Wait until everything pfWrite took is sent. 0 or -1 */
+    int                         (*pfFlush)(
+                                  LLRP_tSConnection *   pConn);
+
+    /** The fd an event loop watches for pfRead having input */
+    int                         (*pfGetPollFd)(
+                                  LLRP_tSConnection *   pConn);
+};
+
 
 /**
  *****************************************************************************
@@ -41,10 +147,18 @@ typedef struct LLRP_SConnection     LLRP_tSConnection;
  **
  ** An LLRP connection consists of:
  **     - A file descriptor (fd) likely, but not necessarily, a socket
+ **     - The I/O backend that does the socket I/O on the fd
  **     - An input queue of messages already received. Used to hold
- **       asynchronous messages while awaiting a response.
+ **       asynchronous messages while awaiting a response. It is
+ **       indexed by MessageID so finding a response is O(1).
+ **     - The send and receive buffers start at nBufferSize. Each
+ **       grows, up to nMaxBufferSize, when a frame needs it and
+ **       goes back after a while without big frames.
  **     - Receiver state.
- **         - The receive buffer and count
+ **         - The receive buffer, count, and read-ahead position.
+ **           Each read() takes as many bytes as the socket has
+ **           (up to the buffer size) so a burst of small frames
+ **           costs one read() rather than two per frame.
  **         - Whether a frame is valid. Valid means that the receive
  **           buffer holds a frame and the MessageLength, MessageType,
  **           ProtocolVersion, and MessageID are valid (usable).
@@ -52,12 +166,22 @@ typedef struct LLRP_SConnection     LLRP_tSConnection;
  **           is being received. Sometimes we want to look at the frame
  **           after it has been (or attempted to be) decoded.
  **         - Top-level frame variables: tSFrameExtract
+ **         - The frame decoder, kept and reused for every frame.
+ **         - Optionally, a hook that sees each frame header first
+ **           and may skip decoding it.
+ **         - Optionally, decoding each message into an arena.
+ **         - Optionally, byte vectors that point into a copy of the frame.
  **         - Details of the last receiver error, including I/O errors,
  **           end-of-file (EOF), timeout, or decode errors.
  **     - Send state
  **         - The send buffer and count
+ **         - The frame encoder, kept and reused for every message.
  **         - Details of the last send error, including I/O errors,
  **           or encode errors.
+ **         - Optionally, non-blocking mode with a queue of encoded
+ **           frames not yet written. See LLRP_Conn_setSendNonBlocking().
+ **     - Asynchronous transactions awaiting a response and those
+ **       finished but not yet reported. See LLRP_Conn_transactSubmit().
  **
  *****************************************************************************/
 
@@ -66,6 +190,11 @@ struct LLRP_SConnection
     /** The file descriptor, probably a socket */
     int                         fd;
 
+    /** The I/O backend, LLRP_ConnIO_POSIX unless LLRP_Conn_setIO()
+     ** chose another, and its state */
+    const LLRP_tSConnIO *       pIO;
+    void *                      pIOContext;
+
     /** Error message if openConnectionToReader() or close...() fail */
     const char *                pConnectErrorStr;
 
@@ -73,21 +202,70 @@ struct LLRP_SConnection
     const LLRP_tSTypeRegistry * pTypeRegistry;
 
     /** Head of queue of messages already received. Probably events.
-     ** the queue is a one-way, NULL terminated linked list. */
+     ** the queue is a two-way, NULL terminated linked list
+     ** through pQueueNext and pQueuePrev, oldest first. */
     LLRP_tSMessage *            pInputQueue;
 
-    /** Size of the send/recv buffers, below, specified at construct() time */
+    /** Tail of the input queue, so appending is O(1) */
+    LLRP_tSMessage *            pInputQueueTail;
+
+    /** Index of the input queue by MessageID so recvResponse()
+     ** finds a response without scanning queued events. A hash
+     ** table of chains through pIndexNext, each oldest first.
+     ** MessageID 0, which events carry, is left out. It doubles
+     ** in size as the queue grows. nBucket is 0 until first use,
+     ** or if allocation failed, in which case lookups scan the
+     ** queue. */
+    struct
+    {
+        /** Per-bucket chain head and tail */
+        LLRP_tSMessage **   apHead;
+        LLRP_tSMessage **   apTail;
+
+        /** Count of buckets, a power of 2 */
+        unsigned int        nBucket;
+
+        /** Count of messages in the index. MessageID 0 is
+         ** never indexed, so this may be less than the queue */
+        unsigned int        nMessage;
+    }                           InputIndex;
+
+    /** Initial size of the send/recv buffers, below, specified at
+     ** construct() time. A buffer grows past this only for a frame
+     ** that needs it. */
     unsigned int                nBufferSize;
 
+    /** Most either buffer may grow to. See LLRP_Conn_setBufferLimits() */
+    unsigned int                nMaxBufferSize;
+
+    /** A grown buffer goes back to nBufferSize once it has gone this
+     ** long without holding a frame bigger than that */
+    unsigned int                nIdleShrinkMS;
+
     /** Receive state */
     struct
     {
         /** The buffer. Contains incomming frame. */
         unsigned char *     pBuffer;
 
-        /** Count of bytes currently in buffer */
+        /** Size of pBuffer as allocated now, from nBufferSize
+         ** up to nMaxBufferSize */
+        unsigned int        nAlloc;
+
+        /** When the buffer last held more than nBufferSize bytes.
+         ** Monotonic ms, see LLRP_Conn_calculateDeadline() */
+        llrp_u64_t          LastLargeMS;
+
+        /** Count of bytes currently in buffer. With read-ahead
+         ** this can include bytes beyond the current frame. */
         unsigned int        nBuffer;
 
+        /** Index of the first byte in the buffer not yet consumed.
+         ** Bytes from iNext to nBuffer are the start of the next
+         ** frame(s), read ahead of need. They are moved to the
+         ** front of the buffer only when more input is required. */
+        unsigned int        iNext;
+
         /** Valid boolean. TRUE means the buffer and frame summary
          ** variables are valid (usable). This is always
          ** FALSE mid receive */
@@ -98,6 +276,34 @@ struct LLRP_SConnection
 
         /** Details of last I/O or decoder error. */
         LLRP_tSErrorDetails ErrorDetails;
+
+        /** Called with each complete frame before it is decoded.
+         ** See LLRP_Conn_setPreDecodeHook(). */
+        LLRP_tEPreDecodeAction (*pfPreDecode)(
+                              LLRP_tSConnection *   pConn,
+                              const LLRP_tSFrameExtract *
+                                                    pFrameExtract,
+                              const unsigned char * pFrame,
+                              unsigned int          nFrame,
+                              void *                pPreDecodeArg);
+
+        /** Passed to pfPreDecode */
+        void *              pPreDecodeArg;
+
+        /** Decode each message into an arena of its own.
+         ** See LLRP_Conn_setDecodeArena(). */
+        llrp_bool_t         bDecodeArena;
+
+        /** Point byte vectors into the message's copy of the frame.
+         ** See LLRP_Conn_setDecodeZeroCopy(). */
+        llrp_bool_t         bDecodeZeroCopy;
+
+        /** Decode each sub-parameter of a message when first read.
+         ** See LLRP_Conn_setDecodeLazy(). */
+        llrp_bool_t         bDecodeLazy;
+
+        /** The frame decoder, reset for each frame */
+        LLRP_tSFrameDecoder Decoder;
     }                           Recv;
 
     /** Send state */
@@ -106,12 +312,162 @@ struct LLRP_SConnection
         /** The buffer. Contains outgoing frame. */
         unsigned char *     pBuffer;
 
+        /** Size of pBuffer as allocated now, from nBufferSize
+         ** up to nMaxBufferSize */
+        unsigned int        nAlloc;
+
+        /** When the buffer last held a frame bigger than
+         ** nBufferSize. Monotonic ms. */
+        llrp_u64_t          LastLargeMS;
+
         /** Count of bytes currently in buffer (from last send) */
         unsigned int        nBuffer;
 
         /** Details of last I/O or encoder error. */
         LLRP_tSErrorDetails ErrorDetails;
+
+        /** The frame encoder, reset for each message */
+        LLRP_tSFrameEncoder Encoder;
+
+        /** TRUE means sends never block. What the socket will not
+         ** take now is queued and written by LLRP_Conn_sendFlush() */
+        llrp_bool_t         bNonBlocking;
+
+        /** Queue of frames not yet completely written, oldest first */
+        LLRP_tSSendFrame *  pQueueHead;
+        LLRP_tSSendFrame *  pQueueTail;
+
+        /** Count of bytes in the queue not yet written */
+        unsigned int        nQueueBytes;
+
+        /** Most bytes the queue may hold before a send is refused */
+        unsigned int        nMaxQueueBytes;
+
+        /** Called with TRUE when the queue becomes non-empty and
+         ** FALSE when it drains, so an event loop can watch for
+         ** the fd becoming writable only while it matters */
+        void                (*pfWatch)(
+                              LLRP_tSConnection *   pConn,
+                              llrp_bool_t           bWantWrite,
+                              void *                pWatchArg);
+
+        /** Passed to pfWatch */
+        void *              pWatchArg;
     }                           Send;
+
+    /** Asynchronous transaction state */
+    struct
+    {
+        /** Transactions awaiting a response, oldest first.
+         ** Two-way linked through pNext and pPrev. */
+        LLRP_tSTransact *   pPendingHead;
+        LLRP_tSTransact *   pPendingTail;
+
+        /** Count of transactions awaiting a response */
+        unsigned int        nPending;
+
+        /** Finished transactions with a callback not yet made,
+         ** oldest first, linked through pNext */
+        LLRP_tSTransact *   pDoneHead;
+        LLRP_tSTransact *   pDoneTail;
+
+        /** Count of transactions ever finished. Lets
+         ** LLRP_Conn_transactPoll() see that one did. */
+        unsigned int        nFinished;
+
+        /** Last MessageID assigned by LLRP_Conn_transactSubmit() */
+        llrp_u32_t          LastMessageID;
+    }                           Transact;
+};
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  An asynchronous transaction
+ **
+ ** Made by LLRP_Conn_transactSubmit(). The request has been sent
+ ** (or queued, in non-blocking mode) and the transaction is
+ ** pending until the response, or ErrorAck, with the same
+ ** MessageID is decoded, the deadline passes, or it is cancelled.
+ **
+ ** The response is matched as it is decoded, whichever receive
+ ** routine decodes it, so it never shows up in the input queue.
+ ** Timeouts are noticed, and callbacks made, by
+ ** LLRP_Conn_transactPoll().
+ **
+ ** With a callback, the transaction belongs to the library and
+ ** is destructed when the callback returns. Without one, the
+ ** application polls LLRP_Transact_isDone() and must call
+ ** LLRP_Transact_destruct() when finished with it.
+ **
+ *****************************************************************************/
+
+struct LLRP_STransact
+{
+    /** The connection while pending, or finished with a callback
+     ** not yet made. NULL otherwise. */
+    LLRP_tSConnection *         pConn;
+
+    /** Next and previous on the pending list, or next on
+     ** the done list */
+    LLRP_tSTransact *           pNext;
+    LLRP_tSTransact *           pPrev;
+
+    /** MessageID of the request, and so of the response */
+    llrp_u32_t                  MessageID;
+
+    /** The sought response type. NULL matches any message
+     ** with the MessageID. */
+    const LLRP_tSTypeDescriptor * pResponseType;
+
+    /** The ErrorAck type, which also matches */
+    const LLRP_tSTypeDescriptor * pErrorAckType;
+
+    /** From LLRP_Conn_calculateDeadline(), 0 => none */
+    llrp_u64_t                  Deadline;
+
+    /** Called once when the transaction finishes */
+    void                        (*pfDone)(
+                                  LLRP_tSTransact *     pTransact,
+                                  void *                pAppContext);
+
+    /** Passed to pfDone */
+    void *                      pAppContext;
+
+    /** TRUE once finished, one way or another */
+    llrp_bool_t                 bDone;
+
+    /** The response, until taken by LLRP_Transact_takeResponse() */
+    LLRP_tSMessage *            pResponse;
+
+    /** LLRP_RC_OK with a response, else why not */
+    LLRP_tSErrorDetails         ErrorDetails;
+};
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  An encoded frame waiting in the non-blocking send queue
+ **
+ ** The frame bytes are allocated right after this structure.
+ **
+ *****************************************************************************/
+
+struct LLRP_SSendFrame
+{
+    /** Next (newer) frame in the queue */
+    LLRP_tSSendFrame *          pNext;
+
+    /** The frame bytes */
+    unsigned char *             pFrame;
+
+    /** Size of the frame */
+    unsigned int                nFrame;
+
+    /** Count of bytes already written */
+    unsigned int                iNext;
 };
 
 
@@ -150,6 +506,29 @@ extern const char *
 LLRP_Conn_getConnectError (
   LLRP_tSConnection *           pConn);
 
+extern int
+LLRP_Conn_setIO (
+  LLRP_tSConnection *           pConn,
+  const LLRP_tSConnIO *         pIO);
+
+extern int
+LLRP_Conn_getPollFd (
+  LLRP_tSConnection *           pConn);
+
+/* The backends. LLRP_ConnIO_IOURING is in ltkc_iouring.c. */
+extern const LLRP_tSConnIO      LLRP_ConnIO_POSIX;
+extern const LLRP_tSConnIO      LLRP_ConnIO_IOURING;
+
+extern LLRP_tResultCode
+LLRP_Conn_setBufferLimits (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  nMaxBufferSize,
+  unsigned int                  nIdleShrinkMS);
+
+extern void
+LLRP_Conn_shrinkIdleBuffers (
+  LLRP_tSConnection *           pConn);
+
 extern LLRP_tSMessage *
 LLRP_Conn_transact (
   LLRP_tSConnection *           pConn,
@@ -160,20 +539,93 @@ extern const LLRP_tSErrorDetails *
 LLRP_Conn_getTransactError (
   LLRP_tSConnection *           pConn);
 
+extern LLRP_tSTransact *
+LLRP_Conn_transactSubmit (
+  LLRP_tSConnection *           pConn,
+  LLRP_tSMessage *              pSendMessage,
+  const LLRP_tSTypeDescriptor * pResponseType,
+  int                           nMaxMS,
+  void                          (*pfDone)(
+                                  LLRP_tSTransact *     pTransact,
+                                  void *                pAppContext),
+  void *                        pAppContext);
+
+extern LLRP_tResultCode
+LLRP_Conn_transactPoll (
+  LLRP_tSConnection *           pConn,
+  int                           nMaxMS);
+
+extern unsigned int
+LLRP_Conn_getTransactPendingCount (
+  LLRP_tSConnection *           pConn);
+
+extern void
+LLRP_Transact_cancel (
+  LLRP_tSTransact *             pTransact);
+
+extern llrp_bool_t
+LLRP_Transact_isDone (
+  LLRP_tSTransact *             pTransact);
+
+extern const LLRP_tSErrorDetails *
+LLRP_Transact_getError (
+  LLRP_tSTransact *             pTransact);
+
+extern LLRP_tSMessage *
+LLRP_Transact_takeResponse (
+  LLRP_tSTransact *             pTransact);
+
+extern void
+LLRP_Transact_destruct (
+  LLRP_tSTransact *             pTransact);
+
 extern LLRP_tResultCode
 LLRP_Conn_sendMessage (
   LLRP_tSConnection *           pConn,
   LLRP_tSMessage *              pMessage);
 
+extern LLRP_tResultCode
+LLRP_Conn_sendFrame (
+  LLRP_tSConnection *           pConn,
+  const unsigned char *         pFrame,
+  unsigned int                  nFrame);
+
 extern const LLRP_tSErrorDetails *
 LLRP_Conn_getSendError (
   LLRP_tSConnection *           pConn);
 
+extern LLRP_tResultCode
+LLRP_Conn_setSendNonBlocking (
+  LLRP_tSConnection *           pConn,
+  llrp_bool_t                   bNonBlocking,
+  unsigned int                  nMaxQueueBytes);
+
+extern void
+LLRP_Conn_setSendWatch (
+  LLRP_tSConnection *           pConn,
+  void                          (*pfWatch)(
+                                  LLRP_tSConnection *   pConn,
+                                  llrp_bool_t           bWantWrite,
+                                  void *                pWatchArg),
+  void *                        pWatchArg);
+
+extern LLRP_tResultCode
+LLRP_Conn_sendFlush (
+  LLRP_tSConnection *           pConn);
+
+extern unsigned int
+LLRP_Conn_getSendQueueBytes (
+  LLRP_tSConnection *           pConn);
+
 extern LLRP_tSMessage *
 LLRP_Conn_recvMessage (
   LLRP_tSConnection *           pConn,
   int                           nMaxMS);
 
+extern LLRP_tSMessage *
+LLRP_Conn_recvQueued (
+  LLRP_tSConnection *           pConn);
+
 extern LLRP_tSMessage *
 LLRP_Conn_recvResponse (
   LLRP_tSConnection *           pConn,
@@ -185,3 +637,368 @@ extern const LLRP_tSErrorDetails *
 LLRP_Conn_getRecvError (
   LLRP_tSConnection *           pConn);
 
+extern llrp_u64_t
+LLRP_Conn_calculateDeadline (
+  int                           nMaxMS);
+
+extern int
+LLRP_Conn_remainingMS (
+  llrp_u64_t                    Deadline);
+
+extern void
+LLRP_Conn_setPreDecodeHook (
+  LLRP_tSConnection *           pConn,
+  LLRP_tEPreDecodeAction        (*pfPreDecode)(
+                                  LLRP_tSConnection *   pConn,
+                                  const LLRP_tSFrameExtract *
+                                                        pFrameExtract,
+                                  const unsigned char * pFrame,
+                                  unsigned int          nFrame,
+                                  void *                pPreDecodeArg),
+  void *                        pPreDecodeArg);
+
+extern void
+LLRP_Conn_setDecodeArena (
+  LLRP_tSConnection *           pConn,
+  llrp_bool_t                   bDecodeArena);
+
+extern void
+LLRP_Conn_setDecodeZeroCopy (
+  LLRP_tSConnection *           pConn,
+  llrp_bool_t                   bDecodeZeroCopy);
+
+extern void
+LLRP_Conn_setDecodeLazy (
+  LLRP_tSConnection *           pConn,
+  llrp_bool_t                   bDecodeLazy);
+
+extern LLRP_tResultCode
+LLRP_Conn_recvFill (
+  LLRP_tSConnection *           pConn);
+
+extern LLRP_tResultCode
+LLRP_Conn_recvDecodeBuffered (
+  LLRP_tSConnection *           pConn);
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Structure of a connection group instance
+ **
+ ** A connection group watches many connections with one epoll
+ ** instance so one thread can service many readers. Each wait
+ ** delivers one decoded message, or one connection error, tagged
+ ** with the connection it came from.
+ **
+ ** Receiving is done with LLRP_Conn_recvFill() and
+ ** LLRP_Conn_recvDecodeBuffered() so the frame extract, decode,
+ ** input queue, and per-connection error details are the same as
+ ** for LLRP_Conn_recvMessage(). While a connection is in a group
+ ** the application should receive only through the group.
+ ** Sending is unchanged, except that the group installs itself as
+ ** the send watch and flushes a non-blocking send queue when the
+ ** fd becomes writable.
+ **
+ *****************************************************************************/
+
+struct LLRP_SConnGroupMember
+{
+    /** The group this is a member of */
+    LLRP_tSConnGroup *          pGroup;
+
+    /** The connection. Not owned by the group. */
+    LLRP_tSConnection *         pConn;
+
+    /** Whatever the application passed to LLRP_ConnGroup_add() */
+    void *                      pAppContext;
+
+    /** Next in the list of all members */
+    LLRP_tSConnGroupMember *    pNextMember;
+
+    /** Next in the list of members with something to deliver */
+    LLRP_tSConnGroupMember *    pNextReady;
+
+    /** TRUE while on the ready list */
+    llrp_bool_t                 bReady;
+
+    /** TRUE while the fd is registered with epoll. Cleared
+     ** after an error that ends the stream (EOF, I/O, framing) */
+    llrp_bool_t                 bWatched;
+
+    /** Receive error not yet delivered. Delivered after any
+     ** messages already in the connection's input queue. */
+    LLRP_tResultCode            ePendingError;
+};
+
+struct LLRP_SConnGroup
+{
+    /** The epoll instance */
+    int                         epfd;
+
+    /** All members, in no particular order */
+    LLRP_tSConnGroupMember *    pMemberList;
+
+    /** Count of members */
+    unsigned int                nMember;
+
+    /** Members with messages or errors to deliver. FIFO, so
+     ** a busy reader does not starve the others. */
+    LLRP_tSConnGroupMember *    pReadyHead;
+    LLRP_tSConnGroupMember *    pReadyTail;
+
+    /** Details of last group error, e.g. epoll failure */
+    LLRP_tSErrorDetails         ErrorDetails;
+};
+
+struct LLRP_SConnGroupEvent
+{
+    /** The connection the event is about */
+    LLRP_tSConnection *         pConn;
+
+    /** Whatever the application passed to LLRP_ConnGroup_add() */
+    void *                      pAppContext;
+
+    /** The message, now owned by the application.
+     ** NULL for an error event. */
+    LLRP_tSMessage *            pMessage;
+
+    /** DeviceSN from the message header. 0 for an error event. */
+    llrp_u64_t                  DeviceSN;
+
+    /** LLRP_RC_OK for a message, else the receive (or send) error.
+     ** LLRP_Conn_getRecvError() has the details. */
+    LLRP_tResultCode            eResultCode;
+};
+
+
+/*
+ * ltkc_conngroup.c
+ */
+extern LLRP_tSConnGroup *
+LLRP_ConnGroup_construct (void);
+
+extern void
+LLRP_ConnGroup_destruct (
+  LLRP_tSConnGroup *            pGroup);
+
+extern LLRP_tResultCode
+LLRP_ConnGroup_add (
+  LLRP_tSConnGroup *            pGroup,
+  LLRP_tSConnection *           pConn,
+  void *                        pAppContext);
+
+extern LLRP_tResultCode
+LLRP_ConnGroup_remove (
+  LLRP_tSConnGroup *            pGroup,
+  LLRP_tSConnection *           pConn);
+
+extern LLRP_tResultCode
+LLRP_ConnGroup_wait (
+  LLRP_tSConnGroup *            pGroup,
+  int                           nMaxMS,
+  LLRP_tSConnGroupEvent *       pEvent);
+
+extern const LLRP_tSErrorDetails *
+LLRP_ConnGroup_getError (
+  LLRP_tSConnGroup *            pGroup);
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Structure of a server instance
+ **
+ ** A server listens for upstream connections, readers in client
+ ** mode, and accepts any number of them. Each is handed back as
+ ** a LLRP_tSConnection of its own.
+ **
+ *****************************************************************************/
+
+/** LLRP_Server_listen() option: share the port with other servers
+ ** (SO_REUSEPORT), one per worker thread */
+#define LLRP_SERVER_REUSEPORT   (0x1u)
+
+struct LLRP_SServer
+{
+    /** The listening socket, non-blocking. -1 until listening.
+     ** Readable means a connection is waiting. */
+    int                         fd;
+
+    /** The registry handed to each accepted connection */
+    const LLRP_tSTypeRegistry * pTypeRegistry;
+
+    /** Buffer size of each accepted connection */
+    unsigned int                nBufferSize;
+
+    /** Details of last server error */
+    LLRP_tSErrorDetails         ErrorDetails;
+};
+
+
+/*
+ * ltkc_server.c
+ */
+extern LLRP_tSServer *
+LLRP_Server_construct (
+  const LLRP_tSTypeRegistry *   pTypeRegistry,
+  unsigned int                  nBufferSize);
+
+extern void
+LLRP_Server_destruct (
+  LLRP_tSServer *               pServer);
+
+extern LLRP_tResultCode
+LLRP_Server_listen (
+  LLRP_tSServer *               pServer,
+  const char *                  pLocalAddr,
+  unsigned int                  Port,
+  int                           nBacklog,
+  unsigned int                  Options);
+
+extern LLRP_tSConnection *
+LLRP_Server_accept (
+  LLRP_tSServer *               pServer,
+  int                           nMaxMS);
+
+extern const LLRP_tSErrorDetails *
+LLRP_Server_getError (
+  LLRP_tSServer *               pServer);
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Structure of a passthrough proxy instance
+ **
+ ** A proxy relays frames between a reader connection and an
+ ** upstream connection byte-for-byte, without decoding them.
+ ** Selected message types can be decoded on the side for
+ ** inspection. See ltkc_proxy.c.
+ **
+ *****************************************************************************/
+
+struct LLRP_SProxySide
+{
+    /** The proxy this is one direction of */
+    LLRP_tSProxy *              pProxy;
+
+    /** Frames are received from pFrom and sent to pTo */
+    LLRP_tSConnection *         pFrom;
+    LLRP_tSConnection *         pTo;
+
+    /** Complete frames received but not yet sent, in
+     ** pFrom's receive buffer */
+    const unsigned char *       pBatch;
+    unsigned int                nBatch;
+
+    /** Counts of frames and bytes relayed */
+    llrp_u64_t                  nFrameRelayed;
+    llrp_u64_t                  nByteRelayed;
+};
+
+struct LLRP_SProxy
+{
+    /** Reader to upstream */
+    LLRP_tSProxySide            Upstream;
+
+    /** Upstream to reader */
+    LLRP_tSProxySide            Downstream;
+
+    /** One bit per MessageType, set to decode on the side */
+    unsigned char               aInspect[65536u / 8u];
+
+    /** Handed each inspected message. See
+     ** LLRP_Proxy_setInspectCallback() */
+    void                        (*pfInspect)(
+                                  LLRP_tSProxy *        pProxy,
+                                  LLRP_tSConnection *   pFrom,
+                                  LLRP_tSMessage *      pMessage,
+                                  void *                pInspectArg);
+
+    /** Passed to pfInspect */
+    void *                      pInspectArg;
+
+    /** Details of last proxy error */
+    LLRP_tSErrorDetails         ErrorDetails;
+
+    /** The connection the last error happened on */
+    LLRP_tSConnection *         pErrorConn;
+};
+
+
+/*
+ * ltkc_proxy.c
+ */
+extern LLRP_tSProxy *
+LLRP_Proxy_construct (
+  LLRP_tSConnection *           pReader,
+  LLRP_tSConnection *           pUpper);
+
+extern void
+LLRP_Proxy_destruct (
+  LLRP_tSProxy *                pProxy);
+
+extern void
+LLRP_Proxy_setInspect (
+  LLRP_tSProxy *                pProxy,
+  llrp_u16_t                    MessageType,
+  llrp_bool_t                   bInspect);
+
+extern void
+LLRP_Proxy_setInspectCallback (
+  LLRP_tSProxy *                pProxy,
+  void                          (*pfInspect)(
+                                  LLRP_tSProxy *        pProxy,
+                                  LLRP_tSConnection *   pFrom,
+                                  LLRP_tSMessage *      pMessage,
+                                  void *                pInspectArg),
+  void *                        pInspectArg);
+
+extern LLRP_tResultCode
+LLRP_Proxy_run (
+  LLRP_tSProxy *                pProxy,
+  int                           nMaxMS);
+
+extern const LLRP_tSErrorDetails *
+LLRP_Proxy_getError (
+  LLRP_tSProxy *                pProxy);
+
+
+/*
+ * ltkc_recvthread.c
+ *
+ * A receive thread reads and decodes a connection on a thread of its
+ * own and hands the messages over through a lock-free ring. The
+ * structure is private to ltkc_recvthread.c. Its members are shared
+ * between threads and are only safe to touch through these functions.
+ */
+extern LLRP_tSRecvThread *
+LLRP_RecvThread_construct (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  nRing);
+
+extern void
+LLRP_RecvThread_destruct (
+  LLRP_tSRecvThread *           pRecvThread);
+
+extern LLRP_tResultCode
+LLRP_RecvThread_start (
+  LLRP_tSRecvThread *           pRecvThread);
+
+extern void
+LLRP_RecvThread_stop (
+  LLRP_tSRecvThread *           pRecvThread);
+
+extern LLRP_tSMessage *
+LLRP_RecvThread_recvMessage (
+  LLRP_tSRecvThread *           pRecvThread,
+  int                           nMaxMS);
+
+extern int
+LLRP_RecvThread_getEventFd (
+  LLRP_tSRecvThread *           pRecvThread);
+
+extern const LLRP_tSErrorDetails *
+LLRP_RecvThread_getError (
+  LLRP_tSRecvThread *           pRecvThread);
@@ -0,0 +1,728 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  ltkc_conngroup.c
+ **
+ ** @brief Functions to receive LLRP messages from many connections
+ **
+ ** A connection group registers the fd of each member connection
+ ** with one epoll instance. LLRP_ConnGroup_wait() returns one
+ ** decoded message at a time, tagged with the connection and
+ ** the DeviceSN it came from. One thread can service hundreds
+ ** of readers this way rather than one thread per reader.
+ **
+ ** epoll is level-triggered. When a member is readable it gets
+ ** one read() and every complete frame is decoded into the member
+ ** connection's input queue. The member then goes on the ready
+ ** list. Ready members are served round-robin, one message per
+ ** wait, so a chatty reader cannot starve a quiet one.
+ **
+ ** A member in non-blocking send mode with frames queued is also
+ ** watched for writable, and its queue is flushed from the wait.
+ **
+ *****************************************************************************/
+
+
+#include <unistd.h>
+#include <errno.h>
+#include <sys/epoll.h>
+
+#include "ltkc_platform.h"
+#include "ltkc_base.h"
+#include "ltkc_frame.h"
+#include "ltkc_connection.h"
+
+
+/*
+ * Most epoll events collected per epoll_wait()
+ */
+#define LLRP_CONNGROUP_MAX_EVENTS   (64u)
+
+
+/* forward declaration of private routines. */
+static LLRP_tSConnGroupMember *
+findMember (
+  LLRP_tSConnGroup *            pGroup,
+  LLRP_tSConnection *           pConn);
+
+static void
+pumpMember (
+  LLRP_tSConnGroup *            pGroup,
+  LLRP_tSConnGroupMember *      pMember);
+
+static void
+unwatchMember (
+  LLRP_tSConnGroup *            pGroup,
+  LLRP_tSConnGroupMember *      pMember);
+
+static void
+makeReady (
+  LLRP_tSConnGroup *            pGroup,
+  LLRP_tSConnGroupMember *      pMember);
+
+static void
+sendWatch (
+  LLRP_tSConnection *           pConn,
+  llrp_bool_t                   bWantWrite,
+  void *                        pWatchArg);
+
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Construct a new connection group instance
+ **
+ ** @return     !=NULL          Pointer to connection group instance
+ **             ==NULL          Error, allocation or epoll_create() failed
+ **
+ *****************************************************************************/
+
+LLRP_tSConnGroup *
+LLRP_ConnGroup_construct (void)
+{
+    LLRP_tSConnGroup *          pGroup;
+
+    /*
+     * Allocate, check, and zero-fill group instance.
+     */
+    pGroup = malloc(sizeof *pGroup);
+    if(NULL == pGroup)
+    {
+        return pGroup;
+    }
+    memset(pGroup, 0, sizeof *pGroup);
+
+    /*
+     * Create the epoll instance. Close-on-exec so it does
+     * not leak into child processes.
+     */
+    pGroup->epfd = epoll_create1(EPOLL_CLOEXEC);
+    if(0 > pGroup->epfd)
+    {
+        free(pGroup);
+        return NULL;
+    }
+
+    /*
+     * Victory
+     */
+    return pGroup;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Destruct a connection group instance
+ **
+ ** The member connections are not closed or destructed.
+ ** Messages already decoded stay in their input queues.
+ ** Their send watches are cleared, as by LLRP_ConnGroup_remove().
+ **
+ ** @param[in]  pGroup          Pointer to the connection group instance.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_ConnGroup_destruct (
+  LLRP_tSConnGroup *            pGroup)
+{
+    if(NULL != pGroup)
+    {
+        /*
+         * Free the member records
+         */
+        while(NULL != pGroup->pMemberList)
+        {
+            LLRP_tSConnGroupMember *    pMember;
+
+            pMember = pGroup->pMemberList;
+            pGroup->pMemberList = pMember->pNextMember;
+
+            /* The watch would otherwise point at the freed member */
+            LLRP_Conn_setSendWatch(pMember->pConn, NULL, NULL);
+
+            free(pMember);
+        }
+
+        close(pGroup->epfd);
+
+        /*
+         * Wipe it out so any stale uses are likely to crash
+         * on a NULL pointer.
+         */
+        memset(pGroup, 0, sizeof *pGroup);
+
+        free(pGroup);
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Add a connection to a group
+ **
+ ** The connection must already be open. If its input queue
+ ** already holds messages, or its receive buffer already holds
+ ** complete frames, they are delivered by the next wait.
+ **
+ ** @param[in]  pGroup          Pointer to the connection group instance.
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  pAppContext     Anything. Handed back in each event.
+ **
+ ** @return     LLRP_RC_OK          Added
+ **             LLRP_RC_MiscError   Not connected, already a member,
+ **                                 allocation or epoll_ctl() failed.
+ **                                 Check LLRP_ConnGroup_getError().
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+LLRP_ConnGroup_add (
+  LLRP_tSConnGroup *            pGroup,
+  LLRP_tSConnection *           pConn,
+  void *                        pAppContext)
+{
+    LLRP_tSErrorDetails *       pError = &pGroup->ErrorDetails;
+    LLRP_tSConnGroupMember *    pMember;
+    struct epoll_event          Event;
+
+    LLRP_Error_clear(pError);
+
+    if(0 > pConn->fd)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "not connected");
+        return pError->eResultCode;
+    }
+
+    if(NULL != findMember(pGroup, pConn))
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "already a member");
+        return pError->eResultCode;
+    }
+
+    pMember = malloc(sizeof *pMember);
+    if(NULL == pMember)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "member allocation failed");
+        return pError->eResultCode;
+    }
+    memset(pMember, 0, sizeof *pMember);
+
+    pMember->pConn = pConn;
+    pMember->pAppContext = pAppContext;
+    pMember->ePendingError = LLRP_RC_OK;
+
+    /*
+     * Register the fd. The member record is the epoll
+     * user data so a ready event leads straight to it.
+     */
+    memset(&Event, 0, sizeof Event);
+    Event.events = EPOLLIN | EPOLLRDHUP;
+    Event.data.ptr = pMember;
+
+    if(0 > epoll_ctl(pGroup->epfd, EPOLL_CTL_ADD,
+            LLRP_Conn_getPollFd(pConn), &Event))
+    {
+        free(pMember);
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "epoll_ctl() failed");
+        return pError->eResultCode;
+    }
+    pMember->bWatched = TRUE;
+    pMember->pGroup = pGroup;
+
+    /*
+     * Take over the send watch so a non-blocking send queue
+     * is flushed when the fd becomes writable. Arm it now
+     * if frames are already waiting.
+     */
+    LLRP_Conn_setSendWatch(pConn, sendWatch, pMember);
+    if(NULL != pConn->Send.pQueueHead)
+    {
+        sendWatch(pConn, TRUE, pMember);
+    }
+
+    pMember->pNextMember = pGroup->pMemberList;
+    pGroup->pMemberList = pMember;
+    pGroup->nMember++;
+
+    /*
+     * Pick up anything received before the connection
+     * joined the group. Without this, complete frames already
+     * in the buffer would wait for the socket to be readable.
+     */
+    pMember->ePendingError = LLRP_Conn_recvDecodeBuffered(pConn);
+    if(NULL != pConn->pInputQueue || LLRP_RC_OK != pMember->ePendingError)
+    {
+        makeReady(pGroup, pMember);
+    }
+
+    return pError->eResultCode;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Remove a connection from a group
+ **
+ ** The connection is not closed. Messages already decoded stay
+ ** in its input queue and can be had with LLRP_Conn_recvMessage().
+ ** Its send watch is cleared; queued frames stay queued for
+ ** LLRP_Conn_sendFlush().
+ **
+ ** @param[in]  pGroup          Pointer to the connection group instance.
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return     LLRP_RC_OK          Removed
+ **             LLRP_RC_MiscError   Not a member
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+LLRP_ConnGroup_remove (
+  LLRP_tSConnGroup *            pGroup,
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSErrorDetails *       pError = &pGroup->ErrorDetails;
+    LLRP_tSConnGroupMember *    pMember;
+    LLRP_tSConnGroupMember **   ppMember;
+    LLRP_tSConnGroupMember *    pPrev;
+
+    LLRP_Error_clear(pError);
+
+    /*
+     * Find and unlink from the member list
+     */
+    for(
+        ppMember = &pGroup->pMemberList;
+        NULL != (pMember = *ppMember);
+        ppMember = &pMember->pNextMember)
+    {
+        if(pMember->pConn == pConn)
+        {
+            break;
+        }
+    }
+
+    if(NULL == pMember)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "not a member");
+        return pError->eResultCode;
+    }
+
+    *ppMember = pMember->pNextMember;
+    pGroup->nMember--;
+
+    /*
+     * Unlink from the ready list, if there
+     */
+    if(pMember->bReady)
+    {
+        pPrev = NULL;
+        for(
+            ppMember = &pGroup->pReadyHead;
+            *ppMember != pMember;
+            ppMember = &(*ppMember)->pNextReady)
+        {
+            pPrev = *ppMember;
+        }
+
+        *ppMember = pMember->pNextReady;
+        if(pGroup->pReadyTail == pMember)
+        {
+            pGroup->pReadyTail = pPrev;
+        }
+    }
+
+    unwatchMember(pGroup, pMember);
+    LLRP_Conn_setSendWatch(pConn, NULL, NULL);
+
+    free(pMember);
+
+    return pError->eResultCode;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Wait for a message or error from any connection in a group
+ **
+ ** An event with eResultCode LLRP_RC_RecvEOF, LLRP_RC_RecvIOError,
+ ** LLRP_RC_RecvFramingError, or LLRP_RC_RecvBufferOverflow means
+ ** the stream is finished. The group stops watching the connection
+ ** but it stays a member until LLRP_ConnGroup_remove(). Other errors
+ ** are a frame that failed to decode; the connection carries on.
+ **
+ ** @param[in]  pGroup          Pointer to the connection group instance.
+ ** @param[in]  nMaxMS          -1 => block indefinitely
+ **                              0 => just peek, return immediately
+ **                                   no matter what
+ **                             >0 => ms to await an event
+ ** @param[out] pEvent          Filled in when LLRP_RC_OK is returned
+ **
+ ** @return     LLRP_RC_OK          *pEvent holds an event
+ **             LLRP_RC_RecvTimeout Nothing within nMaxMS
+ **             LLRP_RC_RecvIOError epoll_wait() failed.
+ **                                 Check LLRP_ConnGroup_getError().
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+LLRP_ConnGroup_wait (
+  LLRP_tSConnGroup *            pGroup,
+  int                           nMaxMS,
+  LLRP_tSConnGroupEvent *       pEvent)
+{
+    LLRP_tSErrorDetails *       pError = &pGroup->ErrorDetails;
+    struct epoll_event          aEvent[LLRP_CONNGROUP_MAX_EVENTS];
+    llrp_u64_t                  Deadline;
+
+    /*
+     * Fix the deadline now. Input that does not produce an
+     * event (a partial frame, a send flush) must not restart
+     * the wait.
+     */
+    Deadline = LLRP_Conn_calculateDeadline(nMaxMS);
+
+    LLRP_Error_clear(pError);
+    memset(pEvent, 0, sizeof *pEvent);
+
+    /*
+     * Loop until victory or some sort of exception happens
+     */
+    for(;;)
+    {
+        LLRP_tSConnGroupMember *    pMember;
+        int                         nEvent;
+        int                         i;
+
+        /*
+         * Serve the member at the head of the ready list.
+         */
+        pMember = pGroup->pReadyHead;
+        if(NULL != pMember)
+        {
+            LLRP_tSConnection *     pConn = pMember->pConn;
+            LLRP_tSMessage *        pMessage;
+
+            pGroup->pReadyHead = pMember->pNextReady;
+            if(NULL == pGroup->pReadyHead)
+            {
+                pGroup->pReadyTail = NULL;
+            }
+            pMember->pNextReady = NULL;
+            pMember->bReady = FALSE;
+
+            pEvent->pConn = pConn;
+            pEvent->pAppContext = pMember->pAppContext;
+
+            pMessage = LLRP_Conn_recvQueued(pConn);
+            if(NULL != pMessage)
+            {
+                pEvent->pMessage = pMessage;
+                pEvent->DeviceSN = pMessage->DeviceSN;
+                pEvent->eResultCode = LLRP_RC_OK;
+            }
+            else
+            {
+                pEvent->eResultCode = pMember->ePendingError;
+                pMember->ePendingError = LLRP_RC_OK;
+            }
+
+            /*
+             * Still more to deliver? Back of the line.
+             */
+            if(NULL != pConn->pInputQueue ||
+               LLRP_RC_OK != pMember->ePendingError)
+            {
+                makeReady(pGroup, pMember);
+            }
+
+            if(NULL != pEvent->pMessage || LLRP_RC_OK != pEvent->eResultCode)
+            {
+                return LLRP_RC_OK;
+            }
+
+            /* Nothing after all, keep looking */
+            memset(pEvent, 0, sizeof *pEvent);
+            continue;
+        }
+
+        /*
+         * Nothing ready. Wait for input.
+         */
+        nEvent = epoll_wait(pGroup->epfd, aEvent,
+                            LLRP_CONNGROUP_MAX_EVENTS,
+                            LLRP_Conn_remainingMS(Deadline));
+        if(0 > nEvent)
+        {
+            if(EINTR == errno)
+            {
+                continue;
+            }
+            LLRP_Error_resultCodeAndWhatStr(pError,
+                LLRP_RC_RecvIOError, "epoll_wait failed");
+            return pError->eResultCode;
+        }
+
+        if(0 == nEvent)
+        {
+            LLRP_Error_resultCodeAndWhatStr(pError,
+                LLRP_RC_RecvTimeout, "timeout");
+            return pError->eResultCode;
+        }
+
+        for(i = 0; i < nEvent; i++)
+        {
+            pMember = (LLRP_tSConnGroupMember *)aEvent[i].data.ptr;
+
+            if(aEvent[i].events & EPOLLOUT)
+            {
+                if(LLRP_RC_OK != LLRP_Conn_sendFlush(pMember->pConn))
+                {
+                    /* Send errors are reported like receive errors */
+                    pMember->ePendingError = LLRP_RC_SendIOError;
+                    makeReady(pGroup, pMember);
+                }
+            }
+
+            if(aEvent[i].events & ~EPOLLOUT)
+            {
+                pumpMember(pGroup, pMember);
+            }
+        }
+
+        /*
+         * Loop to the top and serve what arrived.
+         */
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Get the details that explain a connection group error
+ **
+ ** Receive errors on member connections are reported by events
+ ** and LLRP_Conn_getRecvError(), not here.
+ **
+ ** @param[in]  pGroup          Pointer to the connection group instance.
+ **
+ ** @return                     Pointer to const error details
+ **
+ *****************************************************************************/
+
+const LLRP_tSErrorDetails *
+LLRP_ConnGroup_getError (
+  LLRP_tSConnGroup *            pGroup)
+{
+    return &pGroup->ErrorDetails;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to find the member record of a connection
+ **
+ ** @return     !=NULL          The member
+ **             ==NULL          Not a member
+ **
+ *****************************************************************************/
+
+static LLRP_tSConnGroupMember *
+findMember (
+  LLRP_tSConnGroup *            pGroup,
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSConnGroupMember *    pMember;
+
+    for(
+        pMember = pGroup->pMemberList;
+        NULL != pMember;
+        pMember = pMember->pNextMember)
+    {
+        if(pMember->pConn == pConn)
+        {
+            break;
+        }
+    }
+
+    return pMember;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to receive on a readable member
+ **
+ ** One read(), then decode every complete frame. An error that
+ ** ends the stream stops the watch so level-triggered epoll does
+ ** not keep reporting the fd.
+ **
+ *****************************************************************************/
+
+static void
+pumpMember (
+  LLRP_tSConnGroup *            pGroup,
+  LLRP_tSConnGroupMember *      pMember)
+{
+    LLRP_tSConnection *         pConn = pMember->pConn;
+    LLRP_tResultCode            lrc;
+
+    lrc = LLRP_Conn_recvFill(pConn);
+    if(LLRP_RC_OK == lrc)
+    {
+        lrc = LLRP_Conn_recvDecodeBuffered(pConn);
+    }
+
+    switch(lrc)
+    {
+    case LLRP_RC_OK:
+        break;
+
+    case LLRP_RC_RecvEOF:
+    case LLRP_RC_RecvIOError:
+    case LLRP_RC_RecvFramingError:
+    case LLRP_RC_RecvBufferOverflow:
+        unwatchMember(pGroup, pMember);
+        pMember->ePendingError = lrc;
+        break;
+
+    default:
+        /* A frame failed to decode. Keep the first such error. */
+        if(LLRP_RC_OK == pMember->ePendingError)
+        {
+            pMember->ePendingError = lrc;
+        }
+        break;
+    }
+
+    if(NULL != pConn->pInputQueue || LLRP_RC_OK != pMember->ePendingError)
+    {
+        makeReady(pGroup, pMember);
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to stop watching a member's fd
+ **
+ *****************************************************************************/
+
+static void
+unwatchMember (
+  LLRP_tSConnGroup *            pGroup,
+  LLRP_tSConnGroupMember *      pMember)
+{
+    if(pMember->bWatched)
+    {
+        /* Best effort. The fd might already be closed. */
+        epoll_ctl(pGroup->epfd, EPOLL_CTL_DEL,
+            LLRP_Conn_getPollFd(pMember->pConn), NULL);
+        pMember->bWatched = FALSE;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to put a member at the tail of the ready list
+ **
+ *****************************************************************************/
+
+static void
+makeReady (
+  LLRP_tSConnGroup *            pGroup,
+  LLRP_tSConnGroupMember *      pMember)
+{
+    if(pMember->bReady)
+    {
+        return;
+    }
+
+    pMember->pNextReady = NULL;
+    if(NULL == pGroup->pReadyTail)
+    {
+        pGroup->pReadyHead = pMember;
+    }
+    else
+    {
+        pGroup->pReadyTail->pNextReady = pMember;
+    }
+    pGroup->pReadyTail = pMember;
+    pMember->bReady = TRUE;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine called when a member's send queue fills
+ **         or drains
+ **
+ ** Adds or removes EPOLLOUT for the member's fd.
+ **
+ *****************************************************************************/
+
+static void
+sendWatch (
+  LLRP_tSConnection *           pConn,
+  llrp_bool_t                   bWantWrite,
+  void *                        pWatchArg)
+{
+    LLRP_tSConnGroupMember *    pMember = pWatchArg;
+    struct epoll_event          Event;
+
+    if(!pMember->bWatched)
+    {
+        return;
+    }
+
+    memset(&Event, 0, sizeof Event);
+    Event.events = EPOLLIN | EPOLLRDHUP;
+    if(bWantWrite)
+    {
+        Event.events |= EPOLLOUT;
+    }
+    Event.data.ptr = pMember;
+
+    /* Best effort. A failure shows up as a receive error. */
+    epoll_ctl(pMember->pGroup->epfd, EPOLL_CTL_MOD,
+        LLRP_Conn_getPollFd(pConn), &Event);
+}
@@ -42,6 +42,34 @@ LLRP_Element_construct (
     return pElement;
 }
 
+LLRP_tSElement *
+LLRP_Element_constructInArena (
+  const LLRP_tSTypeDescriptor * pTypeDescriptor,
+  LLRP_tSArena *                pArena)
+{
+    LLRP_tSElement *            pElement;
+
+    pElement = LLRP_Arena_alloc(pArena, pTypeDescriptor->nSizeBytes);
+    if(NULL != pElement)
+    {
+        memset(pElement, 0, pTypeDescriptor->nSizeBytes);
+
+        pElement->pType = pTypeDescriptor;
+        pElement->pArena = pArena;
+    }
+
+    return pElement;
+}
+
+llrp_bool_t
+LLRP_Element_isArenaMemory (
+  const LLRP_tSElement *        pElement,
+  const void *                  pMemory)
+{
+    return NULL != pElement->pArena &&
+           LLRP_Arena_contains(pElement->pArena, pMemory);
+}
+
 void
 LLRP_Element_destruct (
   LLRP_tSElement *              pElement)
@@ -56,29 +84,80 @@ void
 LLRP_Element_finalDestruct (
   LLRP_tSElement *              pElement)
 {
+    LLRP_tSArena *              pArena = pElement->pArena;
+
     LLRP_Element_clearSubParameterAllList(pElement);
+
+    /*
+     * Arena memory is freed all at once, when the
+     * owner of the arena is destructed.
+     */
+    if(NULL != pArena)
+    {
+        if(pArena->pOwner == pElement)
+        {
+            LLRP_Arena_destruct(pArena);
+        }
+        return;
+    }
+
     memset(pElement, 0xAA, pElement->pType->nSizeBytes);
     free(pElement);
 }
 
+/*
+ * A message decoded lazily is decoded the rest of the way
+ * before its sub-parameters are changed or walked. Gives the
+ * error if a sub-parameter failed to decode and was left empty.
+ */
+static LLRP_tResultCode
+materializeMessage (
+  const LLRP_tSElement *        pElement)
+{
+    if(pElement->pType->bIsMessage &&
+       NULL != ((const LLRP_tSMessage *) pElement)->pLazy)
+    {
+        return LLRP_Message_materializeAll((LLRP_tSMessage *) pElement,
+                NULL);
+    }
+
+    return LLRP_RC_OK;
+}
+
 void
 LLRP_Element_addSubParameterToAllList (
   LLRP_tSElement *              pElement,
   LLRP_tSParameter *            pParameter)
 {
-    LLRP_tSParameter **         ppParameter;
-    LLRP_tSParameter *          pNextParameter;
+    LLRP_tSParameter *          pHead = pElement->listAllSubParameters;
+    LLRP_tSParameter *          pTail;
+
+    pParameter->pNextAllSubParameters = NULL;
 
-    for(
-        ppParameter = &pElement->listAllSubParameters;
-        NULL != *ppParameter;
-        ppParameter = &pNextParameter->pNextAllSubParameters)
+    if(NULL == pHead)
     {
-        pNextParameter = *ppParameter;
+        pParameter->pPrevAllSubParameters = pParameter;
+        pElement->listAllSubParameters = pParameter;
+        return;
     }
 
-    pParameter->pNextAllSubParameters = NULL;
-    *ppParameter = pParameter;
+    /*
+     * The head's previous pointer is the tail. Lists linked
+     * by hand may not have it, or may have grown past it.
+     */
+    pTail = pHead->pPrevAllSubParameters;
+    if(NULL == pTail)
+    {
+        pTail = pHead;
+    }
+    while(NULL != pTail->pNextAllSubParameters)
+    {
+        pTail = pTail->pNextAllSubParameters;
+    }
+
+    pTail->pNextAllSubParameters = pParameter;
+    pParameter->pPrevAllSubParameters = pTail;
+    pHead->pPrevAllSubParameters = pParameter;
 }
 
 void
@@ -86,26 +165,56 @@ LLRP_Element_removeSubParameterFromAllList (
   LLRP_tSElement *              pElement,
   LLRP_tSParameter *            pParameter)
 {
-    LLRP_tSParameter **         ppParameter;
-    LLRP_tSParameter *          pNextParameter;
+    LLRP_tSParameter *          pHead = pElement->listAllSubParameters;
+    LLRP_tSParameter *          pPrev = pParameter->pPrevAllSubParameters;
+    LLRP_tSParameter *          pNext = pParameter->pNextAllSubParameters;
 
-    for(
-        ppParameter = &pElement->listAllSubParameters;
-        NULL != *ppParameter;
-        )
+    if(pParameter == pHead)
+    {
+        pElement->listAllSubParameters = pNext;
+        if(NULL != pNext)
+        {
+            pNext->pPrevAllSubParameters = pPrev;
+        }
+    }
+    else if(NULL != pPrev && pPrev->pNextAllSubParameters == pParameter)
     {
-        pNextParameter = *ppParameter;
-        if(pNextParameter == pParameter)
+        pPrev->pNextAllSubParameters = pNext;
+        if(NULL != pNext)
         {
-            *ppParameter = pNextParameter->pNextAllSubParameters;
+            pNext->pPrevAllSubParameters = pPrev;
         }
         else
         {
-            ppParameter = &pNextParameter->pNextAllSubParameters;
+            pHead->pPrevAllSubParameters = pPrev;
+        }
+    }
+    else
+    {
+        /*
+         * No usable previous pointer. Search for it.
+         */
+        LLRP_tSParameter **     ppParameter;
+
+        for(
+            ppParameter = &pElement->listAllSubParameters;
+            NULL != *ppParameter;
+            ppParameter = &(*ppParameter)->pNextAllSubParameters)
+        {
+            if(*ppParameter == pParameter)
+            {
+                *ppParameter = pNext;
+                if(NULL != pHead)
+                {
+                    pHead->pPrevAllSubParameters = NULL;
+                }
+                break;
+            }
         }
     }
 
     pParameter->pNextAllSubParameters = NULL;
+    pParameter->pPrevAllSubParameters = NULL;
 }
 
 void
@@ -122,12 +231,19 @@ LLRP_Element_clearSubParameterAllList (
     }
 }
 
-void
+/*
+ * The routines that change sub-parameters make the change even if
+ * a lazily decoded message had one fail to decode, and give that
+ * error so the generated setters can pass it on.
+ */
+LLRP_tResultCode
 LLRP_Element_setSubParameterPtr (
   LLRP_tSElement *              pElement,
   LLRP_tSParameter **           ppPtr,
   LLRP_tSParameter *            pValue)
 {
+    LLRP_tResultCode            lrc = materializeMessage(pElement);
+
     if(NULL != *ppPtr)
     {
         LLRP_Element_removeSubParameterFromAllList(pElement, *ppPtr);
@@ -138,27 +254,26 @@ LLRP_Element_setSubParameterPtr (
     {
         LLRP_Element_addSubParameterToAllList(pElement, *ppPtr);
     }
+
+    return lrc;
 }
 
-void
+LLRP_tResultCode
 LLRP_Element_addToSubParameterList (
   LLRP_tSElement *              pElement,
   LLRP_tSParameter **           ppListHead,
   LLRP_tSParameter *            pValue)
 {
-    LLRP_tSParameter **         ppCur = ppListHead;
+    LLRP_tResultCode            lrc = materializeMessage(pElement);
 
     if(NULL != pValue)
     {
-        while(NULL != *ppCur)
-        {
-            ppCur = &(*ppCur)->pNextSubParameter;
-        }
-        pValue->pNextSubParameter = NULL;
-        *ppCur = pValue;
+        LLRP_Element_attachToSubParameterList(ppListHead, pValue);
 
         LLRP_Element_addSubParameterToAllList(pElement, pValue);
     }
+
+    return lrc;
 }
 
 void
@@ -166,26 +281,52 @@ LLRP_Element_attachToSubParameterList (
   LLRP_tSParameter **           ppListHead,
   LLRP_tSParameter *            pValue)
 {
-    LLRP_tSParameter **         ppCur = ppListHead;
+    LLRP_tSParameter *          pHead = *ppListHead;
+    LLRP_tSParameter *          pTail;
 
-    if(NULL != pValue)
+    if(NULL == pValue)
     {
-        while(NULL != *ppCur)
-        {
-            ppCur = &(*ppCur)->pNextSubParameter;
-        }
-        pValue->pNextSubParameter = NULL;
-        *ppCur = pValue;
+        return;
+    }
+
+    pValue->pNextSubParameter = NULL;
+
+    if(NULL == pHead)
+    {
+        pValue->pPrevSubParameter = pValue;
+        *ppListHead = pValue;
+        return;
     }
+
+    /*
+     * Same as the list of all sub elements, the head's
+     * previous pointer is the tail.
+     */
+    pTail = pHead->pPrevSubParameter;
+    if(NULL == pTail)
+    {
+        pTail = pHead;
+    }
+    while(NULL != pTail->pNextSubParameter)
+    {
+        pTail = pTail->pNextSubParameter;
+    }
+
+    pTail->pNextSubParameter = pValue;
+    pValue->pPrevSubParameter = pTail;
+    pHead->pPrevSubParameter = pValue;
 }
 
-void
+LLRP_tResultCode
 LLRP_Element_clearSubParameterList (
   LLRP_tSElement *              pElement,
   LLRP_tSParameter **           ppListHead)
 {
     LLRP_tSParameter **         ppCur = ppListHead;
     LLRP_tSParameter *          pValue;
+    LLRP_tResultCode            lrc;
+
+    lrc = materializeMessage(pElement);
 
     while (NULL != (pValue = *ppCur))
     {
@@ -194,6 +335,8 @@ LLRP_Element_clearSubParameterList (
         LLRP_Element_removeSubParameterFromAllList(pElement, pValue);
         LLRP_Element_destruct((LLRP_tSElement *) pValue);
     }
+
+    return lrc;
 }
 
 int
@@ -212,6 +355,10 @@ LLRP_Element_countSubParameterList (
     return n;
 }
 
+/*
+ * A lazily decoded message with a sub-parameter that fails to
+ * decode is not walked, see LLRP_WALK_DECODE_FAILED.
+ */
 int
 LLRP_Element_walk (
   const LLRP_tSElement *          pElement,
@@ -225,6 +372,11 @@ LLRP_Element_walk (
     LLRP_tSParameter *          pParameter;
     int                         rc;
 
+    if(LLRP_RC_OK != materializeMessage(pElement))
+    {
+        return LLRP_WALK_DECODE_FAILED;
+    }
+
     rc = (*pFunc)(pElement, pArg);
     if(0 != rc)
     {
@@ -51,6 +51,19 @@ LLRP_Encoder_encodeElement (
   LLRP_tSEncoder *              pEncoder,
   const LLRP_tSElement *        pElement)
 {
+    /*
+     * The generated encoders read the members. A message
+     * decoded lazily has them all decoded first. One that
+     * fails is not encoded: the failed sub-parameter is empty.
+     */
+    if(pElement->pType->bIsMessage &&
+       NULL != ((const LLRP_tSMessage *) pElement)->pLazy &&
+       LLRP_RC_OK != LLRP_Message_materializeAll(
+            (LLRP_tSMessage *) pElement, &pEncoder->ErrorDetails))
+    {
+        return;
+    }
+
     return pEncoder->pEncoderOps->pfEncodeElement(pEncoder, pElement);
 }
 
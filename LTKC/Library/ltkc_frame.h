@@ -43,6 +43,7 @@ struct LLRP_SFrameExtract
         LLRP_FRAME_NEED_MORE
     }                           eStatus;
 
+    llrp_u64_t                  DeviceSN;
     llrp_u32_t                  MessageLength;
     llrp_u16_t                  MessageType;
     llrp_u8_t                   ProtocolVersion;
@@ -61,6 +62,22 @@ struct LLRP_SFrameDecoder
     unsigned int                iNext;
     unsigned int                BitFieldBuffer;
     unsigned int                nBitFieldResid;
+
+    /* Opt-in: decode each message into an arena of its own */
+    llrp_bool_t                 bUseArena;
+
+    /* Opt-in: byte vectors point into the message's copy of
+     * the frame instead of each being copied. Implies an arena. */
+    llrp_bool_t                 bBorrowVectors;
+
+    /* Opt-in: only the framing of the message's sub-parameters is
+     * checked up front, each is decoded when its accessor is first
+     * called. The message keeps a copy of the frame. Implies an
+     * arena. See LLRP_Message_materializeAll(). */
+    llrp_bool_t                 bLazySubParameters;
+
+    /* The arena of the message being decoded, NULL if none */
+    LLRP_tSArena *              pArena;
 };
 
 extern LLRP_tSFrameExtract
@@ -79,12 +96,236 @@ struct LLRP_SFrameDecoderStream
     unsigned int                iLimit;
 };
 
+extern const llrp_u8_t *
+LLRP_FrameDecoderStream_takeFieldBlock (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  unsigned int                  nByte);
+
+/*
+ * Big-endian loads for the generated frame field decoders
+ */
+#define LLRP_FRAME_LOAD_U16(p)                                  \
+    ((llrp_u16_t)(((unsigned int)(p)[0] << 8u) | (p)[1]))
+#define LLRP_FRAME_LOAD_U32(p)                                  \
+    (((llrp_u32_t)(p)[0] << 24u) | ((llrp_u32_t)(p)[1] << 16u) | \
+     ((llrp_u32_t)(p)[2] << 8u) | (llrp_u32_t)(p)[3])
+#define LLRP_FRAME_LOAD_U64(p)                                  \
+    (((llrp_u64_t)LLRP_FRAME_LOAD_U32(p) << 32u) |              \
+     LLRP_FRAME_LOAD_U32((p) + 4))
+
 extern LLRP_tSFrameDecoder *
 LLRP_FrameDecoder_construct (
   const LLRP_tSTypeRegistry *   pTypeRegistry,
   unsigned char *               pBuffer,
   unsigned int                  nBuffer);
 
+extern void
+LLRP_FrameDecoder_init (
+  LLRP_tSFrameDecoder *         pDecoder,
+  const LLRP_tSTypeRegistry *   pTypeRegistry,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+extern void
+LLRP_FrameDecoder_reset (
+  LLRP_tSFrameDecoder *         pDecoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Callbacks of the streaming frame decoder
+ **
+ ** LLRP_FrameDecoder_stream() walks the message in the decoder's
+ ** frame the way LLRP_Decoder_decodeMessage() does, but builds no
+ ** elements and allocates nothing. Instead, for the message and
+ ** for each parameter in it, in frame order, it calls
+ **     - pfBegin,
+ **     - pfField once per field, and for the message first
+ **       its DeviceSN, Version and MessageID,
+ **     - the same for each sub-parameter,
+ **     - pfEnd.
+ ** Any callback may be NULL.
+ **
+ ** Frame errors (lengths, under- and overruns, unknown types)
+ ** stop the walk and are in the decoder's ErrorDetails, as for
+ ** LLRP_Decoder_decodeMessage(). Whether the sub-parameters are
+ ** the ones the type allows is not checked.
+ **
+ *****************************************************************************/
+
+struct LLRP_SFrameStreamField;
+struct LLRP_SFrameStreamCallbacks;
+
+typedef struct LLRP_SFrameStreamField       LLRP_tSFrameStreamField;
+typedef struct LLRP_SFrameStreamCallbacks   LLRP_tSFrameStreamCallbacks;
+
+struct LLRP_SFrameStreamField
+{
+    /** A scalar field, by the field descriptor's eFieldType.
+     ** Enumerations (LLRP_FT_E1 ...) are in e. */
+    union
+    {
+        llrp_u8_t               u8;
+        llrp_s8_t               s8;
+        llrp_u16_t              u16;
+        llrp_s16_t              s16;
+        llrp_u32_t              u32;
+        llrp_s32_t              s32;
+        llrp_u64_t              u64;
+        llrp_s64_t              s64;
+        llrp_u1_t               u1;
+        llrp_u2_t               u2;
+        int                     e;
+    }                           Scalar;
+
+    /** A vector, u96, utf8v or bytesToEnd field: its bytes in the
+     ** frame, valid during the callback. Values of more than one
+     ** byte are big-endian and maybe unaligned, see the byte swap
+     ** kernels below. NULL for a scalar. */
+    const llrp_u8_t *           pBytes;
+
+    /** Values at pBytes, bits for a u1v */
+    unsigned int                nValue;
+};
+
+struct LLRP_SFrameStreamCallbacks
+{
+    /** A message or parameter starts. Return 0 to go into it,
+     ** non-zero to skip it: no more callbacks for it, pfEnd
+     ** included. */
+    int                         (*pfBegin)(
+                                  void *                pContext,
+                                  const LLRP_tSTypeDescriptor *pType);
+
+    /** A field of the message or parameter last begun */
+    void                        (*pfField)(
+                                  void *                pContext,
+                                  const LLRP_tSTypeDescriptor *pType,
+                                  const LLRP_tSFieldDescriptor *pField,
+                                  const LLRP_tSFrameStreamField *pValue);
+
+    /** The message or parameter ends, sub-parameters and all */
+    void                        (*pfEnd)(
+                                  void *                pContext,
+                                  const LLRP_tSTypeDescriptor *pType);
+};
+
+extern LLRP_tResultCode
+LLRP_FrameDecoder_stream (
+  LLRP_tSFrameDecoder *         pDecoder,
+  const LLRP_tSFrameStreamCallbacks *pCallbacks,
+  void *                        pContext);
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Columnar (struct-of-arrays) batch decode
+ **
+ ** LLRP_Columns_decodeFrame() streams the message in the decoder's
+ ** frame and appends one row per parameter of the column set's row
+ ** type, wherever it is in the message. Each column is one field,
+ ** of the row type itself or of one of its sub-parameters, kept in
+ ** an array of its own:
+ **     - an integer field is a values array, one value per row,
+ **       with a presence bitmap when the sub-parameter is optional.
+ **       An absent value is 0 and its bit, LLRP_COLUMN_PRESENT(),
+ **       is clear.
+ **     - a byte vector field is a pool: the rows' bytes end to end
+ **       and nRow+1 offsets into them.
+ ** Sub-parameters of a row with no column are skipped unseen.
+ **
+ ** Rows accumulate across frames until LLRP_Columns_clear(). A frame
+ ** that fails to decode adds no rows. The generated code has the
+ ** column sets and typed wrappers, e.g. LLRP_TagReportDataColumns_*.
+ **
+ *****************************************************************************/
+
+struct LLRP_SColumnsHdr;
+struct LLRP_SColumnPool;
+struct LLRP_SColumnDescriptor;
+struct LLRP_SColumnSet;
+
+typedef struct LLRP_SColumnsHdr         LLRP_tSColumnsHdr;
+typedef struct LLRP_SColumnPool         LLRP_tSColumnPool;
+typedef struct LLRP_SColumnDescriptor   LLRP_tSColumnDescriptor;
+typedef struct LLRP_SColumnSet          LLRP_tSColumnSet;
+
+struct LLRP_SColumnsHdr
+{
+    const LLRP_tSColumnSet *    pColumnSet;
+
+    /** Rows decoded so far */
+    unsigned int                nRow;
+
+    /** Rows the arrays have room for */
+    unsigned int                nRowMax;
+};
+
+struct LLRP_SColumnPool
+{
+    llrp_u8_t *                 pBytes;
+    unsigned int                nByte;
+    unsigned int                nByteMax;
+
+    /** Row i's bytes are pBytes[pOffset[i]] up to pBytes[pOffset[i+1]].
+     ** NULL until the first row. */
+    unsigned int *              pOffset;
+};
+
+struct LLRP_SColumnDescriptor
+{
+    /** The row type or one of its sub-parameters, and its field */
+    const LLRP_tSTypeDescriptor *pType;
+    const LLRP_tSFieldDescriptor *pField;
+
+    /** Size of a value, 0 for a pool */
+    unsigned int                nValueBytes;
+
+    /** Where in the columns the values pointer, or the pool, is */
+    size_t                      oValues;
+
+    /** Where the presence bitmap pointer is, 0 if none */
+    size_t                      oPresent;
+};
+
+struct LLRP_SColumnSet
+{
+    const LLRP_tSTypeDescriptor *pRowType;
+
+    /** Size of the columns, LLRP_tSColumnsHdr first */
+    unsigned int                nSizeBytes;
+
+    const LLRP_tSColumnDescriptor *pColumns;
+    unsigned int                nColumn;
+};
+
+#define LLRP_COLUMN_PRESENT(pPresent, iRow)                     \
+    (((pPresent)[(iRow) >> 3u] >> ((iRow) & 7u)) & 1u)
+
+/*
+ * ltkc_columns.c
+ */
+extern LLRP_tSColumnsHdr *
+LLRP_Columns_construct (
+  const LLRP_tSColumnSet *      pColumnSet);
+
+extern void
+LLRP_Columns_destruct (
+  LLRP_tSColumnsHdr *           pColumns);
+
+extern void
+LLRP_Columns_clear (
+  LLRP_tSColumnsHdr *           pColumns);
+
+extern LLRP_tResultCode
+LLRP_Columns_decodeFrame (
+  LLRP_tSColumnsHdr *           pColumns,
+  LLRP_tSFrameDecoder *         pDecoder);
+
 
 struct LLRP_SFrameEncoder
 {
@@ -112,3 +353,85 @@ extern LLRP_tSFrameEncoder *
 LLRP_FrameEncoder_construct (
   unsigned char *               pBuffer,
   unsigned int                  nBuffer);
+
+extern void
+LLRP_FrameEncoder_init (
+  LLRP_tSFrameEncoder *         pEncoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+extern void
+LLRP_FrameEncoder_reset (
+  LLRP_tSFrameEncoder *         pEncoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Structure of a byte swap kernel
+ **
+ ** The frame decoder and encoder convert the 16, 32 and 64-bit
+ ** vector fields (u16v, s32v, ...) between the big-endian frame and
+ ** host order with one of these, a whole vector per call. The
+ ** pointers on either side need no particular alignment.
+ **
+ ** The kernel is picked on first use, the best the CPU can run.
+ ** See LLRP_ByteSwap_setKernel().
+ **
+ *****************************************************************************/
+
+struct LLRP_SByteSwapKernel;
+typedef struct LLRP_SByteSwapKernel LLRP_tSByteSwapKernel;
+
+struct LLRP_SByteSwapKernel
+{
+    /** For messages */
+    const char *                pName;
+
+    /** TRUE if built in and the CPU can run it */
+    llrp_bool_t                 (*pfIsSupported)(void);
+
+    /** Big-endian bytes at pSrc to n values at pDst */
+    void                        (*pfLoad16)(
+                                  llrp_u16_t *          pDst,
+                                  const llrp_u8_t *     pSrc,
+                                  unsigned int          n);
+    void                        (*pfLoad32)(
+                                  llrp_u32_t *          pDst,
+                                  const llrp_u8_t *     pSrc,
+                                  unsigned int          n);
+    void                        (*pfLoad64)(
+                                  llrp_u64_t *          pDst,
+                                  const llrp_u8_t *     pSrc,
+                                  unsigned int          n);
+
+    /** n values at pSrc to big-endian bytes at pDst */
+    void                        (*pfStore16)(
+                                  llrp_u8_t *           pDst,
+                                  const llrp_u16_t *    pSrc,
+                                  unsigned int          n);
+    void                        (*pfStore32)(
+                                  llrp_u8_t *           pDst,
+                                  const llrp_u32_t *    pSrc,
+                                  unsigned int          n);
+    void                        (*pfStore64)(
+                                  llrp_u8_t *           pDst,
+                                  const llrp_u64_t *    pSrc,
+                                  unsigned int          n);
+};
+
+/*
+ * ltkc_byteswap.c
+ */
+extern const LLRP_tSByteSwapKernel  LLRP_ByteSwap_PORTABLE;
+extern const LLRP_tSByteSwapKernel  LLRP_ByteSwap_SSE2;
+extern const LLRP_tSByteSwapKernel  LLRP_ByteSwap_AVX2;
+
+extern const LLRP_tSByteSwapKernel *
+LLRP_ByteSwap_getKernel (void);
+
+extern int
+LLRP_ByteSwap_setKernel (
+  const LLRP_tSByteSwapKernel * pKernel);
@@ -26,6 +26,77 @@
 #include "ltkc_frame.h"
 
 
+/*
+ * Bytes of arena to start with per byte of frame. Decoded
+ * elements are bigger than their encoding, pointers and all.
+ * For big frames that guess is capped, and the arena adds
+ * blocks as the message needs them.
+ */
+#define LLRP_FRAME_ARENA_RATIO  (12u)
+#define LLRP_FRAME_ARENA_MAX    (1024u*1024u)
+
+
+/*
+ * The streaming decoder, LLRP_FrameDecoder_stream(). Its
+ * decoder streams are frame decoder streams with stream ops
+ * of their own, which pass each field to the callbacks as
+ * it is decoded. The generated decodeFields() functions drive
+ * them, with no element to fill in.
+ */
+typedef struct LLRP_SFrameStream LLRP_tSFrameStream;
+typedef struct LLRP_SFrameStreamDecoderStream LLRP_tSFrameStreamDecoderStream;
+
+struct LLRP_SFrameStream
+{
+    const LLRP_tSFrameStreamCallbacks *pCallbacks;
+    void *                      pContext;
+
+    /* Decoding the fields of a skipped TV parameter,
+     * only to find where it ends */
+    llrp_bool_t                 bQuiet;
+};
+
+struct LLRP_SFrameStreamDecoderStream
+{
+    LLRP_tSFrameDecoderStream   frameDecoderStreamHdr;
+
+    LLRP_tSFrameStream *        pStream;
+};
+
+/*
+ * The sub-parameters of a lazily decoded message. Each TLV is an
+ * element of its type from the start, linked in and assimilated as
+ * usual, but empty until it is materialized. TVs are small and are
+ * decoded straight away.
+ */
+typedef struct LLRP_SLazyEntry LLRP_tSLazyEntry;
+
+struct LLRP_SLazyEntry
+{
+    LLRP_tSParameter *          pParameter;
+    unsigned int                iBegin;
+    llrp_bool_t                 bDecoded;
+};
+
+struct LLRP_SLazySubParameters
+{
+    /* The message's copy of the frame and how to decode it */
+    const LLRP_tSTypeRegistry * pRegistry;
+    unsigned char *             pFrame;
+    unsigned int                nFrame;
+    unsigned int                iLimit;
+    llrp_bool_t                 bBorrowVectors;
+
+    /* The TLV sub-parameters, in frame order */
+    LLRP_tSLazyEntry *          pEntries;
+    unsigned int                nEntry;
+    unsigned int                nPending;
+
+    /* The first error materializing any of them */
+    LLRP_tSErrorDetails         ErrorDetails;
+};
+
+
 /*
  * BEGIN forward decls
  */
@@ -36,10 +107,32 @@ LLRP_FrameDecoder_construct (
   unsigned char *               pBuffer,
   unsigned int                  nBuffer);
 
+void
+LLRP_FrameDecoder_init (
+  LLRP_tSFrameDecoder *         pDecoder,
+  const LLRP_tSTypeRegistry *   pTypeRegistry,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+void
+LLRP_FrameDecoder_reset (
+  LLRP_tSFrameDecoder *         pDecoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+const llrp_u8_t *
+LLRP_FrameDecoderStream_takeFieldBlock (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  unsigned int                  nByte);
+
 static void
 decoderDestruct (
   LLRP_tSDecoder *              pBaseDecoder);
 
+static void
+decoderFinish (
+  LLRP_tSDecoder *              pBaseDecoder);
+
 static LLRP_tSMessage *
 topDecodeMessage (
   LLRP_tSDecoder *              pBaseDecoder);
@@ -60,6 +153,24 @@ static llrp_u64_t
 next_u64 (
   LLRP_tSFrameDecoder *         pDecoder);
 
+static void
+next_u16v (
+  LLRP_tSFrameDecoder *         pDecoder,
+  llrp_u16_t *                  pValue,
+  unsigned int                  nValue);
+
+static void
+next_u32v (
+  LLRP_tSFrameDecoder *         pDecoder,
+  llrp_u32_t *                  pValue,
+  unsigned int                  nValue);
+
+static void
+next_u64v (
+  LLRP_tSFrameDecoder *         pDecoder,
+  llrp_u64_t *                  pValue,
+  unsigned int                  nValue);
+
 static llrp_u8_t
 get_u8 (
   LLRP_tSDecoderStream *        pBaseDecoderStream,
@@ -215,14 +326,42 @@ streamConstruct_nested (
   LLRP_tSFrameDecoderStream *   pDecoderStream,
   LLRP_tSFrameDecoderStream *   pEnclosingDecoderStream);
 
+static const LLRP_tSTypeDescriptor *
+decodeMessageHeader (
+  LLRP_tSFrameDecoderStream *   pDecoderStream,
+  llrp_u64_t *                  pDeviceSN,
+  llrp_u8_t *                   pVersion,
+  llrp_u32_t *                  pMessageID);
+
 static LLRP_tSMessage *
 decodeMessage (
   LLRP_tSFrameDecoderStream *   pDecoderStream);
 
+static const LLRP_tSTypeDescriptor *
+decodeParameterHeader (
+  LLRP_tSFrameDecoderStream *   pDecoderStream,
+  llrp_bool_t *                 pbIsTV);
+
 static LLRP_tSParameter *
 decodeParameter (
   LLRP_tSFrameDecoderStream *   pDecoderStream);
 
+static llrp_bool_t
+decodeParameterBody (
+  LLRP_tSFrameDecoderStream *   pDecoderStream,
+  LLRP_tSElement *              pElement,
+  llrp_bool_t                   bIsTV);
+
+static void
+scanSubParameters (
+  LLRP_tSFrameDecoderStream *   pDecoderStream,
+  LLRP_tSMessage *              pMessage);
+
+static void
+materializeEntry (
+  LLRP_tSMessage *              pMessage,
+  LLRP_tSLazyEntry *            pEntry);
+
 static unsigned int
 getRemainingByteCount (
   LLRP_tSFrameDecoderStream *   pDecoderStream);
@@ -250,6 +389,204 @@ verifyVectorAllocation (
   const void *                  pValue,
   const LLRP_tSFieldDescriptor *pFieldDescriptor);
 
+static LLRP_tSElement *
+allocElement (
+  LLRP_tSFrameDecoder *         pDecoder,
+  const LLRP_tSTypeDescriptor * pTypeDescriptor);
+
+static void *
+allocVector (
+  LLRP_tSFrameDecoder *         pDecoder,
+  unsigned int                  nByte);
+
+static llrp_u8_t *
+takeBytes (
+  LLRP_tSFrameDecoderStream *   pDecoderStream,
+  unsigned int                  nByte,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static void
+streamConstruct_outermost_stream (
+  LLRP_tSFrameStreamDecoderStream *pDecoderStream,
+  LLRP_tSFrameDecoder *         pDecoder,
+  LLRP_tSFrameStream *          pStream);
+
+static void
+streamConstruct_nested_stream (
+  LLRP_tSFrameStreamDecoderStream *pDecoderStream,
+  LLRP_tSFrameStreamDecoderStream *pEnclosingDecoderStream);
+
+static void
+streamMessage (
+  LLRP_tSFrameStreamDecoderStream *pDecoderStream);
+
+static void
+streamParameter (
+  LLRP_tSFrameStreamDecoderStream *pDecoderStream);
+
+static void
+streamSubParameters (
+  LLRP_tSFrameStreamDecoderStream *pDecoderStream);
+
+static void
+streamField (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor,
+  LLRP_tSFrameStreamField *     pField);
+
+static void
+streamScalar (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor,
+  LLRP_tSFrameStreamField *     pField);
+
+static void
+streamBytes (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor,
+  unsigned int                  nValue,
+  unsigned int                  nByte);
+
+static llrp_u8_t
+stream_get_u8 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_s8_t
+stream_get_s8 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_u8v_t
+stream_get_u8v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_s8v_t
+stream_get_s8v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_u16_t
+stream_get_u16 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_s16_t
+stream_get_s16 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_u16v_t
+stream_get_u16v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_s16v_t
+stream_get_s16v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_u32_t
+stream_get_u32 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_s32_t
+stream_get_s32 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_u32v_t
+stream_get_u32v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_s32v_t
+stream_get_s32v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_u64_t
+stream_get_u64 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_s64_t
+stream_get_s64 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_u64v_t
+stream_get_u64v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_s64v_t
+stream_get_s64v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_u1_t
+stream_get_u1 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_u1v_t
+stream_get_u1v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_u2_t
+stream_get_u2 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_u96_t
+stream_get_u96 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_utf8v_t
+stream_get_utf8v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_bytesToEnd_t
+stream_get_bytesToEnd (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static int
+stream_get_e1 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static int
+stream_get_e2 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static int
+stream_get_e8 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static int
+stream_get_e16 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static int
+stream_get_e32 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
+static llrp_u8v_t
+stream_get_e8v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor);
+
 /*
  * END forward decls
  */
@@ -263,6 +600,17 @@ s_FrameDecoderOps =
     .pfDecodeMessage        = topDecodeMessage,
 };
 
+/*
+ * For a decoder in storage the caller owns,
+ * see LLRP_FrameDecoder_init()
+ */
+static LLRP_tSDecoderOps
+s_FrameDecoderInPlaceOps =
+{
+    .pfDestruct             = decoderFinish,
+    .pfDecodeMessage        = topDecodeMessage,
+};
+
 static LLRP_tSDecoderStreamOps
 s_FrameDecoderStreamOps =
 {
@@ -303,6 +651,46 @@ s_FrameDecoderStreamOps =
     .pfGet_reserved         = get_reserved,
 };
 
+static LLRP_tSDecoderStreamOps
+s_FrameStreamDecoderStreamOps =
+{
+    .pfGet_u8               = stream_get_u8,
+    .pfGet_s8               = stream_get_s8,
+    .pfGet_u8v              = stream_get_u8v,
+    .pfGet_s8v              = stream_get_s8v,
+
+    .pfGet_u16              = stream_get_u16,
+    .pfGet_s16              = stream_get_s16,
+    .pfGet_u16v             = stream_get_u16v,
+    .pfGet_s16v             = stream_get_s16v,
+
+    .pfGet_u32              = stream_get_u32,
+    .pfGet_s32              = stream_get_s32,
+    .pfGet_u32v             = stream_get_u32v,
+    .pfGet_s32v             = stream_get_s32v,
+
+    .pfGet_u64              = stream_get_u64,
+    .pfGet_s64              = stream_get_s64,
+    .pfGet_u64v             = stream_get_u64v,
+    .pfGet_s64v             = stream_get_s64v,
+
+    .pfGet_u1               = stream_get_u1,
+    .pfGet_u1v              = stream_get_u1v,
+    .pfGet_u2               = stream_get_u2,
+    .pfGet_u96              = stream_get_u96,
+    .pfGet_utf8v            = stream_get_utf8v,
+    .pfGet_bytesToEnd       = stream_get_bytesToEnd,
+
+    .pfGet_e1               = stream_get_e1,
+    .pfGet_e2               = stream_get_e2,
+    .pfGet_e8               = stream_get_e8,
+    .pfGet_e16              = stream_get_e16,
+    .pfGet_e32              = stream_get_e32,
+    .pfGet_e8v              = stream_get_e8v,
+
+    .pfGet_reserved         = get_reserved,
+};
+
 LLRP_tSFrameDecoder *
 LLRP_FrameDecoder_construct (
   const LLRP_tSTypeRegistry *   pTypeRegistry,
@@ -317,19 +705,53 @@ LLRP_FrameDecoder_construct (
         return pDecoder;
     }
 
-    memset(pDecoder, 0, sizeof *pDecoder);
+    LLRP_FrameDecoder_init(pDecoder, pTypeRegistry, pBuffer, nBuffer);
 
     pDecoder->decoderHdr.pDecoderOps = &s_FrameDecoderOps;
+
+    return pDecoder;
+}
+
+/*
+ * Initialize a decoder the caller has storage for, embedded
+ * in something else or on the stack. LLRP_Decoder_destruct()
+ * on it is allowed but frees nothing.
+ */
+void
+LLRP_FrameDecoder_init (
+  LLRP_tSFrameDecoder *         pDecoder,
+  const LLRP_tSTypeRegistry *   pTypeRegistry,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    memset(pDecoder, 0, sizeof *pDecoder);
+
+    pDecoder->decoderHdr.pDecoderOps = &s_FrameDecoderInPlaceOps;
     pDecoder->decoderHdr.pRegistry = pTypeRegistry;
 
+    LLRP_FrameDecoder_reset(pDecoder, pBuffer, nBuffer);
+}
+
+/*
+ * Point a decoder at the next frame. The registry and the
+ * bUseArena and bBorrowVectors options are kept, the error
+ * details and position are not.
+ */
+void
+LLRP_FrameDecoder_reset (
+  LLRP_tSFrameDecoder *         pDecoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    pDecoder->decoderHdr.pRootElement = NULL;
+    LLRP_Error_clear(&pDecoder->decoderHdr.ErrorDetails);
+
     pDecoder->pBuffer        = pBuffer;
     pDecoder->nBuffer        = nBuffer;
 
     pDecoder->iNext          = 0;
     pDecoder->BitFieldBuffer = 0;
     pDecoder->nBitFieldResid = 0;
-
-    return pDecoder;
 }
 
 static void
@@ -341,6 +763,13 @@ decoderDestruct (
     free(pDecoder);
 }
 
+static void
+decoderFinish (
+  LLRP_tSDecoder *              pBaseDecoder)
+{
+    /* Nothing to free, the storage is the caller's */
+}
+
 LLRP_tSMessage *
 topDecodeMessage (
   LLRP_tSDecoder *              pBaseDecoder)
@@ -348,21 +777,100 @@ topDecodeMessage (
     LLRP_tSFrameDecoder *       pDecoder;
     LLRP_tSFrameDecoderStream   DecoderStream;
     LLRP_tSMessage *            pMessage;
+    unsigned char *             pFrame;
+    llrp_bool_t                 bBorrowVectors;
+    llrp_bool_t                 bLazySubParameters;
 
     pDecoder = (LLRP_tSFrameDecoder *) pBaseDecoder;
 
     streamConstruct_outermost(&DecoderStream, pDecoder);
 
-    pMessage = decodeMessage(&DecoderStream);
+    /*
+     * With an arena the whole message is one allocation,
+     * sized from the frame. Elements take several times the
+     * room their encoding does, up to LLRP_FRAME_ARENA_MAX.
+     * The copy of the frame made below is room on top. If it
+     * runs out the arena grows. If the arena can't be had,
+     * decode as usual.
+     */
+    if(pDecoder->bUseArena || pDecoder->bBorrowVectors ||
+       pDecoder->bLazySubParameters)
+    {
+        unsigned int            nArena;
 
-    return pMessage;
-}
+        nArena = LLRP_FRAME_ARENA_MAX;
+        if(pDecoder->nBuffer < LLRP_FRAME_ARENA_MAX / LLRP_FRAME_ARENA_RATIO)
+        {
+            nArena = LLRP_FRAME_ARENA_RATIO * pDecoder->nBuffer + 256u;
+        }
+        if(pDecoder->bBorrowVectors || pDecoder->bLazySubParameters)
+        {
+            nArena += pDecoder->nBuffer + 8u;
+        }
+        pDecoder->pArena = LLRP_Arena_construct(nArena);
+    }
 
-static llrp_u8_t
-next_u8 (
-  LLRP_tSFrameDecoder *         pDecoder)
-{
-    llrp_u8_t                   Value;
+    /*
+     * To borrow, the message keeps a copy of the frame in its
+     * arena and its byte vectors point into that. Sub-parameters
+     * decoded lazily are decoded from it too. The caller's
+     * buffer is free to be reused as soon as this returns.
+     * Without the copy, decode as usual.
+     */
+    pFrame = pDecoder->pBuffer;
+    bBorrowVectors = pDecoder->bBorrowVectors;
+    bLazySubParameters = pDecoder->bLazySubParameters;
+    if(pDecoder->bBorrowVectors || pDecoder->bLazySubParameters)
+    {
+        unsigned char *         pCopy = NULL;
+
+        if(NULL != pDecoder->pArena)
+        {
+            pCopy = LLRP_Arena_alloc(pDecoder->pArena, pDecoder->nBuffer);
+        }
+        if(NULL != pCopy)
+        {
+            memcpy(pCopy, pFrame, pDecoder->nBuffer);
+            pDecoder->pBuffer = pCopy;
+        }
+        else
+        {
+            pDecoder->bBorrowVectors = FALSE;
+            pDecoder->bLazySubParameters = FALSE;
+        }
+    }
+
+    pMessage = decodeMessage(&DecoderStream);
+
+    pDecoder->pBuffer = pFrame;
+    pDecoder->bBorrowVectors = bBorrowVectors;
+    pDecoder->bLazySubParameters = bLazySubParameters;
+
+    /*
+     * The message owns its arena. If decode failed the
+     * elements are already destructed, but not freed.
+     */
+    if(NULL != pDecoder->pArena)
+    {
+        if(NULL != pMessage)
+        {
+            pDecoder->pArena->pOwner = &pMessage->elementHdr;
+        }
+        else
+        {
+            LLRP_Arena_destruct(pDecoder->pArena);
+        }
+        pDecoder->pArena = NULL;
+    }
+
+    return pMessage;
+}
+
+static llrp_u8_t
+next_u8 (
+  LLRP_tSFrameDecoder *         pDecoder)
+{
+    llrp_u8_t                   Value;
 
     assert(pDecoder->iNext + 1u <= pDecoder->nBuffer);
 
@@ -433,6 +941,45 @@ next_u64 (
     return Value;
 }
 
+static void
+next_u16v (
+  LLRP_tSFrameDecoder *         pDecoder,
+  llrp_u16_t *                  pValue,
+  unsigned int                  nValue)
+{
+    assert(pDecoder->iNext + 2u * nValue <= pDecoder->nBuffer);
+
+    LLRP_ByteSwap_getKernel()->pfLoad16(pValue,
+                        &pDecoder->pBuffer[pDecoder->iNext], nValue);
+    pDecoder->iNext += 2u * nValue;
+}
+
+static void
+next_u32v (
+  LLRP_tSFrameDecoder *         pDecoder,
+  llrp_u32_t *                  pValue,
+  unsigned int                  nValue)
+{
+    assert(pDecoder->iNext + 4u * nValue <= pDecoder->nBuffer);
+
+    LLRP_ByteSwap_getKernel()->pfLoad32(pValue,
+                        &pDecoder->pBuffer[pDecoder->iNext], nValue);
+    pDecoder->iNext += 4u * nValue;
+}
+
+static void
+next_u64v (
+  LLRP_tSFrameDecoder *         pDecoder,
+  llrp_u64_t *                  pValue,
+  unsigned int                  nValue)
+{
+    assert(pDecoder->iNext + 8u * nValue <= pDecoder->nBuffer);
+
+    LLRP_ByteSwap_getKernel()->pfLoad64(pValue,
+                        &pDecoder->pBuffer[pDecoder->iNext], nValue);
+    pDecoder->iNext += 8u * nValue;
+}
+
 
 static llrp_u8_t
 get_u8 (
@@ -496,17 +1043,9 @@ get_u8v (
     {
         if(checkAvailable(pDecoderStream, 1u * nValue, pFieldDescriptor))
         {
-            Value = LLRP_u8v_construct(nValue);
-            if(verifyVectorAllocation(pDecoderStream, Value.pValue,
-                                pFieldDescriptor))
-            {
-                unsigned int    Ix;
-
-                for(Ix = 0; Ix < nValue; Ix++)
-                {
-                    Value.pValue[Ix] = next_u8(pDecoderStream->pDecoder);
-                }
-            }
+            Value.pValue = takeBytes(pDecoderStream, nValue,
+                                pFieldDescriptor);
+            Value.nValue = (NULL != Value.pValue) ? nValue : 0;
         }
     }
 
@@ -531,17 +1070,9 @@ get_s8v (
     {
         if(checkAvailable(pDecoderStream, 1u * nValue, pFieldDescriptor))
         {
-            Value = LLRP_s8v_construct(nValue);
-            if(verifyVectorAllocation(pDecoderStream, Value.pValue,
-                                pFieldDescriptor))
-            {
-                unsigned int    Ix;
-
-                for(Ix = 0; Ix < nValue; Ix++)
-                {
-                    Value.pValue[Ix] = next_u8(pDecoderStream->pDecoder);
-                }
-            }
+            Value.pValue = (llrp_s8_t *)takeBytes(pDecoderStream, nValue,
+                                pFieldDescriptor);
+            Value.nValue = (NULL != Value.pValue) ? nValue : 0;
         }
     }
 
@@ -610,16 +1141,14 @@ get_u16v (
     {
         if(checkAvailable(pDecoderStream, 2u * nValue, pFieldDescriptor))
         {
-            Value = LLRP_u16v_construct(nValue);
+            Value.pValue = allocVector(pDecoderStream->pDecoder,
+                                nValue * sizeof Value.pValue[0]);
+            Value.nValue = (NULL != Value.pValue) ? nValue : 0;
             if(verifyVectorAllocation(pDecoderStream, Value.pValue,
                                 pFieldDescriptor))
             {
-                unsigned int    Ix;
-
-                for(Ix = 0; Ix < nValue; Ix++)
-                {
-                    Value.pValue[Ix] = next_u16(pDecoderStream->pDecoder);
-                }
+                next_u16v(pDecoderStream->pDecoder,
+                            Value.pValue, nValue);
             }
         }
     }
@@ -645,16 +1174,14 @@ get_s16v (
     {
         if(checkAvailable(pDecoderStream, 2u * nValue, pFieldDescriptor))
         {
-            Value = LLRP_s16v_construct(nValue);
+            Value.pValue = allocVector(pDecoderStream->pDecoder,
+                                nValue * sizeof Value.pValue[0]);
+            Value.nValue = (NULL != Value.pValue) ? nValue : 0;
             if(verifyVectorAllocation(pDecoderStream, Value.pValue,
                                 pFieldDescriptor))
             {
-                unsigned int    Ix;
-
-                for(Ix = 0; Ix < nValue; Ix++)
-                {
-                    Value.pValue[Ix] = next_u16(pDecoderStream->pDecoder);
-                }
+                next_u16v(pDecoderStream->pDecoder,
+                            (llrp_u16_t *) Value.pValue, nValue);
             }
         }
     }
@@ -724,16 +1251,14 @@ get_u32v (
     {
         if(checkAvailable(pDecoderStream, 4u * nValue, pFieldDescriptor))
         {
-            Value = LLRP_u32v_construct(nValue);
+            Value.pValue = allocVector(pDecoderStream->pDecoder,
+                                nValue * sizeof Value.pValue[0]);
+            Value.nValue = (NULL != Value.pValue) ? nValue : 0;
             if(verifyVectorAllocation(pDecoderStream, Value.pValue,
                                 pFieldDescriptor))
             {
-                unsigned int    Ix;
-
-                for(Ix = 0; Ix < nValue; Ix++)
-                {
-                    Value.pValue[Ix] = next_u32(pDecoderStream->pDecoder);
-                }
+                next_u32v(pDecoderStream->pDecoder,
+                            Value.pValue, nValue);
             }
         }
     }
@@ -759,16 +1284,14 @@ get_s32v (
     {
         if(checkAvailable(pDecoderStream, 4u * nValue, pFieldDescriptor))
         {
-            Value = LLRP_s32v_construct(nValue);
+            Value.pValue = allocVector(pDecoderStream->pDecoder,
+                                nValue * sizeof Value.pValue[0]);
+            Value.nValue = (NULL != Value.pValue) ? nValue : 0;
             if(verifyVectorAllocation(pDecoderStream, Value.pValue,
                                 pFieldDescriptor))
             {
-                unsigned int    Ix;
-
-                for(Ix = 0; Ix < nValue; Ix++)
-                {
-                    Value.pValue[Ix] = next_u32(pDecoderStream->pDecoder);
-                }
+                next_u32v(pDecoderStream->pDecoder,
+                            (llrp_u32_t *) Value.pValue, nValue);
             }
         }
     }
@@ -838,16 +1361,14 @@ get_u64v (
     {
         if(checkAvailable(pDecoderStream, 8u * nValue, pFieldDescriptor))
         {
-            Value = LLRP_u64v_construct(nValue);
+            Value.pValue = allocVector(pDecoderStream->pDecoder,
+                                nValue * sizeof Value.pValue[0]);
+            Value.nValue = (NULL != Value.pValue) ? nValue : 0;
             if(verifyVectorAllocation(pDecoderStream, Value.pValue,
                                 pFieldDescriptor))
             {
-                unsigned int    Ix;
-
-                for(Ix = 0; Ix < nValue; Ix++)
-                {
-                    Value.pValue[Ix] = next_u64(pDecoderStream->pDecoder);
-                }
+                next_u64v(pDecoderStream->pDecoder,
+                            Value.pValue, nValue);
             }
         }
     }
@@ -873,16 +1394,14 @@ get_s64v (
     {
         if(checkAvailable(pDecoderStream, 8u * nValue, pFieldDescriptor))
         {
-            Value = LLRP_s64v_construct(nValue);
+            Value.pValue = allocVector(pDecoderStream->pDecoder,
+                                nValue * sizeof Value.pValue[0]);
+            Value.nValue = (NULL != Value.pValue) ? nValue : 0;
             if(verifyVectorAllocation(pDecoderStream, Value.pValue,
                                 pFieldDescriptor))
             {
-                unsigned int    Ix;
-
-                for(Ix = 0; Ix < nValue; Ix++)
-                {
-                    Value.pValue[Ix] = next_u64(pDecoderStream->pDecoder);
-                }
+                next_u64v(pDecoderStream->pDecoder,
+                            (llrp_u64_t *) Value.pValue, nValue);
             }
         }
     }
@@ -925,17 +1444,9 @@ get_u1v (
 
         if(checkAvailable(pDecoderStream, nByte, pFieldDescriptor))
         {
-            Value = LLRP_u1v_construct(nBit);
-            if(verifyVectorAllocation(pDecoderStream, Value.pValue,
-                                pFieldDescriptor))
-            {
-                unsigned int    Ix;
-
-                for(Ix = 0; Ix < nByte; Ix++)
-                {
-                    Value.pValue[Ix] = next_u8(pDecoderStream->pDecoder);
-                }
-            }
+            Value.pValue = takeBytes(pDecoderStream, nByte,
+                                pFieldDescriptor);
+            Value.nBit = (NULL != Value.pValue) ? nBit : 0;
         }
     }
 
@@ -1002,17 +1513,9 @@ get_utf8v (
     {
         if(checkAvailable(pDecoderStream, 1u * nValue, pFieldDescriptor))
         {
-            Value = LLRP_utf8v_construct(nValue);
-            if(verifyVectorAllocation(pDecoderStream, Value.pValue,
-                                pFieldDescriptor))
-            {
-                unsigned int    Ix;
-
-                for(Ix = 0; Ix < nValue; Ix++)
-                {
-                    Value.pValue[Ix] = next_u8(pDecoderStream->pDecoder);
-                }
-            }
+            Value.pValue = takeBytes(pDecoderStream, nValue,
+                                pFieldDescriptor);
+            Value.nValue = (NULL != Value.pValue) ? nValue : 0;
         }
     }
 
@@ -1037,17 +1540,9 @@ get_bytesToEnd (
     {
         if(checkAvailable(pDecoderStream, 1u * nValue, pFieldDescriptor))
         {
-            Value = LLRP_bytesToEnd_construct(nValue);
-            if(verifyVectorAllocation(pDecoderStream, Value.pValue,
-                                pFieldDescriptor))
-            {
-                unsigned int    Ix;
-
-                for(Ix = 0; Ix < nValue; Ix++)
-                {
-                    Value.pValue[Ix] = next_u8(pDecoderStream->pDecoder);
-                }
-            }
+            Value.pValue = takeBytes(pDecoderStream, nValue,
+                                pFieldDescriptor);
+            Value.nValue = (NULL != Value.pValue) ? nValue : 0;
         }
     }
 
@@ -1223,9 +1718,12 @@ streamConstruct_nested (
     pDecoderStream->iLimit                  = pEnclosingDecoderStream->iLimit;
 }
 
-static LLRP_tSMessage *
-decodeMessage (
-  LLRP_tSFrameDecoderStream *   pDecoderStream)
+static const LLRP_tSTypeDescriptor *
+decodeMessageHeader (
+  LLRP_tSFrameDecoderStream *   pDecoderStream,
+  llrp_u64_t *                  pDeviceSN,
+  llrp_u8_t *                   pVersion,
+  llrp_u32_t *                  pMessageID)
 {
     LLRP_tSFrameDecoder *       pDecoder  = pDecoderStream->pDecoder;
     LLRP_tSErrorDetails *       pError    = &pDecoder->decoderHdr.ErrorDetails;
@@ -1233,29 +1731,24 @@ decodeMessage (
     LLRP_tSDecoderStream *      pBaseDecoderStream =
                                         &pDecoderStream->decoderStreamHdr;
     const LLRP_tSTypeDescriptor *pTypeDescriptor;
-    llrp_u64_t                  DeviceSN;
     llrp_u16_t                  Type;
-    llrp_u8_t                   Version;
     llrp_u32_t                  nLength;
     unsigned int                iLimit;
-    llrp_u32_t                  MessageID;
-    LLRP_tSElement *            pElement;
-    LLRP_tSMessage *            pMessage;
 
     if(LLRP_RC_OK != pError->eResultCode)
     {
         return NULL;
     }
 
-    DeviceSN = get_u64(pBaseDecoderStream, &LLRP_g_fdMessageHeader_DeviceSN);
-    Version = get_u8(pBaseDecoderStream, &LLRP_g_fdMessageHeader_Version);
+    *pDeviceSN = get_u64(pBaseDecoderStream, &LLRP_g_fdMessageHeader_DeviceSN);
+    *pVersion = get_u8(pBaseDecoderStream, &LLRP_g_fdMessageHeader_Version);
 
     if(LLRP_RC_OK != pError->eResultCode)
     {
         return NULL;
     }
 
-    if(1u != Version)
+    if(1u != *pVersion)
     {
         pError->eResultCode = LLRP_RC_BadVersion;
         pError->pWhatStr    = "unsupported version";
@@ -1297,7 +1790,8 @@ decodeMessage (
 
     pDecoderStream->iLimit = iLimit;
 
-    MessageID = get_u32(pBaseDecoderStream, &LLRP_g_fdMessageHeader_MessageID);
+    *pMessageID = get_u32(pBaseDecoderStream,
+                            &LLRP_g_fdMessageHeader_MessageID);
 
     if(LLRP_RC_OK != pError->eResultCode)
     {
@@ -1349,7 +1843,32 @@ decodeMessage (
 
     pDecoderStream->pRefType = pTypeDescriptor;
 
-    pElement = LLRP_Element_construct(pTypeDescriptor);
+    return pTypeDescriptor;
+}
+
+static LLRP_tSMessage *
+decodeMessage (
+  LLRP_tSFrameDecoderStream *   pDecoderStream)
+{
+    LLRP_tSFrameDecoder *       pDecoder  = pDecoderStream->pDecoder;
+    LLRP_tSErrorDetails *       pError    = &pDecoder->decoderHdr.ErrorDetails;
+    LLRP_tSDecoderStream *      pBaseDecoderStream =
+                                        &pDecoderStream->decoderStreamHdr;
+    const LLRP_tSTypeDescriptor *pTypeDescriptor;
+    llrp_u64_t                  DeviceSN;
+    llrp_u8_t                   Version;
+    llrp_u32_t                  MessageID;
+    LLRP_tSElement *            pElement;
+    LLRP_tSMessage *            pMessage;
+
+    pTypeDescriptor = decodeMessageHeader(pDecoderStream,
+                            &DeviceSN, &Version, &MessageID);
+    if(NULL == pTypeDescriptor)
+    {
+        return NULL;
+    }
+
+    pElement = allocElement(pDecoder, pTypeDescriptor);
 
     if(NULL == pElement)
     {
@@ -1366,7 +1885,14 @@ decodeMessage (
     pMessage->Version = Version;
     pMessage->MessageID = MessageID;
 
-    pTypeDescriptor->pfDecodeFields(pElement, pBaseDecoderStream);
+    if(NULL != pTypeDescriptor->pfDecodeFrameFields)
+    {
+        pTypeDescriptor->pfDecodeFrameFields(pElement, pBaseDecoderStream);
+    }
+    else
+    {
+        pTypeDescriptor->pfDecodeFields(pElement, pBaseDecoderStream);
+    }
 
     if(LLRP_RC_OK != pError->eResultCode)
     {
@@ -1377,6 +1903,10 @@ decodeMessage (
     /*
      * Subparameters
      */
+    if(pDecoder->bLazySubParameters)
+    {
+        scanSubParameters(pDecoderStream, pMessage);
+    }
     while(0 < getRemainingByteCount(pDecoderStream) &&
           LLRP_RC_OK == pError->eResultCode)
     {
@@ -1433,9 +1963,10 @@ decodeMessage (
     return pMessage;
 }
 
-static LLRP_tSParameter *
-decodeParameter (
-  LLRP_tSFrameDecoderStream *   pDecoderStream)
+static const LLRP_tSTypeDescriptor *
+decodeParameterHeader (
+  LLRP_tSFrameDecoderStream *   pDecoderStream,
+  llrp_bool_t *                 pbIsTV)
 {
     LLRP_tSFrameDecoder *       pDecoder  = pDecoderStream->pDecoder;
     LLRP_tSErrorDetails *       pError    = &pDecoder->decoderHdr.ErrorDetails;
@@ -1444,9 +1975,6 @@ decodeParameter (
                                         &pDecoderStream->decoderStreamHdr;
     const LLRP_tSTypeDescriptor *pTypeDescriptor;
     llrp_u16_t                  Type;
-    llrp_bool_t                 bIsTV;
-    LLRP_tSElement *            pElement;
-    LLRP_tSParameter *          pParameter;
 
     if(LLRP_RC_OK != pError->eResultCode)
     {
@@ -1468,7 +1996,7 @@ decodeParameter (
          * the enclosing element.
          */
         Type &= 0x7F;
-        bIsTV = TRUE;
+        *pbIsTV = TRUE;
     }
     else
     {
@@ -1478,12 +2006,12 @@ decodeParameter (
         /*
          * Type-Length-Value (TLV).
          * Back up and get the real type number,
-         * then get the length.
+         * then get the length. V1.40 types use all
+         * 16 bits, and are looked up as such.
          */
         pDecoder->iNext--;
         Type = get_u16(pBaseDecoderStream,
                     &LLRP_g_fdParameterHeader_TLVType);
-        //Type &= 0x3FF; // V1.40 has bigger type
 
         if(LLRP_RC_OK != pError->eResultCode)
         {
@@ -1524,7 +2052,7 @@ decodeParameter (
 
         pDecoderStream->iLimit = iLimit;
 
-        bIsTV = FALSE;
+        *pbIsTV = FALSE;
     }
 
     /* Custom? */
@@ -1566,7 +2094,7 @@ decodeParameter (
         pError->eResultCode = LLRP_RC_UnknownParameterType;
         pError->pWhatStr    = "unknown parameter type";
         pError->pRefType    = NULL;
-        if(bIsTV)
+        if(*pbIsTV)
         {
             pError->pRefField = &LLRP_g_fdParameterHeader_TVType;
         }
@@ -1580,7 +2108,26 @@ decodeParameter (
 
     pDecoderStream->pRefType = pTypeDescriptor;
 
-    pElement = LLRP_Element_construct(pTypeDescriptor);
+    return pTypeDescriptor;
+}
+
+static LLRP_tSParameter *
+decodeParameter (
+  LLRP_tSFrameDecoderStream *   pDecoderStream)
+{
+    LLRP_tSFrameDecoder *       pDecoder  = pDecoderStream->pDecoder;
+    LLRP_tSErrorDetails *       pError    = &pDecoder->decoderHdr.ErrorDetails;
+    const LLRP_tSTypeDescriptor *pTypeDescriptor;
+    llrp_bool_t                 bIsTV;
+    LLRP_tSElement *            pElement;
+
+    pTypeDescriptor = decodeParameterHeader(pDecoderStream, &bIsTV);
+    if(NULL == pTypeDescriptor)
+    {
+        return NULL;
+    }
+
+    pElement = allocElement(pDecoder, pTypeDescriptor);
 
     if(NULL == pElement)
     {
@@ -1592,117 +2139,452 @@ decodeParameter (
         return NULL;
     }
 
-    pParameter = (LLRP_tSParameter *) pElement;
-
-    pTypeDescriptor->pfDecodeFields(pElement, pBaseDecoderStream);
-
-    if(LLRP_RC_OK != pError->eResultCode)
+    if(!decodeParameterBody(pDecoderStream, pElement, bIsTV))
     {
         LLRP_Element_destruct(pElement);
         return NULL;
     }
 
-    if(!bIsTV)
+    return (LLRP_tSParameter *) pElement;
+}
+
+/*
+ * The fields and, for a TLV, the sub-parameters of a parameter
+ * whose header has been decoded. On error the element is left
+ * for the caller, with whatever was decoded into it.
+ */
+static llrp_bool_t
+decodeParameterBody (
+  LLRP_tSFrameDecoderStream *   pDecoderStream,
+  LLRP_tSElement *              pElement,
+  llrp_bool_t                   bIsTV)
+{
+    LLRP_tSFrameDecoder *       pDecoder  = pDecoderStream->pDecoder;
+    LLRP_tSErrorDetails *       pError    = &pDecoder->decoderHdr.ErrorDetails;
+    LLRP_tSDecoderStream *      pBaseDecoderStream =
+                                        &pDecoderStream->decoderStreamHdr;
+    const LLRP_tSTypeDescriptor *pTypeDescriptor = pElement->pType;
+
+    if(NULL != pTypeDescriptor->pfDecodeFrameFields)
     {
-        /*
-         * Subparameters
-         */
-        while(0 < getRemainingByteCount(pDecoderStream) &&
-              LLRP_RC_OK == pError->eResultCode)
-        {
-            LLRP_tSFrameDecoderStream       NestStream;
-            LLRP_tSParameter *              pSubParameter;
+        pTypeDescriptor->pfDecodeFrameFields(pElement, pBaseDecoderStream);
+    }
+    else
+    {
+        pTypeDescriptor->pfDecodeFields(pElement, pBaseDecoderStream);
+    }
 
-            streamConstruct_nested(&NestStream, pDecoderStream);
+    if(LLRP_RC_OK != pError->eResultCode)
+    {
+        return FALSE;
+    }
 
-            pSubParameter = decodeParameter(&NestStream);
+    if(bIsTV)
+    {
+        return TRUE;
+    }
 
-            if(NULL == pSubParameter)
-            {
-                if(LLRP_RC_OK == pError->eResultCode)
-                {
-                    pError->eResultCode = LLRP_RC_Botch;
-                    pError->pWhatStr    = "botch -- no param and no error";
-                    pError->pRefType    = pTypeDescriptor;
-                    pError->pRefField   = NULL;
-                    pError->OtherDetail = pDecoder->iNext;
-                }
-                break;
-            }
+    /*
+     * Subparameters
+     */
+    while(0 < getRemainingByteCount(pDecoderStream) &&
+          LLRP_RC_OK == pError->eResultCode)
+    {
+        LLRP_tSFrameDecoderStream       NestStream;
+        LLRP_tSParameter *              pSubParameter;
 
-            pSubParameter->elementHdr.pParent = pElement;
-            LLRP_Element_addSubParameterToAllList(pElement, pSubParameter);
-        }
+        streamConstruct_nested(&NestStream, pDecoderStream);
 
-        if(LLRP_RC_OK == pError->eResultCode)
+        pSubParameter = decodeParameter(&NestStream);
+
+        if(NULL == pSubParameter)
         {
-            if(pDecoder->iNext != pDecoderStream->iLimit)
+            if(LLRP_RC_OK == pError->eResultCode)
             {
-                pError->eResultCode = LLRP_RC_ExtraBytes;
-                pError->pWhatStr    = "extra bytes at end of TLV parameter";
+                pError->eResultCode = LLRP_RC_Botch;
+                pError->pWhatStr    = "botch -- no param and no error";
                 pError->pRefType    = pTypeDescriptor;
                 pError->pRefField   = NULL;
                 pError->OtherDetail = pDecoder->iNext;
             }
+            break;
         }
 
-        if(LLRP_RC_OK != pError->eResultCode)
-        {
-            LLRP_Element_destruct(pElement);
-            return NULL;
-        }
-
-        pTypeDescriptor->pfAssimilateSubParameters(pElement, pError);
+        pSubParameter->elementHdr.pParent = pElement;
+        LLRP_Element_addSubParameterToAllList(pElement, pSubParameter);
+    }
 
-        if(LLRP_RC_OK != pError->eResultCode)
+    if(LLRP_RC_OK == pError->eResultCode)
+    {
+        if(pDecoder->iNext != pDecoderStream->iLimit)
         {
-            LLRP_Element_destruct(pElement);
-            return NULL;
+            pError->eResultCode = LLRP_RC_ExtraBytes;
+            pError->pWhatStr    = "extra bytes at end of TLV parameter";
+            pError->pRefType    = pTypeDescriptor;
+            pError->pRefField   = NULL;
+            pError->OtherDetail = pDecoder->iNext;
         }
     }
 
-    return pParameter;
-}
-
-static unsigned int
-getRemainingByteCount (
-  LLRP_tSFrameDecoderStream *   pDecoderStream)
-{
-    LLRP_tSFrameDecoder *       pDecoder = pDecoderStream->pDecoder;
-
-    if(pDecoder->iNext < pDecoderStream->iLimit)
-    {
-        return pDecoderStream->iLimit - pDecoder->iNext;
-    }
-    else
+    if(LLRP_RC_OK != pError->eResultCode)
     {
-        return 0;
+        return FALSE;
     }
+
+    pTypeDescriptor->pfAssimilateSubParameters(pElement, pError);
+
+    return LLRP_RC_OK == pError->eResultCode;
 }
 
-static llrp_bool_t
-checkAvailable (
+/*
+ * Instead of decoding the message's sub-parameters, check their
+ * headers and lengths, and make each TLV an empty element to be
+ * materialized later. Done in two passes so a message whose
+ * framing is bad allocates nothing. Leaves the decoder at the
+ * end of the message, so the caller's loop has nothing to do.
+ */
+static void
+scanSubParameters (
   LLRP_tSFrameDecoderStream *   pDecoderStream,
-  unsigned int                  nByte,
-  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+  LLRP_tSMessage *              pMessage)
 {
-    LLRP_tSFrameDecoder *       pDecoder = pDecoderStream->pDecoder;
-    LLRP_tSErrorDetails *       pError = &pDecoder->decoderHdr.ErrorDetails;
+    LLRP_tSFrameDecoder *       pDecoder  = pDecoderStream->pDecoder;
+    LLRP_tSErrorDetails *       pError    = &pDecoder->decoderHdr.ErrorDetails;
+    LLRP_tSElement *            pElement  = &pMessage->elementHdr;
+    LLRP_tSLazySubParameters *  pLazy;
+    const LLRP_tSTypeDescriptor *pTypeDescriptor;
+    LLRP_tSFrameDecoderStream   NestStream;
+    LLRP_tSParameter *          pParameter;
+    llrp_bool_t                 bIsTV;
+    unsigned int                iFirst = pDecoder->iNext;
+    unsigned int                nEntry = 0;
+    unsigned int                iEntry;
 
-    if(LLRP_RC_OK != pError->eResultCode)
+    /*
+     * Pass 1: framing. A TV's fields are all there
+     * is to say where it ends.
+     */
+    while(0 < getRemainingByteCount(pDecoderStream))
     {
-        return FALSE;
-    }
+        streamConstruct_nested(&NestStream, pDecoderStream);
 
-    if(pDecoder->iNext + nByte > pDecoderStream->iLimit)
-    {
-        pError->eResultCode = LLRP_RC_FieldUnderrun;
-        pError->pWhatStr    = "underrun at field";
-        pError->pRefType    = pDecoderStream->pRefType;
-        pError->pRefField   = pFieldDescriptor;
-        pError->OtherDetail = pDecoder->iNext;
-        return FALSE;
-    }
+        pTypeDescriptor = decodeParameterHeader(&NestStream, &bIsTV);
+        if(NULL == pTypeDescriptor)
+        {
+            return;
+        }
+
+        if(bIsTV)
+        {
+            pTypeDescriptor->pfDecodeFields(NULL,
+                                &NestStream.decoderStreamHdr);
+            if(LLRP_RC_OK != pError->eResultCode)
+            {
+                return;
+            }
+        }
+        else
+        {
+            pDecoder->iNext = NestStream.iLimit;
+            nEntry++;
+        }
+    }
+
+    pLazy = LLRP_Arena_alloc(pDecoder->pArena,
+                sizeof *pLazy + nEntry * sizeof *pLazy->pEntries);
+    if(NULL == pLazy)
+    {
+        pError->eResultCode = LLRP_RC_MessageAllocationFailed;
+        pError->pWhatStr    = "message allocation failed";
+        pError->pRefType    = pElement->pType;
+        pError->pRefField   = NULL;
+        pError->OtherDetail = pDecoder->iNext;
+        return;
+    }
+
+    memset(pLazy, 0, sizeof *pLazy);
+    pLazy->pRegistry      = pDecoder->decoderHdr.pRegistry;
+    pLazy->pFrame         = pDecoder->pBuffer;
+    pLazy->nFrame         = pDecoder->nBuffer;
+    pLazy->iLimit         = pDecoderStream->iLimit;
+    pLazy->bBorrowVectors = pDecoder->bBorrowVectors;
+    pLazy->pEntries       = (LLRP_tSLazyEntry *)(pLazy + 1);
+    pLazy->nEntry         = nEntry;
+    pLazy->nPending       = nEntry;
+
+    /*
+     * Pass 2: the elements, TVs decoded and TLVs empty
+     */
+    pDecoder->iNext = iFirst;
+    iEntry = 0;
+    while(0 < getRemainingByteCount(pDecoderStream))
+    {
+        streamConstruct_nested(&NestStream, pDecoderStream);
+
+        pTypeDescriptor = decodeParameterHeader(&NestStream, &bIsTV);
+        if(NULL == pTypeDescriptor)
+        {
+            return;
+        }
+
+        pParameter = (LLRP_tSParameter *)
+                        allocElement(pDecoder, pTypeDescriptor);
+        if(NULL == pParameter)
+        {
+            pError->eResultCode = LLRP_RC_ParameterAllocationFailed;
+            pError->pWhatStr    = "parameter allocation failed";
+            pError->pRefType    = pTypeDescriptor;
+            pError->pRefField   = NULL;
+            pError->OtherDetail = pDecoder->iNext;
+            return;
+        }
+
+        pParameter->elementHdr.pParent = pElement;
+        LLRP_Element_addSubParameterToAllList(pElement, pParameter);
+
+        if(bIsTV)
+        {
+            decodeParameterBody(&NestStream, &pParameter->elementHdr, TRUE);
+        }
+        else
+        {
+            pLazy->pEntries[iEntry].pParameter = pParameter;
+            pLazy->pEntries[iEntry].iBegin     = NestStream.iBegin;
+            pLazy->pEntries[iEntry].bDecoded   = FALSE;
+            iEntry++;
+            pDecoder->iNext = NestStream.iLimit;
+        }
+    }
+
+    if(0 < nEntry)
+    {
+        pMessage->pLazy = pLazy;
+    }
+}
+
+/*
+ * Decode a TLV sub-parameter of a lazily decoded message into its
+ * empty element, in place. If it fails the element is left empty
+ * and the error is kept for LLRP_Message_materializeAll().
+ */
+static void
+materializeEntry (
+  LLRP_tSMessage *              pMessage,
+  LLRP_tSLazyEntry *            pEntry)
+{
+    LLRP_tSLazySubParameters *  pLazy = pMessage->pLazy;
+    LLRP_tSElement *            pElement = &pEntry->pParameter->elementHdr;
+    LLRP_tSErrorDetails *       pError;
+    const LLRP_tSTypeDescriptor *pTypeDescriptor;
+    LLRP_tSFrameDecoder         Decoder;
+    LLRP_tSFrameDecoderStream   DecoderStream;
+    LLRP_tSFrameDecoderStream   NestStream;
+    llrp_bool_t                 bIsTV;
+
+    pEntry->bDecoded = TRUE;
+    pLazy->nPending--;
+
+    /*
+     * A decoder over the message's copy of the frame, positioned
+     * as when the message was decoded, and allocating from the
+     * message's arena.
+     */
+    LLRP_FrameDecoder_init(&Decoder, pLazy->pRegistry,
+                    pLazy->pFrame, pLazy->nFrame);
+    Decoder.bBorrowVectors = pLazy->bBorrowVectors;
+    Decoder.pArena = pMessage->elementHdr.pArena;
+    pError = &Decoder.decoderHdr.ErrorDetails;
+
+    streamConstruct_outermost(&DecoderStream, &Decoder);
+    DecoderStream.pRefType = pMessage->elementHdr.pType;
+    DecoderStream.iLimit = pLazy->iLimit;
+
+    Decoder.iNext = pEntry->iBegin;
+    streamConstruct_nested(&NestStream, &DecoderStream);
+
+    pTypeDescriptor = decodeParameterHeader(&NestStream, &bIsTV);
+    if(pTypeDescriptor == pElement->pType && !bIsTV)
+    {
+        decodeParameterBody(&NestStream, pElement, FALSE);
+    }
+    else if(LLRP_RC_OK == pError->eResultCode)
+    {
+        pError->eResultCode = LLRP_RC_Botch;
+        pError->pWhatStr    = "botch -- lazy parameter changed type";
+        pError->pRefType    = pElement->pType;
+        pError->pRefField   = NULL;
+        pError->OtherDetail = Decoder.iNext;
+    }
+
+    if(LLRP_RC_OK != pError->eResultCode)
+    {
+        LLRP_Element_clearSubParameterAllList(pElement);
+        memset((char *) pElement + sizeof(LLRP_tSParameter), 0,
+                pElement->pType->nSizeBytes - sizeof(LLRP_tSParameter));
+        if(LLRP_RC_OK == pLazy->ErrorDetails.eResultCode)
+        {
+            pLazy->ErrorDetails = *pError;
+        }
+    }
+}
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Decode sub-parameters of a lazily decoded message
+ **
+ ** Decodes pFirst and those after it on its member list
+ ** (pNextSubParameter) if not already decoded. The generated get
+ ** and begin accessors of messages call this, so callers seldom
+ ** need to.
+ **
+ ** Not thread safe: a message decoded lazily changes as it is read.
+ **
+ ** @param[in]  pMessage        The message
+ ** @param[in]  pFirst          A sub-parameter of it, or NULL
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Message_materializeSubParameters (
+  LLRP_tSMessage *              pMessage,
+  LLRP_tSParameter *            pFirst)
+{
+    LLRP_tSLazySubParameters *  pLazy = pMessage->pLazy;
+    LLRP_tSParameter *          pParameter;
+    unsigned int                iEntry = 0;
+    unsigned int                iFound;
+
+    if(NULL == pLazy || 0 == pLazy->nPending)
+    {
+        return;
+    }
+
+    /*
+     * The member list and the entries are both in frame order,
+     * so one pass over the entries finds them all. Parameters
+     * added since decode are not entries and are passed over.
+     */
+    for(pParameter = pFirst;
+        NULL != pParameter;
+        pParameter = pParameter->pNextSubParameter)
+    {
+        for(iFound = iEntry; iFound < pLazy->nEntry; iFound++)
+        {
+            if(pLazy->pEntries[iFound].pParameter == pParameter)
+            {
+                break;
+            }
+        }
+        if(iFound == pLazy->nEntry)
+        {
+            continue;
+        }
+
+        if(!pLazy->pEntries[iFound].bDecoded)
+        {
+            materializeEntry(pMessage, &pLazy->pEntries[iFound]);
+        }
+        iEntry = iFound + 1u;
+    }
+}
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Decode what is left of a lazily decoded message
+ **
+ ** A message decoded with the frame decoder's bLazySubParameters has
+ ** had its framing checked and its sub-parameters assimilated, so
+ ** bad lengths, unknown types and missing or unexpected parameters
+ ** failed LLRP_Decoder_decodeMessage() as usual. Errors inside a
+ ** sub-parameter only show when it is decoded: it is left empty and
+ ** the first such error is kept for this to give.
+ **
+ ** The encoders and the routines that change a message's
+ ** sub-parameters call this first and give its error: the encoders
+ ** then stop, the changes are made. LLRP_Element_walk() stops too
+ ** and gives LLRP_WALK_DECODE_FAILED.
+ **
+ ** @param[in]  pMessage        The message, lazily decoded or not
+ ** @param[out] pError          Gets the first error, if it has none
+ **                             already. NULL is OK.
+ **
+ ** @return     LLRP_RC_OK      All decoded, or not lazily decoded
+ **             other           Some sub-parameter failed to decode
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+LLRP_Message_materializeAll (
+  LLRP_tSMessage *              pMessage,
+  LLRP_tSErrorDetails *         pError)
+{
+    LLRP_tSLazySubParameters *  pLazy = pMessage->pLazy;
+    unsigned int                iEntry;
+
+    if(NULL == pLazy)
+    {
+        return LLRP_RC_OK;
+    }
+
+    for(iEntry = 0; 0 < pLazy->nPending && iEntry < pLazy->nEntry; iEntry++)
+    {
+        if(!pLazy->pEntries[iEntry].bDecoded)
+        {
+            materializeEntry(pMessage, &pLazy->pEntries[iEntry]);
+        }
+    }
+
+    if(NULL != pError && LLRP_RC_OK == pError->eResultCode)
+    {
+        *pError = pLazy->ErrorDetails;
+    }
+
+    return pLazy->ErrorDetails.eResultCode;
+}
+
+static unsigned int
+getRemainingByteCount (
+  LLRP_tSFrameDecoderStream *   pDecoderStream)
+{
+    LLRP_tSFrameDecoder *       pDecoder = pDecoderStream->pDecoder;
+
+    if(pDecoder->iNext < pDecoderStream->iLimit)
+    {
+        return pDecoderStream->iLimit - pDecoder->iNext;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+static llrp_bool_t
+checkAvailable (
+  LLRP_tSFrameDecoderStream *   pDecoderStream,
+  unsigned int                  nByte,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameDecoder *       pDecoder = pDecoderStream->pDecoder;
+    LLRP_tSErrorDetails *       pError = &pDecoder->decoderHdr.ErrorDetails;
+
+    if(LLRP_RC_OK != pError->eResultCode)
+    {
+        return FALSE;
+    }
+
+    if(pDecoder->iNext + nByte > pDecoderStream->iLimit)
+    {
+        pError->eResultCode = LLRP_RC_FieldUnderrun;
+        pError->pWhatStr    = "underrun at field";
+        pError->pRefType    = pDecoderStream->pRefType;
+        pError->pRefField   = pFieldDescriptor;
+        pError->OtherDetail = pDecoder->iNext;
+        return FALSE;
+    }
 
     if(0 != pDecoder->nBitFieldResid)
     {
@@ -1802,3 +2684,831 @@ verifyVectorAllocation (
     }
 }
 
+/*
+ * Elements and vectors come from the message's arena
+ * when there is one, else from malloc() as usual.
+ */
+static LLRP_tSElement *
+allocElement (
+  LLRP_tSFrameDecoder *         pDecoder,
+  const LLRP_tSTypeDescriptor * pTypeDescriptor)
+{
+    if(NULL != pDecoder->pArena)
+    {
+        return LLRP_Element_constructInArena(pTypeDescriptor,
+                    pDecoder->pArena);
+    }
+
+    return LLRP_Element_construct(pTypeDescriptor);
+}
+
+static void *
+allocVector (
+  LLRP_tSFrameDecoder *         pDecoder,
+  unsigned int                  nByte)
+{
+    if(NULL != pDecoder->pArena)
+    {
+        return LLRP_Arena_alloc(pDecoder->pArena, nByte);
+    }
+
+    return malloc(nByte);
+}
+
+/*
+ * The nByte bytes of a byte vector, already checked available.
+ * When borrowing they stay where they are, in the message's
+ * own copy of the frame. Otherwise they are copied out.
+ * NULL, with the error set, on allocation failure.
+ */
+static llrp_u8_t *
+takeBytes (
+  LLRP_tSFrameDecoderStream *   pDecoderStream,
+  unsigned int                  nByte,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameDecoder *       pDecoder = pDecoderStream->pDecoder;
+    llrp_u8_t *                 pValue;
+
+    if(pDecoder->bBorrowVectors)
+    {
+        pValue = &pDecoder->pBuffer[pDecoder->iNext];
+    }
+    else
+    {
+        pValue = allocVector(pDecoder, nByte);
+        if(!verifyVectorAllocation(pDecoderStream, pValue, pFieldDescriptor))
+        {
+            return NULL;
+        }
+        memcpy(pValue, &pDecoder->pBuffer[pDecoder->iNext], nByte);
+    }
+
+    pDecoder->iNext += nByte;
+
+    return pValue;
+}
+
+/*
+ * For the generated frame field decoders. Takes the nByte
+ * bytes of a type's fixed field block, checked once, and
+ * returns where they are. NULL, with no error set, if they
+ * are not all there or a bit field is part way through.
+ * The generic decodeFields() then finds and reports it.
+ */
+const llrp_u8_t *
+LLRP_FrameDecoderStream_takeFieldBlock (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  unsigned int                  nByte)
+{
+    LLRP_tSFrameDecoderStream * pDecoderStream;
+    LLRP_tSFrameDecoder *       pDecoder;
+    const llrp_u8_t *           pField;
+
+    pDecoderStream = (LLRP_tSFrameDecoderStream *) pBaseDecoderStream;
+    pDecoder = pDecoderStream->pDecoder;
+
+    if(LLRP_RC_OK != pDecoder->decoderHdr.ErrorDetails.eResultCode ||
+       0 != pDecoder->nBitFieldResid ||
+       nByte > getRemainingByteCount(pDecoderStream))
+    {
+        return NULL;
+    }
+
+    pField = &pDecoder->pBuffer[pDecoder->iNext];
+    pDecoder->iNext += nByte;
+
+    return pField;
+}
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Walk the message in the frame, calling back instead of
+ **         building elements
+ **
+ ** See LLRP_tSFrameStreamCallbacks. The decoder is used as by
+ ** LLRP_Decoder_decodeMessage(): LLRP_FrameDecoder_init() or
+ ** _reset() first. Its arena and vector options don't matter,
+ ** nothing is allocated.
+ **
+ ** @return     LLRP_RC_OK, or the code in the decoder's ErrorDetails
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+LLRP_FrameDecoder_stream (
+  LLRP_tSFrameDecoder *         pDecoder,
+  const LLRP_tSFrameStreamCallbacks *pCallbacks,
+  void *                        pContext)
+{
+    LLRP_tSFrameStream          Stream;
+    LLRP_tSFrameStreamDecoderStream DecoderStream;
+
+    Stream.pCallbacks = pCallbacks;
+    Stream.pContext   = pContext;
+    Stream.bQuiet     = FALSE;
+
+    streamConstruct_outermost_stream(&DecoderStream, pDecoder, &Stream);
+
+    streamMessage(&DecoderStream);
+
+    return pDecoder->decoderHdr.ErrorDetails.eResultCode;
+}
+
+static void
+streamConstruct_outermost_stream (
+  LLRP_tSFrameStreamDecoderStream *pDecoderStream,
+  LLRP_tSFrameDecoder *         pDecoder,
+  LLRP_tSFrameStream *          pStream)
+{
+    streamConstruct_outermost(&pDecoderStream->frameDecoderStreamHdr,
+                                pDecoder);
+    pDecoderStream->frameDecoderStreamHdr.decoderStreamHdr.pDecoderStreamOps =
+                                &s_FrameStreamDecoderStreamOps;
+    pDecoderStream->pStream = pStream;
+}
+
+static void
+streamConstruct_nested_stream (
+  LLRP_tSFrameStreamDecoderStream *pDecoderStream,
+  LLRP_tSFrameStreamDecoderStream *pEnclosingDecoderStream)
+{
+    streamConstruct_nested(&pDecoderStream->frameDecoderStreamHdr,
+                    &pEnclosingDecoderStream->frameDecoderStreamHdr);
+    pDecoderStream->frameDecoderStreamHdr.decoderStreamHdr.pDecoderStreamOps =
+                                &s_FrameStreamDecoderStreamOps;
+    pDecoderStream->pStream = pEnclosingDecoderStream->pStream;
+}
+
+/*
+ * Like decodeMessage() but with callbacks
+ */
+static void
+streamMessage (
+  LLRP_tSFrameStreamDecoderStream *pDecoderStream)
+{
+    LLRP_tSFrameDecoderStream * pFrameDecoderStream =
+                                &pDecoderStream->frameDecoderStreamHdr;
+    LLRP_tSDecoderStream *      pBaseDecoderStream =
+                                &pFrameDecoderStream->decoderStreamHdr;
+    LLRP_tSFrameDecoder *       pDecoder  = pFrameDecoderStream->pDecoder;
+    LLRP_tSErrorDetails *       pError    = &pDecoder->decoderHdr.ErrorDetails;
+    const LLRP_tSFrameStreamCallbacks *pCallbacks =
+                                pDecoderStream->pStream->pCallbacks;
+    void *                      pContext  = pDecoderStream->pStream->pContext;
+    const LLRP_tSTypeDescriptor *pTypeDescriptor;
+    LLRP_tSFrameStreamField     Field;
+    llrp_u64_t                  DeviceSN;
+    llrp_u8_t                   Version;
+    llrp_u32_t                  MessageID;
+
+    pTypeDescriptor = decodeMessageHeader(pFrameDecoderStream,
+                            &DeviceSN, &Version, &MessageID);
+    if(NULL == pTypeDescriptor)
+    {
+        return;
+    }
+
+    if(NULL != pCallbacks->pfBegin &&
+       0 != pCallbacks->pfBegin(pContext, pTypeDescriptor))
+    {
+        pDecoder->iNext = pFrameDecoderStream->iLimit;
+        return;
+    }
+
+    Field.Scalar.u64 = DeviceSN;
+    streamScalar(pBaseDecoderStream,
+                &LLRP_g_fdMessageHeader_DeviceSN, &Field);
+    Field.Scalar.u8 = Version;
+    streamScalar(pBaseDecoderStream,
+                &LLRP_g_fdMessageHeader_Version, &Field);
+    Field.Scalar.u32 = MessageID;
+    streamScalar(pBaseDecoderStream,
+                &LLRP_g_fdMessageHeader_MessageID, &Field);
+
+    pTypeDescriptor->pfDecodeFields(NULL, pBaseDecoderStream);
+
+    streamSubParameters(pDecoderStream);
+
+    if(LLRP_RC_OK == pError->eResultCode)
+    {
+        if(pDecoder->iNext != pFrameDecoderStream->iLimit)
+        {
+            pError->eResultCode = LLRP_RC_ExtraBytes;
+            pError->pWhatStr    = "extra bytes at end of message";
+            pError->pRefType    = pTypeDescriptor;
+            pError->pRefField   = NULL;
+            pError->OtherDetail = pDecoder->iNext;
+        }
+    }
+
+    if(LLRP_RC_OK == pError->eResultCode && NULL != pCallbacks->pfEnd)
+    {
+        pCallbacks->pfEnd(pContext, pTypeDescriptor);
+    }
+}
+
+/*
+ * Like decodeParameter() but with callbacks
+ */
+static void
+streamParameter (
+  LLRP_tSFrameStreamDecoderStream *pDecoderStream)
+{
+    LLRP_tSFrameDecoderStream * pFrameDecoderStream =
+                                &pDecoderStream->frameDecoderStreamHdr;
+    LLRP_tSDecoderStream *      pBaseDecoderStream =
+                                &pFrameDecoderStream->decoderStreamHdr;
+    LLRP_tSFrameDecoder *       pDecoder  = pFrameDecoderStream->pDecoder;
+    LLRP_tSErrorDetails *       pError    = &pDecoder->decoderHdr.ErrorDetails;
+    LLRP_tSFrameStream *        pStream   = pDecoderStream->pStream;
+    const LLRP_tSFrameStreamCallbacks *pCallbacks = pStream->pCallbacks;
+    const LLRP_tSTypeDescriptor *pTypeDescriptor;
+    llrp_bool_t                 bIsTV;
+
+    pTypeDescriptor = decodeParameterHeader(pFrameDecoderStream, &bIsTV);
+    if(NULL == pTypeDescriptor)
+    {
+        return;
+    }
+
+    if(NULL != pCallbacks->pfBegin &&
+       0 != pCallbacks->pfBegin(pStream->pContext, pTypeDescriptor))
+    {
+        /*
+         * A TLV says where it ends. A TV ends
+         * where its fields do, so those still
+         * have to be decoded.
+         */
+        if(bIsTV)
+        {
+            pStream->bQuiet = TRUE;
+            pTypeDescriptor->pfDecodeFields(NULL, pBaseDecoderStream);
+            pStream->bQuiet = FALSE;
+        }
+        else
+        {
+            pDecoder->iNext = pFrameDecoderStream->iLimit;
+        }
+        return;
+    }
+
+    pTypeDescriptor->pfDecodeFields(NULL, pBaseDecoderStream);
+
+    if(!bIsTV)
+    {
+        streamSubParameters(pDecoderStream);
+
+        if(LLRP_RC_OK == pError->eResultCode)
+        {
+            if(pDecoder->iNext != pFrameDecoderStream->iLimit)
+            {
+                pError->eResultCode = LLRP_RC_ExtraBytes;
+                pError->pWhatStr    = "extra bytes at end of TLV parameter";
+                pError->pRefType    = pTypeDescriptor;
+                pError->pRefField   = NULL;
+                pError->OtherDetail = pDecoder->iNext;
+            }
+        }
+    }
+
+    if(LLRP_RC_OK == pError->eResultCode && NULL != pCallbacks->pfEnd)
+    {
+        pCallbacks->pfEnd(pStream->pContext, pTypeDescriptor);
+    }
+}
+
+static void
+streamSubParameters (
+  LLRP_tSFrameStreamDecoderStream *pDecoderStream)
+{
+    LLRP_tSFrameDecoderStream * pFrameDecoderStream =
+                                &pDecoderStream->frameDecoderStreamHdr;
+    LLRP_tSErrorDetails *       pError =
+                    &pFrameDecoderStream->pDecoder->decoderHdr.ErrorDetails;
+
+    while(0 < getRemainingByteCount(pFrameDecoderStream) &&
+          LLRP_RC_OK == pError->eResultCode)
+    {
+        LLRP_tSFrameStreamDecoderStream NestStream;
+
+        streamConstruct_nested_stream(&NestStream, pDecoderStream);
+
+        streamParameter(&NestStream);
+    }
+}
+
+/*
+ * Hand a decoded field to pfField, unless decoding failed
+ * or the parameter is being skipped
+ */
+static void
+streamField (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor,
+  LLRP_tSFrameStreamField *     pField)
+{
+    LLRP_tSFrameStreamDecoderStream *pDecoderStream;
+    LLRP_tSFrameStream *        pStream;
+    LLRP_tSFrameDecoder *       pDecoder;
+
+    pDecoderStream = (LLRP_tSFrameStreamDecoderStream *) pBaseDecoderStream;
+    pStream = pDecoderStream->pStream;
+    pDecoder = pDecoderStream->frameDecoderStreamHdr.pDecoder;
+
+    if(LLRP_RC_OK != pDecoder->decoderHdr.ErrorDetails.eResultCode ||
+       pStream->bQuiet ||
+       NULL == pStream->pCallbacks->pfField)
+    {
+        return;
+    }
+
+    pStream->pCallbacks->pfField(pStream->pContext,
+                pDecoderStream->frameDecoderStreamHdr.pRefType,
+                pFieldDescriptor, pField);
+}
+
+static void
+streamScalar (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor,
+  LLRP_tSFrameStreamField *     pField)
+{
+    pField->pBytes = NULL;
+    pField->nValue = 1u;
+
+    streamField(pBaseDecoderStream, pFieldDescriptor, pField);
+}
+
+/*
+ * A vector and the like: point pfField at its nByte
+ * bytes in the frame and step over them
+ */
+static void
+streamBytes (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor,
+  unsigned int                  nValue,
+  unsigned int                  nByte)
+{
+    LLRP_tSFrameDecoderStream * pDecoderStream;
+    LLRP_tSFrameDecoder *       pDecoder;
+    LLRP_tSFrameStreamField     Field;
+
+    pDecoderStream = (LLRP_tSFrameDecoderStream *) pBaseDecoderStream;
+    pDecoder = pDecoderStream->pDecoder;
+
+    if(LLRP_RC_OK != pDecoder->decoderHdr.ErrorDetails.eResultCode)
+    {
+        return;
+    }
+
+    if(0 < nByte && !checkAvailable(pDecoderStream, nByte, pFieldDescriptor))
+    {
+        return;
+    }
+
+    memset(&Field.Scalar, 0, sizeof Field.Scalar);
+    Field.pBytes = &pDecoder->pBuffer[pDecoder->iNext];
+    Field.nValue = nValue;
+
+    pDecoder->iNext += nByte;
+
+    streamField(pBaseDecoderStream, pFieldDescriptor, &Field);
+}
+
+static llrp_u8_t
+stream_get_u8 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.u8 = get_u8(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.u8;
+}
+
+static llrp_s8_t
+stream_get_s8 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.s8 = get_s8(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.s8;
+}
+
+static llrp_u16_t
+stream_get_u16 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.u16 = get_u16(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.u16;
+}
+
+static llrp_s16_t
+stream_get_s16 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.s16 = get_s16(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.s16;
+}
+
+static llrp_u32_t
+stream_get_u32 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.u32 = get_u32(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.u32;
+}
+
+static llrp_s32_t
+stream_get_s32 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.s32 = get_s32(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.s32;
+}
+
+static llrp_u64_t
+stream_get_u64 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.u64 = get_u64(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.u64;
+}
+
+static llrp_s64_t
+stream_get_s64 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.s64 = get_s64(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.s64;
+}
+
+static llrp_u1_t
+stream_get_u1 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.u1 = get_u1(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.u1;
+}
+
+static llrp_u2_t
+stream_get_u2 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.u2 = get_u2(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.u2;
+}
+
+static int
+stream_get_e1 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.e = get_e1(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.e;
+}
+
+static int
+stream_get_e2 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.e = get_e2(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.e;
+}
+
+static int
+stream_get_e8 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.e = get_e8(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.e;
+}
+
+static int
+stream_get_e16 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.e = get_e16(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.e;
+}
+
+static int
+stream_get_e32 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    LLRP_tSFrameStreamField     Field;
+
+    Field.Scalar.e = get_e32(pBaseDecoderStream, pFieldDescriptor);
+    streamScalar(pBaseDecoderStream, pFieldDescriptor, &Field);
+
+    return Field.Scalar.e;
+}
+
+static llrp_u8v_t
+stream_get_u8v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    llrp_u8v_t                  Value;
+    llrp_u16_t                  nValue;
+
+    memset(&Value, 0, sizeof Value);
+
+    nValue = getVarlenCount(
+                (LLRP_tSFrameDecoderStream *) pBaseDecoderStream,
+                pFieldDescriptor);
+    streamBytes(pBaseDecoderStream, pFieldDescriptor,
+                nValue, 1u * nValue);
+
+    return Value;
+}
+
+static llrp_s8v_t
+stream_get_s8v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    llrp_s8v_t                  Value;
+    llrp_u16_t                  nValue;
+
+    memset(&Value, 0, sizeof Value);
+
+    nValue = getVarlenCount(
+                (LLRP_tSFrameDecoderStream *) pBaseDecoderStream,
+                pFieldDescriptor);
+    streamBytes(pBaseDecoderStream, pFieldDescriptor,
+                nValue, 1u * nValue);
+
+    return Value;
+}
+
+static llrp_u16v_t
+stream_get_u16v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    llrp_u16v_t                 Value;
+    llrp_u16_t                  nValue;
+
+    memset(&Value, 0, sizeof Value);
+
+    nValue = getVarlenCount(
+                (LLRP_tSFrameDecoderStream *) pBaseDecoderStream,
+                pFieldDescriptor);
+    streamBytes(pBaseDecoderStream, pFieldDescriptor,
+                nValue, 2u * nValue);
+
+    return Value;
+}
+
+static llrp_s16v_t
+stream_get_s16v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    llrp_s16v_t                 Value;
+    llrp_u16_t                  nValue;
+
+    memset(&Value, 0, sizeof Value);
+
+    nValue = getVarlenCount(
+                (LLRP_tSFrameDecoderStream *) pBaseDecoderStream,
+                pFieldDescriptor);
+    streamBytes(pBaseDecoderStream, pFieldDescriptor,
+                nValue, 2u * nValue);
+
+    return Value;
+}
+
+static llrp_u32v_t
+stream_get_u32v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    llrp_u32v_t                 Value;
+    llrp_u16_t                  nValue;
+
+    memset(&Value, 0, sizeof Value);
+
+    nValue = getVarlenCount(
+                (LLRP_tSFrameDecoderStream *) pBaseDecoderStream,
+                pFieldDescriptor);
+    streamBytes(pBaseDecoderStream, pFieldDescriptor,
+                nValue, 4u * nValue);
+
+    return Value;
+}
+
+static llrp_s32v_t
+stream_get_s32v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    llrp_s32v_t                 Value;
+    llrp_u16_t                  nValue;
+
+    memset(&Value, 0, sizeof Value);
+
+    nValue = getVarlenCount(
+                (LLRP_tSFrameDecoderStream *) pBaseDecoderStream,
+                pFieldDescriptor);
+    streamBytes(pBaseDecoderStream, pFieldDescriptor,
+                nValue, 4u * nValue);
+
+    return Value;
+}
+
+static llrp_u64v_t
+stream_get_u64v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    llrp_u64v_t                 Value;
+    llrp_u16_t                  nValue;
+
+    memset(&Value, 0, sizeof Value);
+
+    nValue = getVarlenCount(
+                (LLRP_tSFrameDecoderStream *) pBaseDecoderStream,
+                pFieldDescriptor);
+    streamBytes(pBaseDecoderStream, pFieldDescriptor,
+                nValue, 8u * nValue);
+
+    return Value;
+}
+
+static llrp_s64v_t
+stream_get_s64v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    llrp_s64v_t                 Value;
+    llrp_u16_t                  nValue;
+
+    memset(&Value, 0, sizeof Value);
+
+    nValue = getVarlenCount(
+                (LLRP_tSFrameDecoderStream *) pBaseDecoderStream,
+                pFieldDescriptor);
+    streamBytes(pBaseDecoderStream, pFieldDescriptor,
+                nValue, 8u * nValue);
+
+    return Value;
+}
+
+static llrp_utf8v_t
+stream_get_utf8v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    llrp_utf8v_t                Value;
+    llrp_u16_t                  nValue;
+
+    memset(&Value, 0, sizeof Value);
+
+    nValue = getVarlenCount(
+                (LLRP_tSFrameDecoderStream *) pBaseDecoderStream,
+                pFieldDescriptor);
+    streamBytes(pBaseDecoderStream, pFieldDescriptor,
+                nValue, 1u * nValue);
+
+    return Value;
+}
+
+static llrp_u8v_t
+stream_get_e8v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    llrp_u8v_t                  Value;
+    llrp_u16_t                  nValue;
+
+    memset(&Value, 0, sizeof Value);
+
+    nValue = getVarlenCount(
+                (LLRP_tSFrameDecoderStream *) pBaseDecoderStream,
+                pFieldDescriptor);
+    streamBytes(pBaseDecoderStream, pFieldDescriptor,
+                nValue, 1u * nValue);
+
+    return Value;
+}
+
+static llrp_u1v_t
+stream_get_u1v (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    llrp_u1v_t                  Value;
+    llrp_u16_t                  nBit;
+
+    memset(&Value, 0, sizeof Value);
+
+    nBit = getVarlenCount(
+                (LLRP_tSFrameDecoderStream *) pBaseDecoderStream,
+                pFieldDescriptor);
+    streamBytes(pBaseDecoderStream, pFieldDescriptor,
+                nBit, (nBit + 7u) / 8u);
+
+    return Value;
+}
+
+static llrp_u96_t
+stream_get_u96 (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    llrp_u96_t                  Value;
+
+    memset(&Value, 0, sizeof Value);
+
+    streamBytes(pBaseDecoderStream, pFieldDescriptor, 12u, 12u);
+
+    return Value;
+}
+
+static llrp_bytesToEnd_t
+stream_get_bytesToEnd (
+  LLRP_tSDecoderStream *        pBaseDecoderStream,
+  const LLRP_tSFieldDescriptor *pFieldDescriptor)
+{
+    llrp_bytesToEnd_t           Value;
+    unsigned int                nByte;
+
+    memset(&Value, 0, sizeof Value);
+
+    nByte = getRemainingByteCount(
+                (LLRP_tSFrameDecoderStream *) pBaseDecoderStream);
+    streamBytes(pBaseDecoderStream, pFieldDescriptor, nByte, nByte);
+
+    return Value;
+}
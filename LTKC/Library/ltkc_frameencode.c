@@ -35,10 +35,26 @@ LLRP_FrameEncoder_construct (
   unsigned char *               pBuffer,
   unsigned int                  nBuffer);
 
+void
+LLRP_FrameEncoder_init (
+  LLRP_tSFrameEncoder *         pEncoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+void
+LLRP_FrameEncoder_reset (
+  LLRP_tSFrameEncoder *         pEncoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
 static void
 encoderDestruct (
   LLRP_tSEncoder *              pBaseEncoder);
 
+static void
+encoderFinish (
+  LLRP_tSEncoder *              pBaseEncoder);
+
 static void
 encodeElement (
   LLRP_tSEncoder *              pBaseEncoder,
@@ -64,6 +80,24 @@ next_u64 (
   LLRP_tSFrameEncoder *         pEncoder,
   llrp_u64_t                    Value);
 
+static void
+next_u16v (
+  LLRP_tSFrameEncoder *         pEncoder,
+  const llrp_u16_t *            pValue,
+  unsigned int                  nValue);
+
+static void
+next_u32v (
+  LLRP_tSFrameEncoder *         pEncoder,
+  const llrp_u32_t *            pValue,
+  unsigned int                  nValue);
+
+static void
+next_u64v (
+  LLRP_tSFrameEncoder *         pEncoder,
+  const llrp_u64_t *            pValue,
+  unsigned int                  nValue);
+
 static void
 putRequiredSubParameter (
   LLRP_tSEncoderStream *        pBaseEncoderStream,
@@ -306,6 +340,17 @@ s_FrameEncoderOps =
     .pfEncodeElement            = encodeElement,
 };
 
+/*
+ * For an encoder in storage the caller owns,
+ * see LLRP_FrameEncoder_init()
+ */
+static LLRP_tSEncoderOps
+s_FrameEncoderInPlaceOps =
+{
+    .pfDestruct                 = encoderFinish,
+    .pfEncodeElement            = encodeElement,
+};
+
 static LLRP_tSEncoderStreamOps
 s_FrameEncoderStreamOps =
 {
@@ -366,18 +411,49 @@ LLRP_FrameEncoder_construct (
         return pEncoder;
     }
 
-    memset(pEncoder, 0, sizeof *pEncoder);
+    LLRP_FrameEncoder_init(pEncoder, pBuffer, nBuffer);
 
     pEncoder->encoderHdr.pEncoderOps = &s_FrameEncoderOps;
 
+    return pEncoder;
+}
+
+/*
+ * Initialize an encoder the caller has storage for, embedded
+ * in something else or on the stack. LLRP_Encoder_destruct()
+ * on it is allowed but frees nothing.
+ */
+void
+LLRP_FrameEncoder_init (
+  LLRP_tSFrameEncoder *         pEncoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    memset(pEncoder, 0, sizeof *pEncoder);
+
+    pEncoder->encoderHdr.pEncoderOps = &s_FrameEncoderInPlaceOps;
+
+    LLRP_FrameEncoder_reset(pEncoder, pBuffer, nBuffer);
+}
+
+/*
+ * Point an encoder at a buffer for the next frame,
+ * clearing the error details and position.
+ */
+void
+LLRP_FrameEncoder_reset (
+  LLRP_tSFrameEncoder *         pEncoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    LLRP_Error_clear(&pEncoder->encoderHdr.ErrorDetails);
+
     pEncoder->pBuffer        = pBuffer;
     pEncoder->nBuffer        = nBuffer;
 
     pEncoder->iNext          = 0;
     pEncoder->BitFieldBuffer = 0;
     pEncoder->nBitFieldResid = 0;
-
-    return pEncoder;
 }
 
 static void
@@ -389,6 +465,13 @@ encoderDestruct (
     free(pEncoder);
 }
 
+static void
+encoderFinish (
+  LLRP_tSEncoder *              pBaseEncoder)
+{
+    /* Nothing to free, the storage is the caller's */
+}
+
 static void
 encodeElement (
   LLRP_tSEncoder *              pBaseEncoder,
@@ -459,6 +542,45 @@ next_u64 (
     pEncoder->pBuffer[pEncoder->iNext++] = Value >> 0u;
 }
 
+static void
+next_u16v (
+  LLRP_tSFrameEncoder *         pEncoder,
+  const llrp_u16_t *            pValue,
+  unsigned int                  nValue)
+{
+    assert(pEncoder->iNext + 2u * nValue <= pEncoder->nBuffer);
+
+    LLRP_ByteSwap_getKernel()->pfStore16(
+                        &pEncoder->pBuffer[pEncoder->iNext], pValue, nValue);
+    pEncoder->iNext += 2u * nValue;
+}
+
+static void
+next_u32v (
+  LLRP_tSFrameEncoder *         pEncoder,
+  const llrp_u32_t *            pValue,
+  unsigned int                  nValue)
+{
+    assert(pEncoder->iNext + 4u * nValue <= pEncoder->nBuffer);
+
+    LLRP_ByteSwap_getKernel()->pfStore32(
+                        &pEncoder->pBuffer[pEncoder->iNext], pValue, nValue);
+    pEncoder->iNext += 4u * nValue;
+}
+
+static void
+next_u64v (
+  LLRP_tSFrameEncoder *         pEncoder,
+  const llrp_u64_t *            pValue,
+  unsigned int                  nValue)
+{
+    assert(pEncoder->iNext + 8u * nValue <= pEncoder->nBuffer);
+
+    LLRP_ByteSwap_getKernel()->pfStore64(
+                        &pEncoder->pBuffer[pEncoder->iNext], pValue, nValue);
+    pEncoder->iNext += 8u * nValue;
+}
+
 
 static void
 putRequiredSubParameter (
@@ -669,13 +791,8 @@ put_u16v (
 
     if(checkAvailable(pEncoderStream, nByte, pFieldDescriptor))
     {
-        unsigned int            i;
-
         next_u16(pEncoder, Value.nValue);
-        for(i = 0; i < Value.nValue; i++)
-        {
-            next_u16(pEncoder, Value.pValue[i]);
-        }
+        next_u16v(pEncoder, Value.pValue, Value.nValue);
     }
 }
 
@@ -694,13 +811,8 @@ put_s16v (
 
     if(checkAvailable(pEncoderStream, nByte, pFieldDescriptor))
     {
-        unsigned int            i;
-
         next_u16(pEncoder, Value.nValue);
-        for(i = 0; i < Value.nValue; i++)
-        {
-            next_u16(pEncoder, Value.pValue[i]);
-        }
+        next_u16v(pEncoder, (const llrp_u16_t *) Value.pValue, Value.nValue);
     }
 }
 
@@ -751,13 +863,8 @@ put_u32v (
 
     if(checkAvailable(pEncoderStream, nByte, pFieldDescriptor))
     {
-        unsigned int            i;
-
         next_u16(pEncoder, Value.nValue);
-        for(i = 0; i < Value.nValue; i++)
-        {
-            next_u32(pEncoder, Value.pValue[i]);
-        }
+        next_u32v(pEncoder, Value.pValue, Value.nValue);
     }
 }
 
@@ -776,13 +883,8 @@ put_s32v (
 
     if(checkAvailable(pEncoderStream, nByte, pFieldDescriptor))
     {
-        unsigned int            i;
-
         next_u16(pEncoder, Value.nValue);
-        for(i = 0; i < Value.nValue; i++)
-        {
-            next_u32(pEncoder, Value.pValue[i]);
-        }
+        next_u32v(pEncoder, (const llrp_u32_t *) Value.pValue, Value.nValue);
     }
 }
 
@@ -833,13 +935,8 @@ put_u64v (
 
     if(checkAvailable(pEncoderStream, nByte, pFieldDescriptor))
     {
-        unsigned int            i;
-
         next_u16(pEncoder, Value.nValue);
-        for(i = 0; i < Value.nValue; i++)
-        {
-            next_u64(pEncoder, Value.pValue[i]);
-        }
+        next_u64v(pEncoder, Value.pValue, Value.nValue);
     }
 }
 
@@ -858,13 +955,8 @@ put_s64v (
 
     if(checkAvailable(pEncoderStream, nByte, pFieldDescriptor))
     {
-        unsigned int            i;
-
         next_u16(pEncoder, Value.nValue);
-        for(i = 0; i < Value.nValue; i++)
-        {
-            next_u64(pEncoder, Value.pValue[i]);
-        }
+        next_u64v(pEncoder, (const llrp_u64_t *) Value.pValue, Value.nValue);
     }
 }
 
@@ -25,9 +25,17 @@
 
 
 /*
- * <0  => Error
- *  0  => Done, length is *pMessageLength
- * >0  => Need more, return value is number of required bytes
+ * Header of the frame, 19 bytes, all big-endian:
+ *
+ *      0..7    DeviceSN
+ *      8       Version
+ *      9..10   MessageType
+ *      11..14  MessageLength, of the body that follows
+ *      15..18  MessageID
+ *
+ * Once the whole header is present every field is extracted,
+ * even if the frame is not yet complete, so frames can be
+ * routed or dropped by type without being decoded.
  */
 
 LLRP_tSFrameExtract
@@ -47,6 +55,20 @@ LLRP_FrameExtract (
     }
     else
     {
+        unsigned int            i;
+
+        for(i = 0; i < 8u; i++)
+        {
+            frameExtract.DeviceSN <<= 8u;
+            frameExtract.DeviceSN |= pBuffer[i];
+        }
+
+        frameExtract.ProtocolVersion = pBuffer[8];
+
+        frameExtract.MessageType = pBuffer[9];
+        frameExtract.MessageType <<= 8u;
+        frameExtract.MessageType |= pBuffer[10];
+
         frameExtract.MessageLength = pBuffer[11];
         frameExtract.MessageLength <<= 8u;
         frameExtract.MessageLength |= pBuffer[12];
@@ -55,22 +77,20 @@ LLRP_FrameExtract (
         frameExtract.MessageLength <<= 8u;
         frameExtract.MessageLength |= pBuffer[14];
 
-        /*
-         * Should we be picky about reserved bits?
-         */
-/*
-        frameExtract.MessageType = VersType & 0x3FFu;
-        frameExtract.ProtocolVersion = (VersType >> 10u) & 0x7u;
-
-        frameExtract.MessageID = pBuffer[6];
+        frameExtract.MessageID = pBuffer[15];
         frameExtract.MessageID <<= 8u;
-        frameExtract.MessageID |= pBuffer[7];
+        frameExtract.MessageID |= pBuffer[16];
         frameExtract.MessageID <<= 8u;
-        frameExtract.MessageID |= pBuffer[8];
+        frameExtract.MessageID |= pBuffer[17];
         frameExtract.MessageID <<= 8u;
-        frameExtract.MessageID |= pBuffer[9];
-*/
-		if(nBuffer >= frameExtract.MessageLength + 19u)
+        frameExtract.MessageID |= pBuffer[18];
+
+        if(frameExtract.MessageLength > ~0u - 19u)
+        {
+            /* Frame size would not fit an unsigned int */
+            frameExtract.eStatus = LLRP_FRAME_ERROR;
+        }
+        else if(nBuffer >= frameExtract.MessageLength + 19u)
         {
             frameExtract.nBytesNeeded = 0;
             frameExtract.eStatus = LLRP_FRAME_READY;
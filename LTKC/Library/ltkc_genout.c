@@ -38,15 +38,10 @@ static char     ident[] = {
 LLRP_tSTypeRegistry *
 LLRP_getTheTypeRegistry (void)
 {
-    LLRP_tSTypeRegistry *       pTypeRegistry;
-
-    pTypeRegistry = LLRP_TypeRegistry_construct();
-    if(NULL == pTypeRegistry)
-    {
-        return pTypeRegistry;
-    }
-
-    LLRP_enrollCoreTypesIntoRegistry (pTypeRegistry);
-
-    return pTypeRegistry;
+    /*
+     * The same as LLRP_enrollCoreTypesIntoRegistry() does,
+     * without the work. Not a copy of LLRP_CoreTypeRegistry,
+     * whose type pages are const and not ours to free.
+     */
+    return LLRP_TypeRegistry_constructLayered(&LLRP_CoreTypeRegistry);
 }
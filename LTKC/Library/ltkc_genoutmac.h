@@ -45,3 +45,10 @@
         LLRP_Element_countSubParameterList(		\
             (LLRP_tSElement *)pThis,			\
             (LLRP_tSParameter**)&pThis->MEMBER)
+
+#define SUBPARAM_MATERIALIZE(MEMBER)			\
+        ((NULL != pThis->hdr.pLazy) ?			\
+            LLRP_Message_materializeSubParameters(	\
+                &pThis->hdr,				\
+                (LLRP_tSParameter*)pThis->MEMBER) :	\
+            (void) 0)
@@ -0,0 +1,1489 @@
+
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  ltkc_iouring.c
+ **
+ ** @brief Connection I/O backend on Linux io_uring
+ **
+ ** Receiving is one multishot recv into a ring of buffers provided
+ ** to the kernel. Once armed it keeps completing as data arrives,
+ ** so a busy connection makes no system call per read. Buffers go
+ ** back to the kernel as soon as their bytes are copied out.
+ **
+ ** Sending hands the kernel one batch at a time. What is written
+ ** while a batch is in flight is collected into the next, which goes
+ ** out when the first completes. Batches never overlap, so the bytes
+ ** stay in order. With nothing in flight or collected, a write first
+ ** tries a plain non-blocking send(). On a socket with room that is
+ ** one system call and no copy, as with LLRP_ConnIO_POSIX; a send
+ ** through the ring costs the copy into the batch, the entry and its
+ ** completion on top of the system call. Only what the socket does
+ ** not take goes through the ring.
+ **
+ ** The poll fd is the ring's own. It is readable while completions
+ ** wait to be looked at. Received bytes already taken off the
+ ** completion queue keep it readable with a NOP.
+ **
+ ** There is no liburing. The rings are set up with the system calls
+ ** and the kernel's header directly. Multishot recv and provided
+ ** buffer rings need Linux 6.0 or later. Attaching fails on older
+ ** kernels and the connection stays with LLRP_ConnIO_POSIX.
+ **
+ *****************************************************************************/
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+#include "ltkc_platform.h"
+#include "ltkc_base.h"
+#include "ltkc_frame.h"
+#include "ltkc_connection.h"
+
+
+/*
+ * Only a few operations are ever queued at once: the recv,
+ * a send, a NOP and a cancel. Multishot recv makes many
+ * completions, so the completion queue is larger.
+ */
+#define IOURING_SQ_ENTRIES      (8u)
+#define IOURING_CQ_ENTRIES      (256u)
+
+/*
+ * The provided receive buffers. The count is a power of 2.
+ */
+#define IOURING_N_RECV_BUF      (16u)
+#define IOURING_RECV_BUF_SIZE   (16u*1024u)
+#define IOURING_RECV_BGID       (0u)
+
+/*
+ * Smallest send batch allocation
+ */
+#define IOURING_SEND_MIN_ALLOC  (64u*1024u)
+
+/*
+ * user_data of each kind of operation
+ */
+#define IOURING_TAG_RECV        (1u)
+#define IOURING_TAG_SEND        (2u)
+#define IOURING_TAG_NOP         (3u)
+#define IOURING_TAG_CANCEL      (4u)
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Structure of a received buffer not yet copied out
+ **
+ *****************************************************************************/
+
+struct LLRP_SIOURingChunk
+{
+    /** Buffer ID as the kernel reported it */
+    unsigned short              BufID;
+
+    /** Bytes received into it, and how many are copied out */
+    unsigned int                nLen;
+    unsigned int                iOff;
+};
+typedef struct LLRP_SIOURingChunk   LLRP_tSIOURingChunk;
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Structure of a send batch
+ **
+ *****************************************************************************/
+
+struct LLRP_SIOURingBatch
+{
+    unsigned char *             pBuffer;
+    unsigned int                nAlloc;
+    unsigned int                nBuffer;
+};
+typedef struct LLRP_SIOURingBatch   LLRP_tSIOURingBatch;
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Structure of the io_uring state of a connection
+ **
+ ** Hung off pConn->pIOContext
+ **
+ *****************************************************************************/
+
+struct LLRP_SIOURing
+{
+    /** The socket and the ring */
+    int                         fd;
+    int                         RingFd;
+
+    /** Mappings of the rings. pCQMap may be pSQMap. */
+    void *                      pSQMap;
+    size_t                      nSQMap;
+    void *                      pCQMap;
+    size_t                      nCQMap;
+    struct io_uring_sqe *       aSQE;
+    size_t                      nSQEMap;
+
+    /** Submission queue. Tail is ours, head the kernel's. */
+    unsigned int *              pSQHead;
+    unsigned int *              pSQTail;
+    unsigned int *              pSQArray;
+    unsigned int                SQMask;
+    unsigned int                nSQEntries;
+
+    /** Queued but not yet submitted */
+    unsigned int                nToSubmit;
+
+    /** Completion queue. Head is ours, tail the kernel's. */
+    unsigned int *              pCQHead;
+    unsigned int *              pCQTail;
+    struct io_uring_cqe *       aCQE;
+    unsigned int                CQMask;
+
+    /** The provided buffer ring, and the buffers */
+    struct io_uring_buf_ring *  pBufRing;
+    size_t                      nBufRingMap;
+    unsigned char *             pBufMem;
+    unsigned short              BufTail;
+
+    /** FIFO of received buffers not yet copied out */
+    LLRP_tSIOURingChunk         aChunk[IOURING_N_RECV_BUF];
+    unsigned int                iChunk;
+    unsigned int                nChunk;
+
+    /** Receive state. RecvErrno is sticky. */
+    llrp_bool_t                 bRecvArmed;
+    llrp_bool_t                 bRecvEOF;
+    int                         RecvErrno;
+
+    /** A NOP is queued to keep the ring fd readable */
+    llrp_bool_t                 bNopPending;
+
+    /** Send batches. aBatch[iFill] collects; iFlight is the
+     ** other one while the kernel sends it, -1 otherwise.
+     ** SendErrno is sticky. */
+    LLRP_tSIOURingBatch         aBatch[2];
+    int                         iFill;
+    int                         iFlight;
+    unsigned int                iFlightOff;
+    int                         SendErrno;
+
+    /** Most bytes to collect before a write waits */
+    unsigned int                nMaxBatch;
+};
+typedef struct LLRP_SIOURing        LLRP_tSIOURing;
+
+
+/* forward declaration of private routines. */
+static int
+uringAttach (
+  LLRP_tSConnection *           pConn);
+
+static void
+uringDetach (
+  LLRP_tSConnection *           pConn);
+
+static int
+uringWait (
+  LLRP_tSConnection *           pConn,
+  int                           nMS);
+
+static int
+uringRead (
+  LLRP_tSConnection *           pConn,
+  unsigned char *               pBuf,
+  unsigned int                  nBuf,
+  llrp_bool_t                   bBlock);
+
+static int
+uringWrite (
+  LLRP_tSConnection *           pConn,
+  const unsigned char *         pBuf,
+  unsigned int                  nBuf);
+
+static int
+uringFlush (
+  LLRP_tSConnection *           pConn);
+
+static int
+uringGetPollFd (
+  LLRP_tSConnection *           pConn);
+
+static int
+mapRings (
+  LLRP_tSIOURing *              pRing,
+  struct io_uring_params *      pParams);
+
+static int
+setupRecvBuffers (
+  LLRP_tSIOURing *              pRing);
+
+static void
+freeRing (
+  LLRP_tSIOURing *              pRing);
+
+static struct io_uring_sqe *
+getSQE (
+  LLRP_tSIOURing *              pRing);
+
+static void
+commitSQE (
+  LLRP_tSIOURing *              pRing);
+
+static int
+submitSQEs (
+  LLRP_tSIOURing *              pRing);
+
+static int
+waitCQE (
+  LLRP_tSIOURing *              pRing,
+  int                           nMS);
+
+static llrp_bool_t
+reapCQE (
+  LLRP_tSIOURing *              pRing);
+
+static void
+armRecv (
+  LLRP_tSIOURing *              pRing);
+
+static void
+recycleRecvBuffer (
+  LLRP_tSIOURing *              pRing,
+  unsigned short                BufID);
+
+static void
+startSend (
+  LLRP_tSIOURing *              pRing);
+
+static void
+queueSend (
+  LLRP_tSIOURing *              pRing);
+
+static void
+keepReadable (
+  LLRP_tSIOURing *              pRing);
+
+static llrp_bool_t
+recvReady (
+  LLRP_tSIOURing *              pRing);
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  The io_uring backend
+ **
+ ** See LLRP_Conn_setIO()
+ **
+ *****************************************************************************/
+
+const LLRP_tSConnIO LLRP_ConnIO_IOURING =
+{
+    "io_uring",
+    uringAttach,
+    uringDetach,
+    uringWait,
+    uringRead,
+    uringWrite,
+    uringFlush,
+    uringGetPollFd,
+};
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Set up a ring on the connection's socket
+ **
+ ** Maps the rings, provides the receive buffers and arms the
+ ** multishot recv.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return     ==0             Attached, pConn->pIOContext set
+ **             <0              Failed, errno tells why
+ **
+ *****************************************************************************/
+
+static int
+uringAttach (
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSIOURing *            pRing;
+    struct io_uring_params      Params;
+    int                         SavedErrno;
+
+    /*
+     * Allocate, check, and zero-fill the ring state.
+     */
+    pRing = malloc(sizeof *pRing);
+    if(NULL == pRing)
+    {
+        errno = ENOMEM;
+        return -1;
+    }
+    memset(pRing, 0, sizeof *pRing);
+
+    pRing->fd = pConn->fd;
+    pRing->RingFd = -1;
+    pRing->iFlight = -1;
+    pRing->nMaxBatch = pConn->nMaxBufferSize;
+
+    memset(&Params, 0, sizeof Params);
+    Params.flags = IORING_SETUP_CQSIZE;
+    Params.cq_entries = IOURING_CQ_ENTRIES;
+
+    pRing->RingFd = syscall(__NR_io_uring_setup, IOURING_SQ_ENTRIES, &Params);
+    if(0 > pRing->RingFd)
+    {
+        goto fail;
+    }
+
+    /*
+     * Timed waits need EXT_ARG. Without it the kernel
+     * is too old for the rest anyway.
+     */
+    if(0 == (Params.features & IORING_FEAT_EXT_ARG))
+    {
+        errno = EOPNOTSUPP;
+        goto fail;
+    }
+
+    if(0 != mapRings(pRing, &Params) ||
+       0 != setupRecvBuffers(pRing))
+    {
+        goto fail;
+    }
+
+    armRecv(pRing);
+    if(0 != submitSQEs(pRing))
+    {
+        goto fail;
+    }
+
+    pConn->pIOContext = pRing;
+
+    return 0;
+
+  fail:
+    SavedErrno = errno;
+    freeRing(pRing);
+    errno = SavedErrno;
+    return -1;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Tear down the ring
+ **
+ ** The recv, and any send still in flight, are cancelled and their
+ ** last completions awaited. Only then are the buffers the kernel
+ ** writes into freed. Received bytes not yet read are discarded.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+static void
+uringDetach (
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSIOURing *            pRing = pConn->pIOContext;
+    struct io_uring_sqe *       pSQE;
+
+    if(NULL == pRing)
+    {
+        return;
+    }
+
+    if(pRing->bRecvArmed && NULL != (pSQE = getSQE(pRing)))
+    {
+        pSQE->opcode = IORING_OP_ASYNC_CANCEL;
+        pSQE->addr = IOURING_TAG_RECV;
+        pSQE->user_data = IOURING_TAG_CANCEL;
+        commitSQE(pRing);
+    }
+    if(0 <= pRing->iFlight && NULL != (pSQE = getSQE(pRing)))
+    {
+        pSQE->opcode = IORING_OP_ASYNC_CANCEL;
+        pSQE->addr = IOURING_TAG_SEND;
+        pSQE->user_data = IOURING_TAG_CANCEL;
+        commitSQE(pRing);
+    }
+
+    /*
+     * Stop anything new from being started while draining.
+     */
+    pRing->bRecvEOF = TRUE;
+    pRing->SendErrno = ECANCELED;
+
+    if(0 == submitSQEs(pRing))
+    {
+        while(pRing->bRecvArmed || pRing->bNopPending ||
+              0 <= pRing->iFlight)
+        {
+            if(reapCQE(pRing))
+            {
+                continue;
+            }
+            if(0 > waitCQE(pRing, -1) && EINTR != errno)
+            {
+                /* Can't wait. Closing the ring cancels the rest. */
+                break;
+            }
+        }
+    }
+
+    freeRing(pRing);
+    pConn->pIOContext = NULL;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Wait for received bytes, end-of-file or an error
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  nMS             Most milliseconds to wait, -1 for ever.
+ **
+ ** @return     >0              uringRead() has something to return
+ **             ==0             Timeout
+ **             <0              Error, errno tells why
+ **
+ *****************************************************************************/
+
+static int
+uringWait (
+  LLRP_tSConnection *           pConn,
+  int                           nMS)
+{
+    LLRP_tSIOURing *            pRing = pConn->pIOContext;
+    struct timespec             Now;
+    long long                   DeadlineMS = 0;
+    long long                   LeftMS;
+    int                         rc;
+
+    if(0 <= nMS)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &Now);
+        DeadlineMS = Now.tv_sec * 1000LL + Now.tv_nsec / 1000000 + nMS;
+    }
+
+    for(;;)
+    {
+        /*
+         * Look at what completed. Send completions may start
+         * the next batch on the way.
+         */
+        while(!recvReady(pRing) && reapCQE(pRing))
+        {
+            /* keep looking */
+        }
+        armRecv(pRing);
+        if(0 != submitSQEs(pRing))
+        {
+            return -1;
+        }
+
+        if(recvReady(pRing))
+        {
+            return 1;
+        }
+
+        /*
+         * Wait for the next completion. A send completing wakes
+         * us too, so wait again for what is left of the time.
+         */
+        LeftMS = -1;
+        if(0 <= nMS)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &Now);
+            LeftMS = DeadlineMS -
+                (Now.tv_sec * 1000LL + Now.tv_nsec / 1000000);
+            if(0 > LeftMS)
+            {
+                LeftMS = 0;
+            }
+        }
+
+        rc = waitCQE(pRing, (int)LeftMS);
+        if(0 >= rc)
+        {
+            return rc;
+        }
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Copy received bytes out
+ **
+ ** As many as fit, across several received buffers if there are.
+ ** Each buffer goes back to the kernel when it has been copied out.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[out] pBuf            Where to copy to
+ ** @param[in]  nBuf            Room in pBuf
+ ** @param[in]  bBlock          TRUE to wait if there is nothing yet
+ **
+ ** @return     >0              Number of bytes copied
+ **             ==0             End-of-file
+ **             <0              Error, errno tells why. EAGAIN when
+ **                             nothing is there and !bBlock.
+ **
+ *****************************************************************************/
+
+static int
+uringRead (
+  LLRP_tSConnection *           pConn,
+  unsigned char *               pBuf,
+  unsigned int                  nBuf,
+  llrp_bool_t                   bBlock)
+{
+    LLRP_tSIOURing *            pRing = pConn->pIOContext;
+    LLRP_tSIOURingChunk *       pChunk;
+    unsigned int                nDone = 0;
+    unsigned int                n;
+
+    for(;;)
+    {
+        /*
+         * Copy out. Take completions off the queue only as
+         * needed, so those left keep the ring fd readable.
+         */
+        while(nDone < nBuf)
+        {
+            if(0 == pRing->nChunk)
+            {
+                if(!reapCQE(pRing))
+                {
+                    break;
+                }
+                continue;
+            }
+
+            pChunk = &pRing->aChunk[pRing->iChunk];
+            n = pChunk->nLen - pChunk->iOff;
+            if(n > nBuf - nDone)
+            {
+                n = nBuf - nDone;
+            }
+            memcpy(&pBuf[nDone],
+                &pRing->pBufMem[pChunk->BufID * IOURING_RECV_BUF_SIZE +
+                                pChunk->iOff], n);
+            nDone += n;
+            pChunk->iOff += n;
+
+            if(pChunk->iOff == pChunk->nLen)
+            {
+                recycleRecvBuffer(pRing, pChunk->BufID);
+                pRing->iChunk = (pRing->iChunk + 1u) &
+                                (IOURING_N_RECV_BUF - 1u);
+                pRing->nChunk--;
+            }
+        }
+
+        if(0 < nDone || !bBlock || recvReady(pRing))
+        {
+            break;
+        }
+
+        /*
+         * Nothing yet and the caller wants to wait.
+         */
+        armRecv(pRing);
+        if(0 != submitSQEs(pRing))
+        {
+            return -1;
+        }
+        if(0 > waitCQE(pRing, -1) && EINTR != errno)
+        {
+            return -1;
+        }
+    }
+
+    armRecv(pRing);
+    keepReadable(pRing);
+    submitSQEs(pRing);
+
+    if(0 < nDone)
+    {
+        return nDone;
+    }
+    if(0 != pRing->RecvErrno)
+    {
+        errno = pRing->RecvErrno;
+        return -1;
+    }
+    if(pRing->bRecvEOF)
+    {
+        return 0;
+    }
+
+    errno = EAGAIN;
+    return -1;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Take bytes for sending
+ **
+ ** With no batch in flight or collected they are sent straight
+ ** away, as far as the socket takes them without waiting. The rest
+ ** is added to the batch being collected. If no batch is in flight
+ ** it goes out at once. A write waits only when the batch has grown
+ ** past the connection's buffer limit.
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ ** @param[in]  pBuf            The bytes
+ ** @param[in]  nBuf            How many
+ **
+ ** @return     ==nBuf          Taken
+ **             <0              Error, errno tells why. Send errors,
+ **                             once seen, are returned from then on.
+ **
+ *****************************************************************************/
+
+static int
+uringWrite (
+  LLRP_tSConnection *           pConn,
+  const unsigned char *         pBuf,
+  unsigned int                  nBuf)
+{
+    LLRP_tSIOURing *            pRing = pConn->pIOContext;
+    LLRP_tSIOURingBatch *       pBatch;
+    unsigned int                nTaken = nBuf;
+
+    /*
+     * Learn of sends that completed. Wait for one in flight
+     * if the batch being collected has grown too big.
+     */
+    for(;;)
+    {
+        while(reapCQE(pRing))
+        {
+            /* keep looking */
+        }
+
+        pBatch = &pRing->aBatch[pRing->iFill];
+        if(0 > pRing->iFlight || 0 != pRing->SendErrno ||
+           pBatch->nBuffer + nBuf <= pRing->nMaxBatch)
+        {
+            break;
+        }
+        if(0 != submitSQEs(pRing) ||
+           (0 > waitCQE(pRing, -1) && EINTR != errno))
+        {
+            pRing->SendErrno = errno;
+        }
+    }
+
+    if(0 != pRing->SendErrno)
+    {
+        errno = pRing->SendErrno;
+        return -1;
+    }
+
+    /*
+     * Nothing ahead of these bytes, so they may go now.
+     */
+    if(0 > pRing->iFlight && 0 == pBatch->nBuffer)
+    {
+        int                     rc;
+
+        rc = send(pRing->fd, pBuf, nBuf, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if(0 > rc && EAGAIN != errno && EWOULDBLOCK != errno &&
+           EINTR != errno)
+        {
+            pRing->SendErrno = errno;
+            return -1;
+        }
+        if(0 < rc)
+        {
+            pBuf += rc;
+            nBuf -= rc;
+        }
+        if(0 == nBuf)
+        {
+            return nTaken;
+        }
+    }
+
+    if(pBatch->nBuffer + nBuf > pBatch->nAlloc)
+    {
+        unsigned int            nNew = pBatch->nAlloc * 2u;
+        unsigned char *         pNew;
+
+        if(nNew < IOURING_SEND_MIN_ALLOC)
+        {
+            nNew = IOURING_SEND_MIN_ALLOC;
+        }
+        if(nNew < pBatch->nBuffer + nBuf)
+        {
+            nNew = pBatch->nBuffer + nBuf;
+        }
+        pNew = realloc(pBatch->pBuffer, nNew);
+        if(NULL == pNew)
+        {
+            /*
+             * Part of this frame may have gone already,
+             * so no later write may follow it.
+             */
+            pRing->SendErrno = ENOMEM;
+            errno = ENOMEM;
+            return -1;
+        }
+        pBatch->pBuffer = pNew;
+        pBatch->nAlloc = nNew;
+    }
+
+    memcpy(&pBatch->pBuffer[pBatch->nBuffer], pBuf, nBuf);
+    pBatch->nBuffer += nBuf;
+
+    startSend(pRing);
+    armRecv(pRing);
+    keepReadable(pRing);
+    if(0 != submitSQEs(pRing))
+    {
+        pRing->SendErrno = errno;
+        return -1;
+    }
+
+    return nTaken;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Wait until every batch is sent
+ **
+ ** @param[in]  pConn           Pointer to the connection instance.
+ **
+ ** @return     ==0             All sent
+ **             <0              Send error, errno tells why
+ **
+ *****************************************************************************/
+
+static int
+uringFlush (
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSIOURing *            pRing = pConn->pIOContext;
+
+    for(;;)
+    {
+        while(reapCQE(pRing))
+        {
+            /* keep looking */
+        }
+        startSend(pRing);
+        armRecv(pRing);
+
+        if(0 != submitSQEs(pRing))
+        {
+            pRing->SendErrno = errno;
+        }
+        if(0 != pRing->SendErrno)
+        {
+            break;
+        }
+        if(0 > pRing->iFlight &&
+           0 == pRing->aBatch[pRing->iFill].nBuffer)
+        {
+            break;
+        }
+        if(0 > waitCQE(pRing, -1) && EINTR != errno)
+        {
+            pRing->SendErrno = errno;
+            break;
+        }
+    }
+
+    keepReadable(pRing);
+    submitSQEs(pRing);
+
+    if(0 != pRing->SendErrno)
+    {
+        errno = pRing->SendErrno;
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  The ring fd is what an event loop watches
+ **
+ *****************************************************************************/
+
+static int
+uringGetPollFd (
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSIOURing *            pRing = pConn->pIOContext;
+
+    return pRing->RingFd;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to map the submission and completion queues
+ **
+ ** @param[in]  pRing           The ring state, RingFd set
+ ** @param[in]  pParams         What io_uring_setup() returned
+ **
+ ** @return     ==0             Mapped
+ **             <0              Failed, errno tells why
+ **
+ *****************************************************************************/
+
+static int
+mapRings (
+  LLRP_tSIOURing *              pRing,
+  struct io_uring_params *      pParams)
+{
+    unsigned char *             pSQ;
+    unsigned char *             pCQ;
+
+    pRing->nSQMap = pParams->sq_off.array +
+                    pParams->sq_entries * sizeof(unsigned int);
+    pRing->nCQMap = pParams->cq_off.cqes +
+                    pParams->cq_entries * sizeof(struct io_uring_cqe);
+
+    if(0 != (pParams->features & IORING_FEAT_SINGLE_MMAP))
+    {
+        if(pRing->nCQMap > pRing->nSQMap)
+        {
+            pRing->nSQMap = pRing->nCQMap;
+        }
+        pRing->nCQMap = 0;
+    }
+
+    pRing->pSQMap = mmap(NULL, pRing->nSQMap, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, pRing->RingFd,
+                        IORING_OFF_SQ_RING);
+    if(MAP_FAILED == pRing->pSQMap)
+    {
+        pRing->pSQMap = NULL;
+        return -1;
+    }
+
+    if(0 == pRing->nCQMap)
+    {
+        pRing->pCQMap = pRing->pSQMap;
+    }
+    else
+    {
+        pRing->pCQMap = mmap(NULL, pRing->nCQMap, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE, pRing->RingFd,
+                            IORING_OFF_CQ_RING);
+        if(MAP_FAILED == pRing->pCQMap)
+        {
+            pRing->pCQMap = NULL;
+            return -1;
+        }
+    }
+
+    pRing->nSQEMap = pParams->sq_entries * sizeof(struct io_uring_sqe);
+    pRing->aSQE = mmap(NULL, pRing->nSQEMap, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, pRing->RingFd,
+                        IORING_OFF_SQES);
+    if(MAP_FAILED == pRing->aSQE)
+    {
+        pRing->aSQE = NULL;
+        return -1;
+    }
+
+    pSQ = pRing->pSQMap;
+    pRing->pSQHead = (unsigned int *)(pSQ + pParams->sq_off.head);
+    pRing->pSQTail = (unsigned int *)(pSQ + pParams->sq_off.tail);
+    pRing->pSQArray = (unsigned int *)(pSQ + pParams->sq_off.array);
+    pRing->SQMask = *(unsigned int *)(pSQ + pParams->sq_off.ring_mask);
+    pRing->nSQEntries = pParams->sq_entries;
+
+    pCQ = pRing->pCQMap;
+    pRing->pCQHead = (unsigned int *)(pCQ + pParams->cq_off.head);
+    pRing->pCQTail = (unsigned int *)(pCQ + pParams->cq_off.tail);
+    pRing->aCQE = (struct io_uring_cqe *)(pCQ + pParams->cq_off.cqes);
+    pRing->CQMask = *(unsigned int *)(pCQ + pParams->cq_off.ring_mask);
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to provide the receive buffers
+ **
+ ** Registers a buffer ring with the kernel and puts every
+ ** buffer on it.
+ **
+ ** @param[in]  pRing           The ring state, rings mapped
+ **
+ ** @return     ==0             Provided
+ **             <0              Failed, errno tells why
+ **
+ *****************************************************************************/
+
+static int
+setupRecvBuffers (
+  LLRP_tSIOURing *              pRing)
+{
+    struct io_uring_buf_reg     Reg;
+    unsigned int                i;
+
+    /*
+     * The ring must be page aligned. mmap() sees to that.
+     */
+    pRing->nBufRingMap = IOURING_N_RECV_BUF * sizeof(struct io_uring_buf);
+    pRing->pBufRing = mmap(NULL, pRing->nBufRingMap, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(MAP_FAILED == pRing->pBufRing)
+    {
+        pRing->pBufRing = NULL;
+        return -1;
+    }
+
+    pRing->pBufMem = malloc(IOURING_N_RECV_BUF * IOURING_RECV_BUF_SIZE);
+    if(NULL == pRing->pBufMem)
+    {
+        errno = ENOMEM;
+        return -1;
+    }
+
+    memset(&Reg, 0, sizeof Reg);
+    Reg.ring_addr = (unsigned long)pRing->pBufRing;
+    Reg.ring_entries = IOURING_N_RECV_BUF;
+    Reg.bgid = IOURING_RECV_BGID;
+
+    if(0 > syscall(__NR_io_uring_register, pRing->RingFd,
+                IORING_REGISTER_PBUF_RING, &Reg, 1))
+    {
+        return -1;
+    }
+
+    for(i = 0; i < IOURING_N_RECV_BUF; i++)
+    {
+        recycleRecvBuffer(pRing, i);
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to close the ring and free what goes with it
+ **
+ ** Safe on a partly set up instance.
+ **
+ *****************************************************************************/
+
+static void
+freeRing (
+  LLRP_tSIOURing *              pRing)
+{
+    unsigned int                i;
+
+    /*
+     * Closing the ring unregisters the buffer ring.
+     */
+    if(0 <= pRing->RingFd)
+    {
+        close(pRing->RingFd);
+    }
+
+    if(NULL != pRing->aSQE)
+    {
+        munmap(pRing->aSQE, pRing->nSQEMap);
+    }
+    if(NULL != pRing->pCQMap && pRing->pCQMap != pRing->pSQMap)
+    {
+        munmap(pRing->pCQMap, pRing->nCQMap);
+    }
+    if(NULL != pRing->pSQMap)
+    {
+        munmap(pRing->pSQMap, pRing->nSQMap);
+    }
+    if(NULL != pRing->pBufRing)
+    {
+        munmap(pRing->pBufRing, pRing->nBufRingMap);
+    }
+    free(pRing->pBufMem);
+
+    for(i = 0; i < 2u; i++)
+    {
+        free(pRing->aBatch[i].pBuffer);
+    }
+
+    memset(pRing, 0, sizeof *pRing);
+    free(pRing);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to get the next free submission queue entry
+ **
+ ** It is cleared. Fill it in and commitSQE().
+ **
+ ** @return     !=NULL          The entry
+ **             ==NULL          Queue full and can't be submitted
+ **
+ *****************************************************************************/
+
+static struct io_uring_sqe *
+getSQE (
+  LLRP_tSIOURing *              pRing)
+{
+    unsigned int                Tail = *pRing->pSQTail;
+    unsigned int                Head;
+    struct io_uring_sqe *       pSQE;
+
+    Head = __atomic_load_n(pRing->pSQHead, __ATOMIC_ACQUIRE);
+    if(Tail - Head >= pRing->nSQEntries)
+    {
+        if(0 != submitSQEs(pRing))
+        {
+            return NULL;
+        }
+        Head = __atomic_load_n(pRing->pSQHead, __ATOMIC_ACQUIRE);
+        if(Tail - Head >= pRing->nSQEntries)
+        {
+            return NULL;
+        }
+    }
+
+    pSQE = &pRing->aSQE[Tail & pRing->SQMask];
+    memset(pSQE, 0, sizeof *pSQE);
+
+    return pSQE;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to queue the entry from getSQE()
+ **
+ *****************************************************************************/
+
+static void
+commitSQE (
+  LLRP_tSIOURing *              pRing)
+{
+    unsigned int                Tail = *pRing->pSQTail;
+
+    pRing->pSQArray[Tail & pRing->SQMask] = Tail & pRing->SQMask;
+    __atomic_store_n(pRing->pSQTail, Tail + 1u, __ATOMIC_RELEASE);
+    pRing->nToSubmit++;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to submit what is queued
+ **
+ ** @return     ==0             Submitted, or nothing to
+ **             <0              Failed, errno tells why
+ **
+ *****************************************************************************/
+
+static int
+submitSQEs (
+  LLRP_tSIOURing *              pRing)
+{
+    int                         rc;
+
+    while(0 < pRing->nToSubmit)
+    {
+        rc = syscall(__NR_io_uring_enter, pRing->RingFd,
+                pRing->nToSubmit, 0, 0, NULL, 0);
+        if(0 > rc && EINTR == errno)
+        {
+            continue;
+        }
+        if(0 >= rc)
+        {
+            return -1;
+        }
+        pRing->nToSubmit -= rc;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to wait for a completion
+ **
+ ** Submit first. The completion is left on the queue.
+ **
+ ** @param[in]  nMS             Most milliseconds to wait, -1 for ever
+ **
+ ** @return     >0              There is a completion
+ **             ==0             Timeout
+ **             <0              Error, errno tells why
+ **
+ *****************************************************************************/
+
+static int
+waitCQE (
+  LLRP_tSIOURing *              pRing,
+  int                           nMS)
+{
+    struct io_uring_getevents_arg Arg;
+    struct __kernel_timespec    TS;
+    int                         rc;
+
+    memset(&Arg, 0, sizeof Arg);
+    Arg.sigmask_sz = _NSIG / 8;
+    if(0 <= nMS)
+    {
+        TS.tv_sec = nMS / 1000;
+        TS.tv_nsec = (nMS % 1000) * 1000000LL;
+        Arg.ts = (unsigned long)&TS;
+    }
+
+    rc = syscall(__NR_io_uring_enter, pRing->RingFd, 0, 1,
+            IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+            &Arg, sizeof Arg);
+    if(0 > rc)
+    {
+        return (ETIME == errno) ? 0 : -1;
+    }
+
+    return 1;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to take one completion off the queue
+ **
+ ** Received data goes on the chunk FIFO. A finished send starts
+ ** the next batch.
+ **
+ ** @return     TRUE            One was handled
+ **             FALSE           The queue is empty
+ **
+ *****************************************************************************/
+
+static llrp_bool_t
+reapCQE (
+  LLRP_tSIOURing *              pRing)
+{
+    unsigned int                Head = *pRing->pCQHead;
+    struct io_uring_cqe *       pCQE;
+    unsigned long long          UserData;
+    int                         Res;
+    unsigned int                Flags;
+
+    if(Head == __atomic_load_n(pRing->pCQTail, __ATOMIC_ACQUIRE))
+    {
+        return FALSE;
+    }
+
+    pCQE = &pRing->aCQE[Head & pRing->CQMask];
+    UserData = pCQE->user_data;
+    Res = pCQE->res;
+    Flags = pCQE->flags;
+    __atomic_store_n(pRing->pCQHead, Head + 1u, __ATOMIC_RELEASE);
+
+    switch(UserData)
+    {
+    case IOURING_TAG_RECV:
+        if(0 == (Flags & IORING_CQE_F_MORE))
+        {
+            /* Multishot ended. armRecv() will see. */
+            pRing->bRecvArmed = FALSE;
+        }
+        if(0 < Res && 0 != (Flags & IORING_CQE_F_BUFFER))
+        {
+            LLRP_tSIOURingChunk *   pChunk;
+
+            pChunk = &pRing->aChunk[(pRing->iChunk + pRing->nChunk) &
+                                    (IOURING_N_RECV_BUF - 1u)];
+            pChunk->BufID = Flags >> IORING_CQE_BUFFER_SHIFT;
+            pChunk->nLen = Res;
+            pChunk->iOff = 0;
+            pRing->nChunk++;
+        }
+        else if(0 == Res)
+        {
+            pRing->bRecvEOF = TRUE;
+        }
+        else if(-ENOBUFS == Res || -ECANCELED == Res)
+        {
+            /* Out of buffers, or cancelled by uringDetach() */
+        }
+        else if(0 > Res)
+        {
+            pRing->RecvErrno = -Res;
+        }
+        break;
+
+    case IOURING_TAG_SEND:
+        if(0 > pRing->iFlight)
+        {
+            /* Cancelled batch already forgotten */
+            break;
+        }
+        if(0 >= Res)
+        {
+            pRing->SendErrno = (0 == Res) ? EPIPE : -Res;
+            pRing->iFlight = -1;
+            break;
+        }
+        pRing->iFlightOff += Res;
+        if(pRing->iFlightOff < pRing->aBatch[pRing->iFlight].nBuffer &&
+           0 == pRing->SendErrno)
+        {
+            /* Short send. Send the rest. */
+            queueSend(pRing);
+            break;
+        }
+        pRing->aBatch[pRing->iFlight].nBuffer = 0;
+        pRing->iFlight = -1;
+        startSend(pRing);
+        break;
+
+    case IOURING_TAG_NOP:
+        pRing->bNopPending = FALSE;
+        break;
+
+    default:
+        break;
+    }
+
+    return TRUE;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to arm the multishot recv if it is not
+ **
+ ** Not while every buffer holds bytes not yet copied out. The
+ ** kernel would only answer ENOBUFS.
+ **
+ *****************************************************************************/
+
+static void
+armRecv (
+  LLRP_tSIOURing *              pRing)
+{
+    struct io_uring_sqe *       pSQE;
+
+    if(pRing->bRecvArmed || pRing->bRecvEOF || 0 != pRing->RecvErrno ||
+       IOURING_N_RECV_BUF <= pRing->nChunk)
+    {
+        return;
+    }
+
+    pSQE = getSQE(pRing);
+    if(NULL == pSQE)
+    {
+        pRing->RecvErrno = errno;
+        return;
+    }
+
+    pSQE->opcode = IORING_OP_RECV;
+    pSQE->fd = pRing->fd;
+    pSQE->ioprio = IORING_RECV_MULTISHOT;
+    pSQE->flags = IOSQE_BUFFER_SELECT;
+    pSQE->buf_group = IOURING_RECV_BGID;
+    pSQE->user_data = IOURING_TAG_RECV;
+    commitSQE(pRing);
+
+    pRing->bRecvArmed = TRUE;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to give a receive buffer back to the kernel
+ **
+ *****************************************************************************/
+
+static void
+recycleRecvBuffer (
+  LLRP_tSIOURing *              pRing,
+  unsigned short                BufID)
+{
+    struct io_uring_buf *       pBuf;
+
+    pBuf = &pRing->pBufRing->bufs[pRing->BufTail & (IOURING_N_RECV_BUF - 1u)];
+    pBuf->addr = (unsigned long)&pRing->pBufMem[BufID * IOURING_RECV_BUF_SIZE];
+    pBuf->len = IOURING_RECV_BUF_SIZE;
+    pBuf->bid = BufID;
+
+    pRing->BufTail++;
+    __atomic_store_n(&pRing->pBufRing->tail, pRing->BufTail,
+        __ATOMIC_RELEASE);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to send the collected batch if none is
+ **         in flight
+ **
+ *****************************************************************************/
+
+static void
+startSend (
+  LLRP_tSIOURing *              pRing)
+{
+    if(0 <= pRing->iFlight || 0 != pRing->SendErrno ||
+       0 == pRing->aBatch[pRing->iFill].nBuffer)
+    {
+        return;
+    }
+
+    pRing->iFlight = pRing->iFill;
+    pRing->iFill ^= 1;
+    pRing->iFlightOff = 0;
+    queueSend(pRing);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to queue a send of what is left of
+ **         the batch in flight
+ **
+ *****************************************************************************/
+
+static void
+queueSend (
+  LLRP_tSIOURing *              pRing)
+{
+    LLRP_tSIOURingBatch *       pBatch = &pRing->aBatch[pRing->iFlight];
+    struct io_uring_sqe *       pSQE;
+
+    pSQE = getSQE(pRing);
+    if(NULL == pSQE)
+    {
+        pRing->SendErrno = errno;
+        pRing->iFlight = -1;
+        return;
+    }
+
+    pSQE->opcode = IORING_OP_SEND;
+    pSQE->fd = pRing->fd;
+    pSQE->addr = (unsigned long)&pBatch->pBuffer[pRing->iFlightOff];
+    pSQE->len = pBatch->nBuffer - pRing->iFlightOff;
+    pSQE->msg_flags = MSG_WAITALL | MSG_NOSIGNAL;
+    pSQE->user_data = IOURING_TAG_SEND;
+    commitSQE(pRing);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to keep the ring fd readable while there
+ **         is something to read
+ **
+ ** Received bytes taken off the completion queue by some other call
+ ** no longer make the ring fd readable. A NOP completion does.
+ **
+ *****************************************************************************/
+
+static void
+keepReadable (
+  LLRP_tSIOURing *              pRing)
+{
+    struct io_uring_sqe *       pSQE;
+
+    if(!recvReady(pRing) || pRing->bNopPending ||
+       *pRing->pCQHead != __atomic_load_n(pRing->pCQTail, __ATOMIC_ACQUIRE))
+    {
+        return;
+    }
+
+    pSQE = getSQE(pRing);
+    if(NULL == pSQE)
+    {
+        return;
+    }
+
+    pSQE->opcode = IORING_OP_NOP;
+    pSQE->user_data = IOURING_TAG_NOP;
+    commitSQE(pRing);
+
+    pRing->bNopPending = TRUE;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to tell if uringRead() has something
+ **         to return
+ **
+ *****************************************************************************/
+
+static llrp_bool_t
+recvReady (
+  LLRP_tSIOURing *              pRing)
+{
+    return 0 < pRing->nChunk || pRing->bRecvEOF || 0 != pRing->RecvErrno;
+}
@@ -0,0 +1,503 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  ltkc_proxy.c
+ **
+ ** @brief Functions to relay LLRP frames between two connections
+ **
+ ** A gateway between a reader and an upstream server has no need
+ ** to decode every frame only to encode it again. A proxy relays
+ ** frames byte-for-byte in both directions.
+ **
+ ** Frame boundaries come from LLRP_FrameExtract() through the
+ ** connection's pre-decode hook. One read() takes whatever the
+ ** socket has into the receive buffer. The complete frames in it
+ ** are then written to the other side with one write(), straight
+ ** from the receive buffer. A partial frame stays behind until the
+ ** rest of it arrives, so the outgoing stream is always framed.
+ **
+ ** Message types marked for inspection are relayed just the same
+ ** and also decoded on the side. They are handed to the inspect
+ ** callback, or left on the input queue of the connection they
+ ** came from.
+ **
+ *****************************************************************************/
+
+
+#include <assert.h>
+
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include "ltkc_platform.h"
+#include "ltkc_base.h"
+#include "ltkc_frame.h"
+#include "ltkc_connection.h"
+
+
+/* forward declaration of private routines. */
+static LLRP_tEPreDecodeAction
+relayHook (
+  LLRP_tSConnection *           pConn,
+  const LLRP_tSFrameExtract *   pFrameExtract,
+  const unsigned char *         pFrame,
+  unsigned int                  nFrame,
+  void *                        pPreDecodeArg);
+
+static LLRP_tResultCode
+relaySide (
+  LLRP_tSProxy *                pProxy,
+  LLRP_tSProxySide *            pSide,
+  llrp_bool_t                   bFill);
+
+static LLRP_tResultCode
+flushBatch (
+  LLRP_tSProxy *                pProxy,
+  LLRP_tSProxySide *            pSide);
+
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Construct a new proxy between two connections
+ **
+ ** Both connections must already be open. The proxy installs its
+ ** own pre-decode hook on each. The connections stay the caller's.
+ **
+ ** @param[in]  pReader         Connection to the reader
+ ** @param[in]  pUpper          Connection to the upstream server
+ **
+ ** @return     !=NULL          Pointer to proxy instance
+ **             ==NULL          Error, always an allocation failure
+ **
+ *****************************************************************************/
+
+LLRP_tSProxy *
+LLRP_Proxy_construct (
+  LLRP_tSConnection *           pReader,
+  LLRP_tSConnection *           pUpper)
+{
+    LLRP_tSProxy *              pProxy;
+
+    /*
+     * Allocate, check, and zero-fill proxy instance.
+     */
+    pProxy = malloc(sizeof *pProxy);
+    if(NULL == pProxy)
+    {
+        return pProxy;
+    }
+    memset(pProxy, 0, sizeof *pProxy);
+
+    pProxy->Upstream.pProxy = pProxy;
+    pProxy->Upstream.pFrom = pReader;
+    pProxy->Upstream.pTo = pUpper;
+    pProxy->Downstream.pProxy = pProxy;
+    pProxy->Downstream.pFrom = pUpper;
+    pProxy->Downstream.pTo = pReader;
+
+    LLRP_Conn_setPreDecodeHook(pReader, relayHook, &pProxy->Upstream);
+    LLRP_Conn_setPreDecodeHook(pUpper, relayHook, &pProxy->Downstream);
+
+    /*
+     * Victory
+     */
+    return pProxy;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Destruct a proxy instance
+ **
+ ** The pre-decode hooks are removed. The connections are not
+ ** closed. Frames partly received stay in their receive buffers.
+ **
+ ** @param[in]  pProxy          Pointer to the proxy instance.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Proxy_destruct (
+  LLRP_tSProxy *                pProxy)
+{
+    if(NULL != pProxy)
+    {
+        LLRP_Conn_setPreDecodeHook(pProxy->Upstream.pFrom, NULL, NULL);
+        LLRP_Conn_setPreDecodeHook(pProxy->Downstream.pFrom, NULL, NULL);
+
+        /*
+         * Wipe it out so any stale uses are likely to crash
+         * on a NULL pointer.
+         */
+        memset(pProxy, 0, sizeof *pProxy);
+
+        free(pProxy);
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Mark a message type for inspection, or not
+ **
+ ** Frames of the type are still relayed as they are. They are
+ ** also decoded and handed to the inspect callback.
+ **
+ ** @param[in]  pProxy          Pointer to the proxy instance.
+ ** @param[in]  MessageType     The type number
+ ** @param[in]  bInspect        TRUE to decode on the side
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Proxy_setInspect (
+  LLRP_tSProxy *                pProxy,
+  llrp_u16_t                    MessageType,
+  llrp_bool_t                   bInspect)
+{
+    unsigned char               Bit = 1u << (MessageType & 7u);
+
+    if(bInspect)
+    {
+        pProxy->aInspect[MessageType >> 3u] |= Bit;
+    }
+    else
+    {
+        pProxy->aInspect[MessageType >> 3u] &= ~Bit;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Set the callback that receives inspected messages
+ **
+ ** Without one, inspected messages stay on the input queue of the
+ ** connection they came from, for LLRP_Conn_recvQueued().
+ **
+ ** @param[in]  pProxy          Pointer to the proxy instance.
+ ** @param[in]  pfInspect       The callback. It owns the message
+ **                             and must destruct it.
+ ** @param[in]  pInspectArg     Passed to pfInspect
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Proxy_setInspectCallback (
+  LLRP_tSProxy *                pProxy,
+  void                          (*pfInspect)(
+                                  LLRP_tSProxy *        pProxy,
+                                  LLRP_tSConnection *   pFrom,
+                                  LLRP_tSMessage *      pMessage,
+                                  void *                pInspectArg),
+  void *                        pInspectArg)
+{
+    pProxy->pfInspect = pfInspect;
+    pProxy->pInspectArg = pInspectArg;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Relay frames both ways for a while
+ **
+ ** Sends are done the way each destination connection is set up.
+ ** Blocking sends push back on the source naturally: while the
+ ** destination is slow, nothing more is read.
+ **
+ ** Complete frames already in either receive buffer, say read
+ ** ahead before the proxy was constructed, are relayed first.
+ ** Otherwise they would wait for more bytes on their socket.
+ **
+ ** @param[in]  pProxy          Pointer to the proxy instance.
+ ** @param[in]  nMaxMS          -1 => relay until something fails
+ **                              0 => relay what is there, return
+ **                             >0 => ms to relay
+ **
+ ** @return     LLRP_RC_OK          Time is up, all well
+ **             LLRP_RC_RecvEOF, LLRP_RC_RecvIOError,
+ **             LLRP_RC_RecvFramingError, LLRP_RC_RecvBufferOverflow,
+ **             LLRP_RC_SendIOError, LLRP_RC_SendQueueFull
+ **                                 One side failed. Check
+ **                                 LLRP_Proxy_getError(); pErrorConn
+ **                                 says which connection.
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+LLRP_Proxy_run (
+  LLRP_tSProxy *                pProxy,
+  int                           nMaxMS)
+{
+    LLRP_tSErrorDetails *       pError = &pProxy->ErrorDetails;
+    LLRP_tSProxySide *          apSide[2];
+    llrp_u64_t                  Deadline;
+    int                         i;
+
+    /*
+     * Fix the deadline now, before anything takes time.
+     */
+    Deadline = LLRP_Conn_calculateDeadline(nMaxMS);
+
+    LLRP_Error_clear(pError);
+    pProxy->pErrorConn = NULL;
+
+    apSide[0] = &pProxy->Upstream;
+    apSide[1] = &pProxy->Downstream;
+
+    for(i = 0; i < 2; i++)
+    {
+        if(LLRP_RC_OK != relaySide(pProxy, apSide[i], FALSE))
+        {
+            return pError->eResultCode;
+        }
+    }
+
+    for(;;)
+    {
+        struct pollfd           aPfd[2];
+        int                     rc;
+
+        for(i = 0; i < 2; i++)
+        {
+            aPfd[i].fd = LLRP_Conn_getPollFd(apSide[i]->pFrom);
+            aPfd[i].events = POLLIN;
+            aPfd[i].revents = 0;
+        }
+
+        rc = poll(aPfd, 2, LLRP_Conn_remainingMS(Deadline));
+        if(0 > rc && EINTR == errno)
+        {
+            continue;
+        }
+        if(0 > rc)
+        {
+            LLRP_Error_resultCodeAndWhatStr(pError,
+                LLRP_RC_RecvIOError, "poll failed");
+            return pError->eResultCode;
+        }
+        if(0 == rc)
+        {
+            /* Time is up */
+            return LLRP_RC_OK;
+        }
+
+        for(i = 0; i < 2; i++)
+        {
+            if(0 != aPfd[i].revents)
+            {
+                if(LLRP_RC_OK != relaySide(pProxy, apSide[i], TRUE))
+                {
+                    return pError->eResultCode;
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Get the details that explain the last proxy error
+ **
+ ** @param[in]  pProxy          Pointer to the proxy instance.
+ **
+ ** @return                     Pointer to const error details
+ **
+ *****************************************************************************/
+
+const LLRP_tSErrorDetails *
+LLRP_Proxy_getError (
+  LLRP_tSProxy *                pProxy)
+{
+    return &pProxy->ErrorDetails;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine, the pre-decode hook on each connection
+ **
+ ** Adds the frame to the batch for the other side. The frames of one
+ ** read() lie end to end in the receive buffer, so the batch is just
+ ** a start and a length. Only inspected types are decoded.
+ **
+ *****************************************************************************/
+
+static LLRP_tEPreDecodeAction
+relayHook (
+  LLRP_tSConnection *           pConn,
+  const LLRP_tSFrameExtract *   pFrameExtract,
+  const unsigned char *         pFrame,
+  unsigned int                  nFrame,
+  void *                        pPreDecodeArg)
+{
+    LLRP_tSProxySide *          pSide = pPreDecodeArg;
+    llrp_u16_t                  MessageType = pFrameExtract->MessageType;
+
+    if(NULL == pSide->pBatch)
+    {
+        pSide->pBatch = pFrame;
+        pSide->nBatch = nFrame;
+    }
+    else
+    {
+        /* The buffer is only ever consumed front to back */
+        assert(pSide->pBatch + pSide->nBatch == pFrame);
+        pSide->nBatch += nFrame;
+    }
+
+    pSide->nFrameRelayed++;
+    pSide->nByteRelayed += nFrame;
+
+    if(pSide->pProxy->aInspect[MessageType >> 3u] & (1u << (MessageType & 7u)))
+    {
+        return LLRP_PREDECODE_DECODE;
+    }
+
+    return LLRP_PREDECODE_SKIP;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to relay what one side has to offer
+ **
+ ** One read() unless bFill is FALSE, then every complete frame
+ ** goes to the other side in one send. Inspected messages are
+ ** handed out last.
+ **
+ ** A frame that fails to decode for inspection has been relayed
+ ** all the same. That is not an error for the proxy.
+ **
+ *****************************************************************************/
+
+static LLRP_tResultCode
+relaySide (
+  LLRP_tSProxy *                pProxy,
+  LLRP_tSProxySide *            pSide,
+  llrp_bool_t                   bFill)
+{
+    LLRP_tSErrorDetails *       pError = &pProxy->ErrorDetails;
+    LLRP_tResultCode            lrc = LLRP_RC_OK;
+    LLRP_tSMessage *            pMessage;
+
+    if(bFill)
+    {
+        lrc = LLRP_Conn_recvFill(pSide->pFrom);
+    }
+    if(LLRP_RC_OK == lrc)
+    {
+        lrc = LLRP_Conn_recvDecodeBuffered(pSide->pFrom);
+    }
+
+    /*
+     * Whatever was batched is whole frames. Send it even if
+     * the stream went bad after it. The batch points into the
+     * receive buffer, which nothing touches before the next read.
+     */
+    if(LLRP_RC_OK != flushBatch(pProxy, pSide))
+    {
+        return pError->eResultCode;
+    }
+
+    switch(lrc)
+    {
+    case LLRP_RC_OK:
+        break;
+
+    case LLRP_RC_RecvEOF:
+    case LLRP_RC_RecvIOError:
+    case LLRP_RC_RecvFramingError:
+    case LLRP_RC_RecvBufferOverflow:
+    case LLRP_RC_MiscError:
+        *pError = *LLRP_Conn_getRecvError(pSide->pFrom);
+        pProxy->pErrorConn = pSide->pFrom;
+        return pError->eResultCode;
+
+    default:
+        /* Decode error on an inspected frame. It was relayed. */
+        break;
+    }
+
+    /*
+     * Hand out the inspected messages.
+     */
+    if(NULL != pProxy->pfInspect)
+    {
+        while(NULL != (pMessage = LLRP_Conn_recvQueued(pSide->pFrom)))
+        {
+            (*pProxy->pfInspect)(pProxy, pSide->pFrom, pMessage,
+                pProxy->pInspectArg);
+        }
+    }
+
+    return LLRP_RC_OK;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to send the batch to the other side
+ **
+ *****************************************************************************/
+
+static LLRP_tResultCode
+flushBatch (
+  LLRP_tSProxy *                pProxy,
+  LLRP_tSProxySide *            pSide)
+{
+    LLRP_tSErrorDetails *       pError = &pProxy->ErrorDetails;
+    LLRP_tResultCode            lrc = LLRP_RC_OK;
+
+    if(NULL != pSide->pBatch)
+    {
+        lrc = LLRP_Conn_sendFrame(pSide->pTo, pSide->pBatch, pSide->nBatch);
+        pSide->pBatch = NULL;
+        pSide->nBatch = 0;
+
+        if(LLRP_RC_OK != lrc)
+        {
+            *pError = *LLRP_Conn_getSendError(pSide->pTo);
+            pProxy->pErrorConn = pSide->pTo;
+        }
+    }
+
+    return lrc;
+}
@@ -0,0 +1,829 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  ltkc_recvthread.c
+ **
+ ** @brief Functions to receive and decode on a thread of its own
+ **
+ ** An application that does slow work per message, say writing
+ ** each tag to a file, stops reading the socket while it does.
+ ** The reader's TCP window fills and reports back up. A receive
+ ** thread keeps reading and decoding while the application works,
+ ** so the two overlap on different cores.
+ **
+ ** The thread hands each decoded message to the application through
+ ** a bounded ring. Exactly one thread puts and one takes, so the ring
+ ** needs no lock, only ordered loads and stores of its two indices.
+ ** An eventfd tells the application there is something to take. It
+ ** is written once per read() worth of messages, not per message,
+ ** and can be registered with the application's own event loop.
+ **
+ ** When the ring is full the thread stops reading until the
+ ** application takes something. Back pressure reaches the reader
+ ** through TCP as it would without the thread.
+ **
+ ** While the thread runs it owns the receive side of the connection,
+ ** including transactions. The application may still send, as long
+ ** as the connection uses LLRP_ConnIO_POSIX. Other backends share
+ ** their state between the two directions.
+ **
+ *****************************************************************************/
+
+
+#include <pthread.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/eventfd.h>
+
+#include "ltkc_platform.h"
+#include "ltkc_base.h"
+#include "ltkc_frame.h"
+#include "ltkc_connection.h"
+
+
+/*
+ * Keep the producer and consumer indices on cache lines
+ * of their own so each core writes only its own line.
+ */
+#define CACHE_LINE_SIZE     (64u)
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Structure of a receive thread instance
+ **
+ ** Private to this file. Several members are shared between the
+ ** receive thread and the application thread and are only touched
+ ** with the atomic builtins.
+ **
+ *****************************************************************************/
+
+struct LLRP_SRecvThread
+{
+    /** The connection received from */
+    LLRP_tSConnection *         pConn;
+
+    /** The ring of decoded messages. nRing is a power of 2. */
+    LLRP_tSMessage **           apRing;
+    unsigned int                nRing;
+
+    /** Written when messages are put or the thread ends.
+     ** Readable means LLRP_RecvThread_recvMessage() has
+     ** something to return, or had since it last returned
+     ** NULL. */
+    int                         EventFd;
+
+    /** Written to stop the thread, or to wake it when the
+     ** ring is no longer full */
+    int                         WakeFd;
+
+    /** The thread, valid while bRunning */
+    pthread_t                   Thread;
+    llrp_bool_t                 bRunning;
+
+    /** Details of why recvMessage() last returned NULL. Only
+     ** the application thread touches this. */
+    LLRP_tSErrorDetails         ErrorDetails;
+
+    /** Details of the error that ended the thread. Written
+     ** by the thread before it sets bEnded. */
+    LLRP_tSErrorDetails         EndErrorDetails;
+
+    /** Count of messages ever put, written only by the thread */
+    unsigned char               aPad0[CACHE_LINE_SIZE];
+    unsigned int                iPut;
+
+    /** Count of messages ever taken, written only by the application */
+    unsigned char               aPad1[CACHE_LINE_SIZE];
+    unsigned int                iTake;
+
+    /** Set by the thread when it waits for room. Set by the
+     ** application to stop the thread. */
+    unsigned char               aPad2[CACHE_LINE_SIZE];
+    int                         bWantRoom;
+    int                         bStop;
+
+    /** Set by the thread as it ends */
+    int                         bEnded;
+};
+
+
+/* forward declaration of private routines. */
+static void *
+threadMain (
+  void *                        pArg);
+
+static llrp_bool_t
+threadHandOut (
+  LLRP_tSRecvThread *           pRecvThread);
+
+static llrp_bool_t
+threadAwaitRoom (
+  LLRP_tSRecvThread *           pRecvThread);
+
+static llrp_bool_t
+threadWait (
+  LLRP_tSRecvThread *           pRecvThread,
+  int                           fd);
+
+static void
+threadEnd (
+  LLRP_tSRecvThread *           pRecvThread,
+  const LLRP_tSErrorDetails *   pError);
+
+static void
+signalFd (
+  int                           fd);
+
+static void
+drainFd (
+  int                           fd);
+
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Construct a new receive thread for a connection
+ **
+ ** The thread is not started. See LLRP_RecvThread_start().
+ **
+ ** @param[in]  pConn           The connection, already open
+ ** @param[in]  nRing           Most decoded messages to hold for the
+ **                             application. Rounded up to a power of 2.
+ **                             0 selects a default of 1024.
+ **
+ ** @return     !=NULL          Pointer to receive thread instance
+ **             ==NULL          Error, always an allocation failure
+ **
+ *****************************************************************************/
+
+LLRP_tSRecvThread *
+LLRP_RecvThread_construct (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  nRing)
+{
+    LLRP_tSRecvThread *         pRecvThread;
+    unsigned int                nPow2;
+
+    if(0 == nRing)
+    {
+        nRing = 1024u;
+    }
+    if(0x80000000u < nRing)
+    {
+        /* Insane ring size */
+        return NULL;
+    }
+    for(nPow2 = 1u; nPow2 < nRing; nPow2 *= 2u)
+    {
+        /* round up */
+    }
+
+    /*
+     * Allocate, check, and zero-fill receive thread instance.
+     */
+    pRecvThread = malloc(sizeof *pRecvThread);
+    if(NULL == pRecvThread)
+    {
+        return pRecvThread;
+    }
+    memset(pRecvThread, 0, sizeof *pRecvThread);
+
+    pRecvThread->pConn = pConn;
+    pRecvThread->nRing = nPow2;
+    pRecvThread->EventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    pRecvThread->WakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    pRecvThread->apRing = malloc(nPow2 * sizeof pRecvThread->apRing[0]);
+
+    if(0 > pRecvThread->EventFd || 0 > pRecvThread->WakeFd ||
+       NULL == pRecvThread->apRing)
+    {
+        LLRP_RecvThread_destruct(pRecvThread);
+        return NULL;
+    }
+
+    /*
+     * Victory
+     */
+    return pRecvThread;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Destruct a receive thread instance
+ **
+ ** Stops the thread if it runs. Messages not yet taken are
+ ** destructed. The connection is not closed.
+ **
+ ** @param[in]  pRecvThread     Pointer to the receive thread instance.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_RecvThread_destruct (
+  LLRP_tSRecvThread *           pRecvThread)
+{
+    LLRP_tSMessage *            pMessage;
+
+    if(NULL == pRecvThread)
+    {
+        return;
+    }
+
+    LLRP_RecvThread_stop(pRecvThread);
+
+    if(NULL != pRecvThread->apRing)
+    {
+        while(pRecvThread->iTake != pRecvThread->iPut)
+        {
+            pMessage = pRecvThread->apRing[
+                    pRecvThread->iTake & (pRecvThread->nRing - 1u)];
+            LLRP_Element_destruct(&pMessage->elementHdr);
+            pRecvThread->iTake++;
+        }
+        free(pRecvThread->apRing);
+    }
+
+    if(0 <= pRecvThread->EventFd)
+    {
+        close(pRecvThread->EventFd);
+    }
+    if(0 <= pRecvThread->WakeFd)
+    {
+        close(pRecvThread->WakeFd);
+    }
+
+    /*
+     * Wipe it out so any stale uses are likely to crash
+     * on a NULL pointer.
+     */
+    memset(pRecvThread, 0, sizeof *pRecvThread);
+
+    free(pRecvThread);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Start the thread
+ **
+ ** From here until LLRP_RecvThread_stop() the application must not
+ ** receive on the connection, nor use transactions on it. Messages
+ ** already on the connection's input queue are handed out first.
+ **
+ ** @param[in]  pRecvThread     Pointer to the receive thread instance.
+ **
+ ** @return     LLRP_RC_OK          Started
+ **             LLRP_RC_MiscError   Already started, or pthread_create()
+ **                                 failed
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+LLRP_RecvThread_start (
+  LLRP_tSRecvThread *           pRecvThread)
+{
+    LLRP_tSErrorDetails *       pError = &pRecvThread->ErrorDetails;
+
+    LLRP_Error_clear(pError);
+
+    if(pRecvThread->bRunning)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "already started");
+        return pError->eResultCode;
+    }
+
+    if(&LLRP_ConnIO_POSIX != pRecvThread->pConn->pIO)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "backend not thread-safe");
+        return pError->eResultCode;
+    }
+
+    /*
+     * No thread runs, so plain stores are fine. pthread_create()
+     * orders them before anything the thread does.
+     */
+    pRecvThread->bStop = FALSE;
+    pRecvThread->bEnded = FALSE;
+    pRecvThread->bWantRoom = FALSE;
+    LLRP_Error_clear(&pRecvThread->EndErrorDetails);
+    drainFd(pRecvThread->WakeFd);
+
+    if(0 != pthread_create(&pRecvThread->Thread, NULL,
+                threadMain, pRecvThread))
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "pthread_create failed");
+        return pError->eResultCode;
+    }
+    pRecvThread->bRunning = TRUE;
+
+    return pError->eResultCode;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Stop the thread and wait for it to end
+ **
+ ** A frame partly received stays in the connection's buffer.
+ ** Messages already in the ring stay there for
+ ** LLRP_RecvThread_recvMessage(). Those decoded but not yet
+ ** put in the ring stay on the connection's input queue.
+ ** Afterwards the application may receive on the connection
+ ** itself again.
+ **
+ ** @param[in]  pRecvThread     Pointer to the receive thread instance.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_RecvThread_stop (
+  LLRP_tSRecvThread *           pRecvThread)
+{
+    if(!pRecvThread->bRunning)
+    {
+        return;
+    }
+
+    __atomic_store_n(&pRecvThread->bStop, TRUE, __ATOMIC_SEQ_CST);
+    signalFd(pRecvThread->WakeFd);
+
+    pthread_join(pRecvThread->Thread, NULL);
+    pRecvThread->bRunning = FALSE;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Take the next message the thread decoded
+ **
+ ** Call from only one application thread at a time.
+ **
+ ** @param[in]  pRecvThread     Pointer to the receive thread instance.
+ ** @param[in]  nMaxMS          -1 => block indefinitely
+ **                              0 => just peek, return immediately
+ **                             >0 => ms to await a message
+ **
+ ** @return     ==NULL          No message available per parameters.
+ **                             Check LLRP_RecvThread_getError() for why
+ **             !=NULL          Input message
+ **
+ *****************************************************************************/
+
+LLRP_tSMessage *
+LLRP_RecvThread_recvMessage (
+  LLRP_tSRecvThread *           pRecvThread,
+  int                           nMaxMS)
+{
+    LLRP_tSErrorDetails *       pError = &pRecvThread->ErrorDetails;
+    llrp_u64_t                  Deadline;
+    unsigned int                iTake = pRecvThread->iTake;
+    LLRP_tSMessage *            pMessage;
+
+    Deadline = LLRP_Conn_calculateDeadline(nMaxMS);
+
+    LLRP_Error_clear(pError);
+
+    for(;;)
+    {
+        struct pollfd           pfd;
+
+        /*
+         * The acquire pairs with the thread's release, so the
+         * message it put is seen whole.
+         */
+        if(__atomic_load_n(&pRecvThread->iPut, __ATOMIC_ACQUIRE) != iTake)
+        {
+            break;
+        }
+
+        /*
+         * Empty. Clear the event, then look again. A message put
+         * after this look is followed by an event the poll sees.
+         */
+        drainFd(pRecvThread->EventFd);
+        if(__atomic_load_n(&pRecvThread->iPut, __ATOMIC_ACQUIRE) != iTake)
+        {
+            break;
+        }
+
+        /*
+         * Nothing more is coming if the thread has ended.
+         */
+        if(__atomic_load_n(&pRecvThread->bEnded, __ATOMIC_ACQUIRE))
+        {
+            *pError = pRecvThread->EndErrorDetails;
+            return NULL;
+        }
+
+        pfd.fd = pRecvThread->EventFd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+
+        if(0 == nMaxMS ||
+           0 == poll(&pfd, 1, LLRP_Conn_remainingMS(Deadline)))
+        {
+            LLRP_Error_resultCodeAndWhatStr(pError,
+                LLRP_RC_RecvTimeout, "timeout");
+            return NULL;
+        }
+        /* Message, thread ended, or EINTR. Look again. */
+    }
+
+    pMessage = pRecvThread->apRing[iTake & (pRecvThread->nRing - 1u)];
+
+    /*
+     * Free the slot. If the thread is waiting for room, wake it.
+     * This store and load pair with the thread's store of
+     * bWantRoom and load of iTake: either the thread sees the
+     * slot free or this sees the thread waiting.
+     */
+    __atomic_store_n(&pRecvThread->iTake, iTake + 1u, __ATOMIC_SEQ_CST);
+    if(__atomic_load_n(&pRecvThread->bWantRoom, __ATOMIC_SEQ_CST))
+    {
+        __atomic_store_n(&pRecvThread->bWantRoom, FALSE, __ATOMIC_SEQ_CST);
+        signalFd(pRecvThread->WakeFd);
+    }
+
+    return pMessage;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Get the fd that is readable when there is a message to take
+ **
+ ** For the application's own event loop. It also becomes readable
+ ** when the thread ends. The application does not read it,
+ ** LLRP_RecvThread_recvMessage() does, but only once the ring is
+ ** empty. So when it is readable, take messages with nMaxMS 0
+ ** until one returns NULL before waiting on it again. Until then
+ ** it may stay readable with nothing left to take.
+ **
+ ** @param[in]  pRecvThread     Pointer to the receive thread instance.
+ **
+ ** @return                     The eventfd
+ **
+ *****************************************************************************/
+
+int
+LLRP_RecvThread_getEventFd (
+  LLRP_tSRecvThread *           pRecvThread)
+{
+    return pRecvThread->EventFd;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Get the details that explain why no message was returned
+ **
+ ** Once the ring is empty after the thread ended, the error is what
+ ** ended it: EOF, I/O, framing, or overflow on the connection, or
+ ** LLRP_RC_MiscError if it was stopped. Otherwise it is a timeout.
+ **
+ ** @param[in]  pRecvThread     Pointer to the receive thread instance.
+ **
+ ** @return                     Pointer to const error details
+ **
+ *****************************************************************************/
+
+const LLRP_tSErrorDetails *
+LLRP_RecvThread_getError (
+  LLRP_tSRecvThread *           pRecvThread)
+{
+    return &pRecvThread->ErrorDetails;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine, the body of the receive thread
+ **
+ ** Waits for the socket, reads what it has, decodes every whole
+ ** frame, and puts the messages in the ring. Ends when stopped or
+ ** when the connection fails. A frame that fails to decode is lost
+ ** but the stream carries on, as with LLRP_Conn_recvDecodeBuffered().
+ **
+ *****************************************************************************/
+
+static void *
+threadMain (
+  void *                        pArg)
+{
+    LLRP_tSRecvThread *         pRecvThread = pArg;
+    LLRP_tSConnection *         pConn = pRecvThread->pConn;
+    LLRP_tResultCode            lrc;
+
+    /*
+     * Decode the whole frames already buffered before the thread
+     * started. Otherwise they would wait for the socket to be
+     * readable, which it may not be again for long.
+     */
+    lrc = LLRP_Conn_recvDecodeBuffered(pConn);
+
+    for(;;)
+    {
+        switch(lrc)
+        {
+        case LLRP_RC_OK:
+            break;
+
+        case LLRP_RC_RecvEOF:
+        case LLRP_RC_RecvIOError:
+        case LLRP_RC_RecvFramingError:
+        case LLRP_RC_RecvBufferOverflow:
+        case LLRP_RC_MiscError:
+            /*
+             * Hand out what got decoded before the failure,
+             * then end. The application sees the error once
+             * it has taken everything.
+             */
+            threadHandOut(pRecvThread);
+            threadEnd(pRecvThread, LLRP_Conn_getRecvError(pConn));
+            return NULL;
+
+        default:
+            /* Decode error. That frame is lost, carry on. */
+            break;
+        }
+
+        /*
+         * Hand out what is decoded already, including what was
+         * queued before the thread started.
+         */
+        if(!threadHandOut(pRecvThread) ||
+           !threadWait(pRecvThread, LLRP_Conn_getPollFd(pConn)))
+        {
+            threadEnd(pRecvThread, NULL);
+            return NULL;
+        }
+
+        lrc = LLRP_Conn_recvFill(pConn);
+        if(LLRP_RC_OK == lrc)
+        {
+            lrc = LLRP_Conn_recvDecodeBuffered(pConn);
+        }
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to move the connection's input queue
+ **         into the ring
+ **
+ ** Waits for room as need be. A message is taken off the input
+ ** queue only once there is room for it, so if the thread is
+ ** stopped meanwhile the rest stay queued on the connection.
+ **
+ ** @return     TRUE            Input queue empty
+ **             FALSE           Stopped while waiting for room
+ **
+ *****************************************************************************/
+
+static llrp_bool_t
+threadHandOut (
+  LLRP_tSRecvThread *           pRecvThread)
+{
+    LLRP_tSConnection *         pConn = pRecvThread->pConn;
+    LLRP_tSMessage *            pMessage;
+    unsigned int                iPut = pRecvThread->iPut;
+    unsigned int                nPut = 0;
+    llrp_bool_t                 bRoom = TRUE;
+
+    while(NULL != pConn->pInputQueue)
+    {
+        if(!threadAwaitRoom(pRecvThread))
+        {
+            bRoom = FALSE;
+            break;
+        }
+
+        pMessage = LLRP_Conn_recvQueued(pConn);
+        pRecvThread->apRing[iPut & (pRecvThread->nRing - 1u)] = pMessage;
+        iPut++;
+        nPut++;
+
+        /* The release publishes the slot before the index */
+        __atomic_store_n(&pRecvThread->iPut, iPut, __ATOMIC_RELEASE);
+    }
+
+    if(0 != nPut)
+    {
+        signalFd(pRecvThread->EventFd);
+    }
+
+    return bRoom;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to wait until the ring has room
+ **
+ ** @return     TRUE            There is room for one more
+ **             FALSE           Stopped while waiting
+ **
+ *****************************************************************************/
+
+static llrp_bool_t
+threadAwaitRoom (
+  LLRP_tSRecvThread *           pRecvThread)
+{
+    unsigned int                iPut = pRecvThread->iPut;
+
+    while(iPut - __atomic_load_n(&pRecvThread->iTake, __ATOMIC_ACQUIRE) >=
+            pRecvThread->nRing)
+    {
+        /*
+         * Full. Make sure the application knows there is plenty
+         * to take. Tell it to wake us, then look again in case
+         * it took one before it could see that.
+         */
+        signalFd(pRecvThread->EventFd);
+        __atomic_store_n(&pRecvThread->bWantRoom, TRUE, __ATOMIC_SEQ_CST);
+        if(iPut - __atomic_load_n(&pRecvThread->iTake, __ATOMIC_SEQ_CST) <
+                pRecvThread->nRing)
+        {
+            break;
+        }
+        if(!threadWait(pRecvThread, -1))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to wait for fd to be readable or a wakeup
+ **
+ ** @param[in]  pRecvThread     Pointer to the receive thread instance.
+ ** @param[in]  fd              The socket, or -1 to wait just for
+ **                             the wakeup
+ **
+ ** @return     TRUE            fd readable, or woken for room
+ **             FALSE           Stopped
+ **
+ *****************************************************************************/
+
+static llrp_bool_t
+threadWait (
+  LLRP_tSRecvThread *           pRecvThread,
+  int                           fd)
+{
+    struct pollfd               aPfd[2];
+
+    for(;;)
+    {
+        if(__atomic_load_n(&pRecvThread->bStop, __ATOMIC_SEQ_CST))
+        {
+            return FALSE;
+        }
+
+        aPfd[0].fd = pRecvThread->WakeFd;
+        aPfd[0].events = POLLIN;
+        aPfd[0].revents = 0;
+        aPfd[1].fd = fd;
+        aPfd[1].events = POLLIN;
+        aPfd[1].revents = 0;
+
+        if(0 >= poll(aPfd, 0 > fd ? 1 : 2, -1))
+        {
+            /* EINTR */
+            continue;
+        }
+
+        if(0 != aPfd[0].revents)
+        {
+            drainFd(pRecvThread->WakeFd);
+            if(0 > fd)
+            {
+                /* Woken for room, or to stop. Caller looks. */
+                return !__atomic_load_n(&pRecvThread->bStop,
+                                                __ATOMIC_SEQ_CST);
+            }
+            continue;
+        }
+
+        return TRUE;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to note the thread has ended, and why
+ **
+ ** @param[in]  pRecvThread     Pointer to the receive thread instance.
+ ** @param[in]  pError          The connection error, NULL if stopped
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+static void
+threadEnd (
+  LLRP_tSRecvThread *           pRecvThread,
+  const LLRP_tSErrorDetails *   pError)
+{
+    if(NULL != pError)
+    {
+        pRecvThread->EndErrorDetails = *pError;
+    }
+    else
+    {
+        LLRP_Error_resultCodeAndWhatStr(&pRecvThread->EndErrorDetails,
+            LLRP_RC_MiscError, "receive thread stopped");
+    }
+
+    /* The release publishes EndErrorDetails */
+    __atomic_store_n(&pRecvThread->bEnded, TRUE, __ATOMIC_RELEASE);
+    signalFd(pRecvThread->EventFd);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to make an eventfd readable
+ **
+ *****************************************************************************/
+
+static void
+signalFd (
+  int                           fd)
+{
+    uint64_t                    One = 1;
+
+    /* Can only fail if the count would overflow, still readable */
+    if(sizeof One != write(fd, &One, sizeof One))
+    {
+        return;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to make an eventfd not readable
+ **
+ *****************************************************************************/
+
+static void
+drainFd (
+  int                           fd)
+{
+    uint64_t                    Count;
+
+    /* Non-blocking, fails with EAGAIN if already clear */
+    if(sizeof Count != read(fd, &Count, sizeof Count))
+    {
+        return;
+    }
+}
@@ -0,0 +1,514 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  ltkc_server.c
+ **
+ ** @brief Functions to accept LLRP connections from many readers
+ **
+ ** Readers in client mode (ClientModeConfiguration) connect to us.
+ ** A server listens once and accepts any number of them, each
+ ** handed back as its own LLRP_tSConnection. Together with
+ ** LLRP_tSConnGroup one process can terminate a whole fleet.
+ **
+ ** The listening socket is always non-blocking. LLRP_Server_accept()
+ ** takes the usual nMaxMS so it can wait, or just peek when the
+ ** listening fd is registered with an event loop.
+ **
+ ** With LLRP_SERVER_REUSEPORT each worker thread can construct its
+ ** own server on the same port. The kernel then spreads incoming
+ ** connections across them.
+ **
+ *****************************************************************************/
+
+
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#include "ltkc_platform.h"
+#include "ltkc_base.h"
+#include "ltkc_frame.h"
+#include "ltkc_connection.h"
+
+
+#define LLRP1_TCP_PORT   (5084u)
+
+
+/* forward declaration of private routines. */
+static int
+acceptOne (
+  LLRP_tSServer *               pServer);
+
+static void
+conditionAccepted (
+  int                           Sock);
+
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Construct a new server instance
+ **
+ ** @param[in]  pTypeRegistry   The LLRP registry handed to each
+ **                             accepted connection.
+ ** @param[in]  nBufferSize     Send/receive buffer size of each
+ **                             accepted connection. 0 selects the
+ **                             LLRP_Conn_construct() default.
+ **
+ ** @return     !=NULL          Pointer to server instance
+ **             ==NULL          Error, always an allocation failure
+ **
+ *****************************************************************************/
+
+LLRP_tSServer *
+LLRP_Server_construct (
+  const LLRP_tSTypeRegistry *   pTypeRegistry,
+  unsigned int                  nBufferSize)
+{
+    LLRP_tSServer *             pServer;
+
+    /*
+     * Allocate, check, and zero-fill server instance.
+     */
+    pServer = malloc(sizeof *pServer);
+    if(NULL == pServer)
+    {
+        return pServer;
+    }
+    memset(pServer, 0, sizeof *pServer);
+
+    /*
+     * Capture variables. fd=-1 indicates there
+     * is no listening socket yet.
+     */
+    pServer->fd = -1;
+    pServer->pTypeRegistry = pTypeRegistry;
+    pServer->nBufferSize = nBufferSize;
+
+    /*
+     * Victory
+     */
+    return pServer;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Destruct a server instance
+ **
+ ** The listening socket is closed. Connections already accepted
+ ** belong to the application and are not affected.
+ **
+ ** @param[in]  pServer         Pointer to the server instance.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+LLRP_Server_destruct (
+  LLRP_tSServer *               pServer)
+{
+    if(NULL != pServer)
+    {
+        if(0 <= pServer->fd)
+        {
+            close(pServer->fd);
+        }
+
+        /*
+         * Wipe it out so any stale uses are likely to crash
+         * on a NULL pointer.
+         */
+        memset(pServer, 0, sizeof *pServer);
+
+        free(pServer);
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Start listening for connections
+ **
+ ** The steps:
+ **     - Create a non-blocking socket
+ **     - Set SO_REUSEADDR, and SO_REUSEPORT if asked
+ **     - Bind the local address and port
+ **     - Listen with the given backlog
+ **
+ ** @param[in]  pServer         Pointer to the server instance.
+ ** @param[in]  pLocalAddr      Dotted IPv4 address to listen on,
+ **                             NULL for all.
+ ** @param[in]  Port            TCP port, 0 for the LLRP port (5084)
+ ** @param[in]  nBacklog        Most connections awaiting accept.
+ **                             0 or less selects SOMAXCONN.
+ ** @param[in]  Options         LLRP_SERVER_REUSEPORT or 0
+ **
+ ** @return     LLRP_RC_OK          Listening
+ **             LLRP_RC_MiscError   Already listening, bad address,
+ **                                 or a socket call failed.
+ **                                 Check LLRP_Server_getError().
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+LLRP_Server_listen (
+  LLRP_tSServer *               pServer,
+  const char *                  pLocalAddr,
+  unsigned int                  Port,
+  int                           nBacklog,
+  unsigned int                  Options)
+{
+    LLRP_tSErrorDetails *       pError = &pServer->ErrorDetails;
+    struct sockaddr_in          Sin;
+    int                         Sock;
+    int                         Flag;
+
+    LLRP_Error_clear(pError);
+
+    /*
+     * Make sure there isn't already a listening socket.
+     */
+    if(0 <= pServer->fd)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "already listening");
+        return pError->eResultCode;
+    }
+
+    /*
+     * Convert the address to sockaddr_in format
+     */
+    memset(&Sin, 0, sizeof Sin);
+    Sin.sin_family = AF_INET;
+    Sin.sin_port = htons(0 == Port ? LLRP1_TCP_PORT : Port);
+    if(NULL == pLocalAddr)
+    {
+        Sin.sin_addr.s_addr = htonl(INADDR_ANY);
+    }
+    else if(1 != inet_pton(AF_INET, pLocalAddr, &Sin.sin_addr))
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "bad local address");
+        return pError->eResultCode;
+    }
+
+    if(0 >= nBacklog)
+    {
+        nBacklog = SOMAXCONN;
+    }
+
+    /*
+     * Create the socket. Non-blocking so accept() never
+     * hangs when a client goes away between poll() and
+     * accept(), and close-on-exec.
+     */
+    Sock = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if(0 > Sock)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "socket() failed");
+        return pError->eResultCode;
+    }
+
+    /*
+     * Allow a restarted server to bind while old
+     * connections linger in TIME_WAIT.
+     */
+    Flag = 1;
+    setsockopt(Sock, SOL_SOCKET, SO_REUSEADDR, (void*)&Flag, sizeof Flag);
+
+    /*
+     * Let several listening sockets share the port, one per
+     * worker. The kernel balances connections across them.
+     */
+    if(Options & LLRP_SERVER_REUSEPORT)
+    {
+        Flag = 1;
+        if(0 > setsockopt(Sock, SOL_SOCKET, SO_REUSEPORT,
+                          (void*)&Flag, sizeof Flag))
+        {
+            LLRP_Error_resultCodeAndWhatStr(pError,
+                LLRP_RC_MiscError, "SO_REUSEPORT failed");
+            close(Sock);
+            return pError->eResultCode;
+        }
+    }
+
+    /*
+     * Bind the address to socket
+     */
+    if(0 > bind(Sock, (struct sockaddr *)&Sin, sizeof Sin))
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "bind() failed");
+        close(Sock);
+        return pError->eResultCode;
+    }
+
+    if(0 > listen(Sock, nBacklog))
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "listen() failed");
+        close(Sock);
+        return pError->eResultCode;
+    }
+
+    /*
+     * Record the socket in the server instance
+     */
+    pServer->fd = Sock;
+
+    /*
+     * Victory
+     */
+    return LLRP_RC_OK;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Accept the next connection
+ **
+ ** The accepted socket is blocking, like one from
+ ** LLRP_Conn_openConnectionToReader(), with TCP_NODELAY and
+ ** keepalive set.
+ **
+ ** @param[in]  pServer         Pointer to the server instance.
+ ** @param[in]  nMaxMS          -1 => block indefinitely
+ **                              0 => take one only if already
+ **                                   waiting, return immediately
+ **                             >0 => ms to await a connection
+ **
+ ** @return     !=NULL          The new connection, owned by the caller
+ **             ==NULL          None. LLRP_Server_getError() says why:
+ **                             LLRP_RC_RecvTimeout none arrived in time,
+ **                             LLRP_RC_RecvIOError poll() or accept()
+ **                             failed, LLRP_RC_MiscError not listening
+ **                             or allocation failed.
+ **
+ *****************************************************************************/
+
+LLRP_tSConnection *
+LLRP_Server_accept (
+  LLRP_tSServer *               pServer,
+  int                           nMaxMS)
+{
+    LLRP_tSErrorDetails *       pError = &pServer->ErrorDetails;
+    LLRP_tSConnection *         pConn;
+    llrp_u64_t                  Deadline;
+    int                         Sock;
+
+    /*
+     * Fix the deadline now, before anything takes time.
+     */
+    Deadline = LLRP_Conn_calculateDeadline(nMaxMS);
+
+    LLRP_Error_clear(pError);
+
+    if(0 > pServer->fd)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "not listening");
+        return NULL;
+    }
+
+    /*
+     * Loop until a connection is accepted or time is up.
+     * Another thread sharing the socket may take the connection
+     * poll() announced, so accept() can still come up empty.
+     */
+    for(;;)
+    {
+        struct pollfd           pfd;
+        int                     rc;
+
+        Sock = acceptOne(pServer);
+        if(0 <= Sock)
+        {
+            break;
+        }
+        if(LLRP_RC_OK != pError->eResultCode)
+        {
+            return NULL;
+        }
+
+        pfd.fd = pServer->fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+
+        rc = poll(&pfd, 1, LLRP_Conn_remainingMS(Deadline));
+        if(0 > rc && EINTR == errno)
+        {
+            continue;
+        }
+        if(0 > rc)
+        {
+            LLRP_Error_resultCodeAndWhatStr(pError,
+                LLRP_RC_RecvIOError, "poll failed");
+            return NULL;
+        }
+        if(0 == rc)
+        {
+            LLRP_Error_resultCodeAndWhatStr(pError,
+                LLRP_RC_RecvTimeout, "timeout");
+            return NULL;
+        }
+    }
+
+    conditionAccepted(Sock);
+
+    /*
+     * Wrap it in a connection instance
+     */
+    pConn = LLRP_Conn_construct(pServer->pTypeRegistry,
+                pServer->nBufferSize);
+    if(NULL == pConn)
+    {
+        LLRP_Error_resultCodeAndWhatStr(pError,
+            LLRP_RC_MiscError, "connection construct failed");
+        close(Sock);
+        return NULL;
+    }
+    pConn->fd = Sock;
+
+    /*
+     * Victory
+     */
+    return pConn;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Get the details that explain the last server error
+ **
+ ** @param[in]  pServer         Pointer to the server instance.
+ **
+ ** @return                     Pointer to const error details
+ **
+ *****************************************************************************/
+
+const LLRP_tSErrorDetails *
+LLRP_Server_getError (
+  LLRP_tSServer *               pServer)
+{
+    return &pServer->ErrorDetails;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to accept one connection without blocking
+ **
+ ** Connections that failed while waiting in the backlog are
+ ** skipped.
+ **
+ ** @return     >=0             The accepted socket
+ **             <0              None. ErrorDetails is LLRP_RC_OK if
+ **                             none is waiting, else why not.
+ **
+ *****************************************************************************/
+
+static int
+acceptOne (
+  LLRP_tSServer *               pServer)
+{
+    int                         Sock;
+
+    for(;;)
+    {
+        Sock = accept(pServer->fd, NULL, NULL);
+        if(0 <= Sock)
+        {
+            fcntl(Sock, F_SETFD, FD_CLOEXEC);
+            return Sock;
+        }
+
+        switch(errno)
+        {
+        case EINTR:
+        case ECONNABORTED:
+        case EPROTO:
+            /* Try again, there may be another waiting */
+            continue;
+
+        case EAGAIN:
+#if EWOULDBLOCK != EAGAIN
+        case EWOULDBLOCK:
+#endif
+            /* None waiting */
+            return -1;
+
+        default:
+            LLRP_Error_resultCodeAndWhatStr(&pServer->ErrorDetails,
+                LLRP_RC_RecvIOError, "accept() failed");
+            return -1;
+        }
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Internal routine to condition an accepted socket
+ **
+ ** Best effort, the same settings LLRP_Conn_startServerForUpper()
+ ** uses. If any don't work we do not declare defeat.
+ **
+ *****************************************************************************/
+
+static void
+conditionAccepted (
+  int                           Sock)
+{
+    int                         Flag;
+
+    Flag = 1;
+    setsockopt(Sock, IPPROTO_TCP, TCP_NODELAY, (void*)&Flag, sizeof Flag);
+
+    Flag = 1;
+    setsockopt(Sock, SOL_SOCKET, SO_KEEPALIVE, (void*)&Flag, sizeof Flag);
+
+    Flag = 5;
+    setsockopt(Sock, SOL_TCP, TCP_KEEPIDLE, (void*)&Flag, sizeof Flag);
+
+    Flag = 3;
+    setsockopt(Sock, SOL_TCP, TCP_KEEPINTVL, (void*)&Flag, sizeof Flag);
+
+    Flag = 2;
+    setsockopt(Sock, SOL_TCP, TCP_KEEPCNT, (void*)&Flag, sizeof Flag);
+}
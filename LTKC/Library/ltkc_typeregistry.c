@@ -23,6 +23,74 @@
 #include "ltkc_base.h"
 
 
+/*
+ * BEGIN forward decls
+ */
+
+static LLRP_tResultCode
+enrollStd (
+  const LLRP_tSTypeDescriptor * const *
+                                apPages[],
+  const LLRP_tSTypeDescriptor * pTypeDescriptor);
+
+static const LLRP_tSTypeDescriptor *
+lookupStd (
+  const LLRP_tSTypeDescriptor * const * const
+                                apPages[],
+  unsigned int                  TypeNum);
+
+static const LLRP_tSTypeDescriptor *
+scanStdByName (
+  const LLRP_tSTypeDescriptor * const * const
+                                apPages[],
+  const char *                  pElementName);
+
+static LLRP_tResultCode
+enrollCustom (
+  const LLRP_tSTypeDescriptor * const **
+                                papHash,
+  unsigned int *                pnHash,
+  const LLRP_tSTypeDescriptor * apList[],
+  unsigned int *                pnList,
+  unsigned int                  nListMax,
+  const LLRP_tSTypeDescriptor * pTypeDescriptor);
+
+static const LLRP_tSTypeDescriptor *
+lookupCustom (
+  const LLRP_tSTypeDescriptor * const *
+                                apHash,
+  unsigned int                  nHash,
+  unsigned int                  VendorID,
+  unsigned int                  TypeNum);
+
+static unsigned int
+customHash (
+  unsigned int                  VendorID,
+  unsigned int                  TypeNum);
+
+static const LLRP_tSTypeDescriptor *
+searchNameIndex (
+  const LLRP_tSTypeDescriptor * const *
+                                ppIndex,
+  unsigned int                  nIndex,
+  const char *                  pElementName);
+
+static llrp_bool_t
+isEnrolledHere (
+  const LLRP_tSTypeRegistry *   pTypeRegistry,
+  const LLRP_tSTypeDescriptor * pTypeDescriptor);
+
+static unsigned int
+probeCustom (
+  const LLRP_tSTypeDescriptor * const *
+                                apHash,
+  unsigned int                  nHash,
+  unsigned int                  VendorID,
+  unsigned int                  TypeNum);
+
+/*
+ * END forward decls
+ */
 
 
 /* Create a new TypeRegistry */
@@ -42,11 +110,39 @@ LLRP_TypeRegistry_construct (void)
     return pTypeRegistry;
 }
 
+/* Create a new TypeRegistry layered over another */
+LLRP_tSTypeRegistry *
+LLRP_TypeRegistry_constructLayered (
+  const LLRP_tSTypeRegistry *   pBase)
+{
+    LLRP_tSTypeRegistry *       pTypeRegistry;
+
+    pTypeRegistry = LLRP_TypeRegistry_construct();
+    if(NULL == pTypeRegistry)
+    {
+        return pTypeRegistry;
+    }
+
+    pTypeRegistry->pBase = pBase;
+
+    return pTypeRegistry;
+}
+
 /* Destruct a TypeRegistry */
 void
 LLRP_TypeRegistry_destruct (
   LLRP_tSTypeRegistry *         pTypeRegistry)
 {
+    unsigned int                iPage;
+
+    for(iPage = 0; iPage < LTKC_TYPE_PAGE_COUNT; iPage++)
+    {
+        free((void *) pTypeRegistry->apStdMessagePages[iPage]);
+        free((void *) pTypeRegistry->apStdParameterPages[iPage]);
+    }
+    free((void *) pTypeRegistry->apCustMessageHash);
+    free((void *) pTypeRegistry->apCustParameterHash);
+
     memset(pTypeRegistry, 0, sizeof *pTypeRegistry);
     free(pTypeRegistry);
 }
@@ -59,48 +155,130 @@ LLRP_TypeRegistry_enroll (
 {
     if(NULL == pTypeDescriptor->pVendorDescriptor)
     {
-        if(1023u < pTypeDescriptor->TypeNum)
-        {
-            return LLRP_RC_EnrollBadTypeNumber;
-        }
+        LLRP_tResultCode        rc;
 
         /*
          * Standard message or parameter
          */
         if(pTypeDescriptor->bIsMessage)
         {
-            pTypeRegistry->apStdMessageTypeDescriptors[
-                    pTypeDescriptor->TypeNum] = pTypeDescriptor;
+            rc = enrollStd(pTypeRegistry->apStdMessagePages,
+                    pTypeDescriptor);
         }
         else
         {
-            pTypeRegistry->apStdParameterTypeDescriptors[
-                    pTypeDescriptor->TypeNum] = pTypeDescriptor;
+            rc = enrollStd(pTypeRegistry->apStdParameterPages,
+                    pTypeDescriptor);
+        }
+        if(LLRP_RC_OK != rc)
+        {
+            return rc;
         }
     }
     else
     {
+        LLRP_tResultCode        rc;
+
         /*
          * Custom message or parameter
          */
         if(pTypeDescriptor->bIsMessage)
         {
-            unsigned int        ix;
-
-            ix = pTypeRegistry->nCustMessageTypeDescriptors++;
-            pTypeRegistry->apCustMessageTypeDescriptors[ix] =
-                        pTypeDescriptor;
+            rc = enrollCustom(&pTypeRegistry->apCustMessageHash,
+                    &pTypeRegistry->nCustMessageHash,
+                    pTypeRegistry->apCustMessageTypeDescriptors,
+                    &pTypeRegistry->nCustMessageTypeDescriptors,
+                    LTKC_MAX_CUSTOM_MESSAGE, pTypeDescriptor);
         }
         else
         {
-            unsigned int        ix;
+            rc = enrollCustom(&pTypeRegistry->apCustParameterHash,
+                    &pTypeRegistry->nCustParameterHash,
+                    pTypeRegistry->apCustParameterTypeDescriptors,
+                    &pTypeRegistry->nCustParameterTypeDescriptors,
+                    LTKC_MAX_CUSTOM_PARAMETER, pTypeDescriptor);
+        }
+        if(LLRP_RC_OK != rc)
+        {
+            return rc;
+        }
+    }
+
+    pTypeRegistry->nEnrolledTypeDescriptors++;
+
+    return LLRP_RC_OK;
+}
 
-            ix = pTypeRegistry->nCustParameterTypeDescriptors++;
-            pTypeRegistry->apCustParameterTypeDescriptors[ix] =
-                        pTypeDescriptor;
+/*
+ * Add a table of type descriptors, sorted by name, for
+ * lookupByName() to binary search. Each is generated along with
+ * the LLRP_enroll...TypesIntoRegistry() function that calls this
+ * after enrolling the types it lists. The table is not copied.
+ *
+ * Every type in the table should be enrolled too. Only those that
+ * are, here and under this very descriptor, and that no earlier
+ * table holds, count towards nIndexedTypeDescriptors. So it reaches
+ * nEnrolledTypeDescriptors only when every type enrolled is in an
+ * index, whatever was refused or enrolled by hand. A table that is
+ * not in strcmp() order, or one too many tables, is refused;
+ * lookupByName() still finds those types by scanning.
+ */
+LLRP_tResultCode
+LLRP_TypeRegistry_enrollNameIndex (
+  LLRP_tSTypeRegistry *         pTypeRegistry,
+  const LLRP_tSTypeDescriptor * const *
+                                ppTypeDescriptors,
+  unsigned int                  nTypeDescriptor)
+{
+    unsigned int                i;
+    unsigned int                ix;
+    unsigned int                nIndexed = 0;
+
+    if(LTKC_MAX_NAME_INDEX <= pTypeRegistry->nNameIndex)
+    {
+        return LLRP_RC_MiscError;
+    }
+
+    for(i = 1; i < nTypeDescriptor; i++)
+    {
+        if(0 <= strcmp(ppTypeDescriptors[i-1]->pName,
+                       ppTypeDescriptors[i]->pName))
+        {
+            return LLRP_RC_MiscError;
         }
     }
-    
+
+    for(i = 0; i < nTypeDescriptor; i++)
+    {
+        const LLRP_tSTypeDescriptor *pTypeDescriptor;
+
+        pTypeDescriptor = ppTypeDescriptors[i];
+        if(!isEnrolledHere(pTypeRegistry, pTypeDescriptor))
+        {
+            continue;
+        }
+
+        for(ix = 0; ix < pTypeRegistry->nNameIndex; ix++)
+        {
+            if(pTypeDescriptor == searchNameIndex(
+                    pTypeRegistry->appNameIndex[ix],
+                    pTypeRegistry->anNameIndex[ix],
+                    pTypeDescriptor->pName))
+            {
+                break;
+            }
+        }
+        if(ix >= pTypeRegistry->nNameIndex)
+        {
+            nIndexed++;
+        }
+    }
+
+    ix = pTypeRegistry->nNameIndex++;
+    pTypeRegistry->appNameIndex[ix] = ppTypeDescriptors;
+    pTypeRegistry->anNameIndex[ix] = nTypeDescriptor;
+    pTypeRegistry->nIndexedTypeDescriptors += nIndexed;
+
     return LLRP_RC_OK;
 }
 
@@ -110,12 +288,18 @@ LLRP_TypeRegistry_lookupMessage (
   const LLRP_tSTypeRegistry *   pTypeRegistry,
   unsigned int                  MessageTypeNum)
 {
-    if(1023u < MessageTypeNum)
+    const LLRP_tSTypeDescriptor *pTypeDescriptor;
+
+    pTypeDescriptor = lookupStd(pTypeRegistry->apStdMessagePages,
+        MessageTypeNum);
+
+    if(NULL == pTypeDescriptor && NULL != pTypeRegistry->pBase)
     {
-        return NULL;
+        return LLRP_TypeRegistry_lookupMessage(pTypeRegistry->pBase,
+            MessageTypeNum);
     }
 
-    return pTypeRegistry->apStdMessageTypeDescriptors[MessageTypeNum];
+    return pTypeDescriptor;
 }
 
 /* Lookup a standard parameter type descriptor. NULL=>not found */
@@ -124,12 +308,18 @@ LLRP_TypeRegistry_lookupParameter (
   const LLRP_tSTypeRegistry *   pTypeRegistry,
   unsigned int                  ParameterTypeNum)
 {
-    if(1023u < ParameterTypeNum)
+    const LLRP_tSTypeDescriptor *pTypeDescriptor;
+
+    pTypeDescriptor = lookupStd(pTypeRegistry->apStdParameterPages,
+        ParameterTypeNum);
+
+    if(NULL == pTypeDescriptor && NULL != pTypeRegistry->pBase)
     {
-        return NULL;
+        return LLRP_TypeRegistry_lookupParameter(pTypeRegistry->pBase,
+            ParameterTypeNum);
     }
 
-    return pTypeRegistry->apStdParameterTypeDescriptors[ParameterTypeNum];
+    return pTypeDescriptor;
 }
 
 /* Lookup a custom message type descriptor. NULL=>not found */
@@ -140,19 +330,17 @@ LLRP_TypeRegistry_lookupCustomMessage (
   unsigned int                  MessageSubTypeNum)
 {
     const LLRP_tSTypeDescriptor *pTypeDescriptor;
-    unsigned int                ix;
 
-    for(ix = 0; ix < pTypeRegistry->nCustMessageTypeDescriptors; ix++)
+    pTypeDescriptor = lookupCustom(pTypeRegistry->apCustMessageHash,
+        pTypeRegistry->nCustMessageHash, VendorID, MessageSubTypeNum);
+
+    if(NULL == pTypeDescriptor && NULL != pTypeRegistry->pBase)
     {
-        pTypeDescriptor = pTypeRegistry->apCustMessageTypeDescriptors[ix];
-        if(VendorID == pTypeDescriptor->pVendorDescriptor->VendorID &&
-           MessageSubTypeNum == pTypeDescriptor->TypeNum)
-        {
-            return pTypeDescriptor;
-        }
+        return LLRP_TypeRegistry_lookupCustomMessage(pTypeRegistry->pBase,
+            VendorID, MessageSubTypeNum);
     }
 
-    return NULL;
+    return pTypeDescriptor;
 }
 
 /* Lookup a custom parameter type descriptor. NULL=>not found */
@@ -163,19 +351,17 @@ LLRP_TypeRegistry_lookupCustomParameter (
   unsigned int                  ParameterSubTypeNum)
 {
     const LLRP_tSTypeDescriptor *pTypeDescriptor;
-    unsigned int                ix;
 
-    for(ix = 0; ix < pTypeRegistry->nCustParameterTypeDescriptors; ix++)
+    pTypeDescriptor = lookupCustom(pTypeRegistry->apCustParameterHash,
+        pTypeRegistry->nCustParameterHash, VendorID, ParameterSubTypeNum);
+
+    if(NULL == pTypeDescriptor && NULL != pTypeRegistry->pBase)
     {
-        pTypeDescriptor = pTypeRegistry->apCustParameterTypeDescriptors[ix];
-        if(VendorID == pTypeDescriptor->pVendorDescriptor->VendorID &&
-           ParameterSubTypeNum == pTypeDescriptor->TypeNum)
-        {
-            return pTypeDescriptor;
-        }
+        return LLRP_TypeRegistry_lookupCustomParameter(pTypeRegistry->pBase,
+            VendorID, ParameterSubTypeNum);
     }
 
-    return NULL;
+    return pTypeDescriptor;
 }
 
 /* Lookup a type descriptor by name. NULL=>not found */
@@ -187,34 +373,86 @@ LLRP_TypeRegistry_lookupByName (
     unsigned int                i;
     const LLRP_tSTypeDescriptor *pTypeDescriptor;
 
-    for(i = 0; i < 1024u; i++)
+    /*
+     * Binary search the name indexes first. A type found there
+     * only counts if it is the one enrolled under its type number
+     * (and vendor); one enrolled over it later is found by the
+     * scans below, as are types enrolled one at a time. If there
+     * are no such types, the name is not here and the scans are
+     * skipped, which keeps bad input from being slow too.
+     */
+    for(i = 0; i < pTypeRegistry->nNameIndex; i++)
     {
-        pTypeDescriptor = pTypeRegistry->apStdMessageTypeDescriptors[i];
+        pTypeDescriptor = searchNameIndex(pTypeRegistry->appNameIndex[i],
+            pTypeRegistry->anNameIndex[i], pElementName);
         if(NULL == pTypeDescriptor)
         {
             continue;
         }
 
-        if(0 == strcmp(pTypeDescriptor->pName, pElementName))
+        if(NULL != pTypeDescriptor->pVendorDescriptor)
         {
-            return pTypeDescriptor;
+            const LLRP_tSTypeDescriptor *pEnrolled;
+
+            if(pTypeDescriptor->bIsMessage)
+            {
+                pEnrolled = LLRP_TypeRegistry_lookupCustomMessage(
+                    pTypeRegistry,
+                    pTypeDescriptor->pVendorDescriptor->VendorID,
+                    pTypeDescriptor->TypeNum);
+            }
+            else
+            {
+                pEnrolled = LLRP_TypeRegistry_lookupCustomParameter(
+                    pTypeRegistry,
+                    pTypeDescriptor->pVendorDescriptor->VendorID,
+                    pTypeDescriptor->TypeNum);
+            }
+            if(pEnrolled == pTypeDescriptor)
+            {
+                return pTypeDescriptor;
+            }
         }
-    }
-
-    for(i = 0; i < 1024u; i++)
-    {
-        pTypeDescriptor = pTypeRegistry->apStdParameterTypeDescriptors[i];
-        if(NULL == pTypeDescriptor)
+        else if(pTypeDescriptor->bIsMessage)
         {
-            continue;
+            if(pTypeDescriptor == LLRP_TypeRegistry_lookupMessage(
+                    pTypeRegistry, pTypeDescriptor->TypeNum))
+            {
+                return pTypeDescriptor;
+            }
         }
-
-        if(0 == strcmp(pTypeDescriptor->pName, pElementName))
+        else
         {
-            return pTypeDescriptor;
+            if(pTypeDescriptor == LLRP_TypeRegistry_lookupParameter(
+                    pTypeRegistry, pTypeDescriptor->TypeNum))
+            {
+                return pTypeDescriptor;
+            }
         }
     }
 
+    if(pTypeRegistry->nIndexedTypeDescriptors >=
+                pTypeRegistry->nEnrolledTypeDescriptors)
+    {
+        return (NULL == pTypeRegistry->pBase) ? NULL :
+            LLRP_TypeRegistry_lookupByName(pTypeRegistry->pBase,
+                pElementName);
+    }
+
+    pTypeDescriptor = scanStdByName(pTypeRegistry->apStdMessagePages,
+        pElementName);
+    if(NULL != pTypeDescriptor)
+    {
+        return pTypeDescriptor;
+    }
+
+    pTypeDescriptor = scanStdByName(pTypeRegistry->apStdParameterPages,
+        pElementName);
+    if(NULL != pTypeDescriptor)
+    {
+        return pTypeDescriptor;
+    }
+
     /*  custom messages */
    for(i = 0; i < pTypeRegistry->nCustMessageTypeDescriptors; i++)
     {
@@ -238,6 +476,294 @@ LLRP_TypeRegistry_lookupByName (
     }
     
 
+    return (NULL == pTypeRegistry->pBase) ? NULL :
+        LLRP_TypeRegistry_lookupByName(pTypeRegistry->pBase, pElementName);
+}
+
+/*
+ * Put a standard type in its page, making the page if need be.
+ * Only registries enrolled into have pages to write to; those
+ * of the const registries are never reached from here.
+ */
+static LLRP_tResultCode
+enrollStd (
+  const LLRP_tSTypeDescriptor * const *
+                                apPages[],
+  const LLRP_tSTypeDescriptor * pTypeDescriptor)
+{
+    unsigned int                TypeNum = pTypeDescriptor->TypeNum;
+    const LLRP_tSTypeDescriptor **ppPage;
+
+    ppPage = (const LLRP_tSTypeDescriptor **)
+                apPages[TypeNum >> LTKC_TYPE_PAGE_SHIFT];
+    if(NULL == ppPage)
+    {
+        ppPage = calloc(LTKC_TYPE_PAGE_SIZE, sizeof *ppPage);
+        if(NULL == ppPage)
+        {
+            return LLRP_RC_EnrollAllocationFailed;
+        }
+        apPages[TypeNum >> LTKC_TYPE_PAGE_SHIFT] = ppPage;
+    }
+
+    ppPage[TypeNum & (LTKC_TYPE_PAGE_SIZE - 1u)] = pTypeDescriptor;
+
+    return LLRP_RC_OK;
+}
+
+/* Find a standard type by number. NULL=>not here */
+static const LLRP_tSTypeDescriptor *
+lookupStd (
+  const LLRP_tSTypeDescriptor * const * const
+                                apPages[],
+  unsigned int                  TypeNum)
+{
+    const LLRP_tSTypeDescriptor * const *ppPage;
+
+    if(LTKC_TYPE_PAGE_COUNT <= (TypeNum >> LTKC_TYPE_PAGE_SHIFT))
+    {
+        return NULL;
+    }
+
+    ppPage = apPages[TypeNum >> LTKC_TYPE_PAGE_SHIFT];
+    if(NULL == ppPage)
+    {
+        return NULL;
+    }
+
+    return ppPage[TypeNum & (LTKC_TYPE_PAGE_SIZE - 1u)];
+}
+
+/* Find a standard type by name, the slow way. NULL=>not here */
+static const LLRP_tSTypeDescriptor *
+scanStdByName (
+  const LLRP_tSTypeDescriptor * const * const
+                                apPages[],
+  const char *                  pElementName)
+{
+    unsigned int                iPage;
+    unsigned int                i;
+
+    for(iPage = 0; iPage < LTKC_TYPE_PAGE_COUNT; iPage++)
+    {
+        const LLRP_tSTypeDescriptor * const *ppPage = apPages[iPage];
+
+        if(NULL == ppPage)
+        {
+            continue;
+        }
+
+        for(i = 0; i < LTKC_TYPE_PAGE_SIZE; i++)
+        {
+            if(NULL != ppPage[i] &&
+               0 == strcmp(ppPage[i]->pName, pElementName))
+            {
+                return ppPage[i];
+            }
+        }
+    }
+
     return NULL;
 }
 
+/* Binary search a name index. NULL=>not in it */
+static const LLRP_tSTypeDescriptor *
+searchNameIndex (
+  const LLRP_tSTypeDescriptor * const *
+                                ppIndex,
+  unsigned int                  nIndex,
+  const char *                  pElementName)
+{
+    unsigned int                iLo = 0;
+    unsigned int                iHi = nIndex;
+
+    while(iLo < iHi)
+    {
+        unsigned int            iMid = iLo + (iHi - iLo) / 2u;
+        int                     Cmp;
+
+        Cmp = strcmp(pElementName, ppIndex[iMid]->pName);
+        if(0 < Cmp)
+        {
+            iLo = iMid + 1u;
+        }
+        else if(0 > Cmp)
+        {
+            iHi = iMid;
+        }
+        else
+        {
+            return ppIndex[iMid];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Is this the type enrolled in this registry, not its base,
+ * under the descriptor's number (and vendor)?
+ */
+static llrp_bool_t
+isEnrolledHere (
+  const LLRP_tSTypeRegistry *   pTypeRegistry,
+  const LLRP_tSTypeDescriptor * pTypeDescriptor)
+{
+    const LLRP_tSTypeDescriptor *pEnrolled;
+
+    if(NULL != pTypeDescriptor->pVendorDescriptor)
+    {
+        unsigned int            VendorID;
+
+        VendorID = pTypeDescriptor->pVendorDescriptor->VendorID;
+        if(pTypeDescriptor->bIsMessage)
+        {
+            pEnrolled = lookupCustom(pTypeRegistry->apCustMessageHash,
+                pTypeRegistry->nCustMessageHash,
+                VendorID, pTypeDescriptor->TypeNum);
+        }
+        else
+        {
+            pEnrolled = lookupCustom(pTypeRegistry->apCustParameterHash,
+                pTypeRegistry->nCustParameterHash,
+                VendorID, pTypeDescriptor->TypeNum);
+        }
+    }
+    else if(pTypeDescriptor->bIsMessage)
+    {
+        pEnrolled = lookupStd(pTypeRegistry->apStdMessagePages,
+            pTypeDescriptor->TypeNum);
+    }
+    else
+    {
+        pEnrolled = lookupStd(pTypeRegistry->apStdParameterPages,
+            pTypeDescriptor->TypeNum);
+    }
+
+    return (pEnrolled == pTypeDescriptor) ? TRUE : FALSE;
+}
+
+/*
+ * Enroll a custom type into a hash and the in-order list. The hash
+ * is doubled, starting at LTKC_CUSTOM_HASH_MIN, whenever the type
+ * would make it more than half full, and refilled from the list so
+ * its slots come out as those of the generated const registries.
+ */
+static LLRP_tResultCode
+enrollCustom (
+  const LLRP_tSTypeDescriptor * const **
+                                papHash,
+  unsigned int *                pnHash,
+  const LLRP_tSTypeDescriptor * apList[],
+  unsigned int *                pnList,
+  unsigned int                  nListMax,
+  const LLRP_tSTypeDescriptor * pTypeDescriptor)
+{
+    const LLRP_tSTypeDescriptor **apHash;
+    unsigned int                nHash = *pnHash;
+    unsigned int                VendorID;
+    unsigned int                iHash;
+    unsigned int                i;
+
+    VendorID = pTypeDescriptor->pVendorDescriptor->VendorID;
+
+    if(nListMax <= *pnList)
+    {
+        return LLRP_RC_EnrollTooManyTypes;
+    }
+
+    if(NULL != lookupCustom(*papHash, nHash, VendorID,
+            pTypeDescriptor->TypeNum))
+    {
+        return LLRP_RC_EnrollDuplicateType;
+    }
+
+    apHash = (const LLRP_tSTypeDescriptor **) *papHash;
+    if(2u * (*pnList + 1u) > nHash)
+    {
+        nHash = (0 == nHash) ? LTKC_CUSTOM_HASH_MIN : 2u * nHash;
+        apHash = calloc(nHash, sizeof *apHash);
+        if(NULL == apHash)
+        {
+            return LLRP_RC_EnrollAllocationFailed;
+        }
+        for(i = 0; i < *pnList; i++)
+        {
+            iHash = probeCustom(apHash, nHash,
+                apList[i]->pVendorDescriptor->VendorID, apList[i]->TypeNum);
+            apHash[iHash] = apList[i];
+        }
+        free((void *) *papHash);
+        *papHash = apHash;
+        *pnHash = nHash;
+    }
+
+    iHash = probeCustom(apHash, nHash, VendorID, pTypeDescriptor->TypeNum);
+    apHash[iHash] = pTypeDescriptor;
+
+    apList[(*pnList)++] = pTypeDescriptor;
+
+    return LLRP_RC_OK;
+}
+
+/* Find a custom type in a hash. NULL=>not here */
+static const LLRP_tSTypeDescriptor *
+lookupCustom (
+  const LLRP_tSTypeDescriptor * const *
+                                apHash,
+  unsigned int                  nHash,
+  unsigned int                  VendorID,
+  unsigned int                  TypeNum)
+{
+    if(0 == nHash)
+    {
+        return NULL;
+    }
+
+    return apHash[probeCustom(apHash, nHash, VendorID, TypeNum)];
+}
+
+/*
+ * Hash the vendor and subtype of a custom type. Each vendor's
+ * subtypes, mostly numbered from 0 up, land in a run of slots of
+ * their own. ltkc_gen_c.xslt (CustomHashSlots) works out the
+ * slots of the const registries with this same sum, so the two
+ * must change together.
+ */
+static unsigned int
+customHash (
+  unsigned int                  VendorID,
+  unsigned int                  TypeNum)
+{
+    return VendorID * 1031u + TypeNum;
+}
+
+/*
+ * Find the slot in a custom hash (nHash a power of two) that holds
+ * the type with this vendor and subtype, else the empty slot where
+ * it would go.
+ */
+static unsigned int
+probeCustom (
+  const LLRP_tSTypeDescriptor * const *
+                                apHash,
+  unsigned int                  nHash,
+  unsigned int                  VendorID,
+  unsigned int                  TypeNum)
+{
+    unsigned int                ix;
+
+    ix = customHash(VendorID, TypeNum) & (nHash - 1u);
+    for(;;)
+    {
+        const LLRP_tSTypeDescriptor *pTypeDescriptor = apHash[ix];
+
+        if(NULL == pTypeDescriptor ||
+           (VendorID == pTypeDescriptor->pVendorDescriptor->VendorID &&
+            TypeNum == pTypeDescriptor->TypeNum))
+        {
+            return ix;
+        }
+        ix = (ix + 1u) & (nHash - 1u);
+    }
+}
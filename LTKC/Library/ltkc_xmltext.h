@@ -82,6 +82,18 @@ LLRP_XMLTextEncoder_construct (
   unsigned char *               pBuffer,
   unsigned int                  nBuffer);
 
+extern void
+LLRP_XMLTextEncoder_init (
+  LLRP_tSXMLTextEncoder *       pEncoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+extern void
+LLRP_XMLTextEncoder_reset (
+  LLRP_tSXMLTextEncoder *       pEncoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
 LLRP_tSLibXMLTextDecoder *
 LLRP_LibXMLTextDecoder_construct_file (
   const LLRP_tSTypeRegistry *   pTypeRegistry,
@@ -37,10 +37,26 @@ LLRP_XMLTextEncoder_construct (
   unsigned char *               pBuffer,
   unsigned int                  nBuffer);
 
+void
+LLRP_XMLTextEncoder_init (
+  LLRP_tSXMLTextEncoder *       pEncoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+void
+LLRP_XMLTextEncoder_reset (
+  LLRP_tSXMLTextEncoder *       pEncoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
 static void
 encoderDestruct (
   LLRP_tSEncoder *              pBaseEncoder);
 
+static void
+encoderFinish (
+  LLRP_tSEncoder *              pBaseEncoder);
+
 static void
 encodeElement (
   LLRP_tSEncoder *              pBaseEncoder,
@@ -324,6 +340,17 @@ s_XMLTextEncoderOps =
     .pfEncodeElement            = encodeElement,
 };
 
+/*
+ * For an encoder in storage the caller owns,
+ * see LLRP_XMLTextEncoder_init()
+ */
+static LLRP_tSEncoderOps
+s_XMLTextEncoderInPlaceOps =
+{
+    .pfDestruct                 = encoderFinish,
+    .pfEncodeElement            = encodeElement,
+};
+
 static LLRP_tSEncoderStreamOps
 s_XMLTextEncoderStreamOps =
 {
@@ -383,15 +410,47 @@ LLRP_XMLTextEncoder_construct (
         return pEncoder;
     }
 
-    memset(pEncoder, 0, sizeof *pEncoder);
+    LLRP_XMLTextEncoder_init(pEncoder, pBuffer, nBuffer);
 
     pEncoder->encoderHdr.pEncoderOps = &s_XMLTextEncoderOps;
+
+    return pEncoder;
+}
+
+/*
+ * Initialize an encoder the caller has storage for, embedded
+ * in something else or on the stack. LLRP_Encoder_destruct()
+ * on it is allowed but frees nothing.
+ */
+void
+LLRP_XMLTextEncoder_init (
+  LLRP_tSXMLTextEncoder *       pEncoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    memset(pEncoder, 0, sizeof *pEncoder);
+
+    pEncoder->encoderHdr.pEncoderOps = &s_XMLTextEncoderInPlaceOps;
+
+    LLRP_XMLTextEncoder_reset(pEncoder, pBuffer, nBuffer);
+}
+
+/*
+ * Point an encoder at a buffer for the next message,
+ * clearing the error details, position and overflow.
+ */
+void
+LLRP_XMLTextEncoder_reset (
+  LLRP_tSXMLTextEncoder *       pEncoder,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    LLRP_Error_clear(&pEncoder->encoderHdr.ErrorDetails);
+
     pEncoder->pBuffer = pBuffer;
     pEncoder->nBuffer = nBuffer;
     pEncoder->iNext   = 0;
     pEncoder->bOverflow = 0;
-
-    return pEncoder;
 }
 
 static void
@@ -404,6 +463,13 @@ encoderDestruct (
     free(pEncoder);
 }
 
+static void
+encoderFinish (
+  LLRP_tSEncoder *              pBaseEncoder)
+{
+    /* Nothing to free, the storage is the caller's */
+}
+
 static void
 encodeElement (
   LLRP_tSEncoder *              pBaseEncoder,
@@ -1526,7 +1592,7 @@ LLRP_toXMLString (
   char *                        pBuffer,
   int                           nBuffer)
 {
-    LLRP_tSXMLTextEncoder *     pXMLEncoder;
+    LLRP_tSXMLTextEncoder       XMLEncoder;
     LLRP_tSEncoder *            pEncoder;
     const LLRP_tSErrorDetails * pError;
 
@@ -1540,19 +1606,14 @@ LLRP_toXMLString (
     }
 
     /*
-     * Construct an XML encoder
+     * An XML encoder on the stack, nothing to allocate
      */
-    pXMLEncoder = LLRP_XMLTextEncoder_construct((unsigned char *)pBuffer, nBuffer);
-    if(NULL == pXMLEncoder)
-    {
-        strcpy(pBuffer, "ERROR: XMLTextEncoder_construct failed\n");
-        return LLRP_RC_MiscError;
-    }
+    LLRP_XMLTextEncoder_init(&XMLEncoder, (unsigned char *)pBuffer, nBuffer);
 
     /*
      * Essentially cast the XMLEncoder as a generic encoder.
      */
-    pEncoder = &pXMLEncoder->encoderHdr;
+    pEncoder = &XMLEncoder.encoderHdr;
 
     /*
      * Now let the encoding mechanism do its thing.
@@ -1572,26 +1633,18 @@ LLRP_toXMLString (
             pElement->pType->pName,
             pError->pWhatStr ? pError->pWhatStr : "no reason given");
 
-        LLRP_Encoder_destruct(pEncoder);
-
         return pError->eResultCode;
     }
 
     /*
      * Check if the XML fit in the buffer.
      */
-    if(pXMLEncoder->bOverflow)
+    if(XMLEncoder.bOverflow)
     {
         strcpy(pBuffer, "ERROR: Buffer overflow\n");
-        LLRP_Encoder_destruct(pEncoder);
         return LLRP_RC_MiscError;
     }
 
-    /*
-     * Done with the XML encoder.
-     */
-    LLRP_Encoder_destruct(pEncoder);
-
     return LLRP_RC_OK;
 }
 
@@ -0,0 +1,587 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  dx401.c
+ **
+ ** @brief Test of LTKC receive timeout accuracy over loopback TCP
+ **
+ ** This is diagnostic 401 for the LLRP Tool Kit for C (LTKC).
+ **
+ ** DX401 needs no reader. It connects a LLRP_tSConnection to
+ ** itself through a 127.0.0.1 TCP socket and a child process
+ ** that plays the peer. Each case times a receive that must
+ ** time out, and passes when the elapsed time is within
+ ** 10 ms of what was asked for.
+ **     - Idle socket, recvMessage() for 20, 50 and 100 ms
+ **     - A frame that trickles in a byte every 5 ms and
+ **       never completes
+ **     - recvResponse() for a MessageID that never comes
+ **       while other messages arrive every 5 ms
+ **     - A peek (nMaxMS 0) returns at once
+ **
+ ** This program can be run with one verbose option (-v)
+ ** to print the timing of every case.
+ **
+ ** Exit status is 0 when every case passes.
+ **
+ *****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "../Library/ltkc.h"
+
+
+/*
+ * BEGIN forward declarations
+ */
+int
+main (
+  int                           ac,
+  char *                        av[]);
+
+void
+usage (
+  char *                        pProgName);
+
+int
+run (void);
+
+int
+openLoopbackPair (
+  int *                         pConnFd,
+  int *                         pPeerFd);
+
+pid_t
+startPeer (
+  int                           PeerFd,
+  int                           ePeerMode);
+
+void
+stopPeer (
+  pid_t                         Pid);
+
+int
+timeRecv (
+  const char *                  pCaseName,
+  int                           ePeerMode,
+  int                           nMaxMS,
+  llrp_bool_t                   bResponse);
+
+unsigned int
+encodeReport (
+  llrp_u32_t                    MessageID,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+double
+nowMS (void);
+/*
+ * END forward declarations
+ */
+
+
+/*
+ * What the peer process does while a case runs
+ */
+enum
+{
+    PEER_IDLE,                  /* Send nothing */
+    PEER_TRICKLE,               /* One byte of a frame every 5 ms */
+    PEER_CHATTER,               /* A whole unrelated frame every 5 ms */
+};
+
+/*
+ * Allowed difference between asked for and actual timeout
+ */
+#define TOLERANCE_MS    (10.0)
+
+/*
+ * Global variables
+ */
+int                             g_Verbose;
+LLRP_tSTypeRegistry *           g_pTypeRegistry;
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Command main routine
+ **
+ ** Command synopsis:
+ **
+ **     dx401 [-v]
+ **
+ ** @exitcode   0               Everything *seemed* to work.
+ **             1               Bad usage
+ **             2               Run failed
+ **
+ *****************************************************************************/
+
+int
+main (
+  int                           ac,
+  char *                        av[])
+{
+    int                         rc;
+
+    if(ac == 2 && 0 == strcmp("-v", av[1]))
+    {
+        g_Verbose = 1;
+    }
+    else if(ac != 1)
+    {
+        usage(av[0]);
+        /* no return */
+    }
+
+    /*
+     * A peer exiting early must not kill us with SIGPIPE.
+     */
+    signal(SIGPIPE, SIG_IGN);
+
+    rc = run();
+
+    printf("INFO: Done\n");
+
+    exit(rc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Print usage message and exit
+ **
+ ** @param[in]  pProgName       Program name.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+usage (
+  char *                        pProgName)
+{
+    printf("Usage: %s [-v]\n", pProgName);
+    printf("\n");
+    printf("Each -v increases verbosity level\n");
+    exit(1);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Run every timing case
+ **
+ ** @return     0               Every case passed
+ **             2               Something failed
+ **
+ *****************************************************************************/
+
+int
+run (void)
+{
+    int                         nFail = 0;
+
+    g_pTypeRegistry = LLRP_getTheTypeRegistry();
+    if(NULL == g_pTypeRegistry)
+    {
+        printf("ERROR: getTheTypeRegistry failed\n");
+        return 2;
+    }
+
+    nFail += timeRecv("idle  20ms", PEER_IDLE, 20, FALSE);
+    nFail += timeRecv("idle  50ms", PEER_IDLE, 50, FALSE);
+    nFail += timeRecv("idle 100ms", PEER_IDLE, 100, FALSE);
+    nFail += timeRecv("trickle 50ms", PEER_TRICKLE, 50, FALSE);
+    nFail += timeRecv("chatter 50ms", PEER_CHATTER, 50, TRUE);
+    nFail += timeRecv("peek 0ms", PEER_IDLE, 0, FALSE);
+
+    LLRP_TypeRegistry_destruct(g_pTypeRegistry);
+
+    if(0 != nFail)
+    {
+        printf("ERROR: %d case(s) failed\n", nFail);
+        return 2;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Time one receive that is expected to time out
+ **
+ ** @param[in]  pCaseName       For messages
+ ** @param[in]  ePeerMode       PEER_IDLE, PEER_TRICKLE, PEER_CHATTER
+ ** @param[in]  nMaxMS          Timeout handed to the receive
+ ** @param[in]  bResponse       TRUE => recvResponse(), else recvMessage()
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+timeRecv (
+  const char *                  pCaseName,
+  int                           ePeerMode,
+  int                           nMaxMS,
+  llrp_bool_t                   bResponse)
+{
+    LLRP_tSConnection *         pConn;
+    LLRP_tSMessage *            pMessage;
+    const LLRP_tSErrorDetails * pError;
+    int                         ConnFd;
+    int                         PeerFd;
+    pid_t                       Pid;
+    double                      StartMS;
+    double                      ElapsedMS;
+    int                         nFail = 0;
+
+    pConn = LLRP_Conn_construct(g_pTypeRegistry, 32u*1024u);
+    if(NULL == pConn)
+    {
+        printf("ERROR: %s: Conn_construct failed\n", pCaseName);
+        return 1;
+    }
+
+    if(0 != openLoopbackPair(&ConnFd, &PeerFd))
+    {
+        printf("ERROR: %s: loopback socket failed\n", pCaseName);
+        LLRP_Conn_destruct(pConn);
+        return 1;
+    }
+
+    /*
+     * The connection is normally opened by name. Here it is
+     * simply handed the already connected socket.
+     */
+    pConn->fd = ConnFd;
+
+    Pid = startPeer(PeerFd, ePeerMode);
+    close(PeerFd);
+
+    /*
+     * Let the peer get going so the receive really
+     * sees the traffic.
+     */
+    usleep(10000);
+
+    StartMS = nowMS();
+    if(bResponse)
+    {
+        /*
+         * Ask for a MessageID the peer never sends
+         */
+        pMessage = LLRP_Conn_recvResponse(pConn, nMaxMS, NULL, 0xFFFFFFFFu);
+    }
+    else
+    {
+        pMessage = LLRP_Conn_recvMessage(pConn, nMaxMS);
+    }
+    ElapsedMS = nowMS() - StartMS;
+
+    stopPeer(Pid);
+
+    pError = LLRP_Conn_getRecvError(pConn);
+    if(NULL != pMessage)
+    {
+        printf("ERROR: %s: unexpected message\n", pCaseName);
+        LLRP_Element_destruct(&pMessage->elementHdr);
+        nFail = 1;
+    }
+    else if(LLRP_RC_RecvTimeout != pError->eResultCode)
+    {
+        printf("ERROR: %s: expected timeout, got %d %s\n", pCaseName,
+            pError->eResultCode,
+            pError->pWhatStr ? pError->pWhatStr : "");
+        nFail = 1;
+    }
+    else if(ElapsedMS - nMaxMS > TOLERANCE_MS ||
+            nMaxMS - ElapsedMS > TOLERANCE_MS)
+    {
+        printf("ERROR: %s: asked %d ms, took %.2f ms\n", pCaseName,
+            nMaxMS, ElapsedMS);
+        nFail = 1;
+    }
+
+    if(g_Verbose || 0 != nFail)
+    {
+        printf("INFO: %-14s %s  asked %3d ms, took %7.2f ms\n",
+            pCaseName, nFail ? "FAIL" : "PASS", nMaxMS, ElapsedMS);
+    }
+
+    LLRP_Conn_closeConnectionToReader(pConn);
+    LLRP_Conn_destruct(pConn);
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Make a connected pair of TCP sockets on 127.0.0.1
+ **
+ ** The listener is bound to an ephemeral port and closed as soon
+ ** as the connection is accepted.
+ **
+ ** @param[out] pConnFd         For the connection under test
+ ** @param[out] pPeerFd         For the peer process
+ **
+ ** @return     0               Made
+ **             -1              Failed
+ **
+ *****************************************************************************/
+
+int
+openLoopbackPair (
+  int *                         pConnFd,
+  int *                         pPeerFd)
+{
+    struct sockaddr_in          Sin;
+    socklen_t                   nSin = sizeof Sin;
+    int                         ListenFd;
+    int                         ConnFd;
+    int                         PeerFd;
+
+    memset(&Sin, 0, sizeof Sin);
+    Sin.sin_family = AF_INET;
+    Sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    Sin.sin_port = 0;
+
+    ListenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if(0 > ListenFd)
+    {
+        return -1;
+    }
+    if(0 > bind(ListenFd, (struct sockaddr *)&Sin, sizeof Sin) ||
+       0 > listen(ListenFd, 1) ||
+       0 > getsockname(ListenFd, (struct sockaddr *)&Sin, &nSin))
+    {
+        close(ListenFd);
+        return -1;
+    }
+
+    ConnFd = socket(AF_INET, SOCK_STREAM, 0);
+    if(0 > ConnFd)
+    {
+        close(ListenFd);
+        return -1;
+    }
+    if(0 > connect(ConnFd, (struct sockaddr *)&Sin, sizeof Sin))
+    {
+        close(ConnFd);
+        close(ListenFd);
+        return -1;
+    }
+
+    PeerFd = accept(ListenFd, NULL, NULL);
+    close(ListenFd);
+    if(0 > PeerFd)
+    {
+        close(ConnFd);
+        return -1;
+    }
+
+    *pConnFd = ConnFd;
+    *pPeerFd = PeerFd;
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Fork the peer process
+ **
+ ** The peer writes according to ePeerMode until it is killed.
+ **
+ ** @param[in]  PeerFd          Socket the peer writes
+ ** @param[in]  ePeerMode       PEER_IDLE, PEER_TRICKLE, PEER_CHATTER
+ **
+ ** @return     Pid of the peer, <0 on failure
+ **
+ *****************************************************************************/
+
+pid_t
+startPeer (
+  int                           PeerFd,
+  int                           ePeerMode)
+{
+    unsigned char               aFrame[4096];
+    unsigned int                nFrame;
+    unsigned int                iNext = 0;
+    llrp_u32_t                  MessageID = 1;
+    pid_t                       Pid;
+
+    Pid = fork();
+    if(0 != Pid)
+    {
+        return Pid;
+    }
+
+    nFrame = encodeReport(MessageID, aFrame, sizeof aFrame);
+
+    for(;;)
+    {
+        switch(ePeerMode)
+        {
+        default:
+        case PEER_IDLE:
+            pause();
+            break;
+
+        case PEER_TRICKLE:
+            /*
+             * Never send the last byte so the frame
+             * never completes.
+             */
+            if(iNext + 1 < nFrame)
+            {
+                if(1 != write(PeerFd, &aFrame[iNext], 1))
+                {
+                    _exit(0);
+                }
+                iNext++;
+            }
+            usleep(5000);
+            break;
+
+        case PEER_CHATTER:
+            if((int)nFrame != write(PeerFd, aFrame, nFrame))
+            {
+                _exit(0);
+            }
+            nFrame = encodeReport(++MessageID, aFrame, sizeof aFrame);
+            usleep(5000);
+            break;
+        }
+    }
+
+    /* not reached */
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Kill and reap the peer process
+ **
+ ** @param[in]  Pid             From startPeer()
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+stopPeer (
+  pid_t                         Pid)
+{
+    if(0 < Pid)
+    {
+        kill(Pid, SIGKILL);
+        waitpid(Pid, NULL, 0);
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Encode a small TagSelectAccessReport frame
+ **
+ ** @param[in]  MessageID       For the message header
+ ** @param[out] pBuffer         Where the frame goes
+ ** @param[in]  nBuffer         Size of pBuffer
+ **
+ ** @return     Frame length, 0 on failure
+ **
+ *****************************************************************************/
+
+unsigned int
+encodeReport (
+  llrp_u32_t                    MessageID,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    LLRP_tSTagSelectAccessReport * pReport;
+    LLRP_tSFrameEncoder *       pEncoder;
+    unsigned int                nFrame = 0;
+
+    pReport = LLRP_TagSelectAccessReport_construct();
+    LLRP_Message_setMessageID(&pReport->hdr, MessageID);
+    pReport->hdr.Version = 1;
+
+    pEncoder = LLRP_FrameEncoder_construct(pBuffer, nBuffer);
+    if(NULL != pEncoder)
+    {
+        LLRP_Encoder_encodeElement(&pEncoder->encoderHdr,
+            &pReport->hdr.elementHdr);
+        if(LLRP_RC_OK == pEncoder->encoderHdr.ErrorDetails.eResultCode)
+        {
+            nFrame = pEncoder->iNext;
+        }
+        LLRP_Encoder_destruct(&pEncoder->encoderHdr);
+    }
+
+    LLRP_Element_destruct(&pReport->hdr.elementHdr);
+
+    return nFrame;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Read the monotonic clock
+ **
+ ** @return     CLOCK_MONOTONIC in (fractional) milliseconds
+ **
+ *****************************************************************************/
+
+double
+nowMS (void)
+{
+    struct timespec             Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return Now.tv_sec * 1000.0 + Now.tv_nsec / 1000000.0;
+}
@@ -0,0 +1,741 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  dx402.c
+ **
+ ** @brief Benchmark of LTKC passthrough proxy against decode/re-encode
+ **
+ ** This is diagnostic 402 for the LLRP Tool Kit for C (LTKC).
+ **
+ ** DX402 needs no reader. A producer process plays the reader and
+ ** writes a burst of TagSelectAccessReport frames. A consumer
+ ** process plays the upstream server and checks that every byte
+ ** it gets matches what the producer sent. In between, this
+ ** process relays the frames three ways and times each:
+ **     - LLRP_Proxy_run(), nothing inspected
+ **     - LLRP_Proxy_run(), every report decoded on the side
+ **     - LLRP_Conn_recvMessage() then LLRP_Conn_sendMessage()
+ **
+ ** This program can be run with one verbose option (-v)
+ ** to print the proxy counters as well.
+ **
+ ** Exit status is 0 when every way relayed the burst intact.
+ **
+ *****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+
+#include "../Library/ltkc.h"
+
+
+/*
+ * BEGIN forward declarations
+ */
+int
+main (
+  int                           ac,
+  char *                        av[]);
+
+void
+usage (
+  char *                        pProgName);
+
+int
+run (void);
+
+int
+relayBurst (
+  const char *                  pCaseName,
+  int                           eRelayMode);
+
+int
+relayByProxy (
+  LLRP_tSConnection *           pReader,
+  LLRP_tSConnection *           pUpper,
+  llrp_bool_t                   bInspect);
+
+int
+relayByDecode (
+  LLRP_tSConnection *           pReader,
+  LLRP_tSConnection *           pUpper);
+
+void
+countInspected (
+  LLRP_tSProxy *                pProxy,
+  LLRP_tSConnection *           pFrom,
+  LLRP_tSMessage *              pMessage,
+  void *                        pInspectArg);
+
+pid_t
+startProducer (
+  int                           Fd);
+
+pid_t
+startConsumer (
+  int                           Fd);
+
+unsigned int
+encodeReport (
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+double
+nowMS (void);
+/*
+ * END forward declarations
+ */
+
+
+/*
+ * How the burst is relayed
+ */
+enum
+{
+    RELAY_PROXY,                /* LLRP_Proxy_run(), nothing inspected */
+    RELAY_PROXY_INSPECT,        /* LLRP_Proxy_run(), reports inspected */
+    RELAY_DECODE,               /* recvMessage() then sendMessage() */
+};
+
+/*
+ * Size of the burst, and tags in each report
+ */
+#define N_FRAME         (20000u)
+#define N_TAG           (20u)
+
+/*
+ * Global variables
+ */
+int                             g_Verbose;
+LLRP_tSTypeRegistry *           g_pTypeRegistry;
+unsigned char                   g_aFrame[4096];
+unsigned int                    g_nFrame;
+unsigned int                    g_nInspected;
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Command main routine
+ **
+ ** Command synopsis:
+ **
+ **     dx402 [-v]
+ **
+ ** @exitcode   0               Everything *seemed* to work.
+ **             1               Bad usage
+ **             2               Run failed
+ **
+ *****************************************************************************/
+
+int
+main (
+  int                           ac,
+  char *                        av[])
+{
+    int                         rc;
+
+    if(ac == 2 && 0 == strcmp("-v", av[1]))
+    {
+        g_Verbose = 1;
+    }
+    else if(ac != 1)
+    {
+        usage(av[0]);
+        /* no return */
+    }
+
+    /*
+     * A consumer exiting early must not kill us with SIGPIPE.
+     */
+    signal(SIGPIPE, SIG_IGN);
+
+    rc = run();
+
+    printf("INFO: Done\n");
+
+    exit(rc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Print usage message and exit
+ **
+ ** @param[in]  pProgName       Program name.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+usage (
+  char *                        pProgName)
+{
+    printf("Usage: %s [-v]\n", pProgName);
+    printf("\n");
+    printf("Each -v increases verbosity level\n");
+    exit(1);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Run every relay case
+ **
+ ** @return     0               Every case passed
+ **             2               Something failed
+ **
+ *****************************************************************************/
+
+int
+run (void)
+{
+    int                         nFail = 0;
+
+    g_pTypeRegistry = LLRP_getTheTypeRegistry();
+    if(NULL == g_pTypeRegistry)
+    {
+        printf("ERROR: getTheTypeRegistry failed\n");
+        return 2;
+    }
+
+    g_nFrame = encodeReport(g_aFrame, sizeof g_aFrame);
+    if(0 == g_nFrame)
+    {
+        printf("ERROR: encodeReport failed\n");
+        LLRP_TypeRegistry_destruct(g_pTypeRegistry);
+        return 2;
+    }
+
+    printf("INFO: %u frames of %u bytes\n", N_FRAME, g_nFrame);
+
+    nFail += relayBurst("proxy", RELAY_PROXY);
+    nFail += relayBurst("proxy+inspect", RELAY_PROXY_INSPECT);
+    nFail += relayBurst("decode/encode", RELAY_DECODE);
+
+    LLRP_TypeRegistry_destruct(g_pTypeRegistry);
+
+    if(0 != nFail)
+    {
+        printf("ERROR: %d case(s) failed\n", nFail);
+        return 2;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Relay one burst from producer to consumer and time it
+ **
+ ** @param[in]  pCaseName       For messages
+ ** @param[in]  eRelayMode      RELAY_PROXY, RELAY_PROXY_INSPECT,
+ **                             RELAY_DECODE
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+relayBurst (
+  const char *                  pCaseName,
+  int                           eRelayMode)
+{
+    LLRP_tSConnection *         pReader;
+    LLRP_tSConnection *         pUpper;
+    int                         aReaderFd[2];
+    int                         aUpperFd[2];
+    pid_t                       ProducerPid;
+    pid_t                       ConsumerPid;
+    int                         Status;
+    double                      StartMS;
+    double                      ElapsedMS;
+    int                         nFail = 0;
+
+    pReader = LLRP_Conn_construct(g_pTypeRegistry, 128u*1024u);
+    pUpper = LLRP_Conn_construct(g_pTypeRegistry, 128u*1024u);
+    if(NULL == pReader || NULL == pUpper)
+    {
+        printf("ERROR: %s: Conn_construct failed\n", pCaseName);
+        exit(2);
+    }
+
+    /*
+     * The consumer is forked before the reader sockets exist.
+     * Otherwise it would hold the producer's end open and the
+     * proxy would never see end of stream.
+     */
+    if(0 > socketpair(AF_UNIX, SOCK_STREAM, 0, aUpperFd))
+    {
+        printf("ERROR: %s: socketpair failed\n", pCaseName);
+        exit(2);
+    }
+    ConsumerPid = startConsumer(aUpperFd[1]);
+    close(aUpperFd[1]);
+
+    if(0 > socketpair(AF_UNIX, SOCK_STREAM, 0, aReaderFd))
+    {
+        printf("ERROR: %s: socketpair failed\n", pCaseName);
+        exit(2);
+    }
+
+    /*
+     * The connections are normally opened by name. Here they
+     * are simply handed the already connected sockets.
+     */
+    pReader->fd = aReaderFd[0];
+    pUpper->fd = aUpperFd[0];
+
+    StartMS = nowMS();
+
+    ProducerPid = startProducer(aReaderFd[1]);
+    close(aReaderFd[1]);
+
+    switch(eRelayMode)
+    {
+    default:
+    case RELAY_PROXY:
+        nFail = relayByProxy(pReader, pUpper, FALSE);
+        break;
+
+    case RELAY_PROXY_INSPECT:
+        nFail = relayByProxy(pReader, pUpper, TRUE);
+        break;
+
+    case RELAY_DECODE:
+        nFail = relayByDecode(pReader, pUpper);
+        break;
+    }
+
+    ElapsedMS = nowMS() - StartMS;
+
+    /*
+     * Closing the upstream side ends the consumer, which
+     * reports whether the stream was intact.
+     */
+    LLRP_Conn_closeConnectionToReader(pUpper);
+    LLRP_Conn_closeConnectionToReader(pReader);
+
+    waitpid(ProducerPid, NULL, 0);
+    if(0 > waitpid(ConsumerPid, &Status, 0) ||
+       !WIFEXITED(Status) || 0 != WEXITSTATUS(Status))
+    {
+        printf("ERROR: %s: consumer saw a damaged stream\n", pCaseName);
+        nFail = 1;
+    }
+
+    printf("INFO: %-14s %s %8.1f ms %10.0f frames/s %8.1f MB/s\n",
+        pCaseName, nFail ? "FAIL" : "PASS", ElapsedMS,
+        N_FRAME * 1000.0 / ElapsedMS,
+        (double)N_FRAME * g_nFrame / 1000.0 / ElapsedMS);
+
+    LLRP_Conn_destruct(pUpper);
+    LLRP_Conn_destruct(pReader);
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Relay the burst with a proxy
+ **
+ ** @param[in]  pReader         Connection the producer writes
+ ** @param[in]  pUpper          Connection the consumer reads
+ ** @param[in]  bInspect        TRUE to decode every report on the side
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+relayByProxy (
+  LLRP_tSConnection *           pReader,
+  LLRP_tSConnection *           pUpper,
+  llrp_bool_t                   bInspect)
+{
+    LLRP_tSProxy *              pProxy;
+    const LLRP_tSErrorDetails * pError;
+    llrp_u64_t                  nFrameRelayed;
+    int                         nFail = 0;
+
+    pProxy = LLRP_Proxy_construct(pReader, pUpper);
+    if(NULL == pProxy)
+    {
+        printf("ERROR: Proxy_construct failed\n");
+        return 1;
+    }
+
+    g_nInspected = 0;
+    if(bInspect)
+    {
+        LLRP_Proxy_setInspect(pProxy,
+            LLRP_tdTagSelectAccessReport.TypeNum, TRUE);
+        LLRP_Proxy_setInspectCallback(pProxy, countInspected, NULL);
+    }
+
+    while(pProxy->Upstream.nFrameRelayed < N_FRAME)
+    {
+        if(LLRP_RC_OK != LLRP_Proxy_run(pProxy, 1000))
+        {
+            break;
+        }
+    }
+
+    nFrameRelayed = pProxy->Upstream.nFrameRelayed;
+    pError = LLRP_Proxy_getError(pProxy);
+
+    if(N_FRAME != nFrameRelayed)
+    {
+        printf("ERROR: relayed %llu frames: %d %s\n",
+            (unsigned long long)nFrameRelayed, pError->eResultCode,
+            pError->pWhatStr ? pError->pWhatStr : "");
+        nFail = 1;
+    }
+    if(bInspect && N_FRAME != g_nInspected)
+    {
+        printf("ERROR: inspected %u frames\n", g_nInspected);
+        nFail = 1;
+    }
+
+    if(g_Verbose)
+    {
+        printf("INFO:   upstream %llu frames %llu bytes, inspected %u\n",
+            (unsigned long long)pProxy->Upstream.nFrameRelayed,
+            (unsigned long long)pProxy->Upstream.nByteRelayed,
+            g_nInspected);
+    }
+
+    LLRP_Proxy_destruct(pProxy);
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Relay the burst by decoding and re-encoding every frame
+ **
+ ** @param[in]  pReader         Connection the producer writes
+ ** @param[in]  pUpper          Connection the consumer reads
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+relayByDecode (
+  LLRP_tSConnection *           pReader,
+  LLRP_tSConnection *           pUpper)
+{
+    LLRP_tSMessage *            pMessage;
+    const LLRP_tSErrorDetails * pError;
+    unsigned int                i;
+
+    for(i = 0; i < N_FRAME; i++)
+    {
+        pMessage = LLRP_Conn_recvMessage(pReader, 1000);
+        if(NULL == pMessage)
+        {
+            pError = LLRP_Conn_getRecvError(pReader);
+            printf("ERROR: recvMessage %u: %d %s\n", i,
+                pError->eResultCode,
+                pError->pWhatStr ? pError->pWhatStr : "");
+            return 1;
+        }
+
+        if(LLRP_RC_OK != LLRP_Conn_sendMessage(pUpper, pMessage))
+        {
+            pError = LLRP_Conn_getSendError(pUpper);
+            printf("ERROR: sendMessage %u: %d %s\n", i,
+                pError->eResultCode,
+                pError->pWhatStr ? pError->pWhatStr : "");
+            LLRP_Element_destruct(&pMessage->elementHdr);
+            return 1;
+        }
+
+        LLRP_Element_destruct(&pMessage->elementHdr);
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Inspect callback, counts the reports it is handed
+ **
+ *****************************************************************************/
+
+void
+countInspected (
+  LLRP_tSProxy *                pProxy,
+  LLRP_tSConnection *           pFrom,
+  LLRP_tSMessage *              pMessage,
+  void *                        pInspectArg)
+{
+    if(&LLRP_tdTagSelectAccessReport == pMessage->elementHdr.pType)
+    {
+        g_nInspected++;
+    }
+
+    LLRP_Element_destruct(&pMessage->elementHdr);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Fork the producer process
+ **
+ ** The producer writes the burst as fast as it can and exits.
+ **
+ ** @param[in]  Fd              Socket the producer writes
+ **
+ ** @return     Pid of the producer, <0 on failure
+ **
+ *****************************************************************************/
+
+pid_t
+startProducer (
+  int                           Fd)
+{
+    unsigned char *             pBurst;
+    unsigned int                nBurst;
+    unsigned int                iNext;
+    pid_t                       Pid;
+    int                         rc;
+
+    Pid = fork();
+    if(0 != Pid)
+    {
+        return Pid;
+    }
+
+    /*
+     * Write in large pieces that mostly split frames, the
+     * way a reader's TCP stream arrives.
+     */
+    nBurst = 64u * g_nFrame;
+    pBurst = malloc(nBurst);
+    if(NULL == pBurst)
+    {
+        _exit(1);
+    }
+    for(iNext = 0; iNext < nBurst; iNext += g_nFrame)
+    {
+        memcpy(&pBurst[iNext], g_aFrame, g_nFrame);
+    }
+
+    for(iNext = 0; iNext < N_FRAME; iNext += 64u)
+    {
+        unsigned int            nWrite = nBurst;
+        unsigned int            iWrite = 0;
+
+        if(N_FRAME - iNext < 64u)
+        {
+            nWrite = (N_FRAME - iNext) * g_nFrame;
+        }
+
+        while(iWrite < nWrite)
+        {
+            rc = write(Fd, &pBurst[iWrite], nWrite - iWrite);
+            if(0 >= rc)
+            {
+                _exit(1);
+            }
+            iWrite += rc;
+        }
+    }
+
+    _exit(0);
+
+    /* not reached */
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Fork the consumer process
+ **
+ ** The consumer reads until end of stream. It exits 0 when it got
+ ** exactly the burst, byte for byte, else 1.
+ **
+ ** @param[in]  Fd              Socket the consumer reads
+ **
+ ** @return     Pid of the consumer, <0 on failure
+ **
+ *****************************************************************************/
+
+pid_t
+startConsumer (
+  int                           Fd)
+{
+    unsigned char               aBuf[64u*1024u];
+    unsigned long long          nTotal = 0;
+    unsigned int                iFrame = 0;
+    pid_t                       Pid;
+    int                         rc;
+    int                         i;
+
+    Pid = fork();
+    if(0 != Pid)
+    {
+        return Pid;
+    }
+
+    for(;;)
+    {
+        rc = read(Fd, aBuf, sizeof aBuf);
+        if(0 >= rc)
+        {
+            break;
+        }
+
+        for(i = 0; i < rc; i++)
+        {
+            if(aBuf[i] != g_aFrame[iFrame])
+            {
+                _exit(1);
+            }
+            if(++iFrame == g_nFrame)
+            {
+                iFrame = 0;
+            }
+        }
+        nTotal += rc;
+    }
+
+    _exit(nTotal == (unsigned long long)N_FRAME * g_nFrame ? 0 : 1);
+
+    /* not reached */
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Encode a TagSelectAccessReport frame with N_TAG tags
+ **
+ ** @param[out] pBuffer         Where the frame goes
+ ** @param[in]  nBuffer         Size of pBuffer
+ **
+ ** @return     Frame length, 0 on failure
+ **
+ *****************************************************************************/
+
+unsigned int
+encodeReport (
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    LLRP_tSTagSelectAccessReport * pReport;
+    LLRP_tSFrameEncoder *       pEncoder;
+    unsigned int                nFrame = 0;
+    unsigned int                i;
+    unsigned int                k;
+
+    pReport = LLRP_TagSelectAccessReport_construct();
+    LLRP_Message_setMessageID(&pReport->hdr, 1);
+    pReport->hdr.Version = 1;
+    pReport->hdr.DeviceSN = 0x1122334455667788ull;
+
+    for(i = 0; i < N_TAG; i++)
+    {
+        LLRP_tSTagReportData *  pTagReportData;
+        LLRP_tSAntennaID *      pAntennaID;
+        llrp_u8v_t              TID;
+
+        pTagReportData = LLRP_TagReportData_construct();
+
+        TID = LLRP_u8v_construct(12);
+        for(k = 0; k < 12; k++)
+        {
+            TID.pValue[k] = i + k;
+        }
+        LLRP_TagReportData_setTID(pTagReportData, TID);
+
+        pAntennaID = LLRP_AntennaID_construct();
+        LLRP_AntennaID_setAntennaID(pAntennaID, i & 3u);
+        LLRP_TagReportData_setAntennaID(pTagReportData, pAntennaID);
+
+        LLRP_TagSelectAccessReport_addTagReportData(pReport, pTagReportData);
+    }
+
+    pEncoder = LLRP_FrameEncoder_construct(pBuffer, nBuffer);
+    if(NULL != pEncoder)
+    {
+        LLRP_Encoder_encodeElement(&pEncoder->encoderHdr,
+            &pReport->hdr.elementHdr);
+        if(LLRP_RC_OK == pEncoder->encoderHdr.ErrorDetails.eResultCode)
+        {
+            nFrame = pEncoder->iNext;
+        }
+        LLRP_Encoder_destruct(&pEncoder->encoderHdr);
+    }
+
+    LLRP_Element_destruct(&pReport->hdr.elementHdr);
+
+    return nFrame;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Read the monotonic clock
+ **
+ ** @return     CLOCK_MONOTONIC in (fractional) milliseconds
+ **
+ *****************************************************************************/
+
+double
+nowMS (void)
+{
+    struct timespec             Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return Now.tv_sec * 1000.0 + Now.tv_nsec / 1000000.0;
+}
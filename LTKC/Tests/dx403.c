@@ -0,0 +1,887 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  dx403.c
+ **
+ ** @brief Benchmark of the LTKC connection I/O backends
+ **
+ ** This is diagnostic 403 for the LLRP Tool Kit for C (LTKC).
+ **
+ ** DX403 needs no reader. It connects to itself over loopback TCP
+ ** and moves a burst of small TagSelectAccessReport frames three
+ ** ways, once with each backend, LLRP_ConnIO_POSIX and
+ ** LLRP_ConnIO_IOURING:
+ **     - recv: an event loop polls LLRP_Conn_getPollFd() and calls
+ **       LLRP_Conn_recvFill(). A pre-decode hook counts and skips
+ **       the frames, so this is I/O and framing only.
+ **     - recv+decode: LLRP_Conn_recvMessage() for every frame
+ **     - send: LLRP_Conn_sendMessage() for every frame
+ **
+ ** For each it prints frames per second and the CPU time, user
+ ** and system, this process spent per frame.
+ **
+ ** If io_uring is not available those cases are skipped.
+ **
+ ** This program can be run with one verbose option (-v).
+ **
+ ** Exit status is 0 when every case moved the burst intact.
+ **
+ *****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <signal.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <sys/resource.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "../Library/ltkc.h"
+
+
+/*
+ * BEGIN forward declarations
+ */
+int
+main (
+  int                           ac,
+  char *                        av[]);
+
+void
+usage (
+  char *                        pProgName);
+
+int
+run (void);
+
+int
+runCase (
+  const char *                  pCaseName,
+  const LLRP_tSConnIO *         pIO,
+  int                           eCase);
+
+int
+recvByEventLoop (
+  LLRP_tSConnection *           pConn);
+
+int
+recvByMessage (
+  LLRP_tSConnection *           pConn);
+
+int
+sendByMessage (
+  LLRP_tSConnection *           pConn);
+
+LLRP_tEPreDecodeAction
+countFrame (
+  LLRP_tSConnection *           pConn,
+  const LLRP_tSFrameExtract *   pFrameExtract,
+  const unsigned char *         pFrame,
+  unsigned int                  nFrame,
+  void *                        pPreDecodeArg);
+
+int
+listenLoopback (
+  unsigned short *              pPort);
+
+int
+connectLoopback (
+  unsigned short                Port);
+
+pid_t
+startProducer (
+  unsigned short                Port);
+
+pid_t
+startConsumer (
+  unsigned short                Port);
+
+LLRP_tSMessage *
+makeReport (void);
+
+double
+nowMS (void);
+
+double
+cpuMS (void);
+/*
+ * END forward declarations
+ */
+
+
+/*
+ * What a case does
+ */
+enum
+{
+    CASE_RECV,                  /* poll + recvFill, frames skipped */
+    CASE_RECV_DECODE,           /* recvMessage() */
+    CASE_SEND,                  /* sendMessage() */
+};
+
+/*
+ * Size of the burst. The frames are small so the I/O
+ * is what costs.
+ */
+#define N_FRAME         (200000u)
+
+/*
+ * Global variables
+ */
+int                             g_Verbose;
+LLRP_tSTypeRegistry *           g_pTypeRegistry;
+LLRP_tSMessage *                g_pReport;
+unsigned char                   g_aFrame[1024];
+unsigned int                    g_nFrame;
+unsigned int                    g_nCounted;
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Command main routine
+ **
+ ** Command synopsis:
+ **
+ **     dx403 [-v]
+ **
+ ** @exitcode   0               Everything *seemed* to work.
+ **             1               Bad usage
+ **             2               Run failed
+ **
+ *****************************************************************************/
+
+int
+main (
+  int                           ac,
+  char *                        av[])
+{
+    int                         rc;
+
+    if(ac == 2 && 0 == strcmp("-v", av[1]))
+    {
+        g_Verbose = 1;
+    }
+    else if(ac != 1)
+    {
+        usage(av[0]);
+        /* no return */
+    }
+
+    /*
+     * A peer exiting early must not kill us with SIGPIPE.
+     */
+    signal(SIGPIPE, SIG_IGN);
+
+    rc = run();
+
+    printf("INFO: Done\n");
+
+    exit(rc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Print usage message and exit
+ **
+ ** @param[in]  pProgName       Program name.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+usage (
+  char *                        pProgName)
+{
+    printf("Usage: %s [-v]\n", pProgName);
+    printf("\n");
+    printf("Each -v increases verbosity level\n");
+    exit(1);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Run every case with every backend
+ **
+ ** @return     0               Every case passed
+ **             2               Something failed
+ **
+ *****************************************************************************/
+
+int
+run (void)
+{
+    LLRP_tSFrameEncoder *       pEncoder;
+    int                         nFail = 0;
+
+    g_pTypeRegistry = LLRP_getTheTypeRegistry();
+    if(NULL == g_pTypeRegistry)
+    {
+        printf("ERROR: getTheTypeRegistry failed\n");
+        return 2;
+    }
+
+    /*
+     * One report, sent as a message and checked as bytes.
+     */
+    g_pReport = makeReport();
+    pEncoder = LLRP_FrameEncoder_construct(g_aFrame, sizeof g_aFrame);
+    if(NULL != pEncoder)
+    {
+        LLRP_Encoder_encodeElement(&pEncoder->encoderHdr,
+            &g_pReport->elementHdr);
+        if(LLRP_RC_OK == pEncoder->encoderHdr.ErrorDetails.eResultCode)
+        {
+            g_nFrame = pEncoder->iNext;
+        }
+        LLRP_Encoder_destruct(&pEncoder->encoderHdr);
+    }
+    if(0 == g_nFrame)
+    {
+        printf("ERROR: encode failed\n");
+        LLRP_Element_destruct(&g_pReport->elementHdr);
+        LLRP_TypeRegistry_destruct(g_pTypeRegistry);
+        return 2;
+    }
+
+    printf("INFO: %u frames of %u bytes over loopback TCP\n",
+        N_FRAME, g_nFrame);
+
+    nFail += runCase("recv", &LLRP_ConnIO_POSIX, CASE_RECV);
+    nFail += runCase("recv", &LLRP_ConnIO_IOURING, CASE_RECV);
+    nFail += runCase("recv+decode", &LLRP_ConnIO_POSIX, CASE_RECV_DECODE);
+    nFail += runCase("recv+decode", &LLRP_ConnIO_IOURING, CASE_RECV_DECODE);
+    nFail += runCase("send", &LLRP_ConnIO_POSIX, CASE_SEND);
+    nFail += runCase("send", &LLRP_ConnIO_IOURING, CASE_SEND);
+
+    LLRP_Element_destruct(&g_pReport->elementHdr);
+    LLRP_TypeRegistry_destruct(g_pTypeRegistry);
+
+    if(0 != nFail)
+    {
+        printf("ERROR: %d case(s) failed\n", nFail);
+        return 2;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Run one case with one backend and time it
+ **
+ ** @param[in]  pCaseName       For messages
+ ** @param[in]  pIO             The backend
+ ** @param[in]  eCase           CASE_RECV, CASE_RECV_DECODE, CASE_SEND
+ **
+ ** @return     0               Passed, or skipped
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+runCase (
+  const char *                  pCaseName,
+  const LLRP_tSConnIO *         pIO,
+  int                           eCase)
+{
+    LLRP_tSConnection *         pConn;
+    unsigned short              Port;
+    int                         ListenFd;
+    pid_t                       PeerPid;
+    int                         Status;
+    double                      StartMS;
+    double                      StartCPUMS;
+    double                      ElapsedMS;
+    double                      CPUMS;
+    int                         nFail = 0;
+
+    pConn = LLRP_Conn_construct(g_pTypeRegistry, 128u*1024u);
+    if(NULL == pConn)
+    {
+        printf("ERROR: %s: Conn_construct failed\n", pCaseName);
+        exit(2);
+    }
+
+    ListenFd = listenLoopback(&Port);
+    if(0 > ListenFd)
+    {
+        printf("ERROR: %s: can't listen on loopback\n", pCaseName);
+        exit(2);
+    }
+
+    if(CASE_SEND == eCase)
+    {
+        PeerPid = startConsumer(Port);
+    }
+    else
+    {
+        PeerPid = startProducer(Port);
+    }
+
+    /*
+     * The connection is normally opened by name. Here it
+     * is simply handed the accepted socket.
+     */
+    pConn->fd = accept(ListenFd, NULL, NULL);
+    close(ListenFd);
+    if(0 > pConn->fd)
+    {
+        printf("ERROR: %s: accept failed\n", pCaseName);
+        exit(2);
+    }
+
+    if(0 != LLRP_Conn_setIO(pConn, pIO))
+    {
+        printf("INFO: %-12s %-8s SKIP %s\n", pCaseName, pIO->pName,
+            LLRP_Conn_getConnectError(pConn));
+        LLRP_Conn_closeConnectionToReader(pConn);
+        kill(PeerPid, SIGKILL);
+        waitpid(PeerPid, NULL, 0);
+        LLRP_Conn_destruct(pConn);
+        return 0;
+    }
+
+    StartMS = nowMS();
+    StartCPUMS = cpuMS();
+
+    switch(eCase)
+    {
+    default:
+    case CASE_RECV:
+        nFail = recvByEventLoop(pConn);
+        break;
+
+    case CASE_RECV_DECODE:
+        nFail = recvByMessage(pConn);
+        break;
+
+    case CASE_SEND:
+        nFail = sendByMessage(pConn);
+        break;
+    }
+
+    /*
+     * Closing waits for what the backend has yet to send.
+     */
+    LLRP_Conn_closeConnectionToReader(pConn);
+
+    ElapsedMS = nowMS() - StartMS;
+    CPUMS = cpuMS() - StartCPUMS;
+
+    if(0 > waitpid(PeerPid, &Status, 0) ||
+       !WIFEXITED(Status) || 0 != WEXITSTATUS(Status))
+    {
+        printf("ERROR: %s: peer saw a damaged stream\n", pCaseName);
+        nFail = 1;
+    }
+
+    printf("INFO: %-12s %-8s %s %8.1f ms %10.0f frames/s %6.2f us CPU/frame\n",
+        pCaseName, pIO->pName, nFail ? "FAIL" : "PASS", ElapsedMS,
+        N_FRAME * 1000.0 / ElapsedMS, CPUMS * 1000.0 / N_FRAME);
+
+    LLRP_Conn_destruct(pConn);
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Receive the burst the way an event loop does
+ **
+ ** @param[in]  pConn           The connection the producer writes
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+recvByEventLoop (
+  LLRP_tSConnection *           pConn)
+{
+    struct pollfd               pfd;
+    LLRP_tResultCode            rc;
+
+    g_nCounted = 0;
+    LLRP_Conn_setPreDecodeHook(pConn, countFrame, NULL);
+
+    while(g_nCounted < N_FRAME)
+    {
+        pfd.fd = LLRP_Conn_getPollFd(pConn);
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        if(0 >= poll(&pfd, 1, 1000))
+        {
+            printf("ERROR: poll timed out at frame %u\n", g_nCounted);
+            return 1;
+        }
+
+        rc = LLRP_Conn_recvFill(pConn);
+        if(LLRP_RC_OK == rc)
+        {
+            rc = LLRP_Conn_recvDecodeBuffered(pConn);
+        }
+        if(LLRP_RC_OK != rc)
+        {
+            printf("ERROR: receive at frame %u: %d\n", g_nCounted, rc);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Receive and decode every frame of the burst
+ **
+ ** @param[in]  pConn           The connection the producer writes
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+recvByMessage (
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSMessage *            pMessage;
+    const LLRP_tSErrorDetails * pError;
+    unsigned int                i;
+
+    for(i = 0; i < N_FRAME; i++)
+    {
+        pMessage = LLRP_Conn_recvMessage(pConn, 1000);
+        if(NULL == pMessage)
+        {
+            pError = LLRP_Conn_getRecvError(pConn);
+            printf("ERROR: recvMessage %u: %d %s\n", i,
+                pError->eResultCode,
+                pError->pWhatStr ? pError->pWhatStr : "");
+            return 1;
+        }
+        LLRP_Element_destruct(&pMessage->elementHdr);
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Send the burst one message at a time
+ **
+ ** @param[in]  pConn           The connection the consumer reads
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+sendByMessage (
+  LLRP_tSConnection *           pConn)
+{
+    const LLRP_tSErrorDetails * pError;
+    unsigned int                i;
+
+    for(i = 0; i < N_FRAME; i++)
+    {
+        if(LLRP_RC_OK != LLRP_Conn_sendMessage(pConn, g_pReport))
+        {
+            pError = LLRP_Conn_getSendError(pConn);
+            printf("ERROR: sendMessage %u: %d %s\n", i,
+                pError->eResultCode,
+                pError->pWhatStr ? pError->pWhatStr : "");
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Pre-decode hook, checks and counts each frame and skips it
+ **
+ *****************************************************************************/
+
+LLRP_tEPreDecodeAction
+countFrame (
+  LLRP_tSConnection *           pConn,
+  const LLRP_tSFrameExtract *   pFrameExtract,
+  const unsigned char *         pFrame,
+  unsigned int                  nFrame,
+  void *                        pPreDecodeArg)
+{
+    if(nFrame == g_nFrame && 0 == memcmp(pFrame, g_aFrame, nFrame))
+    {
+        g_nCounted++;
+    }
+
+    return LLRP_PREDECODE_SKIP;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Listen on an ephemeral loopback port
+ **
+ ** @param[out] pPort           The port chosen
+ **
+ ** @return     The listening socket, <0 on failure
+ **
+ *****************************************************************************/
+
+int
+listenLoopback (
+  unsigned short *              pPort)
+{
+    struct sockaddr_in          Sin;
+    socklen_t                   nSin = sizeof Sin;
+    int                         Fd;
+
+    Fd = socket(AF_INET, SOCK_STREAM, 0);
+    if(0 > Fd)
+    {
+        return -1;
+    }
+
+    memset(&Sin, 0, sizeof Sin);
+    Sin.sin_family = AF_INET;
+    Sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    Sin.sin_port = 0;
+
+    if(0 > bind(Fd, (struct sockaddr *)&Sin, sizeof Sin) ||
+       0 > listen(Fd, 1) ||
+       0 > getsockname(Fd, (struct sockaddr *)&Sin, &nSin))
+    {
+        close(Fd);
+        return -1;
+    }
+
+    *pPort = ntohs(Sin.sin_port);
+
+    return Fd;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Connect to a loopback port
+ **
+ ** @param[in]  Port            The port
+ **
+ ** @return     The connected socket, <0 on failure
+ **
+ *****************************************************************************/
+
+int
+connectLoopback (
+  unsigned short                Port)
+{
+    struct sockaddr_in          Sin;
+    int                         Fd;
+
+    Fd = socket(AF_INET, SOCK_STREAM, 0);
+    if(0 > Fd)
+    {
+        return -1;
+    }
+
+    memset(&Sin, 0, sizeof Sin);
+    Sin.sin_family = AF_INET;
+    Sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    Sin.sin_port = htons(Port);
+
+    if(0 > connect(Fd, (struct sockaddr *)&Sin, sizeof Sin))
+    {
+        close(Fd);
+        return -1;
+    }
+
+    return Fd;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Fork the producer process
+ **
+ ** The producer plays the reader. It connects and writes the burst
+ ** as fast as it can, 64 frames per write, and exits.
+ **
+ ** @param[in]  Port            Where to connect
+ **
+ ** @return     Pid of the producer, <0 on failure
+ **
+ *****************************************************************************/
+
+pid_t
+startProducer (
+  unsigned short                Port)
+{
+    unsigned char *             pBurst;
+    unsigned int                nBurst;
+    unsigned int                iNext;
+    pid_t                       Pid;
+    int                         Fd;
+    int                         rc;
+
+    Pid = fork();
+    if(0 != Pid)
+    {
+        return Pid;
+    }
+
+    Fd = connectLoopback(Port);
+    if(0 > Fd)
+    {
+        _exit(1);
+    }
+
+    nBurst = 64u * g_nFrame;
+    pBurst = malloc(nBurst);
+    if(NULL == pBurst)
+    {
+        _exit(1);
+    }
+    for(iNext = 0; iNext < nBurst; iNext += g_nFrame)
+    {
+        memcpy(&pBurst[iNext], g_aFrame, g_nFrame);
+    }
+
+    for(iNext = 0; iNext < N_FRAME; iNext += 64u)
+    {
+        unsigned int            nWrite = nBurst;
+        unsigned int            iWrite = 0;
+
+        if(N_FRAME - iNext < 64u)
+        {
+            nWrite = (N_FRAME - iNext) * g_nFrame;
+        }
+
+        while(iWrite < nWrite)
+        {
+            rc = write(Fd, &pBurst[iWrite], nWrite - iWrite);
+            if(0 >= rc)
+            {
+                _exit(1);
+            }
+            iWrite += rc;
+        }
+    }
+
+    /*
+     * Stay until the other side is done with the socket.
+     */
+    shutdown(Fd, SHUT_WR);
+    while(0 < read(Fd, pBurst, nBurst))
+    {
+        /* discard */
+    }
+
+    _exit(0);
+
+    /* not reached */
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Fork the consumer process
+ **
+ ** The consumer plays the upstream server. It reads until end of
+ ** stream and exits 0 when it got exactly the burst, byte for byte.
+ **
+ ** @param[in]  Port            Where to connect
+ **
+ ** @return     Pid of the consumer, <0 on failure
+ **
+ *****************************************************************************/
+
+pid_t
+startConsumer (
+  unsigned short                Port)
+{
+    unsigned char               aBuf[64u*1024u];
+    unsigned long long          nTotal = 0;
+    unsigned int                iFrame = 0;
+    pid_t                       Pid;
+    int                         Fd;
+    int                         rc;
+    int                         i;
+
+    Pid = fork();
+    if(0 != Pid)
+    {
+        return Pid;
+    }
+
+    Fd = connectLoopback(Port);
+    if(0 > Fd)
+    {
+        _exit(1);
+    }
+
+    for(;;)
+    {
+        rc = read(Fd, aBuf, sizeof aBuf);
+        if(0 >= rc)
+        {
+            break;
+        }
+
+        for(i = 0; i < rc; i++)
+        {
+            if(aBuf[i] != g_aFrame[iFrame])
+            {
+                _exit(1);
+            }
+            if(++iFrame == g_nFrame)
+            {
+                iFrame = 0;
+            }
+        }
+        nTotal += rc;
+    }
+
+    _exit(nTotal == (unsigned long long)N_FRAME * g_nFrame ? 0 : 1);
+
+    /* not reached */
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Make a TagSelectAccessReport with one tag
+ **
+ ** @return     The report
+ **
+ *****************************************************************************/
+
+LLRP_tSMessage *
+makeReport (void)
+{
+    LLRP_tSTagSelectAccessReport * pReport;
+    LLRP_tSTagReportData *      pTagReportData;
+    LLRP_tSAntennaID *          pAntennaID;
+    llrp_u8v_t                  TID;
+    unsigned int                k;
+
+    pReport = LLRP_TagSelectAccessReport_construct();
+    LLRP_Message_setMessageID(&pReport->hdr, 1);
+    pReport->hdr.Version = 1;
+    pReport->hdr.DeviceSN = 0x1122334455667788ull;
+
+    pTagReportData = LLRP_TagReportData_construct();
+
+    TID = LLRP_u8v_construct(12);
+    for(k = 0; k < 12; k++)
+    {
+        TID.pValue[k] = k;
+    }
+    LLRP_TagReportData_setTID(pTagReportData, TID);
+
+    pAntennaID = LLRP_AntennaID_construct();
+    LLRP_AntennaID_setAntennaID(pAntennaID, 1);
+    LLRP_TagReportData_setAntennaID(pTagReportData, pAntennaID);
+
+    LLRP_TagSelectAccessReport_addTagReportData(pReport, pTagReportData);
+
+    return &pReport->hdr;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Read the monotonic clock
+ **
+ ** @return     CLOCK_MONOTONIC in (fractional) milliseconds
+ **
+ *****************************************************************************/
+
+double
+nowMS (void)
+{
+    struct timespec             Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return Now.tv_sec * 1000.0 + Now.tv_nsec / 1000000.0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Read the CPU time of this process, user and system
+ **
+ ** Kernel threads io_uring starts on our behalf count too.
+ **
+ ** @return     CPU time in (fractional) milliseconds
+ **
+ *****************************************************************************/
+
+double
+cpuMS (void)
+{
+    struct rusage               Usage;
+
+    getrusage(RUSAGE_SELF, &Usage);
+
+    return Usage.ru_utime.tv_sec * 1000.0 +
+           Usage.ru_utime.tv_usec / 1000.0 +
+           Usage.ru_stime.tv_sec * 1000.0 +
+           Usage.ru_stime.tv_usec / 1000.0;
+}
@@ -0,0 +1,537 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  dx404.c
+ **
+ ** @brief Benchmark of sub-parameter lists with many entries
+ **
+ ** This is diagnostic 404 for the LLRP Tool Kit for C (LTKC).
+ **
+ ** DX404 needs no reader. It builds a TagSelectAccessReport with
+ ** thousands of TagReportData, the size of a report pulled from a
+ ** reader's cache after an outage, and times each step that works
+ ** on its sub-parameter lists:
+ **     - build, one LLRP_TagSelectAccessReport_addTagReportData() each
+ **     - encode
+ **     - decode, which appends to the list of all sub-parameters
+ **       and then attaches each to listTagReportData
+ **     - clear, which removes each from the list of all
+ **     - destruct
+ **
+ ** Each step should take time in proportion to the number of tags.
+ ** The decoded report is checked to hold the same tags in the same
+ ** order, and to encode to the same frame.
+ **
+ ** This program can be run with one verbose option (-v)
+ ** to print the frame sizes as well.
+ **
+ ** Exit status is 0 when every report came back intact.
+ **
+ *****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../Library/ltkc.h"
+
+
+/*
+ * BEGIN forward declarations
+ */
+int
+main (
+  int                           ac,
+  char *                        av[]);
+
+void
+usage (
+  char *                        pProgName);
+
+int
+run (void);
+
+int
+runOne (
+  unsigned int                  nTag);
+
+LLRP_tSTagSelectAccessReport *
+buildReport (
+  unsigned int                  nTag);
+
+unsigned int
+encodeReport (
+  LLRP_tSTagSelectAccessReport *pReport,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+LLRP_tSTagSelectAccessReport *
+decodeReport (
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+int
+checkReport (
+  LLRP_tSTagSelectAccessReport *pReport,
+  unsigned int                  nTag);
+
+double
+nowMS (void);
+/*
+ * END forward declarations
+ */
+
+
+/*
+ * Report sizes to try. The last is the one that matters.
+ */
+static const unsigned int       s_anTag[] = { 100u, 1000u, 10000u };
+
+/*
+ * Room to encode the largest report. A tag is
+ * TagReportData, a 12 byte TID and an AntennaID.
+ */
+#define N_TAG_BYTES     (32u)
+
+/*
+ * Global variables
+ */
+int                             g_Verbose;
+LLRP_tSTypeRegistry *           g_pTypeRegistry;
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Command main routine
+ **
+ ** Command synopsis:
+ **
+ **     dx404 [-v]
+ **
+ ** @exitcode   0               Everything *seemed* to work.
+ **             1               Bad usage
+ **             2               Run failed
+ **
+ *****************************************************************************/
+
+int
+main (
+  int                           ac,
+  char *                        av[])
+{
+    int                         rc;
+
+    if(ac == 2 && 0 == strcmp("-v", av[1]))
+    {
+        g_Verbose = 1;
+    }
+    else if(ac != 1)
+    {
+        usage(av[0]);
+        /* no return */
+    }
+
+    rc = run();
+
+    printf("INFO: Done\n");
+
+    exit(rc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Print usage message and exit
+ **
+ ** @param[in]  pProgName       Program name.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+usage (
+  char *                        pProgName)
+{
+    printf("Usage: %s [-v]\n", pProgName);
+    printf("\n");
+    printf("Each -v increases verbosity level\n");
+    exit(1);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Run every report size
+ **
+ ** @return     0               Every size passed
+ **             2               Something failed
+ **
+ *****************************************************************************/
+
+int
+run (void)
+{
+    unsigned int                i;
+    int                         nFail = 0;
+
+    g_pTypeRegistry = LLRP_getTheTypeRegistry();
+    if(NULL == g_pTypeRegistry)
+    {
+        printf("ERROR: getTheTypeRegistry failed\n");
+        return 2;
+    }
+
+    printf("INFO: %6s %9s %9s %9s %9s %9s %9s\n",
+        "tags", "build", "encode", "decode", "clear", "destruct",
+        "us/tag");
+
+    for(i = 0; i < sizeof s_anTag / sizeof s_anTag[0]; i++)
+    {
+        nFail += runOne(s_anTag[i]);
+    }
+
+    LLRP_TypeRegistry_destruct(g_pTypeRegistry);
+
+    if(0 != nFail)
+    {
+        printf("ERROR: %d size(s) failed\n", nFail);
+        return 2;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Time each step for one report size
+ **
+ ** @param[in]  nTag            TagReportData in the report
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+runOne (
+  unsigned int                  nTag)
+{
+    LLRP_tSTagSelectAccessReport *pReport;
+    LLRP_tSTagSelectAccessReport *pDecoded;
+    unsigned char *             pFrame;
+    unsigned char *             pFrame2;
+    unsigned int                nBuffer = nTag * N_TAG_BYTES + 64u;
+    unsigned int                nFrame;
+    unsigned int                nFrame2;
+    double                      aMS[6];
+    double                      TotalMS;
+    int                         nFail = 0;
+
+    pFrame = malloc(nBuffer);
+    pFrame2 = malloc(nBuffer);
+    if(NULL == pFrame || NULL == pFrame2)
+    {
+        printf("ERROR: %u: malloc failed\n", nTag);
+        exit(2);
+    }
+
+    aMS[0] = nowMS();
+    pReport = buildReport(nTag);
+
+    aMS[1] = nowMS();
+    nFrame = encodeReport(pReport, pFrame, nBuffer);
+
+    aMS[2] = nowMS();
+    pDecoded = decodeReport(pFrame, nFrame);
+
+    aMS[3] = nowMS();
+
+    if(0 == nFrame || NULL == pDecoded)
+    {
+        printf("ERROR: %u: encode or decode failed\n", nTag);
+        exit(2);
+    }
+
+    /*
+     * Check before the clear empties it
+     */
+    nFail += checkReport(pDecoded, nTag);
+    nFrame2 = encodeReport(pDecoded, pFrame2, nBuffer);
+    if(nFrame2 != nFrame || 0 != memcmp(pFrame, pFrame2, nFrame))
+    {
+        printf("ERROR: %u: decoded report encodes differently\n", nTag);
+        nFail = 1;
+    }
+    if(g_Verbose)
+    {
+        printf("INFO: %u: frame %u bytes\n", nTag, nFrame);
+    }
+
+    aMS[4] = nowMS();
+    LLRP_TagSelectAccessReport_clearTagReportData(pDecoded);
+    if(NULL != pDecoded->hdr.elementHdr.listAllSubParameters)
+    {
+        printf("ERROR: %u: clear left sub-parameters behind\n", nTag);
+        nFail = 1;
+    }
+
+    aMS[5] = nowMS();
+    LLRP_Element_destruct(&pDecoded->hdr.elementHdr);
+    LLRP_Element_destruct(&pReport->hdr.elementHdr);
+
+    TotalMS = nowMS() - aMS[4] + aMS[3] - aMS[0];
+
+    printf("INFO: %6u %9.2f %9.2f %9.2f %9.2f %9.2f %9.3f %s\n",
+        nTag, aMS[1] - aMS[0], aMS[2] - aMS[1], aMS[3] - aMS[2],
+        aMS[5] - aMS[4], nowMS() - aMS[5],
+        TotalMS * 1000.0 / nTag, nFail ? "FAIL" : "PASS");
+
+    free(pFrame2);
+    free(pFrame);
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Build a report, one tag at a time
+ **
+ ** @param[in]  nTag            TagReportData to add
+ **
+ ** @return     The report, exits on failure
+ **
+ *****************************************************************************/
+
+LLRP_tSTagSelectAccessReport *
+buildReport (
+  unsigned int                  nTag)
+{
+    LLRP_tSTagSelectAccessReport * pReport;
+    unsigned int                i;
+    unsigned int                k;
+
+    pReport = LLRP_TagSelectAccessReport_construct();
+    if(NULL == pReport)
+    {
+        printf("ERROR: TagSelectAccessReport_construct failed\n");
+        exit(2);
+    }
+    LLRP_Message_setMessageID(&pReport->hdr, 404);
+    pReport->hdr.Version = 1;
+
+    for(i = 0; i < nTag; i++)
+    {
+        LLRP_tSTagReportData *  pTagReportData;
+        LLRP_tSAntennaID *      pAntennaID;
+        llrp_u8v_t              TID;
+
+        pTagReportData = LLRP_TagReportData_construct();
+
+        /*
+         * The first four bytes number the tag, so
+         * the order can be checked after decode.
+         */
+        TID = LLRP_u8v_construct(12);
+        TID.pValue[0] = i >> 24u;
+        TID.pValue[1] = i >> 16u;
+        TID.pValue[2] = i >> 8u;
+        TID.pValue[3] = i;
+        for(k = 4; k < 12; k++)
+        {
+            TID.pValue[k] = i + k;
+        }
+        LLRP_TagReportData_setTID(pTagReportData, TID);
+
+        pAntennaID = LLRP_AntennaID_construct();
+        LLRP_AntennaID_setAntennaID(pAntennaID, 1u + (i & 3u));
+        LLRP_TagReportData_setAntennaID(pTagReportData, pAntennaID);
+
+        LLRP_TagSelectAccessReport_addTagReportData(pReport, pTagReportData);
+    }
+
+    return pReport;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Encode a report into a buffer
+ **
+ ** @param[in]  pReport         The report
+ ** @param[out] pBuffer         Where to put the frame
+ ** @param[in]  nBuffer         Room there
+ **
+ ** @return     >0              Bytes in the frame
+ **             0               Encode failed
+ **
+ *****************************************************************************/
+
+unsigned int
+encodeReport (
+  LLRP_tSTagSelectAccessReport *pReport,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    LLRP_tSFrameEncoder *       pEncoder;
+    unsigned int                nFrame = 0;
+
+    pEncoder = LLRP_FrameEncoder_construct(pBuffer, nBuffer);
+    if(NULL != pEncoder)
+    {
+        LLRP_Encoder_encodeElement(&pEncoder->encoderHdr,
+            &pReport->hdr.elementHdr);
+        if(LLRP_RC_OK == pEncoder->encoderHdr.ErrorDetails.eResultCode)
+        {
+            nFrame = pEncoder->iNext;
+        }
+        LLRP_Encoder_destruct(&pEncoder->encoderHdr);
+    }
+
+    return nFrame;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Decode a report from a frame
+ **
+ ** @param[in]  pBuffer         The frame
+ ** @param[in]  nBuffer         Bytes in it
+ **
+ ** @return     !=NULL          The report
+ **             ==NULL          Decode failed
+ **
+ *****************************************************************************/
+
+LLRP_tSTagSelectAccessReport *
+decodeReport (
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    LLRP_tSFrameDecoder *       pDecoder;
+    LLRP_tSMessage *            pMessage;
+
+    pDecoder = LLRP_FrameDecoder_construct(g_pTypeRegistry, pBuffer, nBuffer);
+    if(NULL == pDecoder)
+    {
+        return NULL;
+    }
+
+    pMessage = LLRP_Decoder_decodeMessage(&pDecoder->decoderHdr);
+    if(NULL == pMessage)
+    {
+        printf("ERROR: decode: %s\n",
+            pDecoder->decoderHdr.ErrorDetails.pWhatStr);
+    }
+
+    LLRP_Decoder_destruct(&pDecoder->decoderHdr);
+
+    return (LLRP_tSTagSelectAccessReport *) pMessage;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check a decoded report has every tag, in order
+ **
+ ** @param[in]  pReport         The report
+ ** @param[in]  nTag            Tags it should have
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+checkReport (
+  LLRP_tSTagSelectAccessReport *pReport,
+  unsigned int                  nTag)
+{
+    LLRP_tSTagReportData *      pTagReportData;
+    unsigned int                i = 0;
+
+    if((int)nTag != LLRP_TagSelectAccessReport_countTagReportData(pReport))
+    {
+        printf("ERROR: %u: count is %d\n", nTag,
+            LLRP_TagSelectAccessReport_countTagReportData(pReport));
+        return 1;
+    }
+
+    for(
+        pTagReportData =
+            LLRP_TagSelectAccessReport_beginTagReportData(pReport);
+        NULL != pTagReportData;
+        pTagReportData =
+            LLRP_TagSelectAccessReport_nextTagReportData(pTagReportData))
+    {
+        llrp_u8v_t *            pTID = &pTagReportData->TID;
+        unsigned int            Tag;
+
+        if(12u != pTID->nValue || NULL == pTagReportData->pAntennaID)
+        {
+            printf("ERROR: %u: tag %u is malformed\n", nTag, i);
+            return 1;
+        }
+
+        Tag = (pTID->pValue[0] << 24u) | (pTID->pValue[1] << 16u) |
+              (pTID->pValue[2] << 8u) | pTID->pValue[3];
+        if(Tag != i)
+        {
+            printf("ERROR: %u: tag %u found at %u\n", nTag, Tag, i);
+            return 1;
+        }
+        i++;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Milliseconds from a monotonic clock
+ **
+ *****************************************************************************/
+
+double
+nowMS (void)
+{
+    struct timespec             Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return Now.tv_sec * 1000.0 + Now.tv_nsec / 1000000.0;
+}
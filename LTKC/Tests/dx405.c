@@ -0,0 +1,402 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  dx405.c
+ **
+ ** @brief Benchmark of the byte swap kernels for vector fields
+ **
+ ** This is diagnostic 405 for the LLRP Tool Kit for C (LTKC).
+ **
+ ** DX405 needs no reader. For every byte swap kernel the CPU can
+ ** run, it converts u16, u32 and u64 vectors of several lengths
+ ** from frame to host order (load) and back (store), the way the
+ ** frame decoder and encoder do for u16v etc. fields, and prints
+ ** nanoseconds per value. The lengths run from a few values, as in
+ ** most fields, to the 32K words of a whole memory bank read.
+ **
+ ** Each result is checked against LLRP_ByteSwap_PORTABLE, and each
+ ** store against the frame it came from. Odd lengths make sure the
+ ** values past the last whole block are done too.
+ **
+ ** This program can be run with one verbose option (-v)
+ ** to print the repeat count of each measurement as well.
+ **
+ ** Exit status is 0 when every kernel gave the right answers.
+ **
+ *****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../Library/ltkc.h"
+
+
+/*
+ * BEGIN forward declarations
+ */
+int
+main (
+  int                           ac,
+  char *                        av[]);
+
+void
+usage (
+  char *                        pProgName);
+
+int
+run (void);
+
+int
+runOne (
+  const LLRP_tSByteSwapKernel * pKernel,
+  unsigned int                  nBit,
+  unsigned int                  nValue);
+
+void
+load (
+  const LLRP_tSByteSwapKernel * pKernel,
+  unsigned int                  nBit,
+  void *                        pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  nValue);
+
+void
+store (
+  const LLRP_tSByteSwapKernel * pKernel,
+  unsigned int                  nBit,
+  llrp_u8_t *                   pDst,
+  const void *                  pSrc,
+  unsigned int                  nValue);
+
+double
+nowNS (void);
+/*
+ * END forward declarations
+ */
+
+
+/*
+ * Kernels to try, slowest first
+ */
+static const LLRP_tSByteSwapKernel * const s_apKernel[] =
+{
+    &LLRP_ByteSwap_PORTABLE,
+    &LLRP_ByteSwap_SSE2,
+    &LLRP_ByteSwap_AVX2,
+};
+
+/*
+ * Vector lengths to try. A u16v can hold up to 65535 values.
+ */
+static const unsigned int       s_anValue[] =
+{
+    1u, 3u, 8u, 17u, 64u, 255u, 1024u, 4099u, 32768u
+};
+
+/*
+ * Each measurement converts about this many bytes
+ */
+#define N_BYTES_PER_RUN     (64u*1024u*1024u)
+
+#define N_VALUE_MAX         (32768u)
+
+/*
+ * Global variables
+ */
+int                             g_Verbose;
+llrp_u8_t                       g_aFrame[N_VALUE_MAX * 8u + 8u];
+llrp_u8_t                       g_aFrame2[N_VALUE_MAX * 8u + 8u];
+llrp_u64_t                      g_aValue[N_VALUE_MAX + 1u];
+llrp_u64_t                      g_aExpect[N_VALUE_MAX + 1u];
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Command main routine
+ **
+ ** Command synopsis:
+ **
+ **     dx405 [-v]
+ **
+ ** @exitcode   0               Everything *seemed* to work.
+ **             1               Bad usage
+ **             2               Run failed
+ **
+ *****************************************************************************/
+
+int
+main (
+  int                           ac,
+  char *                        av[])
+{
+    int                         rc;
+
+    if(ac == 2 && 0 == strcmp("-v", av[1]))
+    {
+        g_Verbose = 1;
+    }
+    else if(ac != 1)
+    {
+        usage(av[0]);
+        /* no return */
+    }
+
+    rc = run();
+
+    printf("INFO: Done\n");
+
+    exit(rc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Print usage message and exit
+ **
+ ** @param[in]  pProgName       Program name.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+usage (
+  char *                        pProgName)
+{
+    printf("Usage: %s [-v]\n", pProgName);
+    printf("\n");
+    printf("Each -v increases verbosity level\n");
+    exit(1);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Run every kernel, value size and length
+ **
+ ** @return     0               Every kernel passed
+ **             2               Something failed
+ **
+ *****************************************************************************/
+
+int
+run (void)
+{
+    const LLRP_tSByteSwapKernel *pDefault = LLRP_ByteSwap_getKernel();
+    unsigned int                iKernel;
+    unsigned int                nBit;
+    unsigned int                i;
+    int                         nFail = 0;
+
+    srand(405);
+    for(i = 0; i < sizeof g_aFrame; i++)
+    {
+        g_aFrame[i] = rand();
+    }
+
+    printf("INFO: default kernel %s\n", pDefault->pName);
+    printf("INFO: %-8s %4s %7s %10s %10s\n",
+        "kernel", "bits", "values", "load ns/v", "store ns/v");
+
+    for(iKernel = 0;
+        iKernel < sizeof s_apKernel / sizeof s_apKernel[0];
+        iKernel++)
+    {
+        const LLRP_tSByteSwapKernel *pKernel = s_apKernel[iKernel];
+
+        if(!pKernel->pfIsSupported())
+        {
+            printf("INFO: %-8s not supported here\n", pKernel->pName);
+            continue;
+        }
+
+        for(nBit = 16u; nBit <= 64u; nBit *= 2u)
+        {
+            for(i = 0; i < sizeof s_anValue / sizeof s_anValue[0]; i++)
+            {
+                nFail += runOne(pKernel, nBit, s_anValue[i]);
+            }
+        }
+    }
+
+    if(0 != nFail)
+    {
+        printf("ERROR: %d measurement(s) failed\n", nFail);
+        return 2;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check and time one kernel on one vector length
+ **
+ ** @param[in]  pKernel         The kernel
+ ** @param[in]  nBit            16, 32 or 64
+ ** @param[in]  nValue          Values in the vector
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+runOne (
+  const LLRP_tSByteSwapKernel * pKernel,
+  unsigned int                  nBit,
+  unsigned int                  nValue)
+{
+    unsigned int                nByte = nValue * nBit / 8u;
+    unsigned int                nRep = N_BYTES_PER_RUN / nByte + 1u;
+    unsigned int                iRep;
+    double                      LoadNS;
+    double                      StoreNS;
+    double                      t0;
+    int                         nFail = 0;
+
+    /*
+     * Check. The frame is shifted by a byte so the
+     * kernels see pointers that are not aligned.
+     */
+    load(&LLRP_ByteSwap_PORTABLE, nBit, g_aExpect, g_aFrame + 1, nValue);
+    memset(g_aValue, 0xA5, sizeof g_aValue);
+    load(pKernel, nBit, g_aValue, g_aFrame + 1, nValue);
+    if(0 != memcmp(g_aValue, g_aExpect, nByte) ||
+       ((llrp_u8_t *)g_aValue)[nByte] != 0xA5u)
+    {
+        printf("ERROR: %s %u bits %u values: load wrong\n",
+            pKernel->pName, nBit, nValue);
+        nFail = 1;
+    }
+
+    memset(g_aFrame2, 0xA5, sizeof g_aFrame2);
+    store(pKernel, nBit, g_aFrame2 + 1, g_aValue, nValue);
+    if(0 != memcmp(g_aFrame2 + 1, g_aFrame + 1, nByte) ||
+       g_aFrame2[1u + nByte] != 0xA5u)
+    {
+        printf("ERROR: %s %u bits %u values: store wrong\n",
+            pKernel->pName, nBit, nValue);
+        nFail = 1;
+    }
+
+    /*
+     * Time
+     */
+    t0 = nowNS();
+    for(iRep = 0; iRep < nRep; iRep++)
+    {
+        load(pKernel, nBit, g_aValue, g_aFrame, nValue);
+    }
+    LoadNS = (nowNS() - t0) / nRep / nValue;
+
+    t0 = nowNS();
+    for(iRep = 0; iRep < nRep; iRep++)
+    {
+        store(pKernel, nBit, g_aFrame2, g_aValue, nValue);
+    }
+    StoreNS = (nowNS() - t0) / nRep / nValue;
+
+    printf("INFO: %-8s %4u %7u %10.3f %10.3f %s\n",
+        pKernel->pName, nBit, nValue, LoadNS, StoreNS,
+        nFail ? "FAIL" : "PASS");
+    if(g_Verbose)
+    {
+        printf("INFO: %u repeats\n", nRep);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Frame to host order with the kernel for nBit
+ **
+ *****************************************************************************/
+
+void
+load (
+  const LLRP_tSByteSwapKernel * pKernel,
+  unsigned int                  nBit,
+  void *                        pDst,
+  const llrp_u8_t *             pSrc,
+  unsigned int                  nValue)
+{
+    switch(nBit)
+    {
+    case 16u:   pKernel->pfLoad16(pDst, pSrc, nValue);  break;
+    case 32u:   pKernel->pfLoad32(pDst, pSrc, nValue);  break;
+    default:    pKernel->pfLoad64(pDst, pSrc, nValue);  break;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Host to frame order with the kernel for nBit
+ **
+ *****************************************************************************/
+
+void
+store (
+  const LLRP_tSByteSwapKernel * pKernel,
+  unsigned int                  nBit,
+  llrp_u8_t *                   pDst,
+  const void *                  pSrc,
+  unsigned int                  nValue)
+{
+    switch(nBit)
+    {
+    case 16u:   pKernel->pfStore16(pDst, pSrc, nValue); break;
+    case 32u:   pKernel->pfStore32(pDst, pSrc, nValue); break;
+    default:    pKernel->pfStore64(pDst, pSrc, nValue); break;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Monotonic clock in nanoseconds
+ **
+ *****************************************************************************/
+
+double
+nowNS (void)
+{
+    struct timespec             ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
@@ -0,0 +1,986 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  dx406.c
+ **
+ ** @brief Benchmark of type lookup by name and of XML decode
+ **
+ ** This is diagnostic 406 for the LLRP Tool Kit for C (LTKC).
+ **
+ ** DX406 needs no reader. It builds two type registries, one as
+ ** LLRP_enrollCoreTypesIntoRegistry() makes it and one with its
+ ** name indexes dropped, so LLRP_TypeRegistry_lookupByName()
+ ** falls back to comparing the name of every enrolled type.
+ **
+ ** First the enrolling itself is checked: a custom type enrolled
+ ** twice, one too many custom types, and enrolls that run out of
+ ** memory, both by hand and through
+ ** LLRP_enrollCoreTypesIntoRegistry(). Each must give its result
+ ** code, and every type enrolled must still be found, by number
+ ** and by name. For the memory, calloc() is wrapped (see the
+ ** Makefile) to fail when told to.
+ **
+ ** Then every enrolled type is looked up by name in both and the
+ ** answers compared, and the nanoseconds per lookup printed.
+ ** Then each XML file (by default the dx101 test vectors) is
+ ** decoded with both registries. Every message is encoded to a
+ ** binary frame and the frames compared. The microseconds per
+ ** message decoded are printed for each registry.
+ **
+ ** The dx101 vectors use the older all-capitals message names
+ ** (SET_READER_CONFIG), so with the current definitions every
+ ** message there fails at its first element, which times the
+ ** lookup of an unknown name. To time decodes that succeed, a
+ ** tag report with many tags is made and turned into XML, and
+ ** decoded the same way.
+ **
+ ** This program can be run with one verbose option (-v)
+ ** to print the repeat count of each measurement as well.
+ **
+ ** Exit status is 0 when both registries gave the same answers.
+ **
+ *****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../Library/ltkc.h"
+#include "libxml/parser.h"
+#include "libxml/tree.h"
+
+
+/*
+ * BEGIN forward declarations
+ */
+int
+main (
+  int                           ac,
+  char *                        av[]);
+
+void
+usage (
+  char *                        pProgName);
+
+int
+run (
+  char * const *                ppFileName,
+  unsigned int                  nFileName);
+
+int
+runEnroll (void);
+
+int
+checkEnrolled (
+  const LLRP_tSTypeRegistry *   pTypeRegistry,
+  const LLRP_tSTypeRegistry *   pReference);
+
+int
+expect (
+  int                           bOK,
+  const char *                  pWhat);
+
+void *
+__real_calloc (
+  size_t                        nMember,
+  size_t                        Size);
+
+void *
+__wrap_calloc (
+  size_t                        nMember,
+  size_t                        Size);
+
+int
+runLookup (void);
+
+int
+runFile (
+  const char *                  pFileName);
+
+int
+runReport (void);
+
+int
+runDoc (
+  const char *                  pName,
+  xmlNodePtr                    pFirstNode);
+
+int
+decodeAll (
+  LLRP_tSTypeRegistry *         pTypeRegistry,
+  xmlNodePtr                    pFirstNode,
+  unsigned char *               pOut,
+  unsigned int                  nOut,
+  unsigned int *                pnOut);
+
+double
+nowNS (void);
+/*
+ * END forward declarations
+ */
+
+
+/*
+ * Default files, the XML side of the dx101 test vectors
+ */
+static char * const             s_apDefaultFile[] =
+{
+    "../../Tests/dx101/dx101_a.xml",
+    "../../Tests/dx101/dx101_b.xml",
+    "../../Tests/dx101/dx101_e.xml",
+    "../../Tests/dx101/dx101_f.xml",
+};
+
+/*
+ * Each measurement runs for about this long
+ */
+#define N_NS_PER_RUN        (500e6)
+
+#define N_OUT_BYTES         (16u*1024u*1024u)
+
+#define N_XML_BYTES         (16u*1024u*1024u)
+
+#define N_REPORT_TAGS       (1000u)
+
+#define N_TYPE_NUM          (LTKC_TYPE_PAGE_COUNT * LTKC_TYPE_PAGE_SIZE)
+
+#define N_TYPE_MAX          (2u*N_TYPE_NUM + LTKC_MAX_CUSTOM_MESSAGE + \
+                                LTKC_MAX_CUSTOM_PARAMETER)
+
+/*
+ * Types made by hand for runEnroll(). First and Second are custom
+ * parameters with the same vendor and subtype, Standard is a
+ * standard parameter no definition uses, and there is one more of
+ * Many than a registry has room for.
+ */
+static LLRP_tSVendorDescriptor  s_vdescDX406 =
+{
+    .pName              = "DX406",
+    .VendorID           = 406u,
+};
+
+static LLRP_tSTypeDescriptor    s_tdFirst =
+{
+    .bIsMessage         = FALSE,
+    .pName              = "DX406First",
+    .pVendorDescriptor  = &s_vdescDX406,
+    .TypeNum            = 1u,
+};
+
+static LLRP_tSTypeDescriptor    s_tdSecond =
+{
+    .bIsMessage         = FALSE,
+    .pName              = "DX406Second",
+    .pVendorDescriptor  = &s_vdescDX406,
+    .TypeNum            = 1u,
+};
+
+static LLRP_tSTypeDescriptor    s_tdStandard =
+{
+    .bIsMessage         = FALSE,
+    .pName              = "DX406Standard",
+    .pVendorDescriptor  = NULL,
+    .TypeNum            = 2000u,
+};
+
+static const LLRP_tSTypeDescriptor * const s_apFirstSecond[] =
+{
+    &s_tdFirst,
+    &s_tdSecond,
+};
+
+static LLRP_tSTypeDescriptor    s_atdMany[LTKC_MAX_CUSTOM_PARAMETER + 1u];
+
+/*
+ * Global variables
+ */
+int                             g_Verbose;
+LLRP_tSTypeRegistry *           g_pIndexed;
+LLRP_tSTypeRegistry *           g_pScanned;
+unsigned char                   g_aOutIndexed[N_OUT_BYTES];
+unsigned char                   g_aOutScanned[N_OUT_BYTES];
+const char *                    g_apName[N_TYPE_MAX];
+char                            g_aXML[N_XML_BYTES];
+unsigned int                    g_nCallocFail;
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Command main routine
+ **
+ ** Command synopsis:
+ **
+ **     dx406 [-v] [XMLFILE ...]
+ **
+ ** @exitcode   0               Everything *seemed* to work.
+ **             1               Bad usage
+ **             2               Run failed
+ **
+ *****************************************************************************/
+
+int
+main (
+  int                           ac,
+  char *                        av[])
+{
+    int                         i = 1;
+    int                         rc;
+
+    if(i < ac && 0 == strcmp("-v", av[i]))
+    {
+        g_Verbose = 1;
+        i++;
+    }
+    if(i < ac && '-' == av[i][0])
+    {
+        usage(av[0]);
+        /* no return */
+    }
+
+    if(i < ac)
+    {
+        rc = run(&av[i], ac - i);
+    }
+    else
+    {
+        rc = run(s_apDefaultFile,
+            sizeof s_apDefaultFile / sizeof s_apDefaultFile[0]);
+    }
+
+    printf("INFO: Done\n");
+
+    exit(rc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Print usage message and exit
+ **
+ ** @param[in]  pProgName       Program name.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+usage (
+  char *                        pProgName)
+{
+    printf("Usage: %s [-v] [XMLFILE ...]\n", pProgName);
+    printf("\n");
+    printf("Each -v increases verbosity level\n");
+    printf("XMLFILE defaults to the dx101 test vectors\n");
+    exit(1);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Build the registries, then run the lookups and every file
+ **
+ ** @param[in]  ppFileName      XML files to decode
+ ** @param[in]  nFileName       How many
+ **
+ ** @return     0               Both registries agreed on everything
+ **             2               Something failed
+ **
+ *****************************************************************************/
+
+int
+run (
+  char * const *                ppFileName,
+  unsigned int                  nFileName)
+{
+    unsigned int                i;
+    int                         nFail = 0;
+
+    g_pIndexed = LLRP_TypeRegistry_construct();
+    g_pScanned = LLRP_TypeRegistry_construct();
+    if(NULL == g_pIndexed || NULL == g_pScanned)
+    {
+        printf("ERROR: TypeRegistry_construct failed\n");
+        return 2;
+    }
+    if(LLRP_RC_OK != LLRP_enrollCoreTypesIntoRegistry(g_pIndexed) ||
+       LLRP_RC_OK != LLRP_enrollCoreTypesIntoRegistry(g_pScanned))
+    {
+        printf("ERROR: enrollCoreTypesIntoRegistry failed\n");
+        return 2;
+    }
+
+    if(0 == g_pIndexed->nNameIndex)
+    {
+        printf("ERROR: registry has no name index\n");
+        return 2;
+    }
+    g_pScanned->nNameIndex = 0;
+    g_pScanned->nIndexedTypeDescriptors = 0;
+
+    xmlInitParser();
+    xmlLineNumbersDefault(1);
+
+    nFail += runEnroll();
+    nFail += runLookup();
+
+    printf("INFO: %-16s %6s %12s %12s\n",
+        "file", "msgs", "scan us/msg", "index us/msg");
+    for(i = 0; i < nFileName; i++)
+    {
+        nFail += runFile(ppFileName[i]);
+    }
+    nFail += runReport();
+
+    xmlCleanupParser();
+    LLRP_TypeRegistry_destruct(g_pScanned);
+    LLRP_TypeRegistry_destruct(g_pIndexed);
+
+    if(0 != nFail)
+    {
+        printf("ERROR: %d check(s) failed\n", nFail);
+        return 2;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check enrolls that are refused or run out of memory
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+runEnroll (void)
+{
+    LLRP_tSTypeRegistry *       pReg;
+    LLRP_tResultCode            rc;
+    unsigned int                i;
+    int                         nFail = 0;
+
+    /*
+     * The third page calloc() fails. The types enrolled before
+     * it are found by name without the index, which is left off.
+     * Enrolling again finishes the job.
+     */
+    pReg = LLRP_TypeRegistry_construct();
+    g_nCallocFail = 3u;
+    rc = LLRP_enrollCoreTypesIntoRegistry(pReg);
+    g_nCallocFail = 0;
+    nFail += expect(LLRP_RC_EnrollAllocationFailed == rc,
+        "core enroll out of memory gave the wrong result");
+    nFail += expect(0 == pReg->nNameIndex &&
+        0 < pReg->nEnrolledTypeDescriptors,
+        "core enroll out of memory enrolled the wrong types");
+    nFail += checkEnrolled(pReg, pReg);
+
+    rc = LLRP_enrollCoreTypesIntoRegistry(pReg);
+    nFail += expect(LLRP_RC_OK == rc && 1u == pReg->nNameIndex,
+        "core enroll after running out of memory failed");
+    nFail += checkEnrolled(pReg, g_pIndexed);
+    LLRP_TypeRegistry_destruct(pReg);
+
+    /*
+     * Custom hash calloc() fails
+     */
+    pReg = LLRP_TypeRegistry_construct();
+    g_nCallocFail = 1u;
+    rc = LLRP_TypeRegistry_enroll(pReg, &s_tdFirst);
+    g_nCallocFail = 0;
+    nFail += expect(LLRP_RC_EnrollAllocationFailed == rc &&
+        0 == pReg->nEnrolledTypeDescriptors &&
+        NULL == LLRP_TypeRegistry_lookupCustomParameter(pReg, 406u, 1u),
+        "custom enroll out of memory");
+    rc = LLRP_TypeRegistry_enroll(pReg, &s_tdFirst);
+    nFail += expect(LLRP_RC_OK == rc &&
+        &s_tdFirst == LLRP_TypeRegistry_lookupCustomParameter(pReg,
+            406u, 1u),
+        "custom enroll after running out of memory");
+
+    /*
+     * A second type with the same vendor and subtype is refused.
+     * With both in a name index, a standard type enrolled by hand
+     * after must still be found by name.
+     */
+    rc = LLRP_TypeRegistry_enroll(pReg, &s_tdSecond);
+    nFail += expect(LLRP_RC_EnrollDuplicateType == rc &&
+        &s_tdFirst == LLRP_TypeRegistry_lookupCustomParameter(pReg,
+            406u, 1u),
+        "duplicate custom enroll");
+    rc = LLRP_TypeRegistry_enrollNameIndex(pReg, s_apFirstSecond,
+        sizeof s_apFirstSecond / sizeof s_apFirstSecond[0]);
+    nFail += expect(LLRP_RC_OK == rc, "name index enroll");
+    rc = LLRP_TypeRegistry_enroll(pReg, &s_tdStandard);
+    nFail += expect(LLRP_RC_OK == rc &&
+        &s_tdFirst ==
+            LLRP_TypeRegistry_lookupByName(pReg, "DX406First") &&
+        NULL == LLRP_TypeRegistry_lookupByName(pReg, "DX406Second") &&
+        &s_tdStandard ==
+            LLRP_TypeRegistry_lookupByName(pReg, "DX406Standard"),
+        "lookup by name after a duplicate enroll");
+    LLRP_TypeRegistry_destruct(pReg);
+
+    /*
+     * One custom type too many
+     */
+    pReg = LLRP_TypeRegistry_construct();
+    for(i = 0; i <= LTKC_MAX_CUSTOM_PARAMETER; i++)
+    {
+        s_atdMany[i].bIsMessage = FALSE;
+        s_atdMany[i].pName = "DX406Many";
+        s_atdMany[i].pVendorDescriptor = &s_vdescDX406;
+        s_atdMany[i].TypeNum = i;
+        rc = LLRP_TypeRegistry_enroll(pReg, &s_atdMany[i]);
+        if(i < LTKC_MAX_CUSTOM_PARAMETER ? LLRP_RC_OK != rc :
+           LLRP_RC_EnrollTooManyTypes != rc)
+        {
+            printf("ERROR: enroll: custom type %u gave %d\n", i, rc);
+            nFail++;
+        }
+    }
+    for(i = 0; i <= LTKC_MAX_CUSTOM_PARAMETER; i++)
+    {
+        const LLRP_tSTypeDescriptor *pType;
+
+        pType = LLRP_TypeRegistry_lookupCustomParameter(pReg, 406u, i);
+        if(pType != (i < LTKC_MAX_CUSTOM_PARAMETER ? &s_atdMany[i] : NULL))
+        {
+            printf("ERROR: enroll: custom type %u not as enrolled\n", i);
+            nFail++;
+        }
+    }
+    LLRP_TypeRegistry_destruct(pReg);
+
+    printf("INFO: enroll checks %s\n", nFail ? "FAIL" : "PASS");
+
+    return nFail ? 1 : 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check every standard type of a registry is found by name
+ **
+ ** @param[in]  pTypeRegistry   The registry to check
+ ** @param[in]  pReference      The registry that has the types it
+ **                             should have
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+checkEnrolled (
+  const LLRP_tSTypeRegistry *   pTypeRegistry,
+  const LLRP_tSTypeRegistry *   pReference)
+{
+    unsigned int                i;
+    int                         nFail = 0;
+
+    for(i = 0; i < N_TYPE_NUM; i++)
+    {
+        const LLRP_tSTypeDescriptor *pType;
+
+        pType = LLRP_TypeRegistry_lookupMessage(pReference, i);
+        if(pType != LLRP_TypeRegistry_lookupMessage(pTypeRegistry, i) ||
+           (NULL != pType &&
+            pType != LLRP_TypeRegistry_lookupByName(pTypeRegistry,
+                        pType->pName)))
+        {
+            printf("ERROR: enroll: message %u not as enrolled\n", i);
+            nFail = 1;
+        }
+        pType = LLRP_TypeRegistry_lookupParameter(pReference, i);
+        if(pType != LLRP_TypeRegistry_lookupParameter(pTypeRegistry, i) ||
+           (NULL != pType &&
+            pType != LLRP_TypeRegistry_lookupByName(pTypeRegistry,
+                        pType->pName)))
+        {
+            printf("ERROR: enroll: parameter %u not as enrolled\n", i);
+            nFail = 1;
+        }
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Count a failed check
+ **
+ ** @param[in]  bOK             The check passed
+ ** @param[in]  pWhat           What to print if it did not
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+expect (
+  int                           bOK,
+  const char *                  pWhat)
+{
+    if(!bOK)
+    {
+        printf("ERROR: enroll: %s\n", pWhat);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  calloc(), failing when g_nCallocFail counts down to it
+ **
+ ** The Makefile links dx406 with -Wl,--wrap=calloc, so the
+ ** library's calloc() calls come here.
+ **
+ *****************************************************************************/
+
+void *
+__wrap_calloc (
+  size_t                        nMember,
+  size_t                        Size)
+{
+    if(0 != g_nCallocFail && 0 == --g_nCallocFail)
+    {
+        return NULL;
+    }
+
+    return __real_calloc(nMember, Size);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check and time lookupByName() on every enrolled type
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+runLookup (void)
+{
+    const LLRP_tSTypeRegistry * pReg = g_pIndexed;
+    const LLRP_tSTypeRegistry * apReg[2];
+    double                      aNS[2];
+    unsigned int                nName = 0;
+    unsigned int                nRep;
+    unsigned int                iRep;
+    unsigned int                i;
+    unsigned int                j;
+    int                         nFail = 0;
+
+    for(i = 0; i < N_TYPE_NUM; i++)
+    {
+        const LLRP_tSTypeDescriptor *pType;
+
+        pType = LLRP_TypeRegistry_lookupMessage(pReg, i);
+        if(NULL != pType)
+        {
+            g_apName[nName++] = pType->pName;
+        }
+        pType = LLRP_TypeRegistry_lookupParameter(pReg, i);
+        if(NULL != pType)
+        {
+            g_apName[nName++] = pType->pName;
+        }
+    }
+    for(i = 0; i < pReg->nCustMessageTypeDescriptors; i++)
+    {
+        g_apName[nName++] = pReg->apCustMessageTypeDescriptors[i]->pName;
+    }
+    for(i = 0; i < pReg->nCustParameterTypeDescriptors; i++)
+    {
+        g_apName[nName++] = pReg->apCustParameterTypeDescriptors[i]->pName;
+    }
+
+    /*
+     * Check. Both must find the same type, and that type
+     * must have the name asked for.
+     */
+    for(i = 0; i < nName; i++)
+    {
+        const LLRP_tSTypeDescriptor *pIndexed;
+        const LLRP_tSTypeDescriptor *pScanned;
+
+        pIndexed = LLRP_TypeRegistry_lookupByName(g_pIndexed, g_apName[i]);
+        pScanned = LLRP_TypeRegistry_lookupByName(g_pScanned, g_apName[i]);
+        if(NULL == pIndexed || pIndexed != pScanned ||
+           0 != strcmp(pIndexed->pName, g_apName[i]))
+        {
+            printf("ERROR: lookup of %s differs\n", g_apName[i]);
+            nFail = 1;
+        }
+    }
+    if(NULL != LLRP_TypeRegistry_lookupByName(g_pIndexed, "NoSuchType") ||
+       NULL != LLRP_TypeRegistry_lookupByName(g_pIndexed, ""))
+    {
+        printf("ERROR: lookup of an unknown name found something\n");
+        nFail = 1;
+    }
+
+    /*
+     * Time
+     */
+    apReg[0] = g_pScanned;
+    apReg[1] = g_pIndexed;
+    nRep = 1u;
+    for(j = 0; j < 2u; j++)
+    {
+        double                  t0;
+        double                  t;
+
+        for(;;)
+        {
+            t0 = nowNS();
+            for(iRep = 0; iRep < nRep; iRep++)
+            {
+                for(i = 0; i < nName; i++)
+                {
+                    LLRP_TypeRegistry_lookupByName(apReg[j], g_apName[i]);
+                }
+            }
+            t = nowNS() - t0;
+            if(t >= N_NS_PER_RUN / 10.0)
+            {
+                break;
+            }
+            nRep *= 2u;
+        }
+        aNS[j] = t / nRep / nName;
+        if(g_Verbose)
+        {
+            printf("INFO: %u repeats\n", nRep);
+        }
+    }
+
+    printf("INFO: %u names, scan %.1f ns/lookup, index %.1f ns/lookup %s\n",
+        nName, aNS[0], aNS[1], nFail ? "FAIL" : "PASS");
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check and time the decode of one XML file
+ **
+ ** @param[in]  pFileName       The file, a packetSequence
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+runFile (
+  const char *                  pFileName)
+{
+    const char *                pBaseName;
+    xmlDocPtr                   pDoc;
+    xmlNodePtr                  pNode;
+    int                         nFail;
+
+    pBaseName = strrchr(pFileName, '/');
+    pBaseName = (NULL == pBaseName) ? pFileName : pBaseName + 1;
+
+    pDoc = xmlReadFile(pFileName, NULL, XML_PARSE_COMPACT | XML_PARSE_NONET);
+    if(NULL == pDoc)
+    {
+        printf("ERROR: %s: could not read XML file\n", pFileName);
+        return 1;
+    }
+
+    pNode = xmlDocGetRootElement(pDoc);
+    if(NULL == pNode || 0 != strcmp((char *) pNode->name, "packetSequence"))
+    {
+        printf("ERROR: %s: no packetSequence\n", pFileName);
+        xmlFreeDoc(pDoc);
+        return 1;
+    }
+
+    nFail = runDoc(pBaseName, pNode->children);
+
+    xmlFreeDoc(pDoc);
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check and time the decode of a made up tag report
+ **
+ ** The report has N_REPORT_TAGS tags, each with an EPC, a TID and
+ ** most of the optional parameters, so there are many elements
+ ** to look up for each message.
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+runReport (void)
+{
+    LLRP_tSTagSelectAccessReport *pReport;
+    LLRP_tResultCode            rc;
+    xmlDocPtr                   pDoc;
+    unsigned int                i;
+    int                         nFail;
+
+    pReport = LLRP_TagSelectAccessReport_construct();
+    for(i = 0; i < N_REPORT_TAGS; i++)
+    {
+        LLRP_tSTagReportData *  pTag = LLRP_TagReportData_construct();
+        LLRP_tSAntennaID *      pAntennaID = LLRP_AntennaID_construct();
+        LLRP_tSPeakRSSI *       pPeakRSSI = LLRP_PeakRSSI_construct();
+        LLRP_tSTagSeenCount *   pTagSeenCount = LLRP_TagSeenCount_construct();
+        LLRP_tSFirstSeenTimestampUTC *pFirstSeen;
+        llrp_u8v_t              TID = LLRP_u8v_construct(12u);
+
+        memset(TID.pValue, i, TID.nValue);
+        LLRP_TagReportData_setTID(pTag, TID);
+
+        pAntennaID->AntennaID = 1u + i % 4u;
+        LLRP_TagReportData_setAntennaID(pTag, pAntennaID);
+        pPeakRSSI->PeakRSSI = -40 - (int) (i % 30u);
+        LLRP_TagReportData_setPeakRSSI(pTag, pPeakRSSI);
+        pTagSeenCount->TagCount = 1u + i % 7u;
+        LLRP_TagReportData_setTagSeenCount(pTag, pTagSeenCount);
+        pFirstSeen = LLRP_FirstSeenTimestampUTC_construct();
+        pFirstSeen->Microseconds = 1476000000000000llu + i;
+        LLRP_TagReportData_setFirstSeenTimestampUTC(pTag, pFirstSeen);
+
+        LLRP_TagSelectAccessReport_addTagReportData(pReport, pTag);
+    }
+
+    rc = LLRP_toXMLString(&pReport->hdr.elementHdr, g_aXML, sizeof g_aXML);
+    LLRP_Element_destruct(&pReport->hdr.elementHdr);
+    if(LLRP_RC_OK != rc)
+    {
+        printf("ERROR: toXMLString of the report failed %d\n", rc);
+        return 1;
+    }
+
+    pDoc = xmlReadMemory(g_aXML, strlen(g_aXML), NULL, NULL,
+        XML_PARSE_COMPACT | XML_PARSE_NONET);
+    if(NULL == pDoc)
+    {
+        printf("ERROR: could not read the report XML\n");
+        return 1;
+    }
+
+    nFail = runDoc("tag report", xmlDocGetRootElement(pDoc));
+
+    xmlFreeDoc(pDoc);
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check and time the decode of a list of message nodes
+ **
+ ** @param[in]  pName           What to call them in the output
+ ** @param[in]  pFirstNode      First message node
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+runDoc (
+  const char *                  pName,
+  xmlNodePtr                    pFirstNode)
+{
+    unsigned int                nOutIndexed;
+    unsigned int                nOutScanned;
+    int                         nMessage;
+    double                      aUS[2];
+    unsigned int                j;
+    int                         nFail = 0;
+
+    /*
+     * Check. Messages that do not decode are part of the test
+     * vectors; both registries must fail on the same ones.
+     */
+    nMessage = decodeAll(g_pScanned, pFirstNode,
+        g_aOutScanned, sizeof g_aOutScanned, &nOutScanned);
+    if(nMessage != decodeAll(g_pIndexed, pFirstNode,
+        g_aOutIndexed, sizeof g_aOutIndexed, &nOutIndexed) ||
+       nOutIndexed != nOutScanned ||
+       0 != memcmp(g_aOutIndexed, g_aOutScanned, nOutIndexed))
+    {
+        printf("ERROR: %s: frames differ\n", pName);
+        nFail = 1;
+    }
+
+    /*
+     * Time
+     */
+    for(j = 0; j < 2u; j++)
+    {
+        LLRP_tSTypeRegistry *   pReg = j ? g_pIndexed : g_pScanned;
+        unsigned int            nRep = 0;
+        double                  t0;
+        double                  t;
+
+        t0 = nowNS();
+        do
+        {
+            decodeAll(pReg, pFirstNode,
+                g_aOutIndexed, sizeof g_aOutIndexed, &nOutIndexed);
+            nRep++;
+            t = nowNS() - t0;
+        } while(t < N_NS_PER_RUN / 2.0);
+        aUS[j] = t / 1e3 / nRep / (nMessage ? nMessage : 1);
+        if(g_Verbose)
+        {
+            printf("INFO: %u repeats\n", nRep);
+        }
+    }
+
+    printf("INFO: %-16s %6d %12.2f %12.2f %s\n",
+        pName, nMessage, aUS[0], aUS[1], nFail ? "FAIL" : "PASS");
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Decode every message in a packetSequence and encode it
+ **
+ ** Messages are encoded one after the other into the output
+ ** buffer. A message that does not decode or encode adds a single
+ ** zero byte, so where the failures are is part of the output.
+ **
+ ** @param[in]  pTypeRegistry   Registry to decode with
+ ** @param[in]  pFirstNode      First child of the packetSequence
+ ** @param[out] pOut            Output buffer
+ ** @param[in]  nOut            Its size
+ ** @param[out] pnOut           Bytes of output
+ **
+ ** @return     Count of messages
+ **
+ *****************************************************************************/
+
+int
+decodeAll (
+  LLRP_tSTypeRegistry *         pTypeRegistry,
+  xmlNodePtr                    pFirstNode,
+  unsigned char *               pOut,
+  unsigned int                  nOut,
+  unsigned int *                pnOut)
+{
+    LLRP_tSFrameEncoder         Encoder;
+    xmlNodePtr                  pNode;
+    unsigned int                iOut = 0;
+    int                         nMessage = 0;
+
+    for(pNode = pFirstNode; NULL != pNode; pNode = pNode->next)
+    {
+        LLRP_tSLibXMLTextDecoder *pDecoder;
+        LLRP_tSMessage *        pMessage;
+
+        if(XML_ELEMENT_NODE != pNode->type)
+        {
+            continue;
+        }
+        nMessage++;
+
+        pDecoder = LLRP_LibXMLTextDecoder_construct_nodetree(pTypeRegistry,
+                                                             pNode);
+        if(NULL == pDecoder)
+        {
+            break;
+        }
+        pMessage = LLRP_Decoder_decodeMessage(&pDecoder->decoderHdr);
+        LLRP_Decoder_destruct(&pDecoder->decoderHdr);
+
+        if(NULL != pMessage)
+        {
+            LLRP_FrameEncoder_init(&Encoder, pOut + iOut, nOut - iOut - 1u);
+            LLRP_Encoder_encodeElement(&Encoder.encoderHdr,
+                                       &pMessage->elementHdr);
+            LLRP_Element_destruct(&pMessage->elementHdr);
+            if(LLRP_RC_OK == Encoder.encoderHdr.ErrorDetails.eResultCode)
+            {
+                iOut += Encoder.iNext;
+                continue;
+            }
+        }
+
+        pOut[iOut++] = 0;
+    }
+
+    *pnOut = iOut;
+
+    return nMessage;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Monotonic clock in nanoseconds
+ **
+ *****************************************************************************/
+
+double
+nowNS (void)
+{
+    struct timespec             ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
@@ -0,0 +1,623 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  dx407.c
+ **
+ ** @brief Test of LTKC transactions with callbacks
+ **
+ ** This is diagnostic 407 for the LLRP Tool Kit for C (LTKC).
+ **
+ ** DX407 needs no reader. A LLRP_tSConnection is handed one end
+ ** of a socket pair, and this process plays the reader on the
+ ** other end, reading the requests and writing the responses.
+ ** Each case submits Keepalive requests with callbacks and
+ ** checks which callbacks LLRP_Conn_transactPoll() makes:
+ **     - respond: every request gets a KeepaliveAck, and every
+ **       callback has the right response
+ **     - cancel+destruct: some are cancelled, so finished with
+ **       their callbacks not yet made, and some of those are then
+ **       destructed by the application. Only the others are called
+ **       back, and one cancelled after that still is.
+ **
+ ** Run it under a memory checker too; a transaction that is
+ ** called back after being destructed may not fail otherwise.
+ **
+ ** This program can be run with one verbose option (-v)
+ ** to print every callback.
+ **
+ ** Exit status is 0 when every case passes.
+ **
+ *****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#include "../Library/ltkc.h"
+
+
+/*
+ * BEGIN forward declarations
+ */
+int
+main (
+  int                           ac,
+  char *                        av[]);
+
+void
+usage (
+  char *                        pProgName);
+
+int
+run (void);
+
+int
+caseRespond (void);
+
+int
+caseCancelDestruct (void);
+
+LLRP_tSConnection *
+openPair (
+  int *                         pPeerFd);
+
+LLRP_tSTransact *
+submitKeepalive (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  iDone);
+
+void
+onDone (
+  LLRP_tSTransact *             pTransact,
+  void *                        pAppContext);
+
+int
+respond (
+  int                           PeerFd,
+  unsigned int                  nRequest);
+
+int
+checkDone (
+  const char *                  pCaseName,
+  unsigned int                  iDone,
+  unsigned int                  nExpectCalls,
+  LLRP_tResultCode              eExpectResult);
+/*
+ * END forward declarations
+ */
+
+
+/*
+ * Transactions per case
+ */
+#define N_TRANSACT      (4u)
+
+/*
+ * What a callback saw, one per transaction
+ */
+typedef struct
+{
+    unsigned int                nCalls;
+    LLRP_tResultCode            eResultCode;
+    llrp_u32_t                  RequestID;
+    llrp_u32_t                  ResponseID;
+} tDone;
+
+/*
+ * Global variables
+ */
+int                             g_Verbose;
+LLRP_tSTypeRegistry *           g_pTypeRegistry;
+tDone                           g_aDone[N_TRANSACT];
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Command main routine
+ **
+ ** Command synopsis:
+ **
+ **     dx407 [-v]
+ **
+ ** @exitcode   0               Everything *seemed* to work.
+ **             1               Bad usage
+ **             2               Run failed
+ **
+ *****************************************************************************/
+
+int
+main (
+  int                           ac,
+  char *                        av[])
+{
+    int                         rc;
+
+    if(ac == 2 && 0 == strcmp("-v", av[1]))
+    {
+        g_Verbose = 1;
+    }
+    else if(ac != 1)
+    {
+        usage(av[0]);
+        /* no return */
+    }
+
+    rc = run();
+
+    printf("INFO: Done\n");
+
+    exit(rc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Print usage message and exit
+ **
+ ** @param[in]  pProgName       Program name.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+usage (
+  char *                        pProgName)
+{
+    printf("Usage: %s [-v]\n", pProgName);
+    printf("\n");
+    printf("Each -v increases verbosity level\n");
+    exit(1);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Run every case
+ **
+ ** @return     0               Every case passed
+ **             2               Something failed
+ **
+ *****************************************************************************/
+
+int
+run (void)
+{
+    int                         nFail = 0;
+
+    g_pTypeRegistry = LLRP_getTheTypeRegistry();
+    if(NULL == g_pTypeRegistry)
+    {
+        printf("ERROR: getTheTypeRegistry failed\n");
+        return 2;
+    }
+
+    nFail += caseRespond();
+    nFail += caseCancelDestruct();
+
+    LLRP_TypeRegistry_destruct(g_pTypeRegistry);
+
+    if(0 != nFail)
+    {
+        printf("ERROR: %d check(s) failed\n", nFail);
+        return 2;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Every request gets its response
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseRespond (void)
+{
+    LLRP_tSConnection *         pConn;
+    int                         PeerFd;
+    unsigned int                i;
+    int                         nFail = 0;
+
+    pConn = openPair(&PeerFd);
+    if(NULL == pConn)
+    {
+        return 1;
+    }
+
+    for(i = 0; i < N_TRANSACT; i++)
+    {
+        if(NULL == submitKeepalive(pConn, i))
+        {
+            nFail++;
+        }
+    }
+
+    nFail += respond(PeerFd, N_TRANSACT);
+
+    while(0 < LLRP_Conn_getTransactPendingCount(pConn))
+    {
+        if(LLRP_RC_OK != LLRP_Conn_transactPoll(pConn, 1000))
+        {
+            printf("ERROR: respond: transactPoll failed\n");
+            nFail++;
+            break;
+        }
+    }
+
+    for(i = 0; i < N_TRANSACT; i++)
+    {
+        nFail += checkDone("respond", i, 1, LLRP_RC_OK);
+        if(g_aDone[i].ResponseID != g_aDone[i].RequestID)
+        {
+            printf("ERROR: respond: %u: response ID %u for request %u\n",
+                i, g_aDone[i].ResponseID, g_aDone[i].RequestID);
+            nFail++;
+        }
+    }
+
+    LLRP_Conn_destruct(pConn);
+    close(PeerFd);
+
+    if(0 == nFail)
+    {
+        printf("INFO: respond PASS\n");
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Destruct transactions whose callbacks are not yet made
+ **
+ ** Transactions 0, 1 and 3 are cancelled, which puts them on the
+ ** done list in that order. 1 (the middle) and 3 (the tail) are
+ ** then destructed, and 2 cancelled after, which appends it.
+ ** The next poll must call back 0 and 2 only.
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseCancelDestruct (void)
+{
+    LLRP_tSConnection *         pConn;
+    LLRP_tSTransact *           apTransact[N_TRANSACT];
+    int                         PeerFd;
+    unsigned int                i;
+    int                         nFail = 0;
+
+    pConn = openPair(&PeerFd);
+    if(NULL == pConn)
+    {
+        return 1;
+    }
+
+    for(i = 0; i < N_TRANSACT; i++)
+    {
+        apTransact[i] = submitKeepalive(pConn, i);
+        if(NULL == apTransact[i])
+        {
+            LLRP_Conn_destruct(pConn);
+            close(PeerFd);
+            return 1;
+        }
+    }
+
+    LLRP_Transact_cancel(apTransact[0]);
+    LLRP_Transact_cancel(apTransact[1]);
+    LLRP_Transact_cancel(apTransact[3]);
+    LLRP_Transact_destruct(apTransact[1]);
+    LLRP_Transact_destruct(apTransact[3]);
+    LLRP_Transact_cancel(apTransact[2]);
+
+    if(0 != LLRP_Conn_getTransactPendingCount(pConn))
+    {
+        printf("ERROR: cancel+destruct: transactions still pending\n");
+        nFail++;
+    }
+
+    LLRP_Conn_transactPoll(pConn, 0);
+
+    nFail += checkDone("cancel+destruct", 0, 1, LLRP_RC_TransactCancelled);
+    nFail += checkDone("cancel+destruct", 1, 0, LLRP_RC_OK);
+    nFail += checkDone("cancel+destruct", 2, 1, LLRP_RC_TransactCancelled);
+    nFail += checkDone("cancel+destruct", 3, 0, LLRP_RC_OK);
+
+    /*
+     * Nothing left for another poll, nor for the destruct
+     */
+    LLRP_Conn_transactPoll(pConn, 0);
+    LLRP_Conn_destruct(pConn);
+    close(PeerFd);
+
+    nFail += checkDone("cancel+destruct", 0, 1, LLRP_RC_TransactCancelled);
+    nFail += checkDone("cancel+destruct", 2, 1, LLRP_RC_TransactCancelled);
+
+    if(0 == nFail)
+    {
+        printf("INFO: cancel+destruct PASS\n");
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Make a connection on one end of a socket pair
+ **
+ ** Also clears the callback records.
+ **
+ ** @param[out] pPeerFd         The other end, for the reader side
+ **
+ ** @return     The connection, NULL on failure
+ **
+ *****************************************************************************/
+
+LLRP_tSConnection *
+openPair (
+  int *                         pPeerFd)
+{
+    LLRP_tSConnection *         pConn;
+    int                         aFd[2];
+
+    memset(g_aDone, 0, sizeof g_aDone);
+
+    pConn = LLRP_Conn_construct(g_pTypeRegistry, 32u*1024u);
+    if(NULL == pConn)
+    {
+        printf("ERROR: Conn_construct failed\n");
+        return NULL;
+    }
+
+    if(0 != socketpair(AF_UNIX, SOCK_STREAM, 0, aFd))
+    {
+        printf("ERROR: socketpair failed\n");
+        LLRP_Conn_destruct(pConn);
+        return NULL;
+    }
+
+    /*
+     * The connection is normally opened by name. Here it is
+     * simply handed the already connected socket.
+     */
+    pConn->fd = aFd[0];
+    *pPeerFd = aFd[1];
+
+    return pConn;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Submit a Keepalive with a callback
+ **
+ ** @param[in]  pConn           The connection
+ ** @param[in]  iDone           Which g_aDone[] the callback fills in
+ **
+ ** @return     The transaction, NULL on failure
+ **
+ *****************************************************************************/
+
+LLRP_tSTransact *
+submitKeepalive (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  iDone)
+{
+    LLRP_tSKeepalive *          pKeepalive;
+    LLRP_tSTransact *           pTransact;
+
+    pKeepalive = LLRP_Keepalive_construct();
+    pKeepalive->hdr.Version = 1;
+
+    pTransact = LLRP_Conn_transactSubmit(pConn, &pKeepalive->hdr,
+        &LLRP_tdKeepaliveAck, 1000, onDone, &g_aDone[iDone]);
+    if(NULL == pTransact)
+    {
+        printf("ERROR: transactSubmit failed\n");
+    }
+    else
+    {
+        g_aDone[iDone].RequestID = pKeepalive->hdr.MessageID;
+    }
+
+    LLRP_Element_destruct(&pKeepalive->hdr.elementHdr);
+
+    return pTransact;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Transaction callback, records what it saw
+ **
+ ** @param[in]  pTransact       The finished transaction
+ ** @param[in]  pAppContext     Its tDone
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+onDone (
+  LLRP_tSTransact *             pTransact,
+  void *                        pAppContext)
+{
+    tDone *                     pDone = (tDone *) pAppContext;
+    LLRP_tSMessage *            pResponse;
+
+    pDone->nCalls++;
+    pDone->eResultCode = LLRP_Transact_getError(pTransact)->eResultCode;
+
+    pResponse = LLRP_Transact_takeResponse(pTransact);
+    if(NULL != pResponse)
+    {
+        pDone->ResponseID = pResponse->MessageID;
+        LLRP_Element_destruct(&pResponse->elementHdr);
+    }
+
+    if(g_Verbose)
+    {
+        printf("INFO: callback for request %u, result %d\n",
+            pDone->RequestID, pDone->eResultCode);
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Play the reader: answer requests with KeepaliveAck
+ **
+ ** @param[in]  PeerFd          The reader end of the pair
+ ** @param[in]  nRequest        How many requests to read and answer
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+respond (
+  int                           PeerFd,
+  unsigned int                  nRequest)
+{
+    unsigned char               aFrame[256];
+    unsigned int                i;
+
+    for(i = 0; i < nRequest; i++)
+    {
+        LLRP_tSKeepaliveAck *   pAck;
+        LLRP_tSFrameEncoder *   pEncoder;
+        unsigned int            nLength;
+        unsigned int            nFrame = 0;
+        llrp_u32_t              MessageID;
+
+        /*
+         * Header: DeviceSN(8) Version(1) Type(2) Length(4)
+         * MessageID(4), then Length bytes of body
+         */
+        if(19 != recv(PeerFd, aFrame, 19, MSG_WAITALL))
+        {
+            printf("ERROR: reader side: short request header\n");
+            return 1;
+        }
+        nLength = (aFrame[11] << 24) | (aFrame[12] << 16) |
+                  (aFrame[13] << 8) | aFrame[14];
+        MessageID = (aFrame[15] << 24) | (aFrame[16] << 16) |
+                    (aFrame[17] << 8) | aFrame[18];
+        if(nLength > sizeof aFrame ||
+           (0 < nLength &&
+            (int)nLength != recv(PeerFd, aFrame, nLength, MSG_WAITALL)))
+        {
+            printf("ERROR: reader side: bad request body\n");
+            return 1;
+        }
+
+        pAck = LLRP_KeepaliveAck_construct();
+        LLRP_Message_setMessageID(&pAck->hdr, MessageID);
+        pAck->hdr.Version = 1;
+
+        pEncoder = LLRP_FrameEncoder_construct(aFrame, sizeof aFrame);
+        if(NULL != pEncoder)
+        {
+            LLRP_Encoder_encodeElement(&pEncoder->encoderHdr,
+                &pAck->hdr.elementHdr);
+            if(LLRP_RC_OK == pEncoder->encoderHdr.ErrorDetails.eResultCode)
+            {
+                nFrame = pEncoder->iNext;
+            }
+            LLRP_Encoder_destruct(&pEncoder->encoderHdr);
+        }
+        LLRP_Element_destruct(&pAck->hdr.elementHdr);
+
+        if(0 == nFrame ||
+           (ssize_t)nFrame != write(PeerFd, aFrame, nFrame))
+        {
+            printf("ERROR: reader side: can't send response\n");
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check the callbacks made for one transaction
+ **
+ ** @param[in]  pCaseName       For messages
+ ** @param[in]  iDone           Which g_aDone[]
+ ** @param[in]  nExpectCalls    0 or 1
+ ** @param[in]  eExpectResult   Result expected if called
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+checkDone (
+  const char *                  pCaseName,
+  unsigned int                  iDone,
+  unsigned int                  nExpectCalls,
+  LLRP_tResultCode              eExpectResult)
+{
+    tDone *                     pDone = &g_aDone[iDone];
+
+    if(pDone->nCalls != nExpectCalls)
+    {
+        printf("ERROR: %s: %u: %u callback(s), expected %u\n",
+            pCaseName, iDone, pDone->nCalls, nExpectCalls);
+        return 1;
+    }
+
+    if(0 < nExpectCalls && pDone->eResultCode != eExpectResult)
+    {
+        printf("ERROR: %s: %u: result %d, expected %d\n",
+            pCaseName, iDone, pDone->eResultCode, eExpectResult);
+        return 1;
+    }
+
+    return 0;
+}
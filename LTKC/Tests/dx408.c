@@ -0,0 +1,1101 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  dx408.c
+ **
+ ** @brief Check the streaming decoder against the element decoder
+ **
+ ** This is diagnostic 408 for the LLRP Tool Kit for C (LTKC).
+ **
+ ** DX408 needs no reader. It builds TagSelectAccessReports whose
+ ** TagReportData have TIDs of every length and a random choice of
+ ** the optional sub-parameters, encodes each, and decodes the frame
+ ** three ways:
+ **     - LLRP_Decoder_decodeMessage(), the reference
+ **     - LLRP_FrameDecoder_stream(), gathering each TagReportData
+ **       from the callbacks
+ **     - LLRP_TagReportDataColumns_decodeFrame(), twice, to check
+ **       rows accumulate across frames
+ **
+ ** All must give the same tags, in the same order, with the
+ ** same sub-parameters present and the same values in them.
+ **
+ ** This program can be run with one verbose option (-v)
+ ** to print the frame sizes as well.
+ **
+ ** Exit status is 0 when every report matched.
+ **
+ *****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../Library/ltkc.h"
+
+
+/*
+ * The TagReportData values compared, one row per tag.
+ * The sub-parameters are in frame order, see s_apRowType.
+ */
+#define N_ROW_VALUE     (9u)
+#define N_TID_MAX       (40u)
+
+typedef struct
+{
+    unsigned int                nTID;
+    llrp_u8_t                   aTID[N_TID_MAX];
+    unsigned int                Present;
+    llrp_u64_t                  aValue[N_ROW_VALUE];
+} tRow;
+
+/*
+ * What the stream callbacks gather
+ */
+typedef struct
+{
+    tRow *                      aRow;
+    unsigned int                nRow;
+    unsigned int                nRowMax;
+    unsigned int                nBegin;
+    unsigned int                nEnd;
+    int                         bInRow;
+} tStreamGather;
+
+
+/*
+ * BEGIN forward declarations
+ */
+int
+main (
+  int                           ac,
+  char *                        av[]);
+
+void
+usage (
+  char *                        pProgName);
+
+int
+run (void);
+
+int
+runOne (
+  unsigned int                  nTag);
+
+LLRP_tSTagSelectAccessReport *
+buildReport (
+  unsigned int                  nTag);
+
+unsigned int
+encodeReport (
+  LLRP_tSTagSelectAccessReport *pReport,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+LLRP_tSTagSelectAccessReport *
+decodeReport (
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+tRow *
+treeRows (
+  LLRP_tSTagSelectAccessReport *pReport,
+  unsigned int                  nTag);
+
+int
+checkStream (
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer,
+  const tRow *                  aRow,
+  unsigned int                  nTag);
+
+int
+streamBegin (
+  void *                        pContext,
+  const LLRP_tSTypeDescriptor * pType);
+
+void
+streamField (
+  void *                        pContext,
+  const LLRP_tSTypeDescriptor * pType,
+  const LLRP_tSFieldDescriptor *pField,
+  const LLRP_tSFrameStreamField *pValue);
+
+void
+streamEnd (
+  void *                        pContext,
+  const LLRP_tSTypeDescriptor * pType);
+
+int
+checkColumns (
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer,
+  const tRow *                  aRow,
+  unsigned int                  nTag);
+
+tRow *
+columnRows (
+  LLRP_tSTagReportDataColumns * pColumns);
+
+int
+compareRows (
+  const char *                  pWhat,
+  const tRow *                  aExpect,
+  const tRow *                  aGot,
+  unsigned int                  nRow);
+
+unsigned int
+nextRandom (void);
+/*
+ * END forward declarations
+ */
+
+
+/*
+ * Report sizes to try
+ */
+static const unsigned int       s_anTag[] = { 0u, 1u, 100u, 5000u };
+
+/*
+ * The TagReportData sub-parameters compared, in frame order.
+ * Each has one field; its value goes in tRow.aValue[i] and
+ * bit i of tRow.Present says the sub-parameter is there.
+ */
+static const LLRP_tSTypeDescriptor * const s_apRowType[N_ROW_VALUE] =
+{
+    &LLRP_tdSelectSpecID,
+    &LLRP_tdSpecIndex,
+    &LLRP_tdRfSpecID,
+    &LLRP_tdAntennaID,
+    &LLRP_tdPeakRSSI,
+    &LLRP_tdFirstSeenTimestampUTC,
+    &LLRP_tdLastSeenTimestampUTC,
+    &LLRP_tdTagSeenCount,
+    &LLRP_tdAccessSpecID,
+};
+
+/*
+ * Room to encode the largest report. A tag is TagReportData,
+ * a TID of up to N_TID_MAX bytes and every sub-parameter.
+ */
+#define N_TAG_BYTES     (128u)
+
+/*
+ * Global variables
+ */
+int                             g_Verbose;
+LLRP_tSTypeRegistry *           g_pTypeRegistry;
+unsigned int                    g_Random = 408u;
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Command main routine
+ **
+ ** Command synopsis:
+ **
+ **     dx408 [-v]
+ **
+ ** @exitcode   0               Everything *seemed* to work.
+ **             1               Bad usage
+ **             2               Run failed
+ **
+ *****************************************************************************/
+
+int
+main (
+  int                           ac,
+  char *                        av[])
+{
+    int                         rc;
+
+    if(ac == 2 && 0 == strcmp("-v", av[1]))
+    {
+        g_Verbose = 1;
+    }
+    else if(ac != 1)
+    {
+        usage(av[0]);
+        /* no return */
+    }
+
+    rc = run();
+
+    printf("INFO: Done\n");
+
+    exit(rc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Print usage message and exit
+ **
+ ** @param[in]  pProgName       Program name.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+usage (
+  char *                        pProgName)
+{
+    printf("Usage: %s [-v]\n", pProgName);
+    printf("\n");
+    printf("Each -v increases verbosity level\n");
+    exit(1);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Run every report size
+ **
+ ** @return     0               Every size passed
+ **             2               Something failed
+ **
+ *****************************************************************************/
+
+int
+run (void)
+{
+    unsigned int                i;
+    int                         nFail = 0;
+
+    g_pTypeRegistry = LLRP_getTheTypeRegistry();
+    if(NULL == g_pTypeRegistry)
+    {
+        printf("ERROR: getTheTypeRegistry failed\n");
+        return 2;
+    }
+
+    for(i = 0; i < sizeof s_anTag / sizeof s_anTag[0]; i++)
+    {
+        nFail += runOne(s_anTag[i]);
+    }
+
+    LLRP_TypeRegistry_destruct(g_pTypeRegistry);
+
+    if(0 != nFail)
+    {
+        printf("ERROR: %d size(s) failed\n", nFail);
+        return 2;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Decode one report size every way and compare
+ **
+ ** @param[in]  nTag            TagReportData in the report
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+runOne (
+  unsigned int                  nTag)
+{
+    LLRP_tSTagSelectAccessReport *pReport;
+    LLRP_tSTagSelectAccessReport *pDecoded;
+    unsigned char *             pFrame;
+    unsigned int                nBuffer = nTag * N_TAG_BYTES + 64u;
+    unsigned int                nFrame;
+    tRow *                      aRow;
+    int                         nFail = 0;
+
+    pFrame = malloc(nBuffer);
+    if(NULL == pFrame)
+    {
+        printf("ERROR: %u: malloc failed\n", nTag);
+        exit(2);
+    }
+
+    pReport = buildReport(nTag);
+    nFrame = encodeReport(pReport, pFrame, nBuffer);
+    pDecoded = 0 == nFrame ? NULL : decodeReport(pFrame, nFrame);
+    if(NULL == pDecoded)
+    {
+        printf("ERROR: %u: encode or decode failed\n", nTag);
+        exit(2);
+    }
+    if(g_Verbose)
+    {
+        printf("INFO: %u: frame %u bytes\n", nTag, nFrame);
+    }
+
+    /*
+     * The element decode is the reference. Check it
+     * against what was built before trusting it.
+     */
+    aRow = treeRows(pDecoded, nTag);
+    if(NULL == aRow)
+    {
+        nFail = 1;
+    }
+    else
+    {
+        tRow *                  aBuilt = treeRows(pReport, nTag);
+
+        if(NULL == aBuilt ||
+           0 != compareRows("element", aBuilt, aRow, nTag))
+        {
+            nFail = 1;
+        }
+        free(aBuilt);
+    }
+
+    if(0 == nFail)
+    {
+        nFail += checkStream(pFrame, nFrame, aRow, nTag);
+        nFail += checkColumns(pFrame, nFrame, aRow, nTag);
+    }
+
+    printf("INFO: %6u tags %s\n", nTag, nFail ? "FAIL" : "PASS");
+
+    free(aRow);
+    LLRP_Element_destruct(&pDecoded->hdr.elementHdr);
+    LLRP_Element_destruct(&pReport->hdr.elementHdr);
+    free(pFrame);
+
+    return nFail ? 1 : 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Build a report of tags with random content
+ **
+ ** The TID lengths go round 0 to N_TID_MAX. Each optional
+ ** sub-parameter is there about two times in three.
+ **
+ ** @param[in]  nTag            TagReportData to add
+ **
+ ** @return     The report, exits on failure
+ **
+ *****************************************************************************/
+
+LLRP_tSTagSelectAccessReport *
+buildReport (
+  unsigned int                  nTag)
+{
+    LLRP_tSTagSelectAccessReport * pReport;
+    unsigned int                i;
+    unsigned int                k;
+
+    pReport = LLRP_TagSelectAccessReport_construct();
+    if(NULL == pReport)
+    {
+        printf("ERROR: TagSelectAccessReport_construct failed\n");
+        exit(2);
+    }
+    LLRP_Message_setMessageID(&pReport->hdr, 408);
+    pReport->hdr.Version = 1;
+
+    for(i = 0; i < nTag; i++)
+    {
+        LLRP_tSTagReportData *  pTRD;
+        llrp_u8v_t              TID;
+
+        pTRD = LLRP_TagReportData_construct();
+
+        TID = LLRP_u8v_construct(i % (N_TID_MAX + 1u));
+        for(k = 0; k < TID.nValue; k++)
+        {
+            TID.pValue[k] = nextRandom();
+        }
+        LLRP_TagReportData_setTID(pTRD, TID);
+
+        if(nextRandom() % 3u)
+        {
+            LLRP_tSSelectSpecID *p = LLRP_SelectSpecID_construct();
+
+            LLRP_SelectSpecID_setSelectSpecID(p, nextRandom());
+            LLRP_TagReportData_setSelectSpecID(pTRD, p);
+        }
+        if(nextRandom() % 3u)
+        {
+            LLRP_tSSpecIndex *  p = LLRP_SpecIndex_construct();
+
+            LLRP_SpecIndex_setSpecIndex(p, nextRandom());
+            LLRP_TagReportData_setSpecIndex(pTRD, p);
+        }
+        if(nextRandom() % 3u)
+        {
+            LLRP_tSRfSpecID *   p = LLRP_RfSpecID_construct();
+
+            LLRP_RfSpecID_setRfSpecID(p, nextRandom());
+            LLRP_TagReportData_setRfSpecID(pTRD, p);
+        }
+        if(nextRandom() % 3u)
+        {
+            LLRP_tSAntennaID *  p = LLRP_AntennaID_construct();
+
+            LLRP_AntennaID_setAntennaID(p, nextRandom());
+            LLRP_TagReportData_setAntennaID(pTRD, p);
+        }
+        if(nextRandom() % 3u)
+        {
+            LLRP_tSPeakRSSI *   p = LLRP_PeakRSSI_construct();
+
+            LLRP_PeakRSSI_setPeakRSSI(p, (llrp_s8_t)nextRandom());
+            LLRP_TagReportData_setPeakRSSI(pTRD, p);
+        }
+        if(nextRandom() % 3u)
+        {
+            LLRP_tSFirstSeenTimestampUTC *p =
+                LLRP_FirstSeenTimestampUTC_construct();
+
+            LLRP_FirstSeenTimestampUTC_setMicroseconds(p,
+                ((llrp_u64_t)nextRandom() << 32u) | nextRandom());
+            LLRP_TagReportData_setFirstSeenTimestampUTC(pTRD, p);
+        }
+        if(nextRandom() % 3u)
+        {
+            LLRP_tSLastSeenTimestampUTC *p =
+                LLRP_LastSeenTimestampUTC_construct();
+
+            LLRP_LastSeenTimestampUTC_setMicroseconds(p,
+                ((llrp_u64_t)nextRandom() << 32u) | nextRandom());
+            LLRP_TagReportData_setLastSeenTimestampUTC(pTRD, p);
+        }
+        if(nextRandom() % 3u)
+        {
+            LLRP_tSTagSeenCount *p = LLRP_TagSeenCount_construct();
+
+            LLRP_TagSeenCount_setTagCount(p, nextRandom());
+            LLRP_TagReportData_setTagSeenCount(pTRD, p);
+        }
+        if(nextRandom() % 3u)
+        {
+            LLRP_tSAccessSpecID *p = LLRP_AccessSpecID_construct();
+
+            LLRP_AccessSpecID_setAccessSpecID(p, nextRandom());
+            LLRP_TagReportData_setAccessSpecID(pTRD, p);
+        }
+
+        LLRP_TagSelectAccessReport_addTagReportData(pReport, pTRD);
+    }
+
+    return pReport;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Encode a report into a buffer
+ **
+ ** @param[in]  pReport         The report
+ ** @param[out] pBuffer         Where to put the frame
+ ** @param[in]  nBuffer         Room there
+ **
+ ** @return     >0              Bytes in the frame
+ **             0               Encode failed
+ **
+ *****************************************************************************/
+
+unsigned int
+encodeReport (
+  LLRP_tSTagSelectAccessReport *pReport,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    LLRP_tSFrameEncoder *       pEncoder;
+    unsigned int                nFrame = 0;
+
+    pEncoder = LLRP_FrameEncoder_construct(pBuffer, nBuffer);
+    if(NULL != pEncoder)
+    {
+        LLRP_Encoder_encodeElement(&pEncoder->encoderHdr,
+            &pReport->hdr.elementHdr);
+        if(LLRP_RC_OK == pEncoder->encoderHdr.ErrorDetails.eResultCode)
+        {
+            nFrame = pEncoder->iNext;
+        }
+        LLRP_Encoder_destruct(&pEncoder->encoderHdr);
+    }
+
+    return nFrame;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Decode a report from a frame into elements
+ **
+ ** @param[in]  pBuffer         The frame
+ ** @param[in]  nBuffer         Bytes in it
+ **
+ ** @return     !=NULL          The report
+ **             ==NULL          Decode failed
+ **
+ *****************************************************************************/
+
+LLRP_tSTagSelectAccessReport *
+decodeReport (
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    LLRP_tSFrameDecoder *       pDecoder;
+    LLRP_tSMessage *            pMessage;
+
+    pDecoder = LLRP_FrameDecoder_construct(g_pTypeRegistry, pBuffer, nBuffer);
+    if(NULL == pDecoder)
+    {
+        return NULL;
+    }
+
+    pMessage = LLRP_Decoder_decodeMessage(&pDecoder->decoderHdr);
+    if(NULL == pMessage)
+    {
+        printf("ERROR: decode: %s\n",
+            pDecoder->decoderHdr.ErrorDetails.pWhatStr);
+    }
+
+    LLRP_Decoder_destruct(&pDecoder->decoderHdr);
+
+    return (LLRP_tSTagSelectAccessReport *) pMessage;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Gather the rows of a report through its accessors
+ **
+ ** @param[in]  pReport         The report
+ ** @param[in]  nTag            Tags it should have
+ **
+ ** @return     !=NULL          nTag rows, to free()
+ **             ==NULL          Wrong count, or malloc failed
+ **
+ *****************************************************************************/
+
+tRow *
+treeRows (
+  LLRP_tSTagSelectAccessReport *pReport,
+  unsigned int                  nTag)
+{
+    LLRP_tSTagReportData *      pTRD;
+    tRow *                      aRow;
+    tRow *                      pRow;
+
+    if((int)nTag != LLRP_TagSelectAccessReport_countTagReportData(pReport))
+    {
+        printf("ERROR: %u: count is %d\n", nTag,
+            LLRP_TagSelectAccessReport_countTagReportData(pReport));
+        return NULL;
+    }
+
+    aRow = calloc(nTag + 1u, sizeof *aRow);
+    if(NULL == aRow)
+    {
+        printf("ERROR: %u: calloc failed\n", nTag);
+        return NULL;
+    }
+
+    pRow = aRow;
+    for(
+        pTRD = LLRP_TagSelectAccessReport_beginTagReportData(pReport);
+        NULL != pTRD;
+        pTRD = LLRP_TagSelectAccessReport_nextTagReportData(pTRD))
+    {
+        pRow->nTID = pTRD->TID.nValue;
+        if(0u != pRow->nTID)
+        {
+            memcpy(pRow->aTID, pTRD->TID.pValue, pRow->nTID);
+        }
+
+#define ROW_VALUE(i, pSub, Value)                               \
+        if(NULL != (pSub))                                      \
+        {                                                       \
+            pRow->Present |= 1u << (i);                         \
+            pRow->aValue[i] = (llrp_u64_t)(Value);              \
+        }
+        ROW_VALUE(0, pTRD->pSelectSpecID,
+            pTRD->pSelectSpecID->SelectSpecID)
+        ROW_VALUE(1, pTRD->pSpecIndex,
+            pTRD->pSpecIndex->SpecIndex)
+        ROW_VALUE(2, pTRD->pRfSpecID,
+            pTRD->pRfSpecID->RfSpecID)
+        ROW_VALUE(3, pTRD->pAntennaID,
+            pTRD->pAntennaID->AntennaID)
+        ROW_VALUE(4, pTRD->pPeakRSSI,
+            pTRD->pPeakRSSI->PeakRSSI)
+        ROW_VALUE(5, pTRD->pFirstSeenTimestampUTC,
+            pTRD->pFirstSeenTimestampUTC->Microseconds)
+        ROW_VALUE(6, pTRD->pLastSeenTimestampUTC,
+            pTRD->pLastSeenTimestampUTC->Microseconds)
+        ROW_VALUE(7, pTRD->pTagSeenCount,
+            pTRD->pTagSeenCount->TagCount)
+        ROW_VALUE(8, pTRD->pAccessSpecID,
+            pTRD->pAccessSpecID->AccessSpecID)
+#undef ROW_VALUE
+
+        pRow++;
+    }
+
+    return aRow;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Stream the frame and compare with the reference rows
+ **
+ ** @param[in]  pBuffer         The frame
+ ** @param[in]  nBuffer         Bytes in it
+ ** @param[in]  aRow            The reference rows
+ ** @param[in]  nTag            How many
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+checkStream (
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer,
+  const tRow *                  aRow,
+  unsigned int                  nTag)
+{
+    static const LLRP_tSFrameStreamCallbacks Callbacks =
+    {
+        streamBegin,
+        streamField,
+        streamEnd,
+    };
+    LLRP_tSFrameDecoder *       pDecoder;
+    LLRP_tResultCode            lrc;
+    tStreamGather               Gather;
+    int                         nFail = 0;
+
+    memset(&Gather, 0, sizeof Gather);
+    Gather.nRowMax = nTag;
+    Gather.aRow = calloc(nTag + 1u, sizeof *Gather.aRow);
+
+    pDecoder = LLRP_FrameDecoder_construct(g_pTypeRegistry, pBuffer, nBuffer);
+    if(NULL == pDecoder || NULL == Gather.aRow)
+    {
+        printf("ERROR: %u: stream setup failed\n", nTag);
+        exit(2);
+    }
+
+    lrc = LLRP_FrameDecoder_stream(pDecoder, &Callbacks, &Gather);
+    if(LLRP_RC_OK != lrc)
+    {
+        printf("ERROR: %u: stream: %s\n", nTag,
+            pDecoder->decoderHdr.ErrorDetails.pWhatStr);
+        nFail = 1;
+    }
+    else if(Gather.nBegin != Gather.nEnd)
+    {
+        printf("ERROR: %u: stream: %u begins, %u ends\n", nTag,
+            Gather.nBegin, Gather.nEnd);
+        nFail = 1;
+    }
+    else if(Gather.nRow != nTag)
+    {
+        printf("ERROR: %u: stream: %u rows\n", nTag, Gather.nRow);
+        nFail = 1;
+    }
+    else
+    {
+        nFail = compareRows("stream", aRow, Gather.aRow, nTag);
+    }
+
+    LLRP_Decoder_destruct(&pDecoder->decoderHdr);
+    free(Gather.aRow);
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Stream callback: a message or parameter begins
+ **
+ *****************************************************************************/
+
+int
+streamBegin (
+  void *                        pContext,
+  const LLRP_tSTypeDescriptor * pType)
+{
+    tStreamGather *             pGather = (tStreamGather *) pContext;
+
+    if(&LLRP_tdTagReportData == pType)
+    {
+        if(pGather->nRow >= pGather->nRowMax)
+        {
+            /* More than expected, counted but not kept */
+            pGather->nRow++;
+            return 1;
+        }
+        pGather->bInRow = 1;
+    }
+
+    pGather->nBegin++;
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Stream callback: a field of the message or parameter
+ **
+ ** The TID is a field of the TagReportData. Every other value
+ ** is the one field of a sub-parameter in s_apRowType.
+ **
+ *****************************************************************************/
+
+void
+streamField (
+  void *                        pContext,
+  const LLRP_tSTypeDescriptor * pType,
+  const LLRP_tSFieldDescriptor *pField,
+  const LLRP_tSFrameStreamField *pValue)
+{
+    tStreamGather *             pGather = (tStreamGather *) pContext;
+    tRow *                      pRow;
+    unsigned int                i;
+
+    if(!pGather->bInRow)
+    {
+        return;
+    }
+    pRow = &pGather->aRow[pGather->nRow];
+
+    if(&LLRP_tdTagReportData == pType)
+    {
+        if(NULL != pValue->pBytes && pValue->nValue <= N_TID_MAX)
+        {
+            pRow->nTID = pValue->nValue;
+            memcpy(pRow->aTID, pValue->pBytes, pValue->nValue);
+        }
+        return;
+    }
+
+    for(i = 0; i < N_ROW_VALUE; i++)
+    {
+        if(s_apRowType[i] == pType)
+        {
+            break;
+        }
+    }
+    if(N_ROW_VALUE == i)
+    {
+        return;
+    }
+
+    pRow->Present |= 1u << i;
+    switch(pField->eFieldType)
+    {
+    case LLRP_FT_U8:
+        pRow->aValue[i] = pValue->Scalar.u8;
+        break;
+    case LLRP_FT_S8:
+        pRow->aValue[i] = (llrp_u64_t)pValue->Scalar.s8;
+        break;
+    case LLRP_FT_U16:
+        pRow->aValue[i] = pValue->Scalar.u16;
+        break;
+    case LLRP_FT_U32:
+        pRow->aValue[i] = pValue->Scalar.u32;
+        break;
+    case LLRP_FT_U64:
+        pRow->aValue[i] = pValue->Scalar.u64;
+        break;
+    default:
+        /* Not a type these sub-parameters have, fails the compare */
+        pRow->aValue[i] = ~(llrp_u64_t)0;
+        break;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Stream callback: a message or parameter ends
+ **
+ *****************************************************************************/
+
+void
+streamEnd (
+  void *                        pContext,
+  const LLRP_tSTypeDescriptor * pType)
+{
+    tStreamGather *             pGather = (tStreamGather *) pContext;
+
+    pGather->nEnd++;
+
+    if(&LLRP_tdTagReportData == pType)
+    {
+        pGather->bInRow = 0;
+        pGather->nRow++;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Decode the frame into columns and compare with the
+ **         reference rows
+ **
+ ** The frame is decoded twice, the second time appending after
+ ** the first, then the columns are cleared.
+ **
+ ** @param[in]  pBuffer         The frame
+ ** @param[in]  nBuffer         Bytes in it
+ ** @param[in]  aRow            The reference rows
+ ** @param[in]  nTag            How many
+ **
+ ** @return     0               Passed
+ **             1               Failed
+ **
+ *****************************************************************************/
+
+int
+checkColumns (
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer,
+  const tRow *                  aRow,
+  unsigned int                  nTag)
+{
+    LLRP_tSTagReportDataColumns *pColumns;
+    LLRP_tSFrameDecoder *       pDecoder;
+    LLRP_tResultCode            lrc = LLRP_RC_OK;
+    tRow *                      aGot = NULL;
+    int                         nFail = 0;
+    int                         i;
+
+    pColumns = LLRP_TagReportDataColumns_construct();
+    pDecoder = LLRP_FrameDecoder_construct(g_pTypeRegistry, pBuffer, nBuffer);
+    if(NULL == pColumns || NULL == pDecoder)
+    {
+        printf("ERROR: %u: columns setup failed\n", nTag);
+        exit(2);
+    }
+
+    for(i = 0; i < 2 && LLRP_RC_OK == lrc; i++)
+    {
+        LLRP_FrameDecoder_reset(pDecoder, pBuffer, nBuffer);
+        lrc = LLRP_TagReportDataColumns_decodeFrame(pColumns, pDecoder);
+    }
+
+    if(LLRP_RC_OK != lrc)
+    {
+        printf("ERROR: %u: columns: %s\n", nTag,
+            pDecoder->decoderHdr.ErrorDetails.pWhatStr);
+        nFail = 1;
+    }
+    else if(pColumns->hdr.nRow != 2u * nTag)
+    {
+        printf("ERROR: %u: columns: %u rows\n", nTag, pColumns->hdr.nRow);
+        nFail = 1;
+    }
+    else if(NULL == (aGot = columnRows(pColumns)))
+    {
+        nFail = 1;
+    }
+    else
+    {
+        nFail = compareRows("columns", aRow, aGot, nTag) ||
+                compareRows("columns again", aRow, &aGot[nTag], nTag);
+    }
+
+    LLRP_TagReportDataColumns_clear(pColumns);
+    if(0 != pColumns->hdr.nRow)
+    {
+        printf("ERROR: %u: columns: clear left %u rows\n", nTag,
+            pColumns->hdr.nRow);
+        nFail = 1;
+    }
+
+    free(aGot);
+    LLRP_Decoder_destruct(&pDecoder->decoderHdr);
+    LLRP_TagReportDataColumns_destruct(pColumns);
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Gather the rows held in columns
+ **
+ ** @param[in]  pColumns        The columns
+ **
+ ** @return     !=NULL          pColumns->hdr.nRow rows, to free()
+ **             ==NULL          A TID too long, or calloc failed
+ **
+ *****************************************************************************/
+
+tRow *
+columnRows (
+  LLRP_tSTagReportDataColumns * pColumns)
+{
+    unsigned int                nRow = pColumns->hdr.nRow;
+    tRow *                      aRow;
+    unsigned int                i;
+
+    aRow = calloc(nRow + 1u, sizeof *aRow);
+    if(NULL == aRow)
+    {
+        printf("ERROR: columns: calloc failed\n");
+        return NULL;
+    }
+
+    for(i = 0; i < nRow; i++)
+    {
+        tRow *                  pRow = &aRow[i];
+        unsigned int            iTID = pColumns->TID.pOffset[i];
+
+        pRow->nTID = pColumns->TID.pOffset[i + 1u] - iTID;
+        if(N_TID_MAX < pRow->nTID)
+        {
+            printf("ERROR: columns: row %u: TID of %u bytes\n",
+                i, pRow->nTID);
+            free(aRow);
+            return NULL;
+        }
+        if(0u != pRow->nTID)
+        {
+            memcpy(pRow->aTID, &pColumns->TID.pBytes[iTID], pRow->nTID);
+        }
+
+#define ROW_VALUE(k, Name)                                      \
+        if(LLRP_COLUMN_PRESENT(pColumns->p##Name##Present, i))  \
+        {                                                       \
+            pRow->Present |= 1u << (k);                         \
+            pRow->aValue[k] = (llrp_u64_t)pColumns->p##Name[i]; \
+        }
+        ROW_VALUE(0, SelectSpecID)
+        ROW_VALUE(1, SpecIndex)
+        ROW_VALUE(2, RfSpecID)
+        ROW_VALUE(3, AntennaID)
+        ROW_VALUE(4, PeakRSSI)
+        ROW_VALUE(5, FirstSeenTimestampUTC_Microseconds)
+        ROW_VALUE(6, LastSeenTimestampUTC_Microseconds)
+        ROW_VALUE(7, TagSeenCount_TagCount)
+        ROW_VALUE(8, AccessSpecID)
+#undef ROW_VALUE
+    }
+
+    return aRow;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Compare two sets of rows, reporting the first difference
+ **
+ ** @param[in]  pWhat           Which decode made aGot
+ ** @param[in]  aExpect         The reference rows
+ ** @param[in]  aGot            The rows to check
+ ** @param[in]  nRow            How many
+ **
+ ** @return     0               Same
+ **             1               Different
+ **
+ *****************************************************************************/
+
+int
+compareRows (
+  const char *                  pWhat,
+  const tRow *                  aExpect,
+  const tRow *                  aGot,
+  unsigned int                  nRow)
+{
+    unsigned int                i;
+    unsigned int                k;
+
+    for(i = 0; i < nRow; i++)
+    {
+        const tRow *            pExpect = &aExpect[i];
+        const tRow *            pGot = &aGot[i];
+
+        if(pExpect->nTID != pGot->nTID ||
+           0 != memcmp(pExpect->aTID, pGot->aTID, pExpect->nTID))
+        {
+            printf("ERROR: %s: tag %u: TID differs\n", pWhat, i);
+            return 1;
+        }
+        if(pExpect->Present != pGot->Present)
+        {
+            printf("ERROR: %s: tag %u: present 0x%03x, expected 0x%03x\n",
+                pWhat, i, pGot->Present, pExpect->Present);
+            return 1;
+        }
+        for(k = 0; k < N_ROW_VALUE; k++)
+        {
+            if((pExpect->Present & (1u << k)) &&
+               pExpect->aValue[k] != pGot->aValue[k])
+            {
+                printf("ERROR: %s: tag %u: %s differs\n",
+                    pWhat, i, s_apRowType[k]->pName);
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Repeatable pseudo-random numbers, so every run is the same
+ **
+ *****************************************************************************/
+
+unsigned int
+nextRandom (void)
+{
+    g_Random = g_Random * 1103515245u + 12345u;
+
+    return g_Random >> 8u;
+}
@@ -0,0 +1,654 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  dx409.c
+ **
+ ** @brief Check lazily decoded messages received on a connection
+ **
+ ** This is diagnostic 409 for the LLRP Tool Kit for C (LTKC).
+ **
+ ** DX409 needs no reader. It plays the reader on one end of a
+ ** socket pair and sends a TagSelectAccessReport to a connection
+ ** on the other end, once decoded as usual and once with
+ ** LLRP_Conn_setDecodeLazy(). Two cases:
+ **     - equal, the lazily decoded report must be lazy, give the
+ **       same tags through its accessors, and encode to the same
+ **       frame and the same XML as the other
+ **     - corrupt, the third tag's TID claims more bytes than its
+ **       TagReportData has. The usual decode must fail. The lazy
+ **       one gets the report, since the framing is good, but
+ **       LLRP_Message_materializeAll(), the encoders and the
+ **       setters must all give the error, and LLRP_Element_walk()
+ **       LLRP_WALK_DECODE_FAILED, instead of going on with that
+ **       tag empty.
+ **
+ ** This program can be run with one verbose option (-v)
+ ** to print the errors given as well.
+ **
+ ** Exit status is 0 when every check passed.
+ **
+ *****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#include "../Library/ltkc.h"
+
+
+/*
+ * BEGIN forward declarations
+ */
+int
+main (
+  int                           ac,
+  char *                        av[]);
+
+void
+usage (
+  char *                        pProgName);
+
+int
+run (void);
+
+int
+caseEqual (void);
+
+int
+caseCorrupt (void);
+
+LLRP_tSMessage *
+sendAndRecv (
+  const unsigned char *         pFrame,
+  unsigned int                  nFrame,
+  llrp_bool_t                   bDecodeLazy);
+
+unsigned int
+buildFrame (
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+unsigned int
+encodeMessage (
+  LLRP_tSMessage *              pMessage,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer,
+  LLRP_tSErrorDetails *         pError);
+
+int
+countElement (
+  const LLRP_tSElement *        pElement,
+  void *                        pArg);
+/*
+ * END forward declarations
+ */
+
+
+/*
+ * The report: N_TAG tags of a 12 byte TID, an AntennaID
+ * and a PeakRSSI each. The frame has room to spare.
+ */
+#define N_TAG           (200u)
+#define N_FRAME_MAX     (16u*1024u)
+#define N_XML_MAX       (256u*1024u)
+
+/*
+ * Bytes of the message header, and of a TLV parameter header
+ * whose length is of the body after it
+ */
+#define N_MSG_HDR       (19u)
+#define N_TLV_HDR       (4u)
+
+/*
+ * Global variables
+ */
+int                             g_Verbose;
+LLRP_tSTypeRegistry *           g_pTypeRegistry;
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Command main routine
+ **
+ ** Command synopsis:
+ **
+ **     dx409 [-v]
+ **
+ ** @exitcode   0               Everything *seemed* to work.
+ **             1               Bad usage
+ **             2               Run failed
+ **
+ *****************************************************************************/
+
+int
+main (
+  int                           ac,
+  char *                        av[])
+{
+    int                         rc;
+
+    if(ac == 2 && 0 == strcmp("-v", av[1]))
+    {
+        g_Verbose = 1;
+    }
+    else if(ac != 1)
+    {
+        usage(av[0]);
+        /* no return */
+    }
+
+    rc = run();
+
+    printf("INFO: Done\n");
+
+    exit(rc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Print usage message and exit
+ **
+ ** @param[in]  pProgName       Program name.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+usage (
+  char *                        pProgName)
+{
+    printf("Usage: %s [-v]\n", pProgName);
+    printf("\n");
+    printf("Each -v increases verbosity level\n");
+    exit(1);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Run the cases
+ **
+ ** @return     0               Every case passed
+ **             2               Something failed
+ **
+ *****************************************************************************/
+
+int
+run (void)
+{
+    int                         nFail = 0;
+
+    g_pTypeRegistry = LLRP_getTheTypeRegistry();
+    if(NULL == g_pTypeRegistry)
+    {
+        printf("ERROR: getTheTypeRegistry failed\n");
+        return 2;
+    }
+
+    nFail += caseEqual();
+    nFail += caseCorrupt();
+
+    LLRP_TypeRegistry_destruct(g_pTypeRegistry);
+
+    if(0 != nFail)
+    {
+        printf("ERROR: %d check(s) failed\n", nFail);
+        return 2;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  A good report, decoded lazily and not
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseEqual (void)
+{
+    static unsigned char        aFrame[N_FRAME_MAX];
+    static unsigned char        aEager[N_FRAME_MAX];
+    static unsigned char        aLazy[N_FRAME_MAX];
+    static char                 aEagerXML[N_XML_MAX];
+    static char                 aLazyXML[N_XML_MAX];
+    LLRP_tSErrorDetails         Error;
+    LLRP_tSMessage *            pEager;
+    LLRP_tSMessage *            pLazy;
+    LLRP_tSTagReportData *      pEagerTRD;
+    LLRP_tSTagReportData *      pLazyTRD;
+    unsigned int                nFrame;
+    unsigned int                nEager;
+    unsigned int                nLazy;
+    int                         nFail = 0;
+
+    nFrame = buildFrame(aFrame, sizeof aFrame);
+    pEager = sendAndRecv(aFrame, nFrame, FALSE);
+    pLazy = sendAndRecv(aFrame, nFrame, TRUE);
+    if(NULL == pEager || NULL == pLazy)
+    {
+        printf("ERROR: equal: receive failed\n");
+        exit(2);
+    }
+
+    if(NULL != pEager->pLazy || NULL == pLazy->pLazy)
+    {
+        printf("ERROR: equal: setDecodeLazy not honored\n");
+        nFail++;
+    }
+
+    /*
+     * Read the tags through the accessors, which decode
+     * them one by one, before anything decodes them all
+     */
+    pEagerTRD = LLRP_TagSelectAccessReport_beginTagReportData(
+        (LLRP_tSTagSelectAccessReport *) pEager);
+    pLazyTRD = LLRP_TagSelectAccessReport_beginTagReportData(
+        (LLRP_tSTagSelectAccessReport *) pLazy);
+    while(NULL != pEagerTRD && NULL != pLazyTRD)
+    {
+        if(pEagerTRD->TID.nValue != pLazyTRD->TID.nValue ||
+           0 != memcmp(pEagerTRD->TID.pValue, pLazyTRD->TID.pValue,
+                pEagerTRD->TID.nValue) ||
+           NULL == pLazyTRD->pAntennaID ||
+           pEagerTRD->pAntennaID->AntennaID !=
+                pLazyTRD->pAntennaID->AntennaID)
+        {
+            printf("ERROR: equal: tags differ\n");
+            nFail++;
+            break;
+        }
+        pEagerTRD = LLRP_TagSelectAccessReport_nextTagReportData(pEagerTRD);
+        pLazyTRD = LLRP_TagSelectAccessReport_nextTagReportData(pLazyTRD);
+    }
+    if(pEagerTRD != pLazyTRD)
+    {
+        printf("ERROR: equal: tag counts differ\n");
+        nFail++;
+    }
+
+    memset(&Error, 0, sizeof Error);
+    if(LLRP_RC_OK != LLRP_Message_materializeAll(pLazy, &Error) ||
+       LLRP_RC_OK != Error.eResultCode)
+    {
+        printf("ERROR: equal: materializeAll failed\n");
+        nFail++;
+    }
+
+    nEager = encodeMessage(pEager, aEager, sizeof aEager, NULL);
+    nLazy = encodeMessage(pLazy, aLazy, sizeof aLazy, NULL);
+    if(nEager != nFrame || nLazy != nFrame ||
+       0 != memcmp(aEager, aFrame, nFrame) ||
+       0 != memcmp(aLazy, aFrame, nFrame))
+    {
+        printf("ERROR: equal: frames differ, %u, %u and %u bytes\n",
+            nFrame, nEager, nLazy);
+        nFail++;
+    }
+
+    if(LLRP_RC_OK != LLRP_toXMLString(&pEager->elementHdr,
+            aEagerXML, sizeof aEagerXML) ||
+       LLRP_RC_OK != LLRP_toXMLString(&pLazy->elementHdr,
+            aLazyXML, sizeof aLazyXML) ||
+       0 != strcmp(aEagerXML, aLazyXML))
+    {
+        printf("ERROR: equal: XML differs\n");
+        nFail++;
+    }
+
+    LLRP_Element_destruct(&pEager->elementHdr);
+    LLRP_Element_destruct(&pLazy->elementHdr);
+
+    if(0 == nFail)
+    {
+        printf("INFO: equal PASS\n");
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  A report with a corrupt tag, decoded lazily and not
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseCorrupt (void)
+{
+    static unsigned char        aFrame[N_FRAME_MAX];
+    static unsigned char        aOut[N_FRAME_MAX];
+    static char                 aXML[N_XML_MAX];
+    LLRP_tSErrorDetails         Error;
+    LLRP_tSMessage *            pEager;
+    LLRP_tSMessage *            pLazy;
+    LLRP_tResultCode            lrc;
+    unsigned int                nFrame;
+    unsigned int                iTRD;
+    unsigned int                i;
+    int                         nElement = 0;
+    int                         rc;
+    int                         nFail = 0;
+
+    nFrame = buildFrame(aFrame, sizeof aFrame);
+
+    /*
+     * Step over two TagReportData to the third, and make
+     * the count of its TID, just after its header, too big.
+     */
+    iTRD = N_MSG_HDR;
+    for(i = 0; i < 2u; i++)
+    {
+        iTRD += N_TLV_HDR + ((aFrame[iTRD + 2u] << 8u) | aFrame[iTRD + 3u]);
+    }
+    aFrame[iTRD + N_TLV_HDR] = 0xFF;
+    aFrame[iTRD + N_TLV_HDR + 1u] = 0xFF;
+
+    pEager = sendAndRecv(aFrame, nFrame, FALSE);
+    if(NULL != pEager)
+    {
+        printf("ERROR: corrupt: decoded anyway\n");
+        LLRP_Element_destruct(&pEager->elementHdr);
+        nFail++;
+    }
+
+    pLazy = sendAndRecv(aFrame, nFrame, TRUE);
+    if(NULL == pLazy)
+    {
+        printf("ERROR: corrupt: lazy decode failed on framing\n");
+        return nFail + 1;
+    }
+
+    memset(&Error, 0, sizeof Error);
+    lrc = LLRP_Message_materializeAll(pLazy, &Error);
+    if(LLRP_RC_OK == lrc || lrc != Error.eResultCode)
+    {
+        printf("ERROR: corrupt: materializeAll gave %d\n", lrc);
+        nFail++;
+    }
+    if(g_Verbose)
+    {
+        printf("INFO: corrupt: materializeAll: %s\n",
+            NULL != Error.pWhatStr ? Error.pWhatStr : "");
+    }
+
+    memset(&Error, 0, sizeof Error);
+    if(0 != encodeMessage(pLazy, aOut, sizeof aOut, &Error) ||
+       lrc != Error.eResultCode)
+    {
+        printf("ERROR: corrupt: frame encode gave %d\n",
+            Error.eResultCode);
+        nFail++;
+    }
+
+    if(LLRP_RC_OK == LLRP_toXMLString(&pLazy->elementHdr,
+            aXML, sizeof aXML))
+    {
+        printf("ERROR: corrupt: XML encode succeeded\n");
+        nFail++;
+    }
+
+    rc = LLRP_Element_walk(&pLazy->elementHdr, countElement, &nElement,
+            0, 12);
+    if(LLRP_WALK_DECODE_FAILED != rc || 0 != nElement)
+    {
+        printf("ERROR: corrupt: walk gave %d after %d elements\n",
+            rc, nElement);
+        nFail++;
+    }
+
+    /*
+     * The setter adds the tag but gives the error
+     */
+    lrc = LLRP_TagSelectAccessReport_addTagReportData(
+        (LLRP_tSTagSelectAccessReport *) pLazy,
+        LLRP_TagReportData_construct());
+    if(LLRP_RC_OK == lrc ||
+       (int)N_TAG + 1 != LLRP_TagSelectAccessReport_countTagReportData(
+            (LLRP_tSTagSelectAccessReport *) pLazy))
+    {
+        printf("ERROR: corrupt: add gave %d\n", lrc);
+        nFail++;
+    }
+
+    LLRP_Element_destruct(&pLazy->elementHdr);
+
+    if(0 == nFail)
+    {
+        printf("INFO: corrupt PASS\n");
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Send a frame over a socket pair and receive it
+ **
+ ** @param[in]  pFrame          The frame
+ ** @param[in]  nFrame          Bytes in it
+ ** @param[in]  bDecodeLazy     For LLRP_Conn_setDecodeLazy()
+ **
+ ** @return     !=NULL          The message
+ **             ==NULL          Not received, the error printed
+ **                             with -v
+ **
+ *****************************************************************************/
+
+LLRP_tSMessage *
+sendAndRecv (
+  const unsigned char *         pFrame,
+  unsigned int                  nFrame,
+  llrp_bool_t                   bDecodeLazy)
+{
+    LLRP_tSConnection *         pConn;
+    LLRP_tSMessage *            pMessage;
+    int                         aFd[2];
+
+    pConn = LLRP_Conn_construct(g_pTypeRegistry, 2u * N_FRAME_MAX);
+    if(NULL == pConn || 0 != socketpair(AF_UNIX, SOCK_STREAM, 0, aFd))
+    {
+        printf("ERROR: connection setup failed\n");
+        exit(2);
+    }
+
+    /*
+     * The connection is normally opened by name. Here it is
+     * simply handed the already connected socket.
+     */
+    pConn->fd = aFd[0];
+    LLRP_Conn_setDecodeLazy(pConn, bDecodeLazy);
+
+    if((ssize_t)nFrame != write(aFd[1], pFrame, nFrame))
+    {
+        printf("ERROR: write failed\n");
+        exit(2);
+    }
+
+    pMessage = LLRP_Conn_recvMessage(pConn, 1000);
+    if(NULL == pMessage && g_Verbose)
+    {
+        const LLRP_tSErrorDetails *pError = LLRP_Conn_getRecvError(pConn);
+
+        printf("INFO: recvMessage: %s\n",
+            NULL != pError->pWhatStr ? pError->pWhatStr : "");
+    }
+
+    LLRP_Conn_destruct(pConn);
+    close(aFd[1]);
+
+    return pMessage;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Build and encode the report
+ **
+ ** @param[out] pBuffer         Where to put the frame
+ ** @param[in]  nBuffer         Room there
+ **
+ ** @return     Bytes in the frame, exits on failure
+ **
+ *****************************************************************************/
+
+unsigned int
+buildFrame (
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    LLRP_tSTagSelectAccessReport *pReport;
+    unsigned int                nFrame;
+    unsigned int                i;
+    unsigned int                k;
+
+    pReport = LLRP_TagSelectAccessReport_construct();
+    if(NULL == pReport)
+    {
+        printf("ERROR: TagSelectAccessReport_construct failed\n");
+        exit(2);
+    }
+    LLRP_Message_setMessageID(&pReport->hdr, 409);
+    pReport->hdr.Version = 1;
+
+    for(i = 0; i < N_TAG; i++)
+    {
+        LLRP_tSTagReportData *  pTRD;
+        LLRP_tSAntennaID *      pAntennaID;
+        LLRP_tSPeakRSSI *       pPeakRSSI;
+        llrp_u8v_t              TID;
+
+        pTRD = LLRP_TagReportData_construct();
+
+        TID = LLRP_u8v_construct(12);
+        for(k = 0; k < 12u; k++)
+        {
+            TID.pValue[k] = i * 7u + k;
+        }
+        LLRP_TagReportData_setTID(pTRD, TID);
+
+        pAntennaID = LLRP_AntennaID_construct();
+        LLRP_AntennaID_setAntennaID(pAntennaID, 1u + (i & 3u));
+        LLRP_TagReportData_setAntennaID(pTRD, pAntennaID);
+
+        pPeakRSSI = LLRP_PeakRSSI_construct();
+        LLRP_PeakRSSI_setPeakRSSI(pPeakRSSI, -40 - (int)(i % 30u));
+        LLRP_TagReportData_setPeakRSSI(pTRD, pPeakRSSI);
+
+        LLRP_TagSelectAccessReport_addTagReportData(pReport, pTRD);
+    }
+
+    nFrame = encodeMessage(&pReport->hdr, pBuffer, nBuffer, NULL);
+    if(0 == nFrame)
+    {
+        printf("ERROR: encode failed\n");
+        exit(2);
+    }
+
+    LLRP_Element_destruct(&pReport->hdr.elementHdr);
+
+    return nFrame;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Encode a message into a buffer
+ **
+ ** @param[in]  pMessage        The message
+ ** @param[out] pBuffer         Where to put the frame
+ ** @param[in]  nBuffer         Room there
+ ** @param[out] pError          Gets the encoder's error, NULL is OK
+ **
+ ** @return     >0              Bytes in the frame
+ **             0               Encode failed
+ **
+ *****************************************************************************/
+
+unsigned int
+encodeMessage (
+  LLRP_tSMessage *              pMessage,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer,
+  LLRP_tSErrorDetails *         pError)
+{
+    LLRP_tSFrameEncoder *       pEncoder;
+    unsigned int                nFrame = 0;
+
+    pEncoder = LLRP_FrameEncoder_construct(pBuffer, nBuffer);
+    if(NULL != pEncoder)
+    {
+        LLRP_Encoder_encodeElement(&pEncoder->encoderHdr,
+            &pMessage->elementHdr);
+        if(LLRP_RC_OK == pEncoder->encoderHdr.ErrorDetails.eResultCode)
+        {
+            nFrame = pEncoder->iNext;
+        }
+        if(NULL != pError)
+        {
+            *pError = pEncoder->encoderHdr.ErrorDetails;
+        }
+        LLRP_Encoder_destruct(&pEncoder->encoderHdr);
+    }
+
+    return nFrame;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  LLRP_Element_walk() callback, counts the elements
+ **
+ *****************************************************************************/
+
+int
+countElement (
+  const LLRP_tSElement *        pElement,
+  void *                        pArg)
+{
+    (*(int *) pArg)++;
+
+    return 0;
+}
@@ -0,0 +1,921 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  dx410.c
+ **
+ ** @brief Check the receive thread
+ **
+ ** This is diagnostic 410 for the LLRP Tool Kit for C (LTKC).
+ **
+ ** DX410 needs no reader. A writer thread plays the reader on one
+ ** end of a socket pair. It writes TagSelectAccessReports, MessageID
+ ** 1 up, in pieces of random size. Every tenth is bigger than the
+ ** connection's initial buffer. A LLRP_tSRecvThread with a small
+ ** ring receives them on the other end. Three cases:
+ **     - order, every report must come out whole and in order,
+ **       some waited for on the eventfd, the consumer now and then
+ **       too slow so the ring fills. Then EOF must be reported.
+ **     - error, the reports are followed by a frame header with an
+ **       impossible length, or one over the buffer limit.
+ **       The reports before it must come out, then the framing
+ **       error or the overflow.
+ **     - stop, the thread is stopped with the ring full and more
+ **       decoded. The ring must still give its reports, then the
+ **       connection the rest, in order. Then a new thread is
+ **       destructed with its ring full.
+ **
+ ** This program can be run with one verbose option (-v)
+ ** to print the errors given as well.
+ **
+ ** Exit status is 0 when every check passed.
+ **
+ *****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#include "../Library/ltkc.h"
+
+
+/*
+ * What the writer thread writes
+ */
+typedef struct
+{
+    int                         fd;
+    const unsigned char *       pStream;
+    unsigned int                nStream;
+    llrp_bool_t                 bClose;
+    unsigned int                Random;
+} tWriter;
+
+
+/*
+ * BEGIN forward declarations
+ */
+int
+main (
+  int                           ac,
+  char *                        av[]);
+
+void
+usage (
+  char *                        pProgName);
+
+int
+run (void);
+
+int
+caseOrder (void);
+
+int
+caseError (
+  llrp_bool_t                   bOverflow);
+
+int
+caseStop (void);
+
+LLRP_tSConnection *
+openPair (
+  tWriter *                     pWriter,
+  pthread_t *                   pThread,
+  const unsigned char *         pStream,
+  unsigned int                  nStream,
+  llrp_bool_t                   bClose);
+
+void
+closePair (
+  LLRP_tSConnection *           pConn,
+  tWriter *                     pWriter,
+  pthread_t                     Thread);
+
+void *
+writerMain (
+  void *                        pArg);
+
+int
+checkMessage (
+  const char *                  pWhat,
+  LLRP_tSMessage *              pMessage,
+  unsigned int                  MessageID);
+
+int
+checkEnd (
+  const char *                  pWhat,
+  LLRP_tSRecvThread *           pRecvThread,
+  LLRP_tResultCode              eExpect);
+
+unsigned int
+buildStream (
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer,
+  unsigned int                  nReport);
+
+unsigned int
+tagCount (
+  unsigned int                  MessageID);
+
+unsigned int
+encodeMessage (
+  LLRP_tSMessage *              pMessage,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+unsigned int
+nextRandom (
+  unsigned int *                pRandom);
+/*
+ * END forward declarations
+ */
+
+
+/*
+ * The connection's initial buffer, its limit in the overflow
+ * case, and the receive thread's ring
+ */
+#define N_BUFFER        (1024u)
+#define N_BUFFER_MAX    (16u*1024u)
+#define N_RING          (8u)
+
+/*
+ * Reports in each case, and room for them all
+ */
+#define N_REPORT        (300u)
+#define N_REPORT_ERROR  (20u)
+#define N_REPORT_STOP   (100u)
+#define N_STREAM_MAX    (1024u*1024u)
+
+/*
+ * Tags in every tenth report, making it bigger than N_BUFFER
+ * but not N_BUFFER_MAX
+ */
+#define N_TAG_BIG       (200u)
+
+/*
+ * Global variables
+ */
+int                             g_Verbose;
+LLRP_tSTypeRegistry *           g_pTypeRegistry;
+unsigned char                   g_aStream[N_STREAM_MAX];
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Command main routine
+ **
+ ** Command synopsis:
+ **
+ **     dx410 [-v]
+ **
+ ** @exitcode   0               Everything *seemed* to work.
+ **             1               Bad usage
+ **             2               Run failed
+ **
+ *****************************************************************************/
+
+int
+main (
+  int                           ac,
+  char *                        av[])
+{
+    int                         rc;
+
+    if(ac == 2 && 0 == strcmp("-v", av[1]))
+    {
+        g_Verbose = 1;
+    }
+    else if(ac != 1)
+    {
+        usage(av[0]);
+        /* no return */
+    }
+
+    rc = run();
+
+    printf("INFO: Done\n");
+
+    exit(rc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Print usage message and exit
+ **
+ ** @param[in]  pProgName       Program name.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+usage (
+  char *                        pProgName)
+{
+    printf("Usage: %s [-v]\n", pProgName);
+    printf("\n");
+    printf("Each -v increases verbosity level\n");
+    exit(1);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Run the cases
+ **
+ ** @return     0               Every case passed
+ **             2               Something failed
+ **
+ *****************************************************************************/
+
+int
+run (void)
+{
+    int                         nFail = 0;
+
+    g_pTypeRegistry = LLRP_getTheTypeRegistry();
+    if(NULL == g_pTypeRegistry)
+    {
+        printf("ERROR: getTheTypeRegistry failed\n");
+        return 2;
+    }
+
+    nFail += caseOrder();
+    nFail += caseError(FALSE);
+    nFail += caseError(TRUE);
+    nFail += caseStop();
+
+    LLRP_TypeRegistry_destruct(g_pTypeRegistry);
+
+    if(0 != nFail)
+    {
+        printf("ERROR: %d check(s) failed\n", nFail);
+        return 2;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Every report whole and in order, then EOF
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseOrder (void)
+{
+    LLRP_tSConnection *         pConn;
+    LLRP_tSRecvThread *         pRecvThread;
+    LLRP_tSMessage *            pMessage;
+    tWriter                     Writer;
+    pthread_t                   Thread;
+    unsigned int                nStream;
+    unsigned int                i;
+    int                         nFail = 0;
+
+    nStream = buildStream(g_aStream, sizeof g_aStream, N_REPORT);
+    pConn = openPair(&Writer, &Thread, g_aStream, nStream, TRUE);
+
+    pRecvThread = LLRP_RecvThread_construct(pConn, N_RING);
+    if(NULL == pRecvThread ||
+       LLRP_RC_OK != LLRP_RecvThread_start(pRecvThread))
+    {
+        printf("ERROR: order: receive thread did not start\n");
+        exit(2);
+    }
+
+    i = 1;
+    while(i <= N_REPORT && 0 == nFail)
+    {
+        if(1u == (i / 50u) % 2u)
+        {
+            struct pollfd       pfd;
+
+            /*
+             * Wait on the eventfd as an event loop would,
+             * then take everything there without waiting
+             */
+            pfd.fd = LLRP_RecvThread_getEventFd(pRecvThread);
+            pfd.events = POLLIN;
+            pfd.revents = 0;
+            if(1 != poll(&pfd, 1, 5000))
+            {
+                printf("ERROR: order: eventfd not readable for %u\n", i);
+                nFail++;
+                break;
+            }
+            while(i <= N_REPORT && NULL != (pMessage =
+                        LLRP_RecvThread_recvMessage(pRecvThread, 0)))
+            {
+                nFail += checkMessage("order", pMessage, i);
+                i++;
+            }
+        }
+        else
+        {
+            pMessage = LLRP_RecvThread_recvMessage(pRecvThread, 5000);
+            nFail += checkMessage("order", pMessage, i);
+            i++;
+        }
+
+        if(0 == i % 40u)
+        {
+            /* Slow down so the ring fills */
+            usleep(20000);
+        }
+    }
+
+    nFail += checkEnd("order", pRecvThread, LLRP_RC_RecvEOF);
+
+    LLRP_RecvThread_destruct(pRecvThread);
+    closePair(pConn, &Writer, Thread);
+
+    if(0 == nFail)
+    {
+        printf("INFO: order PASS\n");
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  The reports before a bad frame, then the error
+ **
+ ** @param[in]  bOverflow       The bad frame is over the buffer limit,
+ **                             otherwise its length is impossible
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseError (
+  llrp_bool_t                   bOverflow)
+{
+    const char *                pWhat = bOverflow ? "overflow" : "framing";
+    LLRP_tSConnection *         pConn;
+    LLRP_tSRecvThread *         pRecvThread;
+    tWriter                     Writer;
+    pthread_t                   Thread;
+    unsigned int                nStream;
+    unsigned int                i;
+    int                         nFail = 0;
+
+    /*
+     * The bad frame's header. Its body is either just over the
+     * limit, or so long the frame's size would not fit an
+     * unsigned int.
+     */
+    static unsigned char        aBadHeader[19] =
+    {
+        0, 0, 0, 0, 0, 0, 0, 0,         /* DeviceSN */
+        1,                              /* Version */
+        0, 1,                           /* Type */
+        0xFF, 0xFF, 0xFF, 0xFF,         /* Length */
+        0, 0, 0, 0,                     /* MessageID */
+    };
+
+    if(bOverflow)
+    {
+        aBadHeader[11] = (N_BUFFER_MAX >> 24u) & 0xFFu;
+        aBadHeader[12] = (N_BUFFER_MAX >> 16u) & 0xFFu;
+        aBadHeader[13] = (N_BUFFER_MAX >> 8u) & 0xFFu;
+        aBadHeader[14] = N_BUFFER_MAX & 0xFFu;
+    }
+
+    nStream = buildStream(g_aStream, sizeof g_aStream, N_REPORT_ERROR);
+    memcpy(&g_aStream[nStream], aBadHeader, sizeof aBadHeader);
+    nStream += sizeof aBadHeader;
+
+    /*
+     * The writer keeps its end open, so the error is not EOF
+     */
+    pConn = openPair(&Writer, &Thread, g_aStream, nStream, FALSE);
+    if(bOverflow)
+    {
+        LLRP_Conn_setBufferLimits(pConn, N_BUFFER_MAX, 10000u);
+    }
+
+    pRecvThread = LLRP_RecvThread_construct(pConn, N_RING);
+    if(NULL == pRecvThread ||
+       LLRP_RC_OK != LLRP_RecvThread_start(pRecvThread))
+    {
+        printf("ERROR: %s: receive thread did not start\n", pWhat);
+        exit(2);
+    }
+
+    for(i = 1; i <= N_REPORT_ERROR; i++)
+    {
+        if(0 != checkMessage(pWhat,
+                LLRP_RecvThread_recvMessage(pRecvThread, 5000), i))
+        {
+            nFail++;
+            break;
+        }
+    }
+
+    nFail += checkEnd(pWhat, pRecvThread, bOverflow ?
+        LLRP_RC_RecvBufferOverflow : LLRP_RC_RecvFramingError);
+
+    LLRP_RecvThread_destruct(pRecvThread);
+    closePair(pConn, &Writer, Thread);
+
+    if(0 == nFail)
+    {
+        printf("INFO: %s PASS\n", pWhat);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Stop and destruct with reports still queued
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseStop (void)
+{
+    LLRP_tSConnection *         pConn;
+    LLRP_tSRecvThread *         pRecvThread;
+    LLRP_tSMessage *            pMessage;
+    const LLRP_tSErrorDetails * pError;
+    tWriter                     Writer;
+    pthread_t                   Thread;
+    unsigned int                nStream;
+    unsigned int                i = 1;
+    unsigned int                nFromRing = 0;
+    int                         nFail = 0;
+
+    nStream = buildStream(g_aStream, sizeof g_aStream, N_REPORT_STOP);
+    pConn = openPair(&Writer, &Thread, g_aStream, nStream, FALSE);
+
+    pRecvThread = LLRP_RecvThread_construct(pConn, N_RING);
+    if(NULL == pRecvThread ||
+       LLRP_RC_OK != LLRP_RecvThread_start(pRecvThread))
+    {
+        printf("ERROR: stop: receive thread did not start\n");
+        exit(2);
+    }
+
+    /*
+     * Take a few, then give the thread time to fill the ring
+     * and decode more onto the connection's input queue
+     */
+    for(; i <= 3u; i++)
+    {
+        nFail += checkMessage("stop",
+            LLRP_RecvThread_recvMessage(pRecvThread, 5000), i);
+    }
+    usleep(200000);
+
+    LLRP_RecvThread_stop(pRecvThread);
+
+    /*
+     * The ring still gives what it holds, then that it stopped
+     */
+    while(NULL != (pMessage =
+                LLRP_RecvThread_recvMessage(pRecvThread, 0)))
+    {
+        nFail += checkMessage("stop", pMessage, i);
+        i++;
+        nFromRing++;
+    }
+    pError = LLRP_RecvThread_getError(pRecvThread);
+    if(N_RING != nFromRing || LLRP_RC_MiscError != pError->eResultCode)
+    {
+        printf("ERROR: stop: ring gave %u then %d\n",
+            nFromRing, pError->eResultCode);
+        nFail++;
+    }
+
+    /*
+     * The connection gives the rest
+     */
+    for(; i <= N_REPORT_STOP / 2u; i++)
+    {
+        nFail += checkMessage("stop", LLRP_Conn_recvMessage(pConn, 5000), i);
+    }
+
+    /*
+     * A second thread picks up where the connection left off,
+     * and is destructed with its ring full
+     */
+    LLRP_RecvThread_destruct(pRecvThread);
+    pRecvThread = LLRP_RecvThread_construct(pConn, N_RING);
+    if(NULL == pRecvThread ||
+       LLRP_RC_OK != LLRP_RecvThread_start(pRecvThread))
+    {
+        printf("ERROR: stop: second receive thread did not start\n");
+        exit(2);
+    }
+    nFail += checkMessage("stop",
+        LLRP_RecvThread_recvMessage(pRecvThread, 5000), i);
+    usleep(200000);
+    LLRP_RecvThread_destruct(pRecvThread);
+
+    closePair(pConn, &Writer, Thread);
+
+    if(0 == nFail)
+    {
+        printf("INFO: stop PASS\n");
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Make a connection on a socket pair and start the writer
+ **
+ ** @param[out] pWriter         The writer's state
+ ** @param[out] pThread         The writer thread
+ ** @param[in]  pStream         What it writes
+ ** @param[in]  nStream         Bytes of that
+ ** @param[in]  bClose          It closes its end when done
+ **
+ ** @return     The connection, exits on failure
+ **
+ *****************************************************************************/
+
+LLRP_tSConnection *
+openPair (
+  tWriter *                     pWriter,
+  pthread_t *                   pThread,
+  const unsigned char *         pStream,
+  unsigned int                  nStream,
+  llrp_bool_t                   bClose)
+{
+    LLRP_tSConnection *         pConn;
+    int                         aFd[2];
+
+    pConn = LLRP_Conn_construct(g_pTypeRegistry, N_BUFFER);
+    if(NULL == pConn || 0 != socketpair(AF_UNIX, SOCK_STREAM, 0, aFd))
+    {
+        printf("ERROR: connection setup failed\n");
+        exit(2);
+    }
+
+    /*
+     * The connection is normally opened by name. Here it is
+     * simply handed the already connected socket.
+     */
+    pConn->fd = aFd[0];
+
+    pWriter->fd = aFd[1];
+    pWriter->pStream = pStream;
+    pWriter->nStream = nStream;
+    pWriter->bClose = bClose;
+    pWriter->Random = 410u;
+    if(0 != pthread_create(pThread, NULL, writerMain, pWriter))
+    {
+        printf("ERROR: pthread_create failed\n");
+        exit(2);
+    }
+
+    return pConn;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Close the connection and wait for the writer
+ **
+ ** The writer may still be blocked writing what was not read.
+ ** Closing the connection's end fails that write and ends it.
+ **
+ *****************************************************************************/
+
+void
+closePair (
+  LLRP_tSConnection *           pConn,
+  tWriter *                     pWriter,
+  pthread_t                     Thread)
+{
+    shutdown(pConn->fd, SHUT_RDWR);
+    pthread_join(Thread, NULL);
+    if(!pWriter->bClose)
+    {
+        close(pWriter->fd);
+    }
+    LLRP_Conn_destruct(pConn);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  The writer thread, writes the stream in random pieces
+ **
+ *****************************************************************************/
+
+void *
+writerMain (
+  void *                        pArg)
+{
+    tWriter *                   pWriter = pArg;
+    unsigned int                iNext = 0;
+
+    while(iNext < pWriter->nStream)
+    {
+        unsigned int            nPiece;
+        ssize_t                 nWritten;
+
+        nPiece = 1u + nextRandom(&pWriter->Random) % 1500u;
+        if(nPiece > pWriter->nStream - iNext)
+        {
+            nPiece = pWriter->nStream - iNext;
+        }
+
+        nWritten = send(pWriter->fd, &pWriter->pStream[iNext], nPiece,
+            MSG_NOSIGNAL);
+        if(0 >= nWritten)
+        {
+            break;
+        }
+        iNext += nWritten;
+    }
+
+    if(pWriter->bClose)
+    {
+        close(pWriter->fd);
+    }
+
+    return NULL;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check a message is the report expected next, and free it
+ **
+ ** @return     0               It is
+ **             1               It is not, or is NULL
+ **
+ *****************************************************************************/
+
+int
+checkMessage (
+  const char *                  pWhat,
+  LLRP_tSMessage *              pMessage,
+  unsigned int                  MessageID)
+{
+    int                         nTag;
+
+    if(NULL == pMessage)
+    {
+        printf("ERROR: %s: no report %u\n", pWhat, MessageID);
+        return 1;
+    }
+
+    nTag = -1;
+    if(&LLRP_tdTagSelectAccessReport == pMessage->elementHdr.pType)
+    {
+        nTag = LLRP_TagSelectAccessReport_countTagReportData(
+            (LLRP_tSTagSelectAccessReport *) pMessage);
+    }
+    if(MessageID != pMessage->MessageID ||
+       (int)tagCount(MessageID) != nTag)
+    {
+        printf("ERROR: %s: got report %u of %d tags, not %u of %u\n",
+            pWhat, pMessage->MessageID, nTag,
+            MessageID, tagCount(MessageID));
+        LLRP_Element_destruct(&pMessage->elementHdr);
+        return 1;
+    }
+
+    LLRP_Element_destruct(&pMessage->elementHdr);
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check the thread has nothing more and ended as expected
+ **
+ ** @return     0               It did
+ **             1               It did not
+ **
+ *****************************************************************************/
+
+int
+checkEnd (
+  const char *                  pWhat,
+  LLRP_tSRecvThread *           pRecvThread,
+  LLRP_tResultCode              eExpect)
+{
+    LLRP_tSMessage *            pMessage;
+    const LLRP_tSErrorDetails * pError;
+
+    pMessage = LLRP_RecvThread_recvMessage(pRecvThread, 5000);
+    pError = LLRP_RecvThread_getError(pRecvThread);
+    if(g_Verbose)
+    {
+        printf("INFO: %s: ended with %d, %s\n", pWhat,
+            pError->eResultCode,
+            NULL != pError->pWhatStr ? pError->pWhatStr : "");
+    }
+    if(NULL != pMessage || eExpect != pError->eResultCode)
+    {
+        printf("ERROR: %s: ended with %d, not %d\n", pWhat,
+            pError->eResultCode, eExpect);
+        if(NULL != pMessage)
+        {
+            LLRP_Element_destruct(&pMessage->elementHdr);
+        }
+        return 1;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Encode reports 1 to nReport one after the other
+ **
+ ** @param[out] pBuffer         Where to put the frames
+ ** @param[in]  nBuffer         Room there
+ ** @param[in]  nReport         How many
+ **
+ ** @return     Bytes of frames, exits on failure
+ **
+ *****************************************************************************/
+
+unsigned int
+buildStream (
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer,
+  unsigned int                  nReport)
+{
+    unsigned int                nStream = 0;
+    unsigned int                MessageID;
+
+    for(MessageID = 1; MessageID <= nReport; MessageID++)
+    {
+        LLRP_tSTagSelectAccessReport *pReport;
+        unsigned int            nFrame;
+        unsigned int            i;
+
+        pReport = LLRP_TagSelectAccessReport_construct();
+        if(NULL == pReport)
+        {
+            printf("ERROR: TagSelectAccessReport_construct failed\n");
+            exit(2);
+        }
+        LLRP_Message_setMessageID(&pReport->hdr, MessageID);
+        pReport->hdr.Version = 1;
+
+        for(i = 0; i < tagCount(MessageID); i++)
+        {
+            LLRP_tSTagReportData *pTRD;
+            LLRP_tSAntennaID *  pAntennaID;
+            llrp_u8v_t          TID;
+
+            pTRD = LLRP_TagReportData_construct();
+
+            TID = LLRP_u8v_construct(12);
+            memset(TID.pValue, MessageID + i, 12);
+            LLRP_TagReportData_setTID(pTRD, TID);
+
+            pAntennaID = LLRP_AntennaID_construct();
+            LLRP_AntennaID_setAntennaID(pAntennaID, 1u + (i & 3u));
+            LLRP_TagReportData_setAntennaID(pTRD, pAntennaID);
+
+            LLRP_TagSelectAccessReport_addTagReportData(pReport, pTRD);
+        }
+
+        nFrame = encodeMessage(&pReport->hdr, &pBuffer[nStream],
+            nBuffer - nStream);
+        if(0 == nFrame)
+        {
+            printf("ERROR: encode failed\n");
+            exit(2);
+        }
+        nStream += nFrame;
+
+        LLRP_Element_destruct(&pReport->hdr.elementHdr);
+    }
+
+    return nStream;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Tags in a report, N_TAG_BIG in every tenth
+ **
+ *****************************************************************************/
+
+unsigned int
+tagCount (
+  unsigned int                  MessageID)
+{
+    return (0 == MessageID % 10u) ? N_TAG_BIG : MessageID % 5u;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Encode a message into a buffer
+ **
+ ** @param[in]  pMessage        The message
+ ** @param[out] pBuffer         Where to put the frame
+ ** @param[in]  nBuffer         Room there
+ **
+ ** @return     >0              Bytes in the frame
+ **             0               Encode failed
+ **
+ *****************************************************************************/
+
+unsigned int
+encodeMessage (
+  LLRP_tSMessage *              pMessage,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    LLRP_tSFrameEncoder *       pEncoder;
+    unsigned int                nFrame = 0;
+
+    pEncoder = LLRP_FrameEncoder_construct(pBuffer, nBuffer);
+    if(NULL != pEncoder)
+    {
+        LLRP_Encoder_encodeElement(&pEncoder->encoderHdr,
+            &pMessage->elementHdr);
+        if(LLRP_RC_OK == pEncoder->encoderHdr.ErrorDetails.eResultCode)
+        {
+            nFrame = pEncoder->iNext;
+        }
+        LLRP_Encoder_destruct(&pEncoder->encoderHdr);
+    }
+
+    return nFrame;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Next of a simple, repeatable pseudo-random sequence
+ **
+ *****************************************************************************/
+
+unsigned int
+nextRandom (
+  unsigned int *                pRandom)
+{
+    *pRandom = *pRandom * 1103515245u + 12345u;
+
+    return *pRandom >> 8u;
+}
@@ -0,0 +1,1137 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  dx411.c
+ **
+ ** @brief Check a connection group of several connections
+ **
+ ** This is diagnostic 411 for the LLRP Tool Kit for C (LTKC).
+ **
+ ** DX411 needs no reader. Each connection is one end of a socket
+ ** pair and this program plays the reader on the other end. Pair
+ ** k sends Keepalives with MessageID k*1000+1 up and a DeviceSN
+ ** of its own. Every event must come from the right connection,
+ ** with the right context, and each connection's messages must
+ ** come in order. Three cases:
+ **     - read, one busy connection must not hold up the others,
+ **       a frame that arrives in two pieces is one event, and
+ **       many rounds of a few messages each all come out.
+ **     - remove, connections are removed while their messages
+ **       are waiting, one of them the one just heard from. Nothing
+ **       more may come from them until they are added back, then
+ **       the rest must.
+ **     - error, four connections end or fail four different ways
+ **       at once. Each error event must be for its connection,
+ **       after its messages, and agree with its
+ **       LLRP_Conn_getRecvError(). The ended ones must then
+ **       stay quiet and the one with a bad frame carry on.
+ **
+ ** This program can be run with one verbose option (-v)
+ ** to print the errors given as well.
+ **
+ ** Exit status is 0 when every check passed.
+ **
+ *****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#include "../Library/ltkc.h"
+
+
+/*
+ * One connection and the reader end of its socket pair
+ */
+typedef struct
+{
+    LLRP_tSConnection *         pConn;
+    int                         fd;
+    unsigned int                iPair;
+    unsigned int                nSent;
+    unsigned int                nGot;
+} tPair;
+
+
+/*
+ * BEGIN forward declarations
+ */
+int
+main (
+  int                           ac,
+  char *                        av[]);
+
+void
+usage (
+  char *                        pProgName);
+
+int
+run (void);
+
+int
+caseRead (void);
+
+int
+caseRemove (void);
+
+int
+caseError (void);
+
+void
+openPairs (
+  tPair *                       aPair,
+  unsigned int                  nPair);
+
+void
+closePairs (
+  tPair *                       aPair,
+  unsigned int                  nPair);
+
+int
+addPairs (
+  LLRP_tSConnGroup *            pGroup,
+  tPair *                       aPair,
+  unsigned int                  nPair);
+
+int
+takeEvent (
+  const char *                  pWhat,
+  LLRP_tSConnGroup *            pGroup,
+  LLRP_tSConnGroupEvent *       pEvent);
+
+int
+checkMessage (
+  const char *                  pWhat,
+  LLRP_tSConnGroupEvent *       pEvent,
+  tPair *                       aPair,
+  unsigned int                  nPair,
+  tPair **                      ppPair);
+
+int
+drainPairs (
+  const char *                  pWhat,
+  LLRP_tSConnGroup *            pGroup,
+  tPair *                       aPair,
+  unsigned int                  nPair);
+
+int
+checkQuiet (
+  const char *                  pWhat,
+  LLRP_tSConnGroup *            pGroup);
+
+void
+sendKeepalive (
+  tPair *                       pPair);
+
+unsigned int
+encodeKeepalive (
+  tPair *                       pPair,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+void
+frameHeader (
+  unsigned char *               pHeader,
+  unsigned int                  Type,
+  unsigned int                  Length);
+
+void
+sendBytes (
+  int                           fd,
+  const unsigned char *         pBytes,
+  unsigned int                  nBytes);
+/*
+ * END forward declarations
+ */
+
+
+/*
+ * Connections in a group, and messages in a burst
+ */
+#define N_PAIR          (4u)
+#define N_BURST         (20u)
+#define N_QUEUED        (5u)
+#define N_ROUND         (50u)
+
+/*
+ * The connection's initial buffer, and its limit in the error case
+ */
+#define N_BUFFER        (1024u)
+#define N_BUFFER_MAX    (4096u)
+
+/*
+ * Pair k's DeviceSN is DEVICE_SN+k
+ */
+#define DEVICE_SN       (0x0411000000000000ull)
+
+/*
+ * A message type nothing is registered for
+ */
+#define TYPE_UNKNOWN    (900u)
+
+/*
+ * Global variables
+ */
+int                             g_Verbose;
+LLRP_tSTypeRegistry *           g_pTypeRegistry;
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Command main routine
+ **
+ ** Command synopsis:
+ **
+ **     dx411 [-v]
+ **
+ ** @exitcode   0               Everything *seemed* to work.
+ **             1               Bad usage
+ **             2               Run failed
+ **
+ *****************************************************************************/
+
+int
+main (
+  int                           ac,
+  char *                        av[])
+{
+    int                         rc;
+
+    if(ac == 2 && 0 == strcmp("-v", av[1]))
+    {
+        g_Verbose = 1;
+    }
+    else if(ac != 1)
+    {
+        usage(av[0]);
+        /* no return */
+    }
+
+    rc = run();
+
+    printf("INFO: Done\n");
+
+    exit(rc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Print usage message and exit
+ **
+ ** @param[in]  pProgName       Program name.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+usage (
+  char *                        pProgName)
+{
+    printf("Usage: %s [-v]\n", pProgName);
+    printf("\n");
+    printf("Each -v increases verbosity level\n");
+    exit(1);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Run the cases
+ **
+ ** @return     0               Every case passed
+ **             2               Something failed
+ **
+ *****************************************************************************/
+
+int
+run (void)
+{
+    int                         nFail = 0;
+
+    g_pTypeRegistry = LLRP_getTheTypeRegistry();
+    if(NULL == g_pTypeRegistry)
+    {
+        printf("ERROR: getTheTypeRegistry failed\n");
+        return 2;
+    }
+
+    nFail += caseRead();
+    nFail += caseRemove();
+    nFail += caseError();
+
+    LLRP_TypeRegistry_destruct(g_pTypeRegistry);
+
+    if(0 != nFail)
+    {
+        printf("ERROR: %d check(s) failed\n", nFail);
+        return 2;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Messages from several connections, each from the right one
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseRead (void)
+{
+    const char *                pWhat = "read";
+    LLRP_tSConnGroup *          pGroup;
+    LLRP_tSConnGroupEvent       Event;
+    tPair                       aPair[N_PAIR];
+    tPair *                     pPair;
+    unsigned char               aFrame[64];
+    unsigned int                nFrame;
+    unsigned int                iRound;
+    unsigned int                i;
+    int                         nFail = 0;
+
+    openPairs(aPair, N_PAIR);
+
+    /*
+     * A burst on the first, one each on the others. All of it
+     * is there before the connections join the group.
+     */
+    for(i = 0; i < N_BURST; i++)
+    {
+        sendKeepalive(&aPair[0]);
+    }
+    for(i = 1; i < N_PAIR; i++)
+    {
+        sendKeepalive(&aPair[i]);
+    }
+
+    pGroup = LLRP_ConnGroup_construct();
+    if(NULL == pGroup)
+    {
+        printf("ERROR: %s: ConnGroup_construct failed\n", pWhat);
+        exit(2);
+    }
+    nFail += addPairs(pGroup, aPair, N_PAIR);
+
+    /*
+     * The quiet ones must each be heard before the busy
+     * one is heard twice
+     */
+    for(i = 0; i < N_BURST + N_PAIR - 1u && 0 == nFail; i++)
+    {
+        if(0 != takeEvent(pWhat, pGroup, &Event) ||
+           0 != checkMessage(pWhat, &Event, aPair, N_PAIR, &pPair))
+        {
+            nFail++;
+            break;
+        }
+        if(i == N_PAIR - 1u && aPair[0].nGot != 1u)
+        {
+            printf("ERROR: %s: busy connection heard %u times "
+                "before the others\n", pWhat, aPair[0].nGot);
+            nFail++;
+        }
+    }
+    nFail += checkQuiet(pWhat, pGroup);
+
+    /*
+     * A frame in two pieces, the second with another
+     * connection's frame
+     */
+    nFrame = encodeKeepalive(&aPair[2], aFrame, sizeof aFrame);
+    sendBytes(aPair[2].fd, aFrame, 7u);
+    nFail += checkQuiet(pWhat, pGroup);
+    sendBytes(aPair[2].fd, &aFrame[7], nFrame - 7u);
+    sendKeepalive(&aPair[3]);
+    nFail += drainPairs(pWhat, pGroup, aPair, N_PAIR);
+
+    /*
+     * Rounds of a few messages from each, a different
+     * few each time
+     */
+    for(iRound = 0; iRound < N_ROUND && 0 == nFail; iRound++)
+    {
+        for(i = 0; i < N_PAIR; i++)
+        {
+            unsigned int        n;
+
+            for(n = 0; n < (iRound + i) % 4u; n++)
+            {
+                sendKeepalive(&aPair[i]);
+            }
+        }
+        nFail += drainPairs(pWhat, pGroup, aPair, N_PAIR);
+    }
+    nFail += checkQuiet(pWhat, pGroup);
+
+    /*
+     * The group must let go of the connections' send watches
+     */
+    LLRP_ConnGroup_destruct(pGroup);
+    for(i = 0; i < N_PAIR; i++)
+    {
+        if(NULL != aPair[i].pConn->Send.pfWatch)
+        {
+            printf("ERROR: %s: send watch left after destruct\n", pWhat);
+            nFail++;
+        }
+    }
+
+    closePairs(aPair, N_PAIR);
+
+    if(0 == nFail)
+    {
+        printf("INFO: %s PASS\n", pWhat);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Connections removed with messages waiting, then added back
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseRemove (void)
+{
+    const char *                pWhat = "remove";
+    LLRP_tSConnGroup *          pGroup;
+    LLRP_tSConnGroupEvent       Event;
+    tPair                       aPair[3];
+    tPair *                     pFirst;
+    tPair *                     pSecond;
+    tPair *                     pThird;
+    unsigned int                i;
+    unsigned int                n;
+    int                         nFail = 0;
+
+    openPairs(aPair, 3u);
+
+    pGroup = LLRP_ConnGroup_construct();
+    if(NULL == pGroup)
+    {
+        printf("ERROR: %s: ConnGroup_construct failed\n", pWhat);
+        exit(2);
+    }
+    nFail += addPairs(pGroup, aPair, 3u);
+
+    for(i = 0; i < 3u; i++)
+    {
+        for(n = 0; n < N_QUEUED; n++)
+        {
+            sendKeepalive(&aPair[i]);
+        }
+    }
+
+    /*
+     * Remove the one just heard from. It still has messages.
+     */
+    if(0 != takeEvent(pWhat, pGroup, &Event) ||
+       0 != checkMessage(pWhat, &Event, aPair, 3u, &pFirst))
+    {
+        printf("ERROR: %s: no first event\n", pWhat);
+        exit(2);
+    }
+    if(LLRP_RC_OK != LLRP_ConnGroup_remove(pGroup, pFirst->pConn))
+    {
+        printf("ERROR: %s: remove failed\n", pWhat);
+        nFail++;
+    }
+    if(LLRP_RC_MiscError != LLRP_ConnGroup_remove(pGroup, pFirst->pConn))
+    {
+        printf("ERROR: %s: second remove did not fail\n", pWhat);
+        nFail++;
+    }
+    if(NULL != pFirst->pConn->Send.pfWatch)
+    {
+        printf("ERROR: %s: send watch left after remove\n", pWhat);
+        nFail++;
+    }
+
+    /*
+     * Remove the one not yet heard from, waiting on the ready list
+     */
+    if(0 != takeEvent(pWhat, pGroup, &Event) ||
+       0 != checkMessage(pWhat, &Event, aPair, 3u, &pSecond))
+    {
+        printf("ERROR: %s: no second event\n", pWhat);
+        exit(2);
+    }
+    if(pSecond == pFirst)
+    {
+        printf("ERROR: %s: event from removed connection\n", pWhat);
+        exit(2);
+    }
+    pThird = &aPair[3u - pFirst->iPair - pSecond->iPair];
+    if(LLRP_RC_OK != LLRP_ConnGroup_remove(pGroup, pThird->pConn))
+    {
+        printf("ERROR: %s: remove failed\n", pWhat);
+        nFail++;
+    }
+
+    /*
+     * Only the one left may be heard from
+     */
+    for(n = 1; n < N_QUEUED && 0 == nFail; n++)
+    {
+        tPair *                 pPair;
+
+        if(0 != takeEvent(pWhat, pGroup, &Event) ||
+           0 != checkMessage(pWhat, &Event, aPair, 3u, &pPair))
+        {
+            nFail++;
+        }
+        else if(pPair != pSecond)
+        {
+            printf("ERROR: %s: event from removed connection %u\n",
+                pWhat, pPair->iPair);
+            nFail++;
+        }
+    }
+    nFail += checkQuiet(pWhat, pGroup);
+
+    /*
+     * An empty group. New input on a removed connection
+     * must not be seen.
+     */
+    if(LLRP_RC_OK != LLRP_ConnGroup_remove(pGroup, pSecond->pConn))
+    {
+        printf("ERROR: %s: remove failed\n", pWhat);
+        nFail++;
+    }
+    sendKeepalive(pFirst);
+    nFail += checkQuiet(pWhat, pGroup);
+
+    /*
+     * Back in, the rest of each must come out in order
+     */
+    nFail += addPairs(pGroup, aPair, 3u);
+    if(LLRP_RC_MiscError != LLRP_ConnGroup_add(pGroup, pFirst->pConn, pFirst))
+    {
+        printf("ERROR: %s: second add did not fail\n", pWhat);
+        nFail++;
+    }
+    nFail += drainPairs(pWhat, pGroup, aPair, 3u);
+    nFail += checkQuiet(pWhat, pGroup);
+
+    LLRP_ConnGroup_destruct(pGroup);
+    closePairs(aPair, 3u);
+
+    if(0 == nFail)
+    {
+        printf("INFO: %s PASS\n", pWhat);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Errors on several connections, each reported for its own
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseError (void)
+{
+    const char *                pWhat = "error";
+    LLRP_tSConnGroup *          pGroup;
+    LLRP_tSConnGroupEvent       Event;
+    tPair                       aPair[N_PAIR];
+    llrp_bool_t                 abSeen[N_PAIR];
+    unsigned char               aHeader[19];
+    unsigned int                nError;
+    unsigned int                nEvent;
+    unsigned int                i;
+    int                         nFail = 0;
+
+    /*
+     * What each connection must end with
+     */
+    static const LLRP_tResultCode aeExpect[N_PAIR] =
+    {
+        LLRP_RC_RecvEOF,
+        LLRP_RC_RecvFramingError,
+        LLRP_RC_RecvBufferOverflow,
+        LLRP_RC_UnknownMessageType,
+    };
+
+    openPairs(aPair, N_PAIR);
+    memset(abSeen, 0, sizeof abSeen);
+
+    pGroup = LLRP_ConnGroup_construct();
+    if(NULL == pGroup)
+    {
+        printf("ERROR: %s: ConnGroup_construct failed\n", pWhat);
+        exit(2);
+    }
+    nFail += addPairs(pGroup, aPair, N_PAIR);
+
+    /*
+     * Two messages each, then:
+     *  0: the reader closes its end
+     *  1: a frame too long to exist
+     *  2: a frame over the buffer limit
+     *  3: a frame of unknown type, then a third message
+     */
+    for(i = 0; i < N_PAIR; i++)
+    {
+        sendKeepalive(&aPair[i]);
+        sendKeepalive(&aPair[i]);
+    }
+
+    close(aPair[0].fd);
+    aPair[0].fd = -1;
+
+    frameHeader(aHeader, 62u, 0xFFFFFFFFu);
+    sendBytes(aPair[1].fd, aHeader, sizeof aHeader);
+
+    LLRP_Conn_setBufferLimits(aPair[2].pConn, N_BUFFER_MAX, 10000u);
+    frameHeader(aHeader, 62u, N_BUFFER_MAX);
+    sendBytes(aPair[2].fd, aHeader, sizeof aHeader);
+
+    frameHeader(aHeader, TYPE_UNKNOWN, 0u);
+    sendBytes(aPair[3].fd, aHeader, sizeof aHeader);
+    sendKeepalive(&aPair[3]);
+
+    /*
+     * Every message, and one error from each connection after
+     * its messages
+     */
+    nError = 0;
+    for(nEvent = 0; nEvent < 2u * N_PAIR + 1u + N_PAIR; nEvent++)
+    {
+        const LLRP_tSErrorDetails * pError;
+        tPair *                 pPair;
+
+        if(0 != takeEvent(pWhat, pGroup, &Event))
+        {
+            nFail++;
+            break;
+        }
+
+        if(NULL != Event.pMessage)
+        {
+            nFail += checkMessage(pWhat, &Event, aPair, N_PAIR, &pPair);
+            continue;
+        }
+
+        pPair = Event.pAppContext;
+        if(pPair < &aPair[0] || pPair >= &aPair[N_PAIR] ||
+           pPair->pConn != Event.pConn)
+        {
+            printf("ERROR: %s: error event for unknown connection\n",
+                pWhat);
+            nFail++;
+            continue;
+        }
+
+        pError = LLRP_Conn_getRecvError(pPair->pConn);
+        if(g_Verbose)
+        {
+            printf("INFO: %s: connection %u ended with %d, %s\n",
+                pWhat, pPair->iPair, Event.eResultCode,
+                NULL != pError->pWhatStr ? pError->pWhatStr : "");
+        }
+
+        if(aeExpect[pPair->iPair] != Event.eResultCode ||
+           Event.eResultCode != pError->eResultCode)
+        {
+            printf("ERROR: %s: connection %u gave %d, details %d, "
+                "not %d\n", pWhat, pPair->iPair, Event.eResultCode,
+                pError->eResultCode, aeExpect[pPair->iPair]);
+            nFail++;
+        }
+        if(abSeen[pPair->iPair] || pPair->nGot != pPair->nSent ||
+           0u != Event.DeviceSN)
+        {
+            printf("ERROR: %s: connection %u error out of turn\n",
+                pWhat, pPair->iPair);
+            nFail++;
+        }
+        abSeen[pPair->iPair] = TRUE;
+        nError++;
+    }
+
+    if(N_PAIR != nError)
+    {
+        printf("ERROR: %s: %u errors, not %u\n", pWhat, nError, N_PAIR);
+        nFail++;
+    }
+
+    /*
+     * The ended ones are no longer watched. The one with the
+     * bad frame carries on.
+     */
+    nFail += checkQuiet(pWhat, pGroup);
+    sendKeepalive(&aPair[3]);
+    nFail += drainPairs(pWhat, pGroup, aPair, N_PAIR);
+    nFail += checkQuiet(pWhat, pGroup);
+
+    for(i = 0; i < 3u; i++)
+    {
+        if(aeExpect[i] != LLRP_Conn_getRecvError(aPair[i].pConn)->eResultCode)
+        {
+            printf("ERROR: %s: connection %u lost its error\n", pWhat, i);
+            nFail++;
+        }
+    }
+
+    LLRP_ConnGroup_destruct(pGroup);
+    closePairs(aPair, N_PAIR);
+
+    if(0 == nFail)
+    {
+        printf("INFO: %s PASS\n", pWhat);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Make a connection on a socket pair for each pair
+ **
+ ** @param[out] aPair           The pairs
+ ** @param[in]  nPair           How many
+ **
+ ** @return     void, exits on failure
+ **
+ *****************************************************************************/
+
+void
+openPairs (
+  tPair *                       aPair,
+  unsigned int                  nPair)
+{
+    unsigned int                i;
+
+    for(i = 0; i < nPair; i++)
+    {
+        int                     aFd[2];
+
+        aPair[i].pConn = LLRP_Conn_construct(g_pTypeRegistry, N_BUFFER);
+        if(NULL == aPair[i].pConn ||
+           0 != socketpair(AF_UNIX, SOCK_STREAM, 0, aFd))
+        {
+            printf("ERROR: connection setup failed\n");
+            exit(2);
+        }
+
+        /*
+         * The connection is normally opened by name. Here it is
+         * simply handed the already connected socket.
+         */
+        aPair[i].pConn->fd = aFd[0];
+        aPair[i].fd = aFd[1];
+        aPair[i].iPair = i;
+        aPair[i].nSent = 0;
+        aPair[i].nGot = 0;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Close both ends of each pair and destruct the connections
+ **
+ *****************************************************************************/
+
+void
+closePairs (
+  tPair *                       aPair,
+  unsigned int                  nPair)
+{
+    unsigned int                i;
+
+    for(i = 0; i < nPair; i++)
+    {
+        if(0 <= aPair[i].fd)
+        {
+            close(aPair[i].fd);
+        }
+        LLRP_Conn_destruct(aPair[i].pConn);
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Add each pair's connection to the group, the pair as context
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+addPairs (
+  LLRP_tSConnGroup *            pGroup,
+  tPair *                       aPair,
+  unsigned int                  nPair)
+{
+    unsigned int                i;
+    int                         nFail = 0;
+
+    for(i = 0; i < nPair; i++)
+    {
+        if(LLRP_RC_OK != LLRP_ConnGroup_add(pGroup, aPair[i].pConn,
+                &aPair[i]))
+        {
+            printf("ERROR: ConnGroup_add failed, %s\n",
+                LLRP_ConnGroup_getError(pGroup)->pWhatStr);
+            nFail++;
+        }
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Wait for the next event
+ **
+ ** @return     0               Got one
+ **             1               Did not
+ **
+ *****************************************************************************/
+
+int
+takeEvent (
+  const char *                  pWhat,
+  LLRP_tSConnGroup *            pGroup,
+  LLRP_tSConnGroupEvent *       pEvent)
+{
+    LLRP_tResultCode            lrc;
+
+    lrc = LLRP_ConnGroup_wait(pGroup, 5000, pEvent);
+    if(LLRP_RC_OK != lrc)
+    {
+        printf("ERROR: %s: wait gave %d, not an event\n", pWhat, lrc);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check an event is the message expected next from its pair,
+ **         and free it
+ **
+ ** @param[in]  pWhat           The case
+ ** @param[in]  pEvent          The event
+ ** @param[in]  aPair           The pairs in the group
+ ** @param[in]  nPair           How many
+ ** @param[out] ppPair          The pair it is from
+ **
+ ** @return     0               It is
+ **             1               It is not
+ **
+ *****************************************************************************/
+
+int
+checkMessage (
+  const char *                  pWhat,
+  LLRP_tSConnGroupEvent *       pEvent,
+  tPair *                       aPair,
+  unsigned int                  nPair,
+  tPair **                      ppPair)
+{
+    LLRP_tSMessage *            pMessage = pEvent->pMessage;
+    tPair *                     pPair = pEvent->pAppContext;
+    unsigned int                MessageID;
+
+    *ppPair = pPair;
+
+    if(NULL == pMessage)
+    {
+        printf("ERROR: %s: error %d, not a message\n", pWhat,
+            pEvent->eResultCode);
+        return 1;
+    }
+
+    if(pPair < &aPair[0] || pPair >= &aPair[nPair] ||
+       pPair->pConn != pEvent->pConn)
+    {
+        printf("ERROR: %s: message %u for unknown connection\n",
+            pWhat, pMessage->MessageID);
+        LLRP_Element_destruct(&pMessage->elementHdr);
+        return 1;
+    }
+
+    MessageID = pPair->iPair * 1000u + pPair->nGot + 1u;
+    if(MessageID != pMessage->MessageID ||
+       DEVICE_SN + pPair->iPair != pEvent->DeviceSN ||
+       pEvent->DeviceSN != pMessage->DeviceSN ||
+       &LLRP_tdKeepalive != pMessage->elementHdr.pType)
+    {
+        printf("ERROR: %s: connection %u gave message %u, not %u\n",
+            pWhat, pPair->iPair, pMessage->MessageID, MessageID);
+        LLRP_Element_destruct(&pMessage->elementHdr);
+        return 1;
+    }
+
+    pPair->nGot++;
+    LLRP_Element_destruct(&pMessage->elementHdr);
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Take messages until every pair has given all it sent
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+drainPairs (
+  const char *                  pWhat,
+  LLRP_tSConnGroup *            pGroup,
+  tPair *                       aPair,
+  unsigned int                  nPair)
+{
+    LLRP_tSConnGroupEvent       Event;
+    unsigned int                nLeft = 0;
+    unsigned int                i;
+
+    for(i = 0; i < nPair; i++)
+    {
+        nLeft += aPair[i].nSent - aPair[i].nGot;
+    }
+
+    for(; 0 < nLeft; nLeft--)
+    {
+        tPair *                 pPair;
+
+        if(0 != takeEvent(pWhat, pGroup, &Event) ||
+           0 != checkMessage(pWhat, &Event, aPair, nPair, &pPair))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check the group has nothing to give
+ **
+ ** @return     0               It has not
+ **             1               It gave an event
+ **
+ *****************************************************************************/
+
+int
+checkQuiet (
+  const char *                  pWhat,
+  LLRP_tSConnGroup *            pGroup)
+{
+    LLRP_tSConnGroupEvent       Event;
+    LLRP_tResultCode            lrc;
+
+    lrc = LLRP_ConnGroup_wait(pGroup, 100, &Event);
+    if(LLRP_RC_RecvTimeout != lrc)
+    {
+        printf("ERROR: %s: wait gave %d, event %d, not a timeout\n",
+            pWhat, lrc, Event.eResultCode);
+        if(NULL != Event.pMessage)
+        {
+            LLRP_Element_destruct(&Event.pMessage->elementHdr);
+        }
+        return 1;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Send the pair's next Keepalive from the reader end
+ **
+ *****************************************************************************/
+
+void
+sendKeepalive (
+  tPair *                       pPair)
+{
+    unsigned char               aFrame[64];
+    unsigned int                nFrame;
+
+    nFrame = encodeKeepalive(pPair, aFrame, sizeof aFrame);
+    sendBytes(pPair->fd, aFrame, nFrame);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Encode the pair's next Keepalive and count it sent
+ **
+ ** @param[in]  pPair           The pair
+ ** @param[out] pBuffer         Where to put the frame
+ ** @param[in]  nBuffer         Room there
+ **
+ ** @return     Bytes in the frame, exits on failure
+ **
+ *****************************************************************************/
+
+unsigned int
+encodeKeepalive (
+  tPair *                       pPair,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    LLRP_tSKeepalive *          pKeepalive;
+    LLRP_tSFrameEncoder *       pEncoder;
+    unsigned int                nFrame = 0;
+
+    pKeepalive = LLRP_Keepalive_construct();
+    if(NULL == pKeepalive)
+    {
+        printf("ERROR: Keepalive_construct failed\n");
+        exit(2);
+    }
+    pPair->nSent++;
+    LLRP_Message_setMessageID(&pKeepalive->hdr,
+        pPair->iPair * 1000u + pPair->nSent);
+    pKeepalive->hdr.DeviceSN = DEVICE_SN + pPair->iPair;
+    pKeepalive->hdr.Version = 1;
+
+    pEncoder = LLRP_FrameEncoder_construct(pBuffer, nBuffer);
+    if(NULL != pEncoder)
+    {
+        LLRP_Encoder_encodeElement(&pEncoder->encoderHdr,
+            &pKeepalive->hdr.elementHdr);
+        if(LLRP_RC_OK == pEncoder->encoderHdr.ErrorDetails.eResultCode)
+        {
+            nFrame = pEncoder->iNext;
+        }
+        LLRP_Encoder_destruct(&pEncoder->encoderHdr);
+    }
+
+    LLRP_Element_destruct(&pKeepalive->hdr.elementHdr);
+
+    if(0 == nFrame)
+    {
+        printf("ERROR: encode failed\n");
+        exit(2);
+    }
+
+    return nFrame;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Make a frame header by hand, MessageID 0
+ **
+ ** @param[out] pHeader         19 bytes
+ ** @param[in]  Type            Message type
+ ** @param[in]  Length          Bytes of body it claims
+ **
+ *****************************************************************************/
+
+void
+frameHeader (
+  unsigned char *               pHeader,
+  unsigned int                  Type,
+  unsigned int                  Length)
+{
+    memset(pHeader, 0, 19u);
+    pHeader[8] = 1;                             /* Version */
+    pHeader[9] = (Type >> 8u) & 0xFFu;
+    pHeader[10] = Type & 0xFFu;
+    pHeader[11] = (Length >> 24u) & 0xFFu;
+    pHeader[12] = (Length >> 16u) & 0xFFu;
+    pHeader[13] = (Length >> 8u) & 0xFFu;
+    pHeader[14] = Length & 0xFFu;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Write all of some bytes to the reader end
+ **
+ *****************************************************************************/
+
+void
+sendBytes (
+  int                           fd,
+  const unsigned char *         pBytes,
+  unsigned int                  nBytes)
+{
+    while(0 < nBytes)
+    {
+        ssize_t                 nWritten;
+
+        nWritten = send(fd, pBytes, nBytes, MSG_NOSIGNAL);
+        if(0 >= nWritten)
+        {
+            printf("ERROR: send failed\n");
+            exit(2);
+        }
+        pBytes += nWritten;
+        nBytes -= nWritten;
+    }
+}
@@ -0,0 +1,1210 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  dx412.c
+ **
+ ** @brief Check the non-blocking send path
+ **
+ ** This is diagnostic 412 for the LLRP Tool Kit for C (LTKC).
+ **
+ ** DX412 needs no reader. The connection is one end of a socket
+ ** pair and this program plays the reader on the other end, taking
+ ** only what it is given. Frames carry MessageID 1 up. Some are
+ ** Keepalives sent with LLRP_Conn_sendMessage(), the rest frames
+ ** of odd sizes with patterned bodies sent with LLRP_Conn_sendFrame(),
+ ** sometimes several at once. The reader checks every frame
+ ** arrives once, whole, and in order. Three cases:
+ **     - fill, the socket is filled until frames are queued, then
+ **       the queue until LLRP_RC_SendQueueFull. A frame sent after
+ **       the reader makes room must still wait its turn. Flushed,
+ **       everything must arrive in order.
+ **     - batch, sendmsg() is held to a byte budget so each flush
+ **       is a partial write that stops mid-frame. Each must write
+ **       exactly the budget, gathering many frames in one call.
+ **     - error, a flush to a closed reader must give
+ **       LLRP_RC_SendIOError and discard the queue.
+ ** The send watch must be told each time the queue fills and
+ ** drains, and only then.
+ **
+ ** The Makefile links dx412 with -Wl,--wrap=sendmsg, for the
+ ** budget.
+ **
+ ** This program can be run with one verbose option (-v)
+ ** to print the counts as well.
+ **
+ ** Exit status is 0 when every check passed.
+ **
+ *****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include "../Library/ltkc.h"
+
+
+/*
+ * Reader end of the socket pair, and what it has seen
+ */
+typedef struct
+{
+    int                         fd;
+    unsigned char               aBuf[64u*1024u];
+    unsigned int                nBuf;
+    unsigned int                NextID;
+} tPeer;
+
+
+/*
+ * BEGIN forward declarations
+ */
+int
+main (
+  int                           ac,
+  char *                        av[]);
+
+void
+usage (
+  char *                        pProgName);
+
+int
+run (void);
+
+int
+caseFill (void);
+
+int
+caseBatch (void);
+
+int
+caseError (void);
+
+LLRP_tSConnection *
+openPair (
+  tPeer *                       pPeer,
+  unsigned int                  nMaxQueueBytes);
+
+void
+closePair (
+  LLRP_tSConnection *           pConn,
+  tPeer *                       pPeer);
+
+void
+watchCall (
+  LLRP_tSConnection *           pConn,
+  llrp_bool_t                   bWantWrite,
+  void *                        pWatchArg);
+
+int
+checkWatch (
+  const char *                  pWhat,
+  unsigned int                  nOn,
+  unsigned int                  nOff);
+
+LLRP_tResultCode
+sendNext (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  MessageID);
+
+LLRP_tResultCode
+sendRaw (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  MessageID,
+  unsigned int                  nFrame);
+
+LLRP_tResultCode
+sendKeepalive (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  MessageID);
+
+unsigned int
+rawSize (
+  unsigned int                  MessageID);
+
+unsigned int
+frameSize (
+  unsigned int                  MessageID);
+
+int
+readPeer (
+  const char *                  pWhat,
+  tPeer *                       pPeer);
+
+int
+flushAll (
+  const char *                  pWhat,
+  LLRP_tSConnection *           pConn,
+  tPeer *                       pPeer);
+
+unsigned int
+countQueued (
+  LLRP_tSConnection *           pConn);
+
+ssize_t
+__real_sendmsg (
+  int                           fd,
+  const struct msghdr *         pMsg,
+  int                           Flags);
+
+ssize_t
+__wrap_sendmsg (
+  int                           fd,
+  const struct msghdr *         pMsg,
+  int                           Flags);
+/*
+ * END forward declarations
+ */
+
+
+/*
+ * The connection's buffer, the queue limit when filling, the
+ * socket's send buffer then, and frames in the batch case.
+ * The queue holds more than the socket so one flush can not
+ * empty it.
+ */
+#define N_BUFFER        (1024u)
+#define N_QUEUE_FILL    (32u*1024u)
+#define N_SNDBUF        (4096)
+#define N_BATCH         (150u)
+
+/*
+ * Frames gathered per flush system call. The library's
+ * LLRP_SEND_MAX_IOV.
+ */
+#define N_IOV           (64u)
+
+/*
+ * Type of the patterned frames. Nothing decodes them.
+ */
+#define TYPE_RAW        (1000u)
+
+/*
+ * Global variables
+ */
+int                             g_Verbose;
+LLRP_tSTypeRegistry *           g_pTypeRegistry;
+
+/* Bytes sendmsg() may still take before EAGAIN, -1 for no limit */
+int                             g_nSendBudget = -1;
+
+/* Calls to sendmsg() and the most iovecs in one */
+unsigned int                    g_nSendCall;
+unsigned int                    g_nSendIovMax;
+
+/* Send watch calls, and whether it is on */
+unsigned int                    g_nWatchOn;
+unsigned int                    g_nWatchOff;
+unsigned int                    g_nWatchBad;
+llrp_bool_t                     g_bWatch;
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Command main routine
+ **
+ ** Command synopsis:
+ **
+ **     dx412 [-v]
+ **
+ ** @exitcode   0               Everything *seemed* to work.
+ **             1               Bad usage
+ **             2               Run failed
+ **
+ *****************************************************************************/
+
+int
+main (
+  int                           ac,
+  char *                        av[])
+{
+    int                         rc;
+
+    if(ac == 2 && 0 == strcmp("-v", av[1]))
+    {
+        g_Verbose = 1;
+    }
+    else if(ac != 1)
+    {
+        usage(av[0]);
+        /* no return */
+    }
+
+    rc = run();
+
+    printf("INFO: Done\n");
+
+    exit(rc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Print usage message and exit
+ **
+ ** @param[in]  pProgName       Program name.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+usage (
+  char *                        pProgName)
+{
+    printf("Usage: %s [-v]\n", pProgName);
+    printf("\n");
+    printf("Each -v increases verbosity level\n");
+    exit(1);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Run the cases
+ **
+ ** @return     0               Every case passed
+ **             2               Something failed
+ **
+ *****************************************************************************/
+
+int
+run (void)
+{
+    int                         nFail = 0;
+
+    g_pTypeRegistry = LLRP_getTheTypeRegistry();
+    if(NULL == g_pTypeRegistry)
+    {
+        printf("ERROR: getTheTypeRegistry failed\n");
+        return 2;
+    }
+
+    nFail += caseFill();
+    nFail += caseBatch();
+    nFail += caseError();
+
+    LLRP_TypeRegistry_destruct(g_pTypeRegistry);
+
+    if(0 != nFail)
+    {
+        printf("ERROR: %d check(s) failed\n", nFail);
+        return 2;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Fill the socket, then the queue, then flush
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseFill (void)
+{
+    const char *                pWhat = "fill";
+    LLRP_tSConnection *         pConn;
+    tPeer                       Peer;
+    LLRP_tResultCode            lrc;
+    unsigned int                MessageID = 1;
+    unsigned int                nSent;
+    unsigned int                nQueued;
+    int                         nSndBuf = N_SNDBUF;
+    int                         nFail = 0;
+
+    pConn = openPair(&Peer, N_QUEUE_FILL);
+    setsockopt(pConn->fd, SOL_SOCKET, SO_SNDBUF, &nSndBuf, sizeof nSndBuf);
+
+    /*
+     * Send until the socket is full and a frame is queued
+     */
+    for(nSent = 0; 0u == LLRP_Conn_getSendQueueBytes(pConn); nSent++)
+    {
+        if(10000u == nSent)
+        {
+            printf("ERROR: %s: nothing queued after %u sends\n",
+                pWhat, nSent);
+            exit(2);
+        }
+        lrc = sendNext(pConn, MessageID);
+        if(LLRP_RC_OK != lrc)
+        {
+            printf("ERROR: %s: send %u gave %d\n", pWhat, MessageID, lrc);
+            exit(2);
+        }
+        MessageID++;
+    }
+    if(g_Verbose)
+    {
+        printf("INFO: %s: socket full after %u frames\n", pWhat, nSent);
+    }
+    nFail += checkWatch(pWhat, 1u, 0u);
+
+    /*
+     * Send until the queue refuses. The refused frame must
+     * leave no trace.
+     */
+    for(nSent = 0; ; nSent++)
+    {
+        nQueued = LLRP_Conn_getSendQueueBytes(pConn);
+        if(10000u == nSent)
+        {
+            printf("ERROR: %s: queue never full\n", pWhat);
+            exit(2);
+        }
+        lrc = sendNext(pConn, MessageID);
+        if(LLRP_RC_SendQueueFull == lrc)
+        {
+            break;
+        }
+        if(LLRP_RC_OK != lrc)
+        {
+            printf("ERROR: %s: send %u gave %d\n", pWhat, MessageID, lrc);
+            exit(2);
+        }
+        MessageID++;
+    }
+    if(g_Verbose)
+    {
+        printf("INFO: %s: queue full after %u more, %u bytes\n",
+            pWhat, nSent, nQueued);
+    }
+    if(nQueued != LLRP_Conn_getSendQueueBytes(pConn) ||
+       nQueued > N_QUEUE_FILL ||
+       LLRP_RC_SendQueueFull != LLRP_Conn_getSendError(pConn)->eResultCode)
+    {
+        printf("ERROR: %s: refused frame changed queue, %u to %u\n",
+            pWhat, nQueued, LLRP_Conn_getSendQueueBytes(pConn));
+        nFail++;
+    }
+
+    /*
+     * The reader takes what the socket has and a flush refills
+     * it from the queue. The refused frame, sent again, must
+     * still go behind what is left.
+     */
+    nFail += readPeer(pWhat, &Peer);
+    if(LLRP_RC_OK != LLRP_Conn_sendFlush(pConn))
+    {
+        printf("ERROR: %s: flush failed\n", pWhat);
+        nFail++;
+    }
+    nQueued = LLRP_Conn_getSendQueueBytes(pConn);
+    if(0u == nQueued || nQueued + frameSize(MessageID) > N_QUEUE_FILL)
+    {
+        printf("ERROR: %s: flush left %u bytes queued\n", pWhat, nQueued);
+        exit(2);
+    }
+    lrc = sendNext(pConn, MessageID);
+    if(LLRP_RC_OK != lrc ||
+       nQueued + frameSize(MessageID) != LLRP_Conn_getSendQueueBytes(pConn))
+    {
+        printf("ERROR: %s: frame %u gave %d, did not wait its turn\n",
+            pWhat, MessageID, lrc);
+        nFail++;
+    }
+    MessageID++;
+
+    nFail += flushAll(pWhat, pConn, &Peer);
+    nFail += checkWatch(pWhat, 1u, 1u);
+
+    /*
+     * Queue empty, frames go straight out again
+     */
+    for(nSent = 0; nSent < 5u; nSent++)
+    {
+        lrc = sendNext(pConn, MessageID);
+        if(LLRP_RC_OK != lrc || 0u != LLRP_Conn_getSendQueueBytes(pConn))
+        {
+            printf("ERROR: %s: send %u gave %d or queued\n", pWhat,
+                MessageID, lrc);
+            nFail++;
+        }
+        MessageID++;
+    }
+    nFail += readPeer(pWhat, &Peer);
+
+    if(MessageID != Peer.NextID)
+    {
+        printf("ERROR: %s: reader got to %u, not %u\n", pWhat,
+            Peer.NextID, MessageID);
+        nFail++;
+    }
+
+    closePair(pConn, &Peer);
+
+    if(0 == nFail)
+    {
+        printf("INFO: %s PASS\n", pWhat);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Queue many frames, then flush in partial writes
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseBatch (void)
+{
+    const char *                pWhat = "batch";
+    LLRP_tSConnection *         pConn;
+    tPeer                       Peer;
+    LLRP_tResultCode            lrc;
+    unsigned int                MessageID = 1;
+    unsigned int                nTotal = 0;
+    unsigned int                nFlush;
+    llrp_bool_t                 bSplit = FALSE;
+    int                         nFail = 0;
+
+    pConn = openPair(&Peer, 1024u*1024u);
+
+    /*
+     * The socket takes nothing, so everything queues.
+     * Some sends are three frames at once.
+     */
+    g_nSendBudget = 0;
+    while(MessageID <= N_BATCH)
+    {
+        unsigned int            nFrame = (0u == MessageID % 10u) ? 3u : 1u;
+        unsigned int            i;
+
+        lrc = sendRaw(pConn, MessageID, nFrame);
+        if(LLRP_RC_OK != lrc)
+        {
+            printf("ERROR: %s: send %u gave %d\n", pWhat, MessageID, lrc);
+            exit(2);
+        }
+        for(i = 0; i < nFrame; i++)
+        {
+            nTotal += 19u + rawSize(MessageID);
+            MessageID++;
+        }
+    }
+    if(nTotal != LLRP_Conn_getSendQueueBytes(pConn))
+    {
+        printf("ERROR: %s: %u bytes queued, not %u\n", pWhat,
+            LLRP_Conn_getSendQueueBytes(pConn), nTotal);
+        nFail++;
+    }
+    nFail += checkWatch(pWhat, 1u, 0u);
+
+    /*
+     * Flush with budgets that stop mid-frame. Each flush must
+     * write its budget exactly, in one call that gathers as
+     * many frames as it may.
+     */
+    for(nFlush = 0; 0u != LLRP_Conn_getSendQueueBytes(pConn); nFlush++)
+    {
+        unsigned int            nBefore;
+        unsigned int            nFrameBefore;
+        unsigned int            nBudget;
+        unsigned int            nWrite;
+        unsigned int            nIov;
+
+        if(1000u == nFlush)
+        {
+            printf("ERROR: %s: queue never drained\n", pWhat);
+            exit(2);
+        }
+
+        /*
+         * Once, a new frame with the socket willing. It must
+         * go behind the queue.
+         */
+        if(3u == nFlush)
+        {
+            nBefore = LLRP_Conn_getSendQueueBytes(pConn);
+            g_nSendBudget = -1;
+            lrc = sendRaw(pConn, MessageID, 1u);
+            if(LLRP_RC_OK != lrc || nBefore + 19u + rawSize(MessageID) !=
+                    LLRP_Conn_getSendQueueBytes(pConn))
+            {
+                printf("ERROR: %s: frame %u gave %d, did not wait its "
+                    "turn\n", pWhat, MessageID, lrc);
+                nFail++;
+            }
+            MessageID++;
+        }
+
+        nBefore = LLRP_Conn_getSendQueueBytes(pConn);
+        nFrameBefore = countQueued(pConn);
+        nBudget = 700u + (nFlush * 131u) % 900u;
+        nWrite = (nBudget < nBefore) ? nBudget : nBefore;
+        nIov = (nFrameBefore < N_IOV) ? nFrameBefore : N_IOV;
+
+        g_nSendBudget = nBudget;
+        g_nSendCall = 0;
+        g_nSendIovMax = 0;
+        lrc = LLRP_Conn_sendFlush(pConn);
+        if(LLRP_RC_OK != lrc ||
+           nBefore - nWrite != LLRP_Conn_getSendQueueBytes(pConn))
+        {
+            printf("ERROR: %s: flush %u gave %d, %u to %u bytes, "
+                "budget %u\n", pWhat, nFlush, lrc, nBefore,
+                LLRP_Conn_getSendQueueBytes(pConn), nBudget);
+            nFail++;
+            break;
+        }
+        if(nIov != g_nSendIovMax || 0u == g_nSendCall)
+        {
+            printf("ERROR: %s: flush %u gathered %u frames, not %u\n",
+                pWhat, nFlush, g_nSendIovMax, nIov);
+            nFail++;
+        }
+        if(NULL != pConn->Send.pQueueHead &&
+           0u != pConn->Send.pQueueHead->iNext)
+        {
+            bSplit = TRUE;
+        }
+
+        nFail += readPeer(pWhat, &Peer);
+    }
+    g_nSendBudget = -1;
+
+    if(g_Verbose)
+    {
+        printf("INFO: %s: %u bytes in %u flushes\n", pWhat, nTotal, nFlush);
+    }
+    if(!bSplit)
+    {
+        printf("ERROR: %s: no flush stopped mid-frame\n", pWhat);
+        nFail++;
+    }
+    nFail += checkWatch(pWhat, 1u, 1u);
+
+    if(MessageID != Peer.NextID)
+    {
+        printf("ERROR: %s: reader got to %u, not %u\n", pWhat,
+            Peer.NextID, MessageID);
+        nFail++;
+    }
+
+    closePair(pConn, &Peer);
+
+    if(0 == nFail)
+    {
+        printf("INFO: %s PASS\n", pWhat);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Flush to a reader that has gone
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseError (void)
+{
+    const char *                pWhat = "error";
+    LLRP_tSConnection *         pConn;
+    tPeer                       Peer;
+    LLRP_tResultCode            lrc;
+    int                         nFail = 0;
+
+    pConn = openPair(&Peer, 0u);
+
+    g_nSendBudget = 0;
+    if(LLRP_RC_OK != sendRaw(pConn, 1u, 1u) ||
+       LLRP_RC_OK != sendRaw(pConn, 2u, 3u) ||
+       0u == LLRP_Conn_getSendQueueBytes(pConn))
+    {
+        printf("ERROR: %s: frames not queued\n", pWhat);
+        nFail++;
+    }
+    g_nSendBudget = -1;
+
+    close(Peer.fd);
+    Peer.fd = -1;
+
+    lrc = LLRP_Conn_sendFlush(pConn);
+    if(g_Verbose)
+    {
+        printf("INFO: %s: flush gave %d, %s\n", pWhat, lrc,
+            LLRP_Conn_getSendError(pConn)->pWhatStr);
+    }
+    if(LLRP_RC_SendIOError != lrc ||
+       LLRP_RC_SendIOError != LLRP_Conn_getSendError(pConn)->eResultCode ||
+       0u != LLRP_Conn_getSendQueueBytes(pConn) ||
+       NULL != pConn->Send.pQueueHead)
+    {
+        printf("ERROR: %s: flush gave %d, %u bytes left\n", pWhat, lrc,
+            LLRP_Conn_getSendQueueBytes(pConn));
+        nFail++;
+    }
+    nFail += checkWatch(pWhat, 1u, 1u);
+
+    closePair(pConn, &Peer);
+
+    if(0 == nFail)
+    {
+        printf("INFO: %s PASS\n", pWhat);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Make a non-blocking connection on a socket pair
+ **
+ ** @param[out] pPeer           The reader end
+ ** @param[in]  nMaxQueueBytes  Send queue limit, 0 for the default
+ **
+ ** @return     The connection, exits on failure
+ **
+ *****************************************************************************/
+
+LLRP_tSConnection *
+openPair (
+  tPeer *                       pPeer,
+  unsigned int                  nMaxQueueBytes)
+{
+    LLRP_tSConnection *         pConn;
+    int                         aFd[2];
+
+    pConn = LLRP_Conn_construct(g_pTypeRegistry, N_BUFFER);
+    if(NULL == pConn || 0 != socketpair(AF_UNIX, SOCK_STREAM, 0, aFd))
+    {
+        printf("ERROR: connection setup failed\n");
+        exit(2);
+    }
+
+    /*
+     * The connection is normally opened by name. Here it is
+     * simply handed the already connected socket.
+     */
+    pConn->fd = aFd[0];
+
+    if(LLRP_RC_OK != LLRP_Conn_setSendNonBlocking(pConn, TRUE,
+            nMaxQueueBytes))
+    {
+        printf("ERROR: setSendNonBlocking failed\n");
+        exit(2);
+    }
+    LLRP_Conn_setSendWatch(pConn, watchCall, pPeer);
+
+    pPeer->fd = aFd[1];
+    pPeer->nBuf = 0;
+    pPeer->NextID = 1;
+
+    g_nWatchOn = 0;
+    g_nWatchOff = 0;
+    g_nWatchBad = 0;
+    g_bWatch = FALSE;
+
+    return pConn;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Close both ends and destruct the connection
+ **
+ *****************************************************************************/
+
+void
+closePair (
+  LLRP_tSConnection *           pConn,
+  tPeer *                       pPeer)
+{
+    if(0 <= pPeer->fd)
+    {
+        close(pPeer->fd);
+    }
+    LLRP_Conn_destruct(pConn);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  The send watch, counts the calls
+ **
+ ** Each must change the state, on when the queue fills and off
+ ** when it drains.
+ **
+ *****************************************************************************/
+
+void
+watchCall (
+  LLRP_tSConnection *           pConn,
+  llrp_bool_t                   bWantWrite,
+  void *                        pWatchArg)
+{
+    if(g_bWatch == bWantWrite)
+    {
+        g_nWatchBad++;
+    }
+    g_bWatch = bWantWrite;
+
+    if(bWantWrite)
+    {
+        g_nWatchOn++;
+    }
+    else
+    {
+        g_nWatchOff++;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check the send watch was called as expected
+ **
+ ** @return     0               It was
+ **             1               It was not
+ **
+ *****************************************************************************/
+
+int
+checkWatch (
+  const char *                  pWhat,
+  unsigned int                  nOn,
+  unsigned int                  nOff)
+{
+    if(nOn != g_nWatchOn || nOff != g_nWatchOff || 0u != g_nWatchBad)
+    {
+        printf("ERROR: %s: watch on %u, off %u, bad %u, not %u and %u\n",
+            pWhat, g_nWatchOn, g_nWatchOff, g_nWatchBad, nOn, nOff);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Send the next frame, a patterned one every seventh
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+sendNext (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  MessageID)
+{
+    if(0u == MessageID % 7u)
+    {
+        return sendRaw(pConn, MessageID, 1u);
+    }
+
+    return sendKeepalive(pConn, MessageID);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Send patterned frames with LLRP_Conn_sendFrame()
+ **
+ ** @param[in]  pConn           The connection
+ ** @param[in]  MessageID       Of the first
+ ** @param[in]  nFrame          How many, in one send
+ **
+ ** @return     What LLRP_Conn_sendFrame() gave
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+sendRaw (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  MessageID,
+  unsigned int                  nFrame)
+{
+    unsigned char               aFrame[4u*1024u];
+    unsigned int                nBytes = 0;
+    unsigned int                i;
+
+    for(i = 0; i < nFrame; i++, MessageID++)
+    {
+        unsigned char *         pFrame = &aFrame[nBytes];
+        unsigned int            nBody = rawSize(MessageID);
+        unsigned int            j;
+
+        memset(pFrame, 0, 19u);
+        pFrame[8] = 1;                          /* Version */
+        pFrame[9] = (TYPE_RAW >> 8u) & 0xFFu;
+        pFrame[10] = TYPE_RAW & 0xFFu;
+        pFrame[11] = (nBody >> 24u) & 0xFFu;
+        pFrame[12] = (nBody >> 16u) & 0xFFu;
+        pFrame[13] = (nBody >> 8u) & 0xFFu;
+        pFrame[14] = nBody & 0xFFu;
+        pFrame[15] = (MessageID >> 24u) & 0xFFu;
+        pFrame[16] = (MessageID >> 16u) & 0xFFu;
+        pFrame[17] = (MessageID >> 8u) & 0xFFu;
+        pFrame[18] = MessageID & 0xFFu;
+
+        for(j = 0; j < nBody; j++)
+        {
+            pFrame[19u + j] = (MessageID * 7u + j) & 0xFFu;
+        }
+
+        nBytes += 19u + nBody;
+    }
+
+    return LLRP_Conn_sendFrame(pConn, aFrame, nBytes);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Send a Keepalive with LLRP_Conn_sendMessage()
+ **
+ *****************************************************************************/
+
+LLRP_tResultCode
+sendKeepalive (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  MessageID)
+{
+    LLRP_tSKeepalive *          pKeepalive;
+    LLRP_tResultCode            lrc;
+
+    pKeepalive = LLRP_Keepalive_construct();
+    if(NULL == pKeepalive)
+    {
+        printf("ERROR: Keepalive_construct failed\n");
+        exit(2);
+    }
+    LLRP_Message_setMessageID(&pKeepalive->hdr, MessageID);
+    pKeepalive->hdr.Version = 1;
+
+    lrc = LLRP_Conn_sendMessage(pConn, &pKeepalive->hdr);
+
+    LLRP_Element_destruct(&pKeepalive->hdr.elementHdr);
+
+    return lrc;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Body size of a patterned frame, odd so writes split anywhere
+ **
+ *****************************************************************************/
+
+unsigned int
+rawSize (
+  unsigned int                  MessageID)
+{
+    return (MessageID * 37u) % 500u;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Size of the frame sendNext() sends, a Keepalive is all header
+ **
+ *****************************************************************************/
+
+unsigned int
+frameSize (
+  unsigned int                  MessageID)
+{
+    if(0u == MessageID % 7u)
+    {
+        return 19u + rawSize(MessageID);
+    }
+
+    return 19u;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Read what the reader end has and check each frame
+ **
+ ** Each frame must be the next MessageID. A patterned frame must
+ ** be its size with its pattern, anything else a Keepalive.
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+readPeer (
+  const char *                  pWhat,
+  tPeer *                       pPeer)
+{
+    for(;;)
+    {
+        ssize_t                 nRead;
+        unsigned int            iNext = 0;
+
+        nRead = recv(pPeer->fd, &pPeer->aBuf[pPeer->nBuf],
+            sizeof pPeer->aBuf - pPeer->nBuf, MSG_DONTWAIT);
+        if(0 >= nRead)
+        {
+            break;
+        }
+        pPeer->nBuf += nRead;
+
+        for(;;)
+        {
+            LLRP_tSFrameExtract Extract;
+            const unsigned char *pBody;
+            unsigned int        j;
+
+            Extract = LLRP_FrameExtract(&pPeer->aBuf[iNext],
+                pPeer->nBuf - iNext);
+            if(LLRP_FRAME_READY != Extract.eStatus)
+            {
+                break;
+            }
+            pBody = &pPeer->aBuf[iNext + 19u];
+
+            if(pPeer->NextID != Extract.MessageID)
+            {
+                printf("ERROR: %s: reader got frame %u, not %u\n",
+                    pWhat, Extract.MessageID, pPeer->NextID);
+                return 1;
+            }
+
+            if(TYPE_RAW == Extract.MessageType)
+            {
+                if(rawSize(Extract.MessageID) != Extract.MessageLength)
+                {
+                    printf("ERROR: %s: frame %u is %u bytes\n", pWhat,
+                        Extract.MessageID, Extract.MessageLength);
+                    return 1;
+                }
+                for(j = 0; j < Extract.MessageLength; j++)
+                {
+                    if(((Extract.MessageID * 7u + j) & 0xFFu) != pBody[j])
+                    {
+                        printf("ERROR: %s: frame %u damaged at %u\n",
+                            pWhat, Extract.MessageID, j);
+                        return 1;
+                    }
+                }
+            }
+            else if(LLRP_tdKeepalive.TypeNum != Extract.MessageType)
+            {
+                printf("ERROR: %s: frame %u is type %u\n", pWhat,
+                    Extract.MessageID, Extract.MessageType);
+                return 1;
+            }
+
+            iNext += 19u + Extract.MessageLength;
+            pPeer->NextID++;
+        }
+
+        /*
+         * Keep the partial frame, if any
+         */
+        memmove(pPeer->aBuf, &pPeer->aBuf[iNext], pPeer->nBuf - iNext);
+        pPeer->nBuf -= iNext;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Read and flush until the send queue is empty
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+flushAll (
+  const char *                  pWhat,
+  LLRP_tSConnection *           pConn,
+  tPeer *                       pPeer)
+{
+    unsigned int                nFlush;
+
+    for(nFlush = 0; 0u != LLRP_Conn_getSendQueueBytes(pConn); nFlush++)
+    {
+        struct pollfd           pfd;
+        LLRP_tResultCode        lrc;
+
+        if(10000u == nFlush)
+        {
+            printf("ERROR: %s: queue never drained\n", pWhat);
+            return 1;
+        }
+
+        if(0 != readPeer(pWhat, pPeer))
+        {
+            return 1;
+        }
+
+        lrc = LLRP_Conn_sendFlush(pConn);
+        if(LLRP_RC_OK != lrc)
+        {
+            printf("ERROR: %s: flush gave %d\n", pWhat, lrc);
+            return 1;
+        }
+
+        /*
+         * Wait for the flush to land, as an event loop would
+         */
+        pfd.fd = pPeer->fd;
+        pfd.events = POLLIN;
+        poll(&pfd, 1, 1000);
+    }
+
+    if(g_Verbose)
+    {
+        printf("INFO: %s: drained in %u flushes\n", pWhat, nFlush);
+    }
+
+    return readPeer(pWhat, pPeer);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Count the frames in the send queue
+ **
+ *****************************************************************************/
+
+unsigned int
+countQueued (
+  LLRP_tSConnection *           pConn)
+{
+    LLRP_tSSendFrame *          pFrame;
+    unsigned int                nFrame = 0;
+
+    for(
+        pFrame = pConn->Send.pQueueHead;
+        NULL != pFrame;
+        pFrame = pFrame->pNext)
+    {
+        nFrame++;
+    }
+
+    return nFrame;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  sendmsg(), taking no more than g_nSendBudget bytes
+ **
+ ** The Makefile links dx412 with -Wl,--wrap=sendmsg, so the
+ ** library's sendmsg() calls come here. With the budget spent
+ ** it fails EAGAIN as a full socket would.
+ **
+ *****************************************************************************/
+
+ssize_t
+__wrap_sendmsg (
+  int                           fd,
+  const struct msghdr *         pMsg,
+  int                           Flags)
+{
+    struct iovec                aIov[N_IOV];
+    struct msghdr               Msg;
+    size_t                      nLeft;
+    ssize_t                     rc;
+
+    g_nSendCall++;
+    if(g_nSendIovMax < pMsg->msg_iovlen)
+    {
+        g_nSendIovMax = pMsg->msg_iovlen;
+    }
+
+    if(0 > g_nSendBudget || N_IOV < pMsg->msg_iovlen)
+    {
+        return __real_sendmsg(fd, pMsg, Flags);
+    }
+
+    if(0 == g_nSendBudget)
+    {
+        errno = EAGAIN;
+        return -1;
+    }
+
+    /*
+     * Trim the iovecs to the budget
+     */
+    Msg = *pMsg;
+    Msg.msg_iov = aIov;
+    Msg.msg_iovlen = 0;
+    nLeft = g_nSendBudget;
+    while(0u < nLeft && Msg.msg_iovlen < pMsg->msg_iovlen)
+    {
+        aIov[Msg.msg_iovlen] = pMsg->msg_iov[Msg.msg_iovlen];
+        if(aIov[Msg.msg_iovlen].iov_len > nLeft)
+        {
+            aIov[Msg.msg_iovlen].iov_len = nLeft;
+        }
+        nLeft -= aIov[Msg.msg_iovlen].iov_len;
+        Msg.msg_iovlen++;
+    }
+
+    rc = __real_sendmsg(fd, &Msg, Flags);
+    if(0 < rc)
+    {
+        g_nSendBudget -= rc;
+    }
+
+    return rc;
+}
@@ -0,0 +1,1004 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  dx413.c
+ **
+ ** @brief Check the server that accepts connections from readers
+ **
+ ** This is diagnostic 413 for the LLRP Tool Kit for C (LTKC).
+ **
+ ** DX413 needs no reader. It listens on 127.0.0.1, on a port the
+ ** kernel picks, and plays the readers in client mode itself. Each
+ ** client sends a Keepalive with a MessageID of its own. The
+ ** accepted connection must get it and answer with a KeepaliveAck
+ ** that the client must get back. Three cases:
+ **     - usage, accept before listening, a bad address, listening
+ **       twice, and another server on a port taken must each fail.
+ **       Accept must time out on time, or return at once with
+ **       nMaxMS 0, when nobody connects.
+ **     - clients, several connect at once and each is accepted
+ **       and answered. One more connects while accept waits. The
+ **       backlog must be SOMAXCONN (as far as the kernel allows)
+ **       by default and what was asked otherwise. Accepted sockets
+ **       must be blocking, close-on-exec, with TCP_NODELAY and
+ **       keepalive.
+ **     - reuseport, two servers with LLRP_SERVER_REUSEPORT share
+ **       a port. Between them they must accept every client, each
+ **       some.
+ **
+ ** This program can be run with one verbose option (-v)
+ ** to print the errors and counts as well.
+ **
+ ** Exit status is 0 when every check passed.
+ **
+ *****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#include "../Library/ltkc.h"
+
+
+/*
+ * A client that connects after a while, from a thread of its own
+ */
+typedef struct
+{
+    unsigned int                Port;
+    unsigned int                DelayMS;
+    LLRP_tSConnection *         pConn;
+} tLater;
+
+
+/*
+ * BEGIN forward declarations
+ */
+int
+main (
+  int                           ac,
+  char *                        av[]);
+
+void
+usage (
+  char *                        pProgName);
+
+int
+run (void);
+
+int
+caseUsage (void);
+
+int
+caseClients (void);
+
+int
+caseReusePort (void);
+
+LLRP_tSServer *
+openServer (
+  unsigned int *                pPort,
+  int                           nBacklog,
+  unsigned int                  Options);
+
+unsigned int
+pickPort (void);
+
+LLRP_tSConnection *
+connectClient (
+  unsigned int                  Port);
+
+void *
+laterMain (
+  void *                        pArg);
+
+int
+checkAccepted (
+  const char *                  pWhat,
+  LLRP_tSConnection *           pConn);
+
+int
+checkFail (
+  const char *                  pWhat,
+  const LLRP_tSErrorDetails *   pError,
+  LLRP_tResultCode              eExpect);
+
+int
+roundTrip (
+  const char *                  pWhat,
+  LLRP_tSConnection **          apClient,
+  LLRP_tSConnection **          apAccepted,
+  unsigned int                  nClient);
+
+int
+sendKeepalive (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  MessageID);
+
+unsigned int
+listenBacklog (
+  LLRP_tSServer *               pServer);
+
+unsigned int
+defaultBacklog (void);
+
+llrp_u64_t
+nowMS (void);
+/*
+ * END forward declarations
+ */
+
+
+/*
+ * Clients connected at once, and to servers sharing a port
+ */
+#define N_CLIENT        (8u)
+#define N_CLIENT_SHARED (32u)
+
+/*
+ * The backlog asked for when not the default
+ */
+#define N_BACKLOG       (3)
+
+/*
+ * How long accept is to wait when nobody connects, and how
+ * long the late client waits before connecting
+ */
+#define N_TIMEOUT_MS    (200)
+#define N_LATER_MS      (100u)
+
+/*
+ * Global variables
+ */
+int                             g_Verbose;
+LLRP_tSTypeRegistry *           g_pTypeRegistry;
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Command main routine
+ **
+ ** Command synopsis:
+ **
+ **     dx413 [-v]
+ **
+ ** @exitcode   0               Everything *seemed* to work.
+ **             1               Bad usage
+ **             2               Run failed
+ **
+ *****************************************************************************/
+
+int
+main (
+  int                           ac,
+  char *                        av[])
+{
+    int                         rc;
+
+    if(ac == 2 && 0 == strcmp("-v", av[1]))
+    {
+        g_Verbose = 1;
+    }
+    else if(ac != 1)
+    {
+        usage(av[0]);
+        /* no return */
+    }
+
+    rc = run();
+
+    printf("INFO: Done\n");
+
+    exit(rc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Print usage message and exit
+ **
+ ** @param[in]  pProgName       Program name.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+usage (
+  char *                        pProgName)
+{
+    printf("Usage: %s [-v]\n", pProgName);
+    printf("\n");
+    printf("Each -v increases verbosity level\n");
+    exit(1);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Run the cases
+ **
+ ** @return     0               Every case passed
+ **             2               Something failed
+ **
+ *****************************************************************************/
+
+int
+run (void)
+{
+    int                         nFail = 0;
+
+    g_pTypeRegistry = LLRP_getTheTypeRegistry();
+    if(NULL == g_pTypeRegistry)
+    {
+        printf("ERROR: getTheTypeRegistry failed\n");
+        return 2;
+    }
+
+    nFail += caseUsage();
+    nFail += caseClients();
+    nFail += caseReusePort();
+
+    LLRP_TypeRegistry_destruct(g_pTypeRegistry);
+
+    if(0 != nFail)
+    {
+        printf("ERROR: %d check(s) failed\n", nFail);
+        return 2;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  What must fail, and accept timing out
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseUsage (void)
+{
+    const char *                pWhat = "usage";
+    LLRP_tSServer *             pServer;
+    LLRP_tSServer *             pOther;
+    LLRP_tSConnection *         pConn;
+    unsigned int                Port;
+    llrp_u64_t                  StartMS;
+    llrp_u64_t                  ElapsedMS;
+    int                         nFail = 0;
+
+    pServer = LLRP_Server_construct(g_pTypeRegistry, 0);
+    if(NULL == pServer)
+    {
+        printf("ERROR: %s: Server_construct failed\n", pWhat);
+        exit(2);
+    }
+
+    pConn = LLRP_Server_accept(pServer, 0);
+    nFail += checkFail(pWhat, LLRP_Server_getError(pServer),
+        LLRP_RC_MiscError);
+
+    LLRP_Server_listen(pServer, "127.0.0.256", pickPort(), 0, 0);
+    nFail += checkFail(pWhat, LLRP_Server_getError(pServer),
+        LLRP_RC_MiscError);
+    LLRP_Server_destruct(pServer);
+
+    pServer = openServer(&Port, 0, 0);
+
+    LLRP_Server_listen(pServer, "127.0.0.1", Port, 0, 0);
+    nFail += checkFail(pWhat, LLRP_Server_getError(pServer),
+        LLRP_RC_MiscError);
+
+    /*
+     * The port is taken, and not shared
+     */
+    pOther = LLRP_Server_construct(g_pTypeRegistry, 0);
+    LLRP_Server_listen(pOther, "127.0.0.1", Port, 0, 0);
+    nFail += checkFail(pWhat, LLRP_Server_getError(pOther),
+        LLRP_RC_MiscError);
+    LLRP_Server_destruct(pOther);
+
+    /*
+     * Nobody connects
+     */
+    StartMS = nowMS();
+    pConn = LLRP_Server_accept(pServer, N_TIMEOUT_MS);
+    ElapsedMS = nowMS() - StartMS;
+    if(NULL != pConn)
+    {
+        LLRP_Conn_destruct(pConn);
+    }
+    nFail += checkFail(pWhat, LLRP_Server_getError(pServer),
+        LLRP_RC_RecvTimeout);
+    if(N_TIMEOUT_MS - 10 > ElapsedMS || 10u * N_TIMEOUT_MS < ElapsedMS)
+    {
+        printf("ERROR: %s: accept timed out after %u ms, not %d\n",
+            pWhat, (unsigned int)ElapsedMS, N_TIMEOUT_MS);
+        nFail++;
+    }
+
+    StartMS = nowMS();
+    pConn = LLRP_Server_accept(pServer, 0);
+    ElapsedMS = nowMS() - StartMS;
+    nFail += checkFail(pWhat, LLRP_Server_getError(pServer),
+        LLRP_RC_RecvTimeout);
+    if(N_TIMEOUT_MS / 2 < ElapsedMS)
+    {
+        printf("ERROR: %s: accept peek took %u ms\n", pWhat,
+            (unsigned int)ElapsedMS);
+        nFail++;
+    }
+
+    LLRP_Server_destruct(pServer);
+
+    if(0 == nFail)
+    {
+        printf("INFO: %s PASS\n", pWhat);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Several clients accepted and answered
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseClients (void)
+{
+    const char *                pWhat = "clients";
+    LLRP_tSServer *             pServer;
+    LLRP_tSConnection *         apClient[N_CLIENT + 1u];
+    LLRP_tSConnection *         apAccepted[N_CLIENT + 1u];
+    tLater                      Later;
+    pthread_t                   Thread;
+    unsigned int                Port;
+    unsigned int                nBacklog;
+    llrp_u64_t                  StartMS;
+    llrp_u64_t                  ElapsedMS;
+    unsigned int                i;
+    int                         nFail = 0;
+
+    /*
+     * Asked for backlog, then the default
+     */
+    pServer = openServer(&Port, N_BACKLOG, 0);
+    nBacklog = listenBacklog(pServer);
+    if(N_BACKLOG != nBacklog)
+    {
+        printf("ERROR: %s: backlog %u, not %d\n", pWhat, nBacklog,
+            N_BACKLOG);
+        nFail++;
+    }
+    LLRP_Server_destruct(pServer);
+
+    pServer = openServer(&Port, 0, 0);
+    nBacklog = listenBacklog(pServer);
+    if(g_Verbose)
+    {
+        printf("INFO: %s: default backlog %u\n", pWhat, nBacklog);
+    }
+    if(defaultBacklog() != nBacklog)
+    {
+        printf("ERROR: %s: default backlog %u, not %u\n", pWhat,
+            nBacklog, defaultBacklog());
+        nFail++;
+    }
+
+    /*
+     * All connect, then all are accepted
+     */
+    for(i = 0; i < N_CLIENT; i++)
+    {
+        apClient[i] = connectClient(Port);
+    }
+    for(i = 0; i < N_CLIENT; i++)
+    {
+        apAccepted[i] = LLRP_Server_accept(pServer, 2000);
+        if(NULL == apAccepted[i])
+        {
+            printf("ERROR: %s: client %u not accepted, %s\n", pWhat, i,
+                LLRP_Server_getError(pServer)->pWhatStr);
+            exit(2);
+        }
+        nFail += checkAccepted(pWhat, apAccepted[i]);
+    }
+
+    /*
+     * One more, while accept waits
+     */
+    Later.Port = Port;
+    Later.DelayMS = N_LATER_MS;
+    Later.pConn = NULL;
+    if(0 != pthread_create(&Thread, NULL, laterMain, &Later))
+    {
+        printf("ERROR: pthread_create failed\n");
+        exit(2);
+    }
+    StartMS = nowMS();
+    apAccepted[N_CLIENT] = LLRP_Server_accept(pServer, 5000);
+    ElapsedMS = nowMS() - StartMS;
+    pthread_join(Thread, NULL);
+    apClient[N_CLIENT] = Later.pConn;
+    if(NULL == apAccepted[N_CLIENT])
+    {
+        printf("ERROR: %s: late client not accepted, %s\n", pWhat,
+            LLRP_Server_getError(pServer)->pWhatStr);
+        exit(2);
+    }
+    if(N_LATER_MS / 2u > ElapsedMS)
+    {
+        printf("ERROR: %s: late client accepted after %u ms\n", pWhat,
+            (unsigned int)ElapsedMS);
+        nFail++;
+    }
+    nFail += checkAccepted(pWhat, apAccepted[N_CLIENT]);
+
+    nFail += roundTrip(pWhat, apClient, apAccepted, N_CLIENT + 1u);
+
+    for(i = 0; i < N_CLIENT + 1u; i++)
+    {
+        LLRP_Conn_destruct(apClient[i]);
+        LLRP_Conn_destruct(apAccepted[i]);
+    }
+    LLRP_Server_destruct(pServer);
+
+    if(0 == nFail)
+    {
+        printf("INFO: %s PASS\n", pWhat);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Two servers sharing a port
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseReusePort (void)
+{
+    const char *                pWhat = "reuseport";
+    LLRP_tSServer *             apServer[2];
+    LLRP_tSConnection *         apClient[N_CLIENT_SHARED];
+    LLRP_tSConnection *         apAccepted[N_CLIENT_SHARED];
+    unsigned int                anAccepted[2] = { 0, 0 };
+    unsigned int                Port;
+    unsigned int                nAccepted = 0;
+    unsigned int                nTry;
+    unsigned int                i;
+    int                         nFail = 0;
+
+    apServer[0] = openServer(&Port, 0, LLRP_SERVER_REUSEPORT);
+    apServer[1] = LLRP_Server_construct(g_pTypeRegistry, 0);
+    if(NULL == apServer[1] ||
+       LLRP_RC_OK != LLRP_Server_listen(apServer[1], "127.0.0.1", Port, 0,
+            LLRP_SERVER_REUSEPORT))
+    {
+        printf("ERROR: %s: second server did not listen\n", pWhat);
+        exit(2);
+    }
+
+    for(i = 0; i < N_CLIENT_SHARED; i++)
+    {
+        apClient[i] = connectClient(Port);
+    }
+
+    /*
+     * Take turns peeking at each until all are accepted
+     */
+    for(nTry = 0; nAccepted < N_CLIENT_SHARED && nTry < 1000u; nTry++)
+    {
+        for(i = 0; i < 2u && nAccepted < N_CLIENT_SHARED; i++)
+        {
+            LLRP_tSConnection * pConn;
+
+            pConn = LLRP_Server_accept(apServer[i], 0 == i ? 10 : 0);
+            if(NULL != pConn)
+            {
+                nFail += checkAccepted(pWhat, pConn);
+                apAccepted[nAccepted++] = pConn;
+                anAccepted[i]++;
+            }
+            else if(LLRP_RC_RecvTimeout !=
+                    LLRP_Server_getError(apServer[i])->eResultCode)
+            {
+                printf("ERROR: %s: accept failed, %s\n", pWhat,
+                    LLRP_Server_getError(apServer[i])->pWhatStr);
+                exit(2);
+            }
+        }
+    }
+    if(g_Verbose)
+    {
+        printf("INFO: %s: accepted %u and %u\n", pWhat,
+            anAccepted[0], anAccepted[1]);
+    }
+    if(N_CLIENT_SHARED != nAccepted)
+    {
+        printf("ERROR: %s: accepted %u of %u\n", pWhat, nAccepted,
+            N_CLIENT_SHARED);
+        exit(2);
+    }
+    if(0u == anAccepted[0] || 0u == anAccepted[1])
+    {
+        printf("ERROR: %s: one server accepted them all\n", pWhat);
+        nFail++;
+    }
+
+    nFail += roundTrip(pWhat, apClient, apAccepted, N_CLIENT_SHARED);
+
+    for(i = 0; i < N_CLIENT_SHARED; i++)
+    {
+        LLRP_Conn_destruct(apClient[i]);
+        LLRP_Conn_destruct(apAccepted[i]);
+    }
+    LLRP_Server_destruct(apServer[0]);
+    LLRP_Server_destruct(apServer[1]);
+
+    if(0 == nFail)
+    {
+        printf("INFO: %s PASS\n", pWhat);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Construct a server listening on 127.0.0.1
+ **
+ ** The port is one the kernel picks. Another program could take
+ ** it before the server binds, so that is tried a few times.
+ **
+ ** @param[out] pPort           The port
+ ** @param[in]  nBacklog        For LLRP_Server_listen()
+ ** @param[in]  Options         For LLRP_Server_listen()
+ **
+ ** @return     The server, exits on failure
+ **
+ *****************************************************************************/
+
+LLRP_tSServer *
+openServer (
+  unsigned int *                pPort,
+  int                           nBacklog,
+  unsigned int                  Options)
+{
+    LLRP_tSServer *             pServer;
+    unsigned int                nTry;
+
+    pServer = LLRP_Server_construct(g_pTypeRegistry, 0);
+    if(NULL == pServer)
+    {
+        printf("ERROR: Server_construct failed\n");
+        exit(2);
+    }
+
+    for(nTry = 0; nTry < 5u; nTry++)
+    {
+        *pPort = pickPort();
+        if(LLRP_RC_OK == LLRP_Server_listen(pServer, "127.0.0.1", *pPort,
+                nBacklog, Options))
+        {
+            return pServer;
+        }
+    }
+
+    printf("ERROR: Server_listen failed, %s\n",
+        LLRP_Server_getError(pServer)->pWhatStr);
+    exit(2);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Have the kernel pick a free port on 127.0.0.1
+ **
+ ** LLRP_Server_listen() takes port 0 to mean the LLRP port, so
+ ** the port is had from a socket bound just to find one.
+ **
+ ** @return     The port, exits on failure
+ **
+ *****************************************************************************/
+
+unsigned int
+pickPort (void)
+{
+    struct sockaddr_in          Sin;
+    socklen_t                   nSin = sizeof Sin;
+    int                         Sock;
+
+    memset(&Sin, 0, sizeof Sin);
+    Sin.sin_family = AF_INET;
+    Sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    Sin.sin_port = 0;
+
+    Sock = socket(AF_INET, SOCK_STREAM, 0);
+    if(0 > Sock ||
+       0 > bind(Sock, (struct sockaddr *)&Sin, sizeof Sin) ||
+       0 > getsockname(Sock, (struct sockaddr *)&Sin, &nSin))
+    {
+        printf("ERROR: no free port\n");
+        exit(2);
+    }
+    close(Sock);
+
+    return ntohs(Sin.sin_port);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Connect a client, the reader in client mode
+ **
+ ** @return     The connection, exits on failure
+ **
+ *****************************************************************************/
+
+LLRP_tSConnection *
+connectClient (
+  unsigned int                  Port)
+{
+    LLRP_tSConnection *         pConn;
+    struct sockaddr_in          Sin;
+    int                         Sock;
+
+    memset(&Sin, 0, sizeof Sin);
+    Sin.sin_family = AF_INET;
+    Sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    Sin.sin_port = htons(Port);
+
+    pConn = LLRP_Conn_construct(g_pTypeRegistry, 0);
+    Sock = socket(AF_INET, SOCK_STREAM, 0);
+    if(NULL == pConn || 0 > Sock ||
+       0 > connect(Sock, (struct sockaddr *)&Sin, sizeof Sin))
+    {
+        printf("ERROR: client did not connect\n");
+        exit(2);
+    }
+
+    /*
+     * The connection is normally opened by name. Here it is
+     * simply handed the already connected socket.
+     */
+    pConn->fd = Sock;
+
+    return pConn;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  The late client's thread
+ **
+ *****************************************************************************/
+
+void *
+laterMain (
+  void *                        pArg)
+{
+    tLater *                    pLater = pArg;
+
+    usleep(pLater->DelayMS * 1000u);
+    pLater->pConn = connectClient(pLater->Port);
+
+    return NULL;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check how an accepted socket was set up
+ **
+ ** @return     0               As documented
+ **             1               Not
+ **
+ *****************************************************************************/
+
+int
+checkAccepted (
+  const char *                  pWhat,
+  LLRP_tSConnection *           pConn)
+{
+    int                         NoDelay = 0;
+    int                         KeepAlive = 0;
+    socklen_t                   nFlag;
+
+    nFlag = sizeof NoDelay;
+    getsockopt(pConn->fd, IPPROTO_TCP, TCP_NODELAY, &NoDelay, &nFlag);
+    nFlag = sizeof KeepAlive;
+    getsockopt(pConn->fd, SOL_SOCKET, SO_KEEPALIVE, &KeepAlive, &nFlag);
+
+    if((fcntl(pConn->fd, F_GETFL) & O_NONBLOCK) ||
+       !(fcntl(pConn->fd, F_GETFD) & FD_CLOEXEC) ||
+       !NoDelay || !KeepAlive)
+    {
+        printf("ERROR: %s: accepted socket not set up\n", pWhat);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check a server call failed the way expected
+ **
+ ** @return     0               It did
+ **             1               It did not
+ **
+ *****************************************************************************/
+
+int
+checkFail (
+  const char *                  pWhat,
+  const LLRP_tSErrorDetails *   pError,
+  LLRP_tResultCode              eExpect)
+{
+    if(g_Verbose)
+    {
+        printf("INFO: %s: gave %d, %s\n", pWhat, pError->eResultCode,
+            NULL != pError->pWhatStr ? pError->pWhatStr : "");
+    }
+
+    if(eExpect != pError->eResultCode)
+    {
+        printf("ERROR: %s: gave %d, not %d\n", pWhat,
+            pError->eResultCode, eExpect);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  A Keepalive from each client, answered on its accepted
+ **         connection
+ **
+ ** Accepted connections need not be in the order the clients
+ ** connected, so each answers whatever MessageID it got. Each
+ ** client must get back its own.
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+roundTrip (
+  const char *                  pWhat,
+  LLRP_tSConnection **          apClient,
+  LLRP_tSConnection **          apAccepted,
+  unsigned int                  nClient)
+{
+    unsigned int                i;
+    int                         nFail = 0;
+
+    for(i = 0; i < nClient; i++)
+    {
+        nFail += sendKeepalive(apClient[i], 1u + i);
+    }
+
+    for(i = 0; i < nClient; i++)
+    {
+        LLRP_tSMessage *        pMessage;
+        LLRP_tSKeepaliveAck *   pAck;
+
+        pMessage = LLRP_Conn_recvMessage(apAccepted[i], 2000);
+        if(NULL == pMessage ||
+           &LLRP_tdKeepalive != pMessage->elementHdr.pType)
+        {
+            printf("ERROR: %s: accepted connection %u got no Keepalive\n",
+                pWhat, i);
+            nFail++;
+            if(NULL != pMessage)
+            {
+                LLRP_Element_destruct(&pMessage->elementHdr);
+            }
+            continue;
+        }
+
+        pAck = LLRP_KeepaliveAck_construct();
+        LLRP_Message_setMessageID(&pAck->hdr, pMessage->MessageID);
+        pAck->hdr.Version = 1;
+        if(LLRP_RC_OK != LLRP_Conn_sendMessage(apAccepted[i], &pAck->hdr))
+        {
+            printf("ERROR: %s: accepted connection %u could not answer\n",
+                pWhat, i);
+            nFail++;
+        }
+        LLRP_Element_destruct(&pAck->hdr.elementHdr);
+        LLRP_Element_destruct(&pMessage->elementHdr);
+    }
+
+    for(i = 0; i < nClient; i++)
+    {
+        LLRP_tSMessage *        pMessage;
+
+        pMessage = LLRP_Conn_recvMessage(apClient[i], 2000);
+        if(NULL == pMessage ||
+           &LLRP_tdKeepaliveAck != pMessage->elementHdr.pType ||
+           1u + i != pMessage->MessageID)
+        {
+            printf("ERROR: %s: client %u got no answer\n", pWhat, i);
+            nFail++;
+        }
+        if(NULL != pMessage)
+        {
+            LLRP_Element_destruct(&pMessage->elementHdr);
+        }
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Send a Keepalive
+ **
+ ** @return     0               Sent
+ **             1               Not
+ **
+ *****************************************************************************/
+
+int
+sendKeepalive (
+  LLRP_tSConnection *           pConn,
+  unsigned int                  MessageID)
+{
+    LLRP_tSKeepalive *          pKeepalive;
+    LLRP_tResultCode            lrc;
+
+    pKeepalive = LLRP_Keepalive_construct();
+    if(NULL == pKeepalive)
+    {
+        printf("ERROR: Keepalive_construct failed\n");
+        exit(2);
+    }
+    LLRP_Message_setMessageID(&pKeepalive->hdr, MessageID);
+    pKeepalive->hdr.Version = 1;
+
+    lrc = LLRP_Conn_sendMessage(pConn, &pKeepalive->hdr);
+
+    LLRP_Element_destruct(&pKeepalive->hdr.elementHdr);
+
+    if(LLRP_RC_OK != lrc)
+    {
+        printf("ERROR: Keepalive %u not sent\n", MessageID);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  The backlog of a listening socket
+ **
+ ** For a listening socket Linux reports its backlog limit in
+ ** tcpi_sacked.
+ **
+ *****************************************************************************/
+
+unsigned int
+listenBacklog (
+  LLRP_tSServer *               pServer)
+{
+    struct tcp_info             Info;
+    socklen_t                   nInfo = sizeof Info;
+
+    memset(&Info, 0, sizeof Info);
+    getsockopt(pServer->fd, IPPROTO_TCP, TCP_INFO, &Info, &nInfo);
+
+    return Info.tcpi_sacked;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  The backlog listen(SOMAXCONN) gets, after the kernel's limit
+ **
+ *****************************************************************************/
+
+unsigned int
+defaultBacklog (void)
+{
+    unsigned int                nBacklog = SOMAXCONN;
+    unsigned int                nLimit;
+    FILE *                      pFile;
+
+    pFile = fopen("/proc/sys/net/core/somaxconn", "r");
+    if(NULL != pFile)
+    {
+        if(1 == fscanf(pFile, "%u", &nLimit) && nLimit < nBacklog)
+        {
+            nBacklog = nLimit;
+        }
+        fclose(pFile);
+    }
+
+    return nBacklog;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Read the monotonic clock
+ **
+ *****************************************************************************/
+
+llrp_u64_t
+nowMS (void)
+{
+    struct timespec             Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return (llrp_u64_t)Now.tv_sec * 1000u + Now.tv_nsec / 1000000u;
+}
@@ -0,0 +1,1043 @@
+/*
+ ***************************************************************************
+ *  Copyright 2007,2008 Impinj, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ***************************************************************************
+ */
+
+/**
+ *****************************************************************************
+ **
+ ** @file  dx414.c
+ **
+ ** @brief Check buffer growth, limits, idle shrink, and framing errors
+ **
+ ** This is diagnostic 414 for the LLRP Tool Kit for C (LTKC).
+ **
+ ** DX414 needs no reader. The connection is one end of a socket
+ ** pair and this program plays the reader on the other end. The
+ ** connection starts with 1KB buffers. Four cases:
+ **     - grow, a report bigger than the buffer must arrive whole,
+ **       and one sent must go out whole, each buffer grown but
+ **       within the limit. A frame exactly the limit must be taken.
+ **       One byte more, or a report too big to send, must fail.
+ **     - shrink, a grown buffer must stay grown until it has been
+ **       idle a while, then go back, both by
+ **       LLRP_Conn_shrinkIdleBuffers() and as the next small frame
+ **       comes in. It must not shrink while it holds part of a big
+ **       frame. Lowering the limit shrinks it at once.
+ **     - overflow, the frames before one over the limit must come
+ **       out, then LLRP_RC_RecvBufferOverflow.
+ **     - framing, LLRP_FrameExtract() must call a frame length that
+ **       would not fit an unsigned int an error and the largest
+ **       that would an incomplete frame. On a connection the first
+ **       must be LLRP_RC_RecvFramingError, from LLRP_Conn_recvMessage()
+ **       and from LLRP_Conn_recvFill() and LLRP_Conn_recvDecodeBuffered(),
+ **       and the second LLRP_RC_RecvBufferOverflow.
+ **
+ ** This program can be run with one verbose option (-v)
+ ** to print the errors and buffer sizes as well.
+ **
+ ** Exit status is 0 when every check passed.
+ **
+ *****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#include "../Library/ltkc.h"
+
+
+/*
+ * BEGIN forward declarations
+ */
+int
+main (
+  int                           ac,
+  char *                        av[]);
+
+void
+usage (
+  char *                        pProgName);
+
+int
+run (void);
+
+int
+caseGrow (void);
+
+int
+caseShrink (void);
+
+int
+caseOverflow (void);
+
+int
+caseFraming (void);
+
+LLRP_tSConnection *
+openPair (
+  int *                         pPeerFd);
+
+void
+closePair (
+  LLRP_tSConnection *           pConn,
+  int                           PeerFd);
+
+int
+checkReport (
+  const char *                  pWhat,
+  LLRP_tSMessage *              pMessage,
+  unsigned int                  MessageID,
+  unsigned int                  nTag);
+
+int
+checkError (
+  const char *                  pWhat,
+  LLRP_tSMessage *              pMessage,
+  LLRP_tSConnection *           pConn,
+  LLRP_tResultCode              eExpect);
+
+int
+checkAlloc (
+  const char *                  pWhat,
+  const char *                  pWhen,
+  LLRP_tSConnection *           pConn,
+  unsigned int                  nRecvAlloc);
+
+LLRP_tSTagSelectAccessReport *
+buildReport (
+  unsigned int                  MessageID,
+  unsigned int                  nTag);
+
+unsigned int
+encodeReport (
+  unsigned int                  MessageID,
+  unsigned int                  nTag,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer);
+
+unsigned int
+rawFrame (
+  unsigned char *               pBuffer,
+  unsigned int                  MessageID,
+  unsigned int                  Length);
+
+void
+sendBytes (
+  int                           fd,
+  const unsigned char *         pBytes,
+  unsigned int                  nBytes);
+
+unsigned int
+drainPeer (
+  int                           fd);
+/*
+ * END forward declarations
+ */
+
+
+/*
+ * The connection's initial buffer, its limit, and how long a
+ * grown buffer is kept
+ */
+#define N_BUFFER        (1024u)
+#define N_BUFFER_MAX    (64u*1024u)
+#define N_IDLE_MS       (200u)
+
+/*
+ * Tags in a big report, more than N_BUFFER and less than
+ * N_BUFFER_MAX, and in one too big to send
+ */
+#define N_TAG_BIG       (500u)
+#define N_TAG_TOO_BIG   (3000u)
+
+/*
+ * Type of the hand-made frames. Nothing decodes them.
+ */
+#define TYPE_RAW        (1000u)
+
+/*
+ * Global variables
+ */
+int                             g_Verbose;
+LLRP_tSTypeRegistry *           g_pTypeRegistry;
+unsigned char                   g_aFrame[2u*N_BUFFER_MAX];
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Command main routine
+ **
+ ** Command synopsis:
+ **
+ **     dx414 [-v]
+ **
+ ** @exitcode   0               Everything *seemed* to work.
+ **             1               Bad usage
+ **             2               Run failed
+ **
+ *****************************************************************************/
+
+int
+main (
+  int                           ac,
+  char *                        av[])
+{
+    int                         rc;
+
+    if(ac == 2 && 0 == strcmp("-v", av[1]))
+    {
+        g_Verbose = 1;
+    }
+    else if(ac != 1)
+    {
+        usage(av[0]);
+        /* no return */
+    }
+
+    rc = run();
+
+    printf("INFO: Done\n");
+
+    exit(rc);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Print usage message and exit
+ **
+ ** @param[in]  pProgName       Program name.
+ **
+ ** @return     void
+ **
+ *****************************************************************************/
+
+void
+usage (
+  char *                        pProgName)
+{
+    printf("Usage: %s [-v]\n", pProgName);
+    printf("\n");
+    printf("Each -v increases verbosity level\n");
+    exit(1);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Run the cases
+ **
+ ** @return     0               Every case passed
+ **             2               Something failed
+ **
+ *****************************************************************************/
+
+int
+run (void)
+{
+    int                         nFail = 0;
+
+    g_pTypeRegistry = LLRP_getTheTypeRegistry();
+    if(NULL == g_pTypeRegistry)
+    {
+        printf("ERROR: getTheTypeRegistry failed\n");
+        return 2;
+    }
+
+    nFail += caseGrow();
+    nFail += caseShrink();
+    nFail += caseOverflow();
+    nFail += caseFraming();
+
+    LLRP_TypeRegistry_destruct(g_pTypeRegistry);
+
+    if(0 != nFail)
+    {
+        printf("ERROR: %d check(s) failed\n", nFail);
+        return 2;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Frames bigger than the buffer, up to the limit
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseGrow (void)
+{
+    const char *                pWhat = "grow";
+    LLRP_tSConnection *         pConn;
+    LLRP_tSTagSelectAccessReport *pReport;
+    LLRP_tResultCode            lrc;
+    unsigned int                nFrame;
+    unsigned int                nRead;
+    int                         PeerFd;
+    int                         nFail = 0;
+
+    pConn = openPair(&PeerFd);
+
+    /*
+     * In: a big report, then one frame exactly the limit.
+     * That one does not decode, but must not overflow.
+     * Then a small report to show the stream is still framed.
+     */
+    nFrame = encodeReport(1u, N_TAG_BIG, g_aFrame, sizeof g_aFrame);
+    if(N_BUFFER >= nFrame)
+    {
+        printf("ERROR: %s: big report only %u bytes\n", pWhat, nFrame);
+        exit(2);
+    }
+    sendBytes(PeerFd, g_aFrame, nFrame);
+    nFail += checkReport(pWhat, LLRP_Conn_recvMessage(pConn, 2000),
+        1u, N_TAG_BIG);
+    nFail += checkAlloc(pWhat, "after big report", pConn, 0u);
+
+    nFrame = rawFrame(g_aFrame, 2u, N_BUFFER_MAX - 19u);
+    nFrame += encodeReport(3u, 1u, &g_aFrame[nFrame],
+        sizeof g_aFrame - nFrame);
+    sendBytes(PeerFd, g_aFrame, nFrame);
+    nFail += checkError(pWhat, LLRP_Conn_recvMessage(pConn, 2000), pConn,
+        LLRP_RC_UnknownMessageType);
+    nFail += checkAlloc(pWhat, "after frame at limit", pConn, N_BUFFER_MAX);
+    nFail += checkReport(pWhat, LLRP_Conn_recvMessage(pConn, 2000), 3u, 1u);
+
+    /*
+     * Out: a big report grows the send buffer. One too big
+     * for the limit fails and sends nothing.
+     */
+    pReport = buildReport(4u, N_TAG_BIG);
+    lrc = LLRP_Conn_sendMessage(pConn, &pReport->hdr);
+    nRead = drainPeer(PeerFd);
+    if(LLRP_RC_OK != lrc || nRead != pConn->Send.nBuffer ||
+       N_BUFFER >= nRead || N_BUFFER_MAX < pConn->Send.nAlloc)
+    {
+        printf("ERROR: %s: big send gave %d, %u bytes, buffer %u\n",
+            pWhat, lrc, nRead, pConn->Send.nAlloc);
+        nFail++;
+    }
+    LLRP_Element_destruct(&pReport->hdr.elementHdr);
+
+    pReport = buildReport(5u, N_TAG_TOO_BIG);
+    lrc = LLRP_Conn_sendMessage(pConn, &pReport->hdr);
+    nRead = drainPeer(PeerFd);
+    if(g_Verbose)
+    {
+        printf("INFO: %s: too big send gave %d, %s\n", pWhat, lrc,
+            LLRP_Conn_getSendError(pConn)->pWhatStr);
+    }
+    if(LLRP_RC_OK == lrc || 0u != nRead ||
+       N_BUFFER_MAX != pConn->Send.nAlloc)
+    {
+        printf("ERROR: %s: too big send gave %d, %u bytes, buffer %u\n",
+            pWhat, lrc, nRead, pConn->Send.nAlloc);
+        nFail++;
+    }
+    LLRP_Element_destruct(&pReport->hdr.elementHdr);
+
+    /*
+     * One byte over the limit
+     */
+    nFrame = rawFrame(g_aFrame, 6u, N_BUFFER_MAX - 18u);
+    sendBytes(PeerFd, g_aFrame, nFrame);
+    nFail += checkError(pWhat, LLRP_Conn_recvMessage(pConn, 2000), pConn,
+        LLRP_RC_RecvBufferOverflow);
+    nFail += checkAlloc(pWhat, "after overflow", pConn, N_BUFFER_MAX);
+
+    closePair(pConn, PeerFd);
+
+    if(0 == nFail)
+    {
+        printf("INFO: %s PASS\n", pWhat);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  A grown buffer goes back after the idle time
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseShrink (void)
+{
+    const char *                pWhat = "shrink";
+    LLRP_tSConnection *         pConn;
+    LLRP_tSTagSelectAccessReport *pReport;
+    unsigned int                nFrame;
+    int                         PeerFd;
+    int                         nFail = 0;
+
+    pConn = openPair(&PeerFd);
+
+    /*
+     * Not idle yet, neither a call nor a small frame shrinks it
+     */
+    nFrame = encodeReport(1u, N_TAG_BIG, g_aFrame, sizeof g_aFrame);
+    sendBytes(PeerFd, g_aFrame, nFrame);
+    nFail += checkReport(pWhat, LLRP_Conn_recvMessage(pConn, 2000),
+        1u, N_TAG_BIG);
+    pReport = buildReport(2u, N_TAG_BIG);
+    LLRP_Conn_sendMessage(pConn, &pReport->hdr);
+    LLRP_Element_destruct(&pReport->hdr.elementHdr);
+    drainPeer(PeerFd);
+
+    LLRP_Conn_shrinkIdleBuffers(pConn);
+    nFrame = encodeReport(3u, 1u, g_aFrame, sizeof g_aFrame);
+    sendBytes(PeerFd, g_aFrame, nFrame);
+    nFail += checkReport(pWhat, LLRP_Conn_recvMessage(pConn, 2000), 3u, 1u);
+    if(N_BUFFER >= pConn->Recv.nAlloc || N_BUFFER >= pConn->Send.nAlloc)
+    {
+        printf("ERROR: %s: shrunk before idle, %u and %u\n", pWhat,
+            pConn->Recv.nAlloc, pConn->Send.nAlloc);
+        nFail++;
+    }
+
+    /*
+     * Idle, the call shrinks both
+     */
+    usleep((N_IDLE_MS + 50u) * 1000u);
+    LLRP_Conn_shrinkIdleBuffers(pConn);
+    nFail += checkAlloc(pWhat, "after idle call", pConn, N_BUFFER);
+    if(N_BUFFER != pConn->Send.nAlloc)
+    {
+        printf("ERROR: %s: send buffer %u after idle call\n", pWhat,
+            pConn->Send.nAlloc);
+        nFail++;
+    }
+
+    /*
+     * Grown again. Idle, the next small frame shrinks it.
+     */
+    nFrame = encodeReport(4u, N_TAG_BIG, g_aFrame, sizeof g_aFrame);
+    sendBytes(PeerFd, g_aFrame, nFrame);
+    nFail += checkReport(pWhat, LLRP_Conn_recvMessage(pConn, 2000),
+        4u, N_TAG_BIG);
+    usleep((N_IDLE_MS + 50u) * 1000u);
+    nFrame = encodeReport(5u, 1u, g_aFrame, sizeof g_aFrame);
+    sendBytes(PeerFd, g_aFrame, nFrame);
+    nFail += checkReport(pWhat, LLRP_Conn_recvMessage(pConn, 2000), 5u, 1u);
+    nFail += checkAlloc(pWhat, "after idle frame", pConn, N_BUFFER);
+
+    /*
+     * Half a big frame in the buffer. Idle, it must stay.
+     */
+    nFrame = encodeReport(6u, N_TAG_BIG, g_aFrame, sizeof g_aFrame);
+    sendBytes(PeerFd, g_aFrame, nFrame / 2u);
+    if(NULL != LLRP_Conn_recvMessage(pConn, 100))
+    {
+        printf("ERROR: %s: half a frame received\n", pWhat);
+        nFail++;
+    }
+    usleep((N_IDLE_MS + 50u) * 1000u);
+    LLRP_Conn_shrinkIdleBuffers(pConn);
+    if(N_BUFFER >= pConn->Recv.nAlloc)
+    {
+        printf("ERROR: %s: shrunk holding half a frame\n", pWhat);
+        nFail++;
+    }
+    sendBytes(PeerFd, &g_aFrame[nFrame / 2u], nFrame - nFrame / 2u);
+    nFail += checkReport(pWhat, LLRP_Conn_recvMessage(pConn, 2000),
+        6u, N_TAG_BIG);
+
+    /*
+     * A lower limit shrinks it at once
+     */
+    if(LLRP_RC_OK != LLRP_Conn_setBufferLimits(pConn, N_BUFFER, N_IDLE_MS))
+    {
+        printf("ERROR: %s: lower limit refused\n", pWhat);
+        nFail++;
+    }
+    nFail += checkAlloc(pWhat, "after lower limit", pConn, N_BUFFER);
+
+    closePair(pConn, PeerFd);
+
+    if(0 == nFail)
+    {
+        printf("INFO: %s PASS\n", pWhat);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Frames, then one over the limit
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseOverflow (void)
+{
+    const char *                pWhat = "overflow";
+    LLRP_tSConnection *         pConn;
+    unsigned int                nFrame = 0;
+    unsigned int                MessageID;
+    int                         PeerFd;
+    int                         nFail = 0;
+
+    pConn = openPair(&PeerFd);
+
+    /*
+     * Only the header of the big one is sent. The limit
+     * must be noticed without waiting for the rest.
+     */
+    for(MessageID = 1; MessageID <= 3u; MessageID++)
+    {
+        nFrame += encodeReport(MessageID, MessageID * 100u,
+            &g_aFrame[nFrame], sizeof g_aFrame - nFrame);
+    }
+    nFrame += rawFrame(&g_aFrame[nFrame], 4u, 4u * N_BUFFER_MAX);
+    sendBytes(PeerFd, g_aFrame, nFrame);
+
+    for(MessageID = 1; MessageID <= 3u; MessageID++)
+    {
+        nFail += checkReport(pWhat, LLRP_Conn_recvMessage(pConn, 2000),
+            MessageID, MessageID * 100u);
+    }
+    nFail += checkError(pWhat, LLRP_Conn_recvMessage(pConn, 2000), pConn,
+        LLRP_RC_RecvBufferOverflow);
+    nFail += checkAlloc(pWhat, "after overflow", pConn, 0u);
+
+    closePair(pConn, PeerFd);
+
+    if(0 == nFail)
+    {
+        printf("INFO: %s PASS\n", pWhat);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Frame lengths at the edge of what can be
+ **
+ ** @return     Count of failed checks
+ **
+ *****************************************************************************/
+
+int
+caseFraming (void)
+{
+    const char *                pWhat = "framing";
+    LLRP_tSConnection *         pConn;
+    LLRP_tSFrameExtract         Extract;
+    LLRP_tResultCode            lrc;
+    unsigned char               aHeader[19];
+    unsigned int                nFrame;
+    int                         PeerFd;
+    int                         nFail = 0;
+
+    /*
+     * The extractor itself
+     */
+    rawFrame(aHeader, 1u, 0u);
+    Extract = LLRP_FrameExtract(aHeader, 10u);
+    if(LLRP_FRAME_NEED_MORE != Extract.eStatus || 9u != Extract.nBytesNeeded)
+    {
+        printf("ERROR: %s: part header gave %d, need %u\n", pWhat,
+            Extract.eStatus, Extract.nBytesNeeded);
+        nFail++;
+    }
+    Extract = LLRP_FrameExtract(aHeader, sizeof aHeader);
+    if(LLRP_FRAME_READY != Extract.eStatus || 1u != Extract.MessageID)
+    {
+        printf("ERROR: %s: empty frame gave %d\n", pWhat, Extract.eStatus);
+        nFail++;
+    }
+
+    rawFrame(aHeader, 1u, ~0u - 19u);
+    Extract = LLRP_FrameExtract(aHeader, sizeof aHeader);
+    if(LLRP_FRAME_NEED_MORE != Extract.eStatus ||
+       ~0u - 19u != Extract.nBytesNeeded)
+    {
+        printf("ERROR: %s: largest frame gave %d, need %u\n", pWhat,
+            Extract.eStatus, Extract.nBytesNeeded);
+        nFail++;
+    }
+
+    rawFrame(aHeader, 1u, ~0u - 18u);
+    Extract = LLRP_FrameExtract(aHeader, sizeof aHeader);
+    if(LLRP_FRAME_ERROR != Extract.eStatus)
+    {
+        printf("ERROR: %s: too large frame gave %d\n", pWhat,
+            Extract.eStatus);
+        nFail++;
+    }
+
+    /*
+     * On a connection, by LLRP_Conn_recvMessage(). The error
+     * stays, the stream can not be framed past it.
+     */
+    pConn = openPair(&PeerFd);
+    nFrame = encodeReport(1u, 2u, g_aFrame, sizeof g_aFrame);
+    nFrame += rawFrame(&g_aFrame[nFrame], 2u, ~0u);
+    sendBytes(PeerFd, g_aFrame, nFrame);
+    nFail += checkReport(pWhat, LLRP_Conn_recvMessage(pConn, 2000), 1u, 2u);
+    nFail += checkError(pWhat, LLRP_Conn_recvMessage(pConn, 2000), pConn,
+        LLRP_RC_RecvFramingError);
+    nFail += checkError(pWhat, LLRP_Conn_recvMessage(pConn, 0), pConn,
+        LLRP_RC_RecvFramingError);
+    closePair(pConn, PeerFd);
+
+    /*
+     * By LLRP_Conn_recvFill() and LLRP_Conn_recvDecodeBuffered(),
+     * as an event loop would
+     */
+    pConn = openPair(&PeerFd);
+    sendBytes(PeerFd, g_aFrame, nFrame);
+    lrc = LLRP_Conn_recvFill(pConn);
+    if(LLRP_RC_OK == lrc)
+    {
+        lrc = LLRP_Conn_recvDecodeBuffered(pConn);
+    }
+    if(LLRP_RC_RecvFramingError != lrc)
+    {
+        printf("ERROR: %s: decode buffered gave %d\n", pWhat, lrc);
+        nFail++;
+    }
+    nFail += checkReport(pWhat, LLRP_Conn_recvQueued(pConn), 1u, 2u);
+    closePair(pConn, PeerFd);
+
+    /*
+     * The largest length that fits is no framing error, but
+     * is over any limit
+     */
+    pConn = openPair(&PeerFd);
+    nFrame = rawFrame(g_aFrame, 1u, ~0u - 19u);
+    sendBytes(PeerFd, g_aFrame, nFrame);
+    nFail += checkError(pWhat, LLRP_Conn_recvMessage(pConn, 2000), pConn,
+        LLRP_RC_RecvBufferOverflow);
+    closePair(pConn, PeerFd);
+
+    if(0 == nFail)
+    {
+        printf("INFO: %s PASS\n", pWhat);
+    }
+
+    return nFail;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Make a connection on a socket pair, limits set
+ **
+ ** @param[out] pPeerFd         The reader end
+ **
+ ** @return     The connection, exits on failure
+ **
+ *****************************************************************************/
+
+LLRP_tSConnection *
+openPair (
+  int *                         pPeerFd)
+{
+    LLRP_tSConnection *         pConn;
+    int                         aFd[2];
+
+    pConn = LLRP_Conn_construct(g_pTypeRegistry, N_BUFFER);
+    if(NULL == pConn || 0 != socketpair(AF_UNIX, SOCK_STREAM, 0, aFd))
+    {
+        printf("ERROR: connection setup failed\n");
+        exit(2);
+    }
+
+    /*
+     * The connection is normally opened by name. Here it is
+     * simply handed the already connected socket.
+     */
+    pConn->fd = aFd[0];
+    *pPeerFd = aFd[1];
+
+    if(LLRP_RC_OK != LLRP_Conn_setBufferLimits(pConn, N_BUFFER_MAX,
+            N_IDLE_MS))
+    {
+        printf("ERROR: setBufferLimits failed\n");
+        exit(2);
+    }
+
+    return pConn;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Close both ends and destruct the connection
+ **
+ *****************************************************************************/
+
+void
+closePair (
+  LLRP_tSConnection *           pConn,
+  int                           PeerFd)
+{
+    close(PeerFd);
+    LLRP_Conn_destruct(pConn);
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check a message is the report expected, and free it
+ **
+ ** @return     0               It is
+ **             1               It is not, or is NULL
+ **
+ *****************************************************************************/
+
+int
+checkReport (
+  const char *                  pWhat,
+  LLRP_tSMessage *              pMessage,
+  unsigned int                  MessageID,
+  unsigned int                  nTag)
+{
+    int                         nGotTag;
+
+    if(NULL == pMessage)
+    {
+        printf("ERROR: %s: no report %u\n", pWhat, MessageID);
+        return 1;
+    }
+
+    nGotTag = -1;
+    if(&LLRP_tdTagSelectAccessReport == pMessage->elementHdr.pType)
+    {
+        nGotTag = LLRP_TagSelectAccessReport_countTagReportData(
+            (LLRP_tSTagSelectAccessReport *) pMessage);
+    }
+    if(MessageID != pMessage->MessageID || (int)nTag != nGotTag)
+    {
+        printf("ERROR: %s: got report %u of %d tags, not %u of %u\n",
+            pWhat, pMessage->MessageID, nGotTag, MessageID, nTag);
+        LLRP_Element_destruct(&pMessage->elementHdr);
+        return 1;
+    }
+
+    LLRP_Element_destruct(&pMessage->elementHdr);
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check a receive failed the way expected
+ **
+ ** @return     0               It did
+ **             1               It did not
+ **
+ *****************************************************************************/
+
+int
+checkError (
+  const char *                  pWhat,
+  LLRP_tSMessage *              pMessage,
+  LLRP_tSConnection *           pConn,
+  LLRP_tResultCode              eExpect)
+{
+    const LLRP_tSErrorDetails * pError = LLRP_Conn_getRecvError(pConn);
+
+    if(g_Verbose)
+    {
+        printf("INFO: %s: gave %d, %s\n", pWhat, pError->eResultCode,
+            NULL != pError->pWhatStr ? pError->pWhatStr : "");
+    }
+
+    if(NULL != pMessage || eExpect != pError->eResultCode)
+    {
+        printf("ERROR: %s: gave %d, not %d\n", pWhat,
+            pError->eResultCode, eExpect);
+        if(NULL != pMessage)
+        {
+            LLRP_Element_destruct(&pMessage->elementHdr);
+        }
+        return 1;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Check the size of the receive buffer
+ **
+ ** @param[in]  nRecvAlloc      The size it must be, or 0 for
+ **                             anything grown but within the limit
+ **
+ ** @return     0               It is
+ **             1               It is not
+ **
+ *****************************************************************************/
+
+int
+checkAlloc (
+  const char *                  pWhat,
+  const char *                  pWhen,
+  LLRP_tSConnection *           pConn,
+  unsigned int                  nRecvAlloc)
+{
+    if(g_Verbose)
+    {
+        printf("INFO: %s: buffers %u and %u %s\n", pWhat,
+            pConn->Recv.nAlloc, pConn->Send.nAlloc, pWhen);
+    }
+
+    if(0u == nRecvAlloc ?
+        (N_BUFFER >= pConn->Recv.nAlloc ||
+         N_BUFFER_MAX < pConn->Recv.nAlloc) :
+        nRecvAlloc != pConn->Recv.nAlloc)
+    {
+        printf("ERROR: %s: receive buffer %u %s\n", pWhat,
+            pConn->Recv.nAlloc, pWhen);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Construct a report with some tags
+ **
+ ** @return     The report, exits on failure
+ **
+ *****************************************************************************/
+
+LLRP_tSTagSelectAccessReport *
+buildReport (
+  unsigned int                  MessageID,
+  unsigned int                  nTag)
+{
+    LLRP_tSTagSelectAccessReport *pReport;
+    unsigned int                i;
+
+    pReport = LLRP_TagSelectAccessReport_construct();
+    if(NULL == pReport)
+    {
+        printf("ERROR: TagSelectAccessReport_construct failed\n");
+        exit(2);
+    }
+    LLRP_Message_setMessageID(&pReport->hdr, MessageID);
+    pReport->hdr.Version = 1;
+
+    for(i = 0; i < nTag; i++)
+    {
+        LLRP_tSTagReportData *  pTRD;
+        LLRP_tSAntennaID *      pAntennaID;
+        llrp_u8v_t              TID;
+
+        pTRD = LLRP_TagReportData_construct();
+
+        TID = LLRP_u8v_construct(12);
+        memset(TID.pValue, MessageID + i, 12);
+        LLRP_TagReportData_setTID(pTRD, TID);
+
+        pAntennaID = LLRP_AntennaID_construct();
+        LLRP_AntennaID_setAntennaID(pAntennaID, 1u + (i & 3u));
+        LLRP_TagReportData_setAntennaID(pTRD, pAntennaID);
+
+        LLRP_TagSelectAccessReport_addTagReportData(pReport, pTRD);
+    }
+
+    return pReport;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Encode a report with some tags into a buffer
+ **
+ ** @return     Bytes in the frame, exits on failure
+ **
+ *****************************************************************************/
+
+unsigned int
+encodeReport (
+  unsigned int                  MessageID,
+  unsigned int                  nTag,
+  unsigned char *               pBuffer,
+  unsigned int                  nBuffer)
+{
+    LLRP_tSTagSelectAccessReport *pReport;
+    LLRP_tSFrameEncoder *       pEncoder;
+    unsigned int                nFrame = 0;
+
+    pReport = buildReport(MessageID, nTag);
+
+    pEncoder = LLRP_FrameEncoder_construct(pBuffer, nBuffer);
+    if(NULL != pEncoder)
+    {
+        LLRP_Encoder_encodeElement(&pEncoder->encoderHdr,
+            &pReport->hdr.elementHdr);
+        if(LLRP_RC_OK == pEncoder->encoderHdr.ErrorDetails.eResultCode)
+        {
+            nFrame = pEncoder->iNext;
+        }
+        LLRP_Encoder_destruct(&pEncoder->encoderHdr);
+    }
+
+    LLRP_Element_destruct(&pReport->hdr.elementHdr);
+
+    if(0 == nFrame)
+    {
+        printf("ERROR: encode failed\n");
+        exit(2);
+    }
+
+    return nFrame;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Make a frame by hand, body zero-filled
+ **
+ ** The body is filled in only if it is within the limit. For
+ ** longer ones only the header is made, which is all that
+ ** matters for them.
+ **
+ ** @param[out] pBuffer         Where to put it
+ ** @param[in]  MessageID       Its MessageID
+ ** @param[in]  Length          Bytes of body it claims
+ **
+ ** @return     Bytes made
+ **
+ *****************************************************************************/
+
+unsigned int
+rawFrame (
+  unsigned char *               pBuffer,
+  unsigned int                  MessageID,
+  unsigned int                  Length)
+{
+    memset(pBuffer, 0, 19u);
+    pBuffer[8] = 1;                             /* Version */
+    pBuffer[9] = (TYPE_RAW >> 8u) & 0xFFu;
+    pBuffer[10] = TYPE_RAW & 0xFFu;
+    pBuffer[11] = (Length >> 24u) & 0xFFu;
+    pBuffer[12] = (Length >> 16u) & 0xFFu;
+    pBuffer[13] = (Length >> 8u) & 0xFFu;
+    pBuffer[14] = Length & 0xFFu;
+    pBuffer[15] = (MessageID >> 24u) & 0xFFu;
+    pBuffer[16] = (MessageID >> 16u) & 0xFFu;
+    pBuffer[17] = (MessageID >> 8u) & 0xFFu;
+    pBuffer[18] = MessageID & 0xFFu;
+
+    if(Length > N_BUFFER_MAX)
+    {
+        return 19u;
+    }
+
+    memset(&pBuffer[19], 0, Length);
+
+    return 19u + Length;
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Write all of some bytes to the reader end
+ **
+ *****************************************************************************/
+
+void
+sendBytes (
+  int                           fd,
+  const unsigned char *         pBytes,
+  unsigned int                  nBytes)
+{
+    while(0 < nBytes)
+    {
+        ssize_t                 nWritten;
+
+        nWritten = send(fd, pBytes, nBytes, MSG_NOSIGNAL);
+        if(0 >= nWritten)
+        {
+            printf("ERROR: send failed\n");
+            exit(2);
+        }
+        pBytes += nWritten;
+        nBytes -= nWritten;
+    }
+}
+
+
+/**
+ *****************************************************************************
+ **
+ ** @brief  Read and discard what the reader end has
+ **
+ ** @return     Bytes read
+ **
+ *****************************************************************************/
+
+unsigned int
+drainPeer (
+  int                           fd)
+{
+    unsigned char               aBuf[4096];
+    unsigned int                nRead = 0;
+    ssize_t                     rc;
+
+    while(0 < (rc = recv(fd, aBuf, sizeof aBuf, MSG_DONTWAIT)))
+    {
+        nRead += rc;
+    }
+
+    return nRead;
+}
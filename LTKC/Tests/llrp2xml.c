@@ -141,6 +141,8 @@ int
 main (int ac, char *av[])
 {
     LLRP_tSTypeRegistry *       pTypeRegistry;
+    LLRP_tSFrameDecoder         Decoder;
+    LLRP_tSXMLTextEncoder       Encoder;
     FILE *                      infp;
 
     /*
@@ -169,6 +171,13 @@ main (int ac, char *av[])
      */
     pTypeRegistry = LLRP_getTheTypeRegistry();
 
+    /*
+     * One frame decoder and one XML encoder, on the stack,
+     * serve every message. Each is reset for the next.
+     */
+    LLRP_FrameDecoder_init(&Decoder, pTypeRegistry, aInBuffer, 0);
+    LLRP_XMLTextEncoder_init(&Encoder, (unsigned char *) aXMLTextBuf,
+            sizeof aXMLTextBuf);
 
     /*
      * Loop iterates for each input frame
@@ -177,9 +186,9 @@ main (int ac, char *av[])
     {
         unsigned int            nInBuffer = sizeof aInBuffer;
         int                     bEOF;
-        LLRP_tSFrameDecoder *   pDecoder;
+        LLRP_tSFrameDecoder *   pDecoder = &Decoder;
         LLRP_tSMessage *        pMessage;
-        LLRP_tSXMLTextEncoder * pEncoder;
+        LLRP_tSXMLTextEncoder * pEncoder = &Encoder;
 
         /*
          * Zero fill the buffer to make things easier
@@ -289,11 +298,10 @@ main (int ac, char *av[])
         fprintf (stdout, "\n");
 
         /*
-         * Construct a frame decoder. It references the
-         * type registry and the input buffer.
+         * Point the frame decoder at the frame. It
+         * references the type registry and the input buffer.
          */
-        pDecoder = LLRP_FrameDecoder_construct(pTypeRegistry,
-                                               aInBuffer, nInBuffer);
+        LLRP_FrameDecoder_reset(pDecoder, aInBuffer, nInBuffer);
 
         /*
          * Now ask the frame decoder to actually decode
@@ -329,21 +337,15 @@ main (int ac, char *av[])
             /* if decode fails, write the error message */
             fprintf(stdout, "%s", errMsgStr);
 
-            LLRP_Decoder_destruct(&pDecoder->decoderHdr);
             continue;
         }
 
         /*
          * pMessage points to the root of an object
          * tree representing the LLRP message.
-         * We are done with the frame decoder.
-         */
-        LLRP_Decoder_destruct(&pDecoder->decoderHdr);
-
-        /*
-         * Print as XML text the LLRP message to stdout.
+         * Print it as XML text to stdout.
          */
-        pEncoder = LLRP_XMLTextEncoder_construct((unsigned char*) aXMLTextBuf,
+        LLRP_XMLTextEncoder_reset(pEncoder, (unsigned char *) aXMLTextBuf,
                 sizeof aXMLTextBuf);
 
         LLRP_Encoder_encodeElement(&pEncoder->encoderHdr,
@@ -358,7 +360,6 @@ main (int ac, char *av[])
             /* if decode fails, write the error message */
             fprintf(stdout, "%s", errMsgStr);
         }
-        LLRP_Encoder_destruct(&pEncoder->encoderHdr);
 
         /*
          * Destruct the message. This must deallocate